@@ -0,0 +1,243 @@
+#include "Bitset.hpp"
+#include <algorithm>
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+
+/*
+ * Verifies whether the processor supports AVX2. The CPU model data that
+ * __builtin_cpu_supports reads is filled in by __builtin_cpu_init, which is
+ * not guaranteed to have run before the static initialisation of this file.
+ *
+ * @return true if the processor supports AVX2; false otherwise.
+ */
+static bool supportsAVX2() {
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx2");
+}
+
+const bool Bitset::HAS_AVX2 = supportsAVX2();
+#else
+const bool Bitset::HAS_AVX2 = false;
+#endif
+
+/*
+ * Counts the elements of the intersection of two arrays of words, or of the
+ * first array's difference with the second one, one word at a time.
+ *
+ * @param a      the first array.
+ * @param b      the second array.
+ * @param size   the number of words.
+ * @param negate the flag indicating whether to count the difference.
+ *
+ * @return the number of elements.
+ */
+unsigned int Bitset::countAnd(const unsigned long long * a, const unsigned long long * b,
+        unsigned int size, bool negate) {
+    unsigned int count = 0;
+
+    for (unsigned int i = 0; i < size; i++) {
+        count += __builtin_popcountll(a[i] & (negate ? ~b[i] : b[i]));
+    }
+
+    return count;
+}
+
+#if defined(__GNUC__) && defined(__x86_64__)
+/*
+ * Counts the elements of the intersection of two arrays of words, or of the
+ * first array's difference with the second one, four words at a time with
+ * AVX2. The bits of each byte are counted by looking up its two nibbles in a
+ * table, and the bytes' counts are summed by the absolute differences with
+ * zero.
+ *
+ * @param a      the first array.
+ * @param b      the second array.
+ * @param size   the number of words.
+ * @param negate the flag indicating whether to count the difference.
+ *
+ * @return the number of elements.
+ */
+__attribute__((target("avx2")))
+unsigned int Bitset::countAndAVX2(const unsigned long long * a,
+        const unsigned long long * b, unsigned int size, bool negate) {
+    const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+    __m256i sums = _mm256_setzero_si256();
+    unsigned int i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        __m256i x = _mm256_loadu_si256((const __m256i *) (a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i *) (b + i));
+
+        /* x ∧ ¬y or x ∧ y */
+        x = negate ? _mm256_andnot_si256(y, x) : _mm256_and_si256(x, y);
+
+        __m256i low = _mm256_shuffle_epi8(table, _mm256_and_si256(x, nibbleMask));
+        __m256i high = _mm256_shuffle_epi8(table,
+                _mm256_and_si256(_mm256_srli_epi16(x, 4), nibbleMask));
+
+        sums = _mm256_add_epi64(sums, _mm256_sad_epu8(_mm256_add_epi8(low, high),
+                    _mm256_setzero_si256()));
+    }
+
+    unsigned int count = _mm256_extract_epi64(sums, 0) + _mm256_extract_epi64(sums, 1) +
+        _mm256_extract_epi64(sums, 2) + _mm256_extract_epi64(sums, 3);
+
+    return count + Bitset::countAnd(a + i, b + i, size - i, negate);
+}
+#else
+/*
+ * Counts the elements of the intersection of two arrays of words, or of the
+ * first array's difference with the second one, without AVX2.
+ *
+ * @param a      the first array.
+ * @param b      the second array.
+ * @param size   the number of words.
+ * @param negate the flag indicating whether to count the difference.
+ *
+ * @return the number of elements.
+ */
+unsigned int Bitset::countAndAVX2(const unsigned long long * a,
+        const unsigned long long * b, unsigned int size, bool negate) {
+    return Bitset::countAnd(a, b, size, negate);
+}
+#endif
+
+/*
+ * Constructs a new empty bitset.
+ *
+ * @param n the new bitset's number of elements.
+ */
+Bitset::Bitset(unsigned int n) : words((n + 63) / 64, 0), n(n) {}
+
+/*
+ * Constructs a new empty bitset without elements.
+ */
+Bitset::Bitset() : Bitset::Bitset(0) {}
+
+/*
+ * Returns this bitset's number of elements.
+ *
+ * @return this bitset's number of elements.
+ */
+unsigned int Bitset::size() const {
+    return this->n;
+}
+
+/*
+ * Inserts the specified element into this bitset.
+ *
+ * @param i the element.
+ */
+void Bitset::set(unsigned int i) {
+    this->words[i / 64] |= 1ULL << (i % 64);
+}
+
+/*
+ * Removes the specified element from this bitset.
+ *
+ * @param i the element.
+ */
+void Bitset::reset(unsigned int i) {
+    this->words[i / 64] &= ~(1ULL << (i % 64));
+}
+
+/*
+ * Verifies whether the specified element is in this bitset.
+ *
+ * @param i the element.
+ *
+ * @return true if the element is in this bitset; false otherwise.
+ */
+bool Bitset::test(unsigned int i) const {
+    return (this->words[i / 64] >> (i % 64)) & 1ULL;
+}
+
+/*
+ * Removes all the elements from this bitset.
+ */
+void Bitset::clear() {
+    std::fill(this->words.begin(), this->words.end(), 0ULL);
+}
+
+/*
+ * Returns the smallest element of this bitset not smaller than the specified
+ * one.
+ *
+ * @param i the element from which to search.
+ *
+ * @return the smallest element not smaller than i; the number of elements if
+ *         there is none.
+ */
+unsigned int Bitset::findNext(unsigned int i) const {
+    if (i >= this->n) {
+        return this->n;
+    }
+
+    unsigned int w = i / 64;
+    unsigned long long word = this->words[w] & (~0ULL << (i % 64));
+
+    while (word == 0) {
+        if (++w == this->words.size()) {
+            return this->n;
+        }
+
+        word = this->words[w];
+    }
+
+    return w * 64 + __builtin_ctzll(word);
+}
+
+/*
+ * Returns the number of elements in this bitset.
+ *
+ * @return the number of elements in this bitset.
+ */
+unsigned int Bitset::count() const {
+    unsigned int count = 0;
+
+    for (unsigned long long word : this->words) {
+        count += __builtin_popcountll(word);
+    }
+
+    return count;
+}
+
+/*
+ * Returns the number of elements in both this bitset and the specified one,
+ * of the same size.
+ *
+ * @param other the other bitset.
+ *
+ * @return the number of elements in the intersection.
+ */
+unsigned int Bitset::countAnd(const Bitset & other) const {
+    if (HAS_AVX2) {
+        return Bitset::countAndAVX2(this->words.data(), other.words.data(),
+                this->words.size(), false);
+    }
+
+    return Bitset::countAnd(this->words.data(), other.words.data(), this->words.size(),
+            false);
+}
+
+/*
+ * Returns the number of elements in this bitset but not in the specified
+ * one, of the same size.
+ *
+ * @param other the other bitset.
+ *
+ * @return the number of elements in the difference.
+ */
+unsigned int Bitset::countAndNot(const Bitset & other) const {
+    if (HAS_AVX2) {
+        return Bitset::countAndAVX2(this->words.data(), other.words.data(),
+                this->words.size(), true);
+    }
+
+    return Bitset::countAnd(this->words.data(), other.words.data(), this->words.size(),
+            true);
+}
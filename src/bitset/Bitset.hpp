@@ -0,0 +1,136 @@
+#pragma once
+
+#include <vector>
+
+/*
+ * The Bitset class represents a dense set of the elements {0, ..., n - 1},
+ * stored as 64-bit words so that the set operations of two bitsets run one
+ * word (or, with AVX2, four words) at a time instead of walking trees.
+ */
+class Bitset {
+    private:
+        /* This bitset's words; the bits beyond the size are always zero. */
+        std::vector<unsigned long long> words;
+
+        /* This bitset's number of elements. */
+        unsigned int n;
+
+        /* The flag indicating whether the processor supports AVX2. */
+        static const bool HAS_AVX2;
+
+        /*
+         * Counts the elements of the intersection of two arrays of words, or
+         * of the first array's difference with the second one, one word at
+         * a time.
+         *
+         * @param a      the first array.
+         * @param b      the second array.
+         * @param size   the number of words.
+         * @param negate the flag indicating whether to count the difference.
+         *
+         * @return the number of elements.
+         */
+        static unsigned int countAnd(const unsigned long long * a,
+                const unsigned long long * b, unsigned int size, bool negate);
+
+        /*
+         * Counts the elements of the intersection of two arrays of words, or
+         * of the first array's difference with the second one, four words at
+         * a time with AVX2.
+         *
+         * @param a      the first array.
+         * @param b      the second array.
+         * @param size   the number of words.
+         * @param negate the flag indicating whether to count the difference.
+         *
+         * @return the number of elements.
+         */
+        static unsigned int countAndAVX2(const unsigned long long * a,
+                const unsigned long long * b, unsigned int size, bool negate);
+
+    public:
+        /*
+         * Constructs a new empty bitset.
+         *
+         * @param n the new bitset's number of elements.
+         */
+        Bitset(unsigned int n);
+
+        /*
+         * Constructs a new empty bitset without elements.
+         */
+        Bitset();
+
+        /*
+         * Returns this bitset's number of elements.
+         *
+         * @return this bitset's number of elements.
+         */
+        unsigned int size() const;
+
+        /*
+         * Inserts the specified element into this bitset.
+         *
+         * @param i the element.
+         */
+        void set(unsigned int i);
+
+        /*
+         * Removes the specified element from this bitset.
+         *
+         * @param i the element.
+         */
+        void reset(unsigned int i);
+
+        /*
+         * Verifies whether the specified element is in this bitset.
+         *
+         * @param i the element.
+         *
+         * @return true if the element is in this bitset; false otherwise.
+         */
+        bool test(unsigned int i) const;
+
+        /*
+         * Removes all the elements from this bitset.
+         */
+        void clear();
+
+        /*
+         * Returns the smallest element of this bitset not smaller than the
+         * specified one.
+         *
+         * @param i the element from which to search.
+         *
+         * @return the smallest element not smaller than i; the number of
+         *         elements if there is none.
+         */
+        unsigned int findNext(unsigned int i) const;
+
+        /*
+         * Returns the number of elements in this bitset.
+         *
+         * @return the number of elements in this bitset.
+         */
+        unsigned int count() const;
+
+        /*
+         * Returns the number of elements in both this bitset and the
+         * specified one, of the same size.
+         *
+         * @param other the other bitset.
+         *
+         * @return the number of elements in the intersection.
+         */
+        unsigned int countAnd(const Bitset & other) const;
+
+        /*
+         * Returns the number of elements in this bitset but not in the
+         * specified one, of the same size.
+         *
+         * @param other the other bitset.
+         *
+         * @return the number of elements in the difference.
+         */
+        unsigned int countAndNot(const Bitset & other) const;
+};
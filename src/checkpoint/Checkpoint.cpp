@@ -0,0 +1,291 @@
+#include "Checkpoint.hpp"
+#include <sstream>
+
+/* The first bytes of every checkpoint. */
+static const unsigned int MAGIC = 0x43454450;
+
+/* The version of the checkpoints' layout. */
+static const unsigned int VERSION = 3;
+
+/* The kind of a checkpoint written by a GRASP solver. */
+const unsigned int Checkpoint::GRASP = 0;
+
+/* The kind of a checkpoint written by an exact solver after its warm start. */
+const unsigned int Checkpoint::EXACT = 1;
+
+/*
+ * Writes the header of a checkpoint of the specified kind for the specified
+ * instance into the specified output stream.
+ *
+ * @param os       the output stream to write into.
+ * @param kind     the checkpoint's kind (GRASP or EXACT).
+ * @param instance the instance being solved.
+ */
+void Checkpoint::writeHeader(std::ostream & os, unsigned int kind,
+        const Instance & instance) {
+    Checkpoint::write(os, MAGIC);
+    Checkpoint::write(os, VERSION);
+    Checkpoint::write(os, kind);
+    Checkpoint::write(os, instance.getM());
+    Checkpoint::write(os, instance.getG().m());
+}
+
+/*
+ * Reads the header of a checkpoint for the specified instance from the
+ * specified input stream.
+ *
+ * @param is       the input stream to read from.
+ * @param instance the instance being solved.
+ *
+ * @return the checkpoint's kind (GRASP or EXACT).
+ */
+unsigned int Checkpoint::readHeader(std::istream & is, const Instance & instance) {
+    unsigned int magic = 0, version = 0, kind = 0, m = 0, edges = 0;
+
+    Checkpoint::read(is, magic);
+    Checkpoint::read(is, version);
+    Checkpoint::read(is, kind);
+    Checkpoint::read(is, m);
+    Checkpoint::read(is, edges);
+
+    /* A checkpoint is only resumed by the same version on the same instance */
+    if (!is || magic != MAGIC || version != VERSION || m != instance.getM() ||
+            edges != instance.getG().m()) {
+        throw "Invalid checkpoint.";
+    }
+
+    return kind;
+}
+
+/*
+ * Writes the specified value into the specified output stream.
+ *
+ * @param os    the output stream to write into.
+ * @param value the value to be written.
+ */
+void Checkpoint::write(std::ostream & os, unsigned int value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/*
+ * Writes the specified value into the specified output stream.
+ *
+ * @param os    the output stream to write into.
+ * @param value the value to be written.
+ */
+void Checkpoint::write(std::ostream & os, unsigned long long value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/*
+ * Writes the specified value into the specified output stream.
+ *
+ * @param os    the output stream to write into.
+ * @param value the value to be written.
+ */
+void Checkpoint::write(std::ostream & os, double value) {
+    os.write(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+/*
+ * Writes the specified values into the specified output stream.
+ *
+ * @param os     the output stream to write into.
+ * @param values the values to be written.
+ */
+void Checkpoint::write(std::ostream & os, const std::vector<unsigned int> & values) {
+    Checkpoint::write(os, (unsigned int) values.size());
+    os.write(reinterpret_cast<const char *>(values.data()),
+            values.size() * sizeof(unsigned int));
+}
+
+/*
+ * Writes the specified values into the specified output stream.
+ *
+ * @param os     the output stream to write into.
+ * @param values the values to be written.
+ */
+void Checkpoint::write(std::ostream & os, const std::vector<double> & values) {
+    Checkpoint::write(os, (unsigned int) values.size());
+    os.write(reinterpret_cast<const char *>(values.data()),
+            values.size() * sizeof(double));
+}
+
+/*
+ * Writes the state of the specified pseudo-random numbers generator into the
+ * specified output stream.
+ *
+ * @param os        the output stream to write into.
+ * @param generator the pseudo-random numbers generator.
+ */
+void Checkpoint::write(std::ostream & os, const std::mt19937 & generator) {
+    /* The standard only exposes the engine's state through its text form */
+    std::stringstream ss;
+    std::vector<unsigned int> state;
+    unsigned int word;
+
+    ss << generator;
+
+    while (ss >> word) {
+        state.push_back(word);
+    }
+
+    Checkpoint::write(os, state);
+}
+
+/*
+ * Writes the specified statistics into the specified output stream.
+ *
+ * @param os         the output stream to write into.
+ * @param statistics the statistics to be written.
+ */
+void Checkpoint::write(std::ostream & os, const Statistics & statistics) {
+    Checkpoint::write(os, statistics.getSize());
+    Checkpoint::write(os, statistics.getMean());
+    Checkpoint::write(os, statistics.getVariance());
+}
+
+/*
+ * Writes the districts of the specified solution into the specified output
+ * stream.
+ *
+ * @param os       the output stream to write into.
+ * @param solution the solution to be written.
+ */
+void Checkpoint::write(std::ostream & os, const Solution & solution) {
+    if (solution.isEmpty()) {
+        Checkpoint::write(os, std::vector<unsigned int> ());
+    } else {
+        Checkpoint::write(os, solution.getEdgesDistrict());
+    }
+}
+
+/*
+ * Reads a value from the specified input stream.
+ *
+ * @param is    the input stream to read from.
+ * @param value the value read.
+ */
+void Checkpoint::read(std::istream & is, unsigned int & value) {
+    is.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+/*
+ * Reads a value from the specified input stream.
+ *
+ * @param is    the input stream to read from.
+ * @param value the value read.
+ */
+void Checkpoint::read(std::istream & is, unsigned long long & value) {
+    is.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+/*
+ * Reads a value from the specified input stream.
+ *
+ * @param is    the input stream to read from.
+ * @param value the value read.
+ */
+void Checkpoint::read(std::istream & is, double & value) {
+    is.read(reinterpret_cast<char *>(&value), sizeof(value));
+}
+
+/*
+ * Reads values from the specified input stream.
+ *
+ * @param is     the input stream to read from.
+ * @param values the values read.
+ */
+void Checkpoint::read(std::istream & is, std::vector<unsigned int> & values) {
+    unsigned int size = 0;
+
+    Checkpoint::read(is, size);
+
+    if (!is) {
+        throw "Invalid checkpoint.";
+    }
+
+    values.resize(size);
+    is.read(reinterpret_cast<char *>(values.data()), size * sizeof(unsigned int));
+}
+
+/*
+ * Reads values from the specified input stream.
+ *
+ * @param is     the input stream to read from.
+ * @param values the values read.
+ */
+void Checkpoint::read(std::istream & is, std::vector<double> & values) {
+    unsigned int size = 0;
+
+    Checkpoint::read(is, size);
+
+    if (!is) {
+        throw "Invalid checkpoint.";
+    }
+
+    values.resize(size);
+    is.read(reinterpret_cast<char *>(values.data()), size * sizeof(double));
+}
+
+/*
+ * Reads the state of a pseudo-random numbers generator from the specified
+ * input stream.
+ *
+ * @param is        the input stream to read from.
+ * @param generator the pseudo-random numbers generator.
+ */
+void Checkpoint::read(std::istream & is, std::mt19937 & generator) {
+    std::vector<unsigned int> state;
+    std::stringstream ss;
+
+    Checkpoint::read(is, state);
+
+    for (unsigned int word : state) {
+        ss << word << " ";
+    }
+
+    ss >> generator;
+
+    if (!ss) {
+        throw "Invalid checkpoint.";
+    }
+}
+
+/*
+ * Reads statistics from the specified input stream.
+ *
+ * @param is         the input stream to read from.
+ * @param statistics the statistics read.
+ */
+void Checkpoint::read(std::istream & is, Statistics & statistics) {
+    unsigned int size = 0;
+    double mean = 0.0, variance = 0.0;
+
+    Checkpoint::read(is, size);
+    Checkpoint::read(is, mean);
+    Checkpoint::read(is, variance);
+
+    statistics = Statistics(size, mean, variance);
+}
+
+/*
+ * Reads the districts of a solution for the specified instance from the
+ * specified input stream.
+ *
+ * @param is       the input stream to read from.
+ * @param instance the solution's instance.
+ *
+ * @return the solution read, or an empty solution if none was written.
+ */
+Solution Checkpoint::readSolution(std::istream & is, const Instance & instance) {
+    std::vector<unsigned int> edgesDistrict;
+
+    Checkpoint::read(is, edgesDistrict);
+
+    if (edgesDistrict.empty()) {
+        return Solution();
+    }
+
+    return Solution(instance, edgesDistrict);
+}
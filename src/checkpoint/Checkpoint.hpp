@@ -0,0 +1,178 @@
+#pragma once
+
+#include "../solution/Solution.hpp"
+#include "../statistics/Statistics.hpp"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * The Checkpoint class groups the functions that write and read the state of
+ * a solver into and from a compact binary stream, so that an interrupted run
+ * can be resumed.
+ */
+class Checkpoint {
+    public:
+        /* The kind of a checkpoint written by a GRASP solver. */
+        static const unsigned int GRASP;
+
+        /* The kind of a checkpoint written by an exact solver after its warm start. */
+        static const unsigned int EXACT;
+
+        /*
+         * Writes the header of a checkpoint of the specified kind for the
+         * specified instance into the specified output stream.
+         *
+         * @param os       the output stream to write into.
+         * @param kind     the checkpoint's kind (GRASP or EXACT).
+         * @param instance the instance being solved.
+         */
+        static void writeHeader(std::ostream & os, unsigned int kind,
+                const Instance & instance);
+
+        /*
+         * Reads the header of a checkpoint for the specified instance from
+         * the specified input stream.
+         *
+         * @param is       the input stream to read from.
+         * @param instance the instance being solved.
+         *
+         * @return the checkpoint's kind (GRASP or EXACT).
+         */
+        static unsigned int readHeader(std::istream & is, const Instance & instance);
+
+        /*
+         * Writes the specified value into the specified output stream.
+         *
+         * @param os    the output stream to write into.
+         * @param value the value to be written.
+         */
+        static void write(std::ostream & os, unsigned int value);
+
+        /*
+         * Writes the specified value into the specified output stream.
+         *
+         * @param os    the output stream to write into.
+         * @param value the value to be written.
+         */
+        static void write(std::ostream & os, unsigned long long value);
+
+        /*
+         * Writes the specified value into the specified output stream.
+         *
+         * @param os    the output stream to write into.
+         * @param value the value to be written.
+         */
+        static void write(std::ostream & os, double value);
+
+        /*
+         * Writes the specified values into the specified output stream.
+         *
+         * @param os     the output stream to write into.
+         * @param values the values to be written.
+         */
+        static void write(std::ostream & os, const std::vector<unsigned int> & values);
+
+        /*
+         * Writes the specified values into the specified output stream.
+         *
+         * @param os     the output stream to write into.
+         * @param values the values to be written.
+         */
+        static void write(std::ostream & os, const std::vector<double> & values);
+
+        /*
+         * Writes the state of the specified pseudo-random numbers generator
+         * into the specified output stream.
+         *
+         * @param os        the output stream to write into.
+         * @param generator the pseudo-random numbers generator.
+         */
+        static void write(std::ostream & os, const std::mt19937 & generator);
+
+        /*
+         * Writes the specified statistics into the specified output stream.
+         *
+         * @param os         the output stream to write into.
+         * @param statistics the statistics to be written.
+         */
+        static void write(std::ostream & os, const Statistics & statistics);
+
+        /*
+         * Writes the districts of the specified solution into the specified
+         * output stream.
+         *
+         * @param os       the output stream to write into.
+         * @param solution the solution to be written.
+         */
+        static void write(std::ostream & os, const Solution & solution);
+
+        /*
+         * Reads a value from the specified input stream.
+         *
+         * @param is    the input stream to read from.
+         * @param value the value read.
+         */
+        static void read(std::istream & is, unsigned int & value);
+
+        /*
+         * Reads a value from the specified input stream.
+         *
+         * @param is    the input stream to read from.
+         * @param value the value read.
+         */
+        static void read(std::istream & is, unsigned long long & value);
+
+        /*
+         * Reads a value from the specified input stream.
+         *
+         * @param is    the input stream to read from.
+         * @param value the value read.
+         */
+        static void read(std::istream & is, double & value);
+
+        /*
+         * Reads values from the specified input stream.
+         *
+         * @param is     the input stream to read from.
+         * @param values the values read.
+         */
+        static void read(std::istream & is, std::vector<unsigned int> & values);
+
+        /*
+         * Reads values from the specified input stream.
+         *
+         * @param is     the input stream to read from.
+         * @param values the values read.
+         */
+        static void read(std::istream & is, std::vector<double> & values);
+
+        /*
+         * Reads the state of a pseudo-random numbers generator from the
+         * specified input stream.
+         *
+         * @param is        the input stream to read from.
+         * @param generator the pseudo-random numbers generator.
+         */
+        static void read(std::istream & is, std::mt19937 & generator);
+
+        /*
+         * Reads statistics from the specified input stream.
+         *
+         * @param is         the input stream to read from.
+         * @param statistics the statistics read.
+         */
+        static void read(std::istream & is, Statistics & statistics);
+
+        /*
+         * Reads the districts of a solution for the specified instance from
+         * the specified input stream.
+         *
+         * @param is       the input stream to read from.
+         * @param instance the solution's instance.
+         *
+         * @return the solution read, or an empty solution if none was written.
+         */
+        static Solution readSolution(std::istream & is, const Instance & instance);
+};
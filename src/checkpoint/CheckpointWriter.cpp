@@ -0,0 +1,140 @@
+#include "CheckpointWriter.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+/*
+ * Constructs a new writer.
+ *
+ * @param filename the file the new writer writes into; an empty name disables
+ *                 the new writer.
+ */
+CheckpointWriter::CheckpointWriter(const std::string & filename) :
+    filename(filename), hasPendingCheckpoint(false), isWriting(false),
+    isStopped(false), writesCounter(0) {
+    if (this->isEnabled()) {
+        this->thread = std::thread(&CheckpointWriter::run, this);
+    }
+}
+
+/*
+ * Waits for the pending checkpoint to be written and stops this writer's
+ * thread.
+ */
+CheckpointWriter::~CheckpointWriter() {
+    if (this->isEnabled()) {
+        this->flush();
+
+        {
+            std::lock_guard<std::mutex> lock (this->mutex);
+            this->isStopped = true;
+        }
+
+        this->condition.notify_all();
+        this->thread.join();
+    }
+}
+
+/*
+ * Writes the submitted checkpoints until this writer is stopped.
+ */
+void CheckpointWriter::run() {
+    std::unique_lock<std::mutex> lock (this->mutex);
+
+    while (true) {
+        this->condition.wait(lock, [this] () {
+            return this->hasPendingCheckpoint || this->isStopped;
+        });
+
+        if (!this->hasPendingCheckpoint) {
+            return;
+        }
+
+        std::string checkpoint;
+
+        checkpoint.swap(this->pendingCheckpoint);
+        this->hasPendingCheckpoint = false;
+        this->isWriting = true;
+        lock.unlock();
+
+        /* Writes a temporary file and renames it over the previous checkpoint */
+        std::string temporaryFilename = this->filename + ".tmp";
+        std::ofstream ofs (temporaryFilename, std::ios::binary | std::ios::trunc);
+        bool isWritten = false;
+
+        if (ofs.is_open()) {
+            ofs.write(checkpoint.data(), checkpoint.size());
+            ofs.close();
+            isWritten = ofs.good() && std::rename(temporaryFilename.c_str(),
+                    this->filename.c_str()) == 0;
+        }
+
+        if (!isWritten) {
+            std::cerr << "Checkpoint not written: " << this->filename << std::endl;
+        }
+
+        lock.lock();
+        this->isWriting = false;
+
+        if (isWritten) {
+            this->writesCounter++;
+        }
+
+        this->condition.notify_all();
+    }
+}
+
+/*
+ * Verifies whether this writer writes into a file.
+ *
+ * @return true if this writer is enabled; false otherwise.
+ */
+bool CheckpointWriter::isEnabled() const {
+    return !this->filename.empty();
+}
+
+/*
+ * Returns this writer's counter of checkpoints written.
+ *
+ * @return this writer's counter of checkpoints written.
+ */
+unsigned int CheckpointWriter::getWritesCounter() {
+    std::lock_guard<std::mutex> lock (this->mutex);
+
+    return this->writesCounter;
+}
+
+/*
+ * Hands the specified checkpoint to this writer's thread, replacing the
+ * pending one, if any, without waiting for the disk.
+ *
+ * @param checkpoint the checkpoint's bytes.
+ */
+void CheckpointWriter::submit(std::string checkpoint) {
+    if (!this->isEnabled()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock (this->mutex);
+        this->pendingCheckpoint.swap(checkpoint);
+        this->hasPendingCheckpoint = true;
+    }
+
+    this->condition.notify_all();
+}
+
+/*
+ * Waits until every submitted checkpoint has been written.
+ */
+void CheckpointWriter::flush() {
+    if (!this->isEnabled()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock (this->mutex);
+
+    this->condition.wait(lock, [this] () {
+        return !this->hasPendingCheckpoint && !this->isWriting;
+    });
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+ * The CheckpointWriter class represents a background thread that writes
+ * checkpoints into a file, so that a solver never waits for the disk. Only
+ * the latest submitted checkpoint is kept while the thread is busy, and each
+ * one replaces the file atomically, so the file always holds a complete
+ * checkpoint.
+ */
+class CheckpointWriter {
+    private:
+        /* The file this writer writes into; empty if this writer is disabled. */
+        std::string filename;
+
+        /* The latest checkpoint submitted and not yet written. */
+        std::string pendingCheckpoint;
+
+        /* The flag indicating whether there is a checkpoint to be written. */
+        bool hasPendingCheckpoint;
+
+        /* The flag indicating whether a checkpoint is being written. */
+        bool isWriting;
+
+        /* The flag indicating whether this writer's thread must stop. */
+        bool isStopped;
+
+        /* This writer's counter of checkpoints written. */
+        unsigned int writesCounter;
+
+        /* The mutex guarding this writer's state. */
+        std::mutex mutex;
+
+        /* The condition signalled whenever this writer's state changes. */
+        std::condition_variable condition;
+
+        /* This writer's thread. */
+        std::thread thread;
+
+        /*
+         * Writes the submitted checkpoints until this writer is stopped.
+         */
+        void run();
+
+    public:
+        /*
+         * Constructs a new writer.
+         *
+         * @param filename the file the new writer writes into; an empty name
+         *                 disables the new writer.
+         */
+        CheckpointWriter(const std::string & filename);
+
+        /*
+         * Waits for the pending checkpoint to be written and stops this
+         * writer's thread.
+         */
+        ~CheckpointWriter();
+
+        CheckpointWriter(const CheckpointWriter &) = delete;
+
+        CheckpointWriter & operator = (const CheckpointWriter &) = delete;
+
+        /*
+         * Verifies whether this writer writes into a file.
+         *
+         * @return true if this writer is enabled; false otherwise.
+         */
+        bool isEnabled() const;
+
+        /*
+         * Returns this writer's counter of checkpoints written.
+         *
+         * @return this writer's counter of checkpoints written.
+         */
+        unsigned int getWritesCounter();
+
+        /*
+         * Hands the specified checkpoint to this writer's thread, replacing
+         * the pending one, if any, without waiting for the disk.
+         *
+         * @param checkpoint the checkpoint's bytes.
+         */
+        void submit(std::string checkpoint);
+
+        /*
+         * Waits until every submitted checkpoint has been written.
+         */
+        void flush();
+};
@@ -0,0 +1,214 @@
+#include "../instance/Instance.hpp"
+#include "ArgumentParser.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+/*
+ * Splits the specified comma-separated list.
+ *
+ * @param list the comma-separated list.
+ *
+ * @return the items of the specified list.
+ */
+std::vector<std::string> split(const std::string & list) {
+    std::vector<std::string> items;
+    std::stringstream ss (list);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+/*
+ * Returns the option's value, or the specified default value if the option is missing.
+ *
+ * @param argParser    the argument parser.
+ * @param option       the option whose value is to be returned.
+ * @param defaultValue the value returned if the option is missing.
+ *
+ * @return the option's value, or the specified default value if the option is missing.
+ */
+std::string getCmdOption(const ArgumentParser & argParser, const std::string & option,
+        const std::string & defaultValue) {
+    if (argParser.cmdOptionExists(option)) {
+        return argParser.getCmdOption(option);
+    }
+
+    return defaultValue;
+}
+
+/*
+ * Derives a job's seed from the base seed, so that every file depends only on
+ * the parameters that produced it and not on the scheduling of the threads.
+ *
+ * @param seed the base seed.
+ * @param job  the job's index.
+ *
+ * @return the job's seed.
+ */
+unsigned int getJobSeed(unsigned int seed, unsigned long long job) {
+    unsigned long long z = seed + (job + 1) * 0x9E3779B97F4A7C15ULL;
+
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+    return (unsigned int) (z ^ (z >> 31));
+}
+
+/*
+ * Removes the dots of the specified number, as the benchmark's file names do.
+ *
+ * @param number the number.
+ *
+ * @return the number without dots.
+ */
+std::string removeDots(std::string number) {
+    number.erase(std::remove(number.begin(), number.end(), '.'), number.end());
+
+    return number;
+}
+
+/* Serializes the failure reports of the worker threads */
+std::mutex failuresMutex;
+
+/*
+ * Reports the failure of the job generating the specified graph.
+ *
+ * @param T       the job's topology.
+ * @param V       the job's number of vertices.
+ * @param E       the job's number of edges.
+ * @param message the failure's message.
+ */
+void reportFailure(const std::string & T, const std::string & V, const std::string & E,
+        const std::string & message) {
+    std::lock_guard<std::mutex> lock (failuresMutex);
+
+    std::cerr << "Job " << T << " V=" << V << " E=" << E << " failed: " << message
+        << std::endl;
+}
+
+int main (int argc, char * argv[]) {
+    ArgumentParser argParser (argc, argv);
+
+    if (argParser.cmdOptionExists("--help")) {
+        std::cerr << "./BenchmarkGeneratorExec --topologies <T1,...> --sizes <V1:E1,...> "
+            << "-m <m1,...> -B <B1,...> -D <D1,...> --max-demand <maxDemand> "
+            << "--seed <seed> --threads <threads> --graphs <dir> --instances <dir>"
+            << std::endl;
+
+        return 0;
+    }
+
+    std::vector<std::string> topologies = split(getCmdOption(argParser, "--topologies",
+                "grid,random"));
+    std::vector<std::string> sizes = split(getCmdOption(argParser, "--sizes",
+                "25:24,25:32,25:40,49:48,49:66,49:84,100:99,100:140,100:180"));
+    std::vector<std::string> ms = split(getCmdOption(argParser, "-m", "5,10"));
+    std::vector<std::string> Bs = split(getCmdOption(argParser, "-B", "0.5,1.0"));
+    std::vector<std::string> Ds = split(getCmdOption(argParser, "-D", "0.5,1.0"));
+    unsigned int maxDemand = std::stoul(getCmdOption(argParser, "--max-demand", "100"));
+    unsigned int seed = std::stoul(getCmdOption(argParser, "--seed",
+                std::to_string((unsigned int) std::chrono::system_clock::now()
+                    .time_since_epoch().count())));
+    unsigned int threads = std::stoul(getCmdOption(argParser, "--threads",
+                std::to_string(std::max(1U, std::thread::hardware_concurrency()))));
+    std::string graphsDir = getCmdOption(argParser, "--graphs", "graphs");
+    std::string instancesDir = getCmdOption(argParser, "--instances", "instances");
+
+    /* One job per graph; each job writes the graph and all of its instances */
+    std::vector<std::pair<std::string, std::string> > jobs;
+
+    for (const std::string & T : topologies) {
+        for (const std::string & VE : sizes) {
+            jobs.push_back(std::make_pair(T, VE));
+        }
+    }
+
+    std::atomic<unsigned int> nextJob (0);
+    std::atomic<unsigned int> failures (0);
+    std::vector<std::thread> workers;
+
+    for (unsigned int t = 0; t < std::max(1U, threads); t++) {
+        workers.push_back(std::thread([&] () {
+            for (unsigned int i = nextJob++; i < jobs.size(); i = nextJob++) {
+                const std::string & T = jobs[i].first;
+                std::string V = jobs[i].second.substr(0, jobs[i].second.find(':'));
+                std::string E = jobs[i].second.substr(jobs[i].second.find(':') + 1);
+                unsigned int graphSeed = getJobSeed(seed, i);
+
+                try {
+                    std::vector<Vertex> vertices;
+                    std::vector<Edge> edges;
+                    double dE;
+                    std::ofstream gfs;
+
+                    gfs.open(graphsDir + "/" + T + "-V" + V + "E" + E + ".in");
+
+                    if (!gfs.is_open()) {
+                        throw "File not created.";
+                    }
+
+                    if (T == "grid") {
+                        unsigned int r, c;
+                        r = c = round(sqrt(std::stoul(V)));
+                        dE = Graph::writeRandomConnectedGridGraph(gfs, r, c, std::stoul(E),
+                                maxDemand, true, graphSeed, vertices, edges);
+                    } else {
+                        dE = Graph::writeRandomConnectedGraph(gfs, std::stoul(V),
+                                std::stoul(E), maxDemand, true, graphSeed, vertices, edges);
+                    }
+
+                    gfs.close();
+
+                    for (unsigned int j = 0; j < ms.size() * Bs.size() * Ds.size(); j++) {
+                        const std::string & m = ms[j / (Bs.size() * Ds.size())];
+                        const std::string & B = Bs[(j / Ds.size()) % Bs.size()];
+                        const std::string & D = Ds[j % Ds.size()];
+                        unsigned int maxD = round(((2.0 * (1.0 + (std::stod(D) *
+                                            std::stod(B)))) / std::stod(m)) * dE);
+                        std::ofstream ofs;
+
+                        ofs.open(instancesDir + "/" + T + "-m" + m + "V" + V + "E" + E +
+                                "B" + removeDots(B) + "D" + removeDots(D) + ".in");
+
+                        if (!ofs.is_open()) {
+                            throw "File not created.";
+                        }
+
+                        Instance::writeRandomInstance(ofs, std::stoul(m), maxD,
+                                std::stod(B), vertices, edges, getJobSeed(graphSeed, j));
+                    }
+                } catch (const char * message) {
+                    failures++;
+                    reportFailure(T, V, E, message);
+                } catch (const std::exception & e) {
+                    failures++;
+                    reportFailure(T, V, E, e.what());
+                }
+            }
+        }));
+    }
+
+    for (std::thread & worker : workers) {
+        worker.join();
+    }
+
+    if (failures > 0) {
+        std::cerr << failures << " of " << jobs.size() << " jobs failed." << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,5 +1,6 @@
 #include "../solver/exact/branch-and-cut/BnCSolver.hpp"
 #include "ArgumentParser.hpp"
+#include <fstream>
 
 int main (int argc, char * argv[]) {
     ArgumentParser argParser (argc, argv);
@@ -28,6 +29,28 @@ int main (int argc, char * argv[]) {
                                      k,
                                      statisticalFilter);
 
+        if (argParser.cmdOptionExists("--checkpoint")) {
+            std::string checkpointFilename = argParser.getCmdOption("--checkpoint");
+            unsigned int checkpointInterval = 60;
+
+            if (argParser.cmdOptionExists("--checkpoint-interval")) {
+                checkpointInterval =
+                    std::stoul(argParser.getCmdOption("--checkpoint-interval"));
+            }
+
+            solver.setCheckpoint(checkpointFilename, checkpointInterval);
+
+            /* A missing checkpoint means the run was interrupted before the first one */
+            if (argParser.cmdOptionExists("--resume") &&
+                    std::ifstream(checkpointFilename).good()) {
+                solver.resume(checkpointFilename);
+            }
+        }
+
+        if (argParser.cmdOptionExists("--grasp-threads")) {
+            solver.setConcurrentGRASP(std::stoul(argParser.getCmdOption("--grasp-threads")));
+        }
+
         solver.solve();
 
         if (argParser.cmdOptionExists("--statistics")) {
@@ -52,6 +75,10 @@ int main (int argc, char * argv[]) {
                   << "--m <m> "
                   << "--k <k> "
                   << "--statistical-filter "
+                  << "--checkpoint <checkpointFilename> "
+                  << "--checkpoint-interval <seconds> "
+                  << "--resume "
+                  << "--grasp-threads <graspThreadsNumber> "
                   << "--statistics <solverStatisticsFilename> "
                   << "--solution <solutionFilename>"
                   << std::endl;
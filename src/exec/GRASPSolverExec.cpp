@@ -1,5 +1,6 @@
 #include "../solver/metaheuristic/grasp/GRASPSolver.hpp"
 #include "ArgumentParser.hpp"
+#include <fstream>
 
 int main (int argc, char * argv[]) {
     ArgumentParser argParser (argc, argv);
@@ -18,16 +19,127 @@ int main (int argc, char * argv[]) {
         bool statisticalFilter =
             argParser.cmdOptionExists("--statistical-filter");
 
+        unsigned int elitePoolSize = 0;
+        unsigned int pathRelinking = PathRelinkingHeuristic::MIXED;
+        unsigned int cacheSize = 0;
+        unsigned int alphaPolicy = AlphaSelector::REACTIVE;
+
         if (argParser.cmdOptionExists("--seed")) {
             seed = std::stoul(argParser.getCmdOption("--seed"));
         }
 
+        if (argParser.cmdOptionExists("--elite-pool")) {
+            elitePoolSize = std::stoul(argParser.getCmdOption("--elite-pool"));
+        }
+
+        if (argParser.cmdOptionExists("--path-relinking")) {
+            std::string direction = argParser.getCmdOption("--path-relinking");
+
+            if (direction == "forward") {
+                pathRelinking = PathRelinkingHeuristic::FORWARD;
+            } else if (direction == "backward") {
+                pathRelinking = PathRelinkingHeuristic::BACKWARD;
+            }
+        }
+
+        if (argParser.cmdOptionExists("--cache-size")) {
+            cacheSize = std::stoul(argParser.getCmdOption("--cache-size"));
+        }
+
+        if (argParser.cmdOptionExists("--alpha-policy")) {
+            std::string policy = argParser.getCmdOption("--alpha-policy");
+
+            if (policy == "ucb1") {
+                alphaPolicy = AlphaSelector::UCB1;
+            } else if (policy == "thompson") {
+                alphaPolicy = AlphaSelector::THOMPSON;
+            }
+        }
+
         Instance instance (instanceFilename);
         GRASPSolver solver = GRASPSolver(instance, timeLimit, seed, m, k,
-                statisticalFilter);
+                statisticalFilter, elitePoolSize, pathRelinking, cacheSize,
+                alphaPolicy);
+
+        if (argParser.cmdOptionExists("--alpha-import")) {
+            solver.importAlphaDistribution(argParser.getCmdOption("--alpha-import"));
+        }
+
+        solver.setLagrangianBound(argParser.cmdOptionExists("--lagrangian-bound"));
+        solver.setVND(argParser.cmdOptionExists("--vnd"));
+        solver.setFlowRebalancing(argParser.cmdOptionExists("--flow-rebalancing"));
+
+        if (argParser.cmdOptionExists("--region-growing")) {
+            std::string seeding = argParser.getCmdOption("--region-growing");
+
+            solver.setRegionGrowing(true);
+
+            if (seeding == "euclidean") {
+                solver.setRegionGrowingSeeding(
+                        RegionGrowingConstructiveHeuristic::EUCLIDEAN_SEEDING);
+            } else {
+                solver.setRegionGrowingSeeding(
+                        RegionGrowingConstructiveHeuristic::LINE_GRAPH_SEEDING);
+            }
+        }
+
+        if (argParser.cmdOptionExists("--ls-strategy")) {
+            std::string lsStrategyName = argParser.getCmdOption("--ls-strategy");
+            unsigned int lsStrategy = LocalSearchHeuristic::FIRST_IMPROVEMENT;
+            unsigned int lsCandidatesNumber = 1;
+
+            if (lsStrategyName == "best") {
+                lsStrategy = LocalSearchHeuristic::BEST_IMPROVEMENT;
+            } else if (lsStrategyName == "candidates") {
+                lsStrategy = LocalSearchHeuristic::CANDIDATE_LIST;
+                lsCandidatesNumber = 3;
+
+                if (argParser.cmdOptionExists("--ls-candidates")) {
+                    lsCandidatesNumber = std::stoul(argParser.getCmdOption("--ls-candidates"));
+                }
+            }
+
+            solver.setLocalSearchStrategy(lsStrategy, lsCandidatesNumber);
+        }
+
+        if (argParser.cmdOptionExists("--ls-threads")) {
+            solver.setLocalSearchThreadsNumber(std::stoul(argParser.getCmdOption("--ls-threads")));
+        }
+
+        if (argParser.cmdOptionExists("--lns")) {
+            unsigned int lnsThreadsNumber = 1;
+
+            if (argParser.cmdOptionExists("--lns-threads")) {
+                lnsThreadsNumber = std::stoul(argParser.getCmdOption("--lns-threads"));
+            }
+
+            solver.setLNS(std::stoul(argParser.getCmdOption("--lns")), lnsThreadsNumber);
+        }
+
+        if (argParser.cmdOptionExists("--checkpoint")) {
+            std::string checkpointFilename = argParser.getCmdOption("--checkpoint");
+            unsigned int checkpointInterval = 60;
+
+            if (argParser.cmdOptionExists("--checkpoint-interval")) {
+                checkpointInterval = 
+                    std::stoul(argParser.getCmdOption("--checkpoint-interval"));
+            }
+
+            solver.setCheckpoint(checkpointFilename, checkpointInterval);
+
+            /* A missing checkpoint means the run was interrupted before the first one */
+            if (argParser.cmdOptionExists("--resume") && 
+                    std::ifstream(checkpointFilename).good()) {
+                solver.resume(checkpointFilename);
+            }
+        }
 
         solver.solve();
 
+        if (argParser.cmdOptionExists("--alpha-export")) {
+            solver.exportAlphaDistribution(argParser.getCmdOption("--alpha-export"));
+        }
+
         if (argParser.cmdOptionExists("--statistics")) {
             std::string solverStatisticsFilename =
                 argParser.getCmdOption("--statistics");
@@ -48,7 +160,18 @@ int main (int argc, char * argv[]) {
     } else {
         std::cerr << "./GRASPSolverExec --instance <instanceFilename> " << 
             "--time-limit <timeLimit> --seed <seed> --m <m> --k <k> " << 
-            "--statistical-filter --statistics <solverStatisticsFilename> " << 
+            "--statistical-filter --elite-pool <elitePoolSize> " << 
+            "--path-relinking <forward|backward|mixed> " << 
+            "--cache-size <cacheSize> " << 
+            "--alpha-policy <reactive|ucb1|thompson> " << 
+            "--alpha-import <alphaFilename> --alpha-export <alphaFilename> " << 
+            "--checkpoint <checkpointFilename> --checkpoint-interval <seconds> " << 
+            "--resume --lagrangian-bound --vnd --flow-rebalancing " << 
+            "--region-growing <euclidean|line-graph> " << 
+            "--ls-strategy <first|best|candidates> --ls-candidates <k> " << 
+            "--ls-threads <lsThreadsNumber> " << 
+            "--lns <iterations> --lns-threads <lnsThreadsNumber> " << 
+            "--statistics <solverStatisticsFilename> " << 
             "--solution <solutionFilename>" << std::endl;
     }
 
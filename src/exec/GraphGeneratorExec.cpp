@@ -5,14 +5,20 @@
 int main (int argc, char * argv[]) {
     ArgumentParser argParser (argc, argv);
 
-    if (argParser.cmdOptionExists("-V") && argParser.cmdOptionExists("-E")) {
+    if (argParser.cmdOptionExists("-V") && 
+            (argParser.cmdOptionExists("-E") || argParser.cmdOptionExists("--knn"))) {
         unsigned int V = std::stoul(argParser.getCmdOption("-V"));
-        unsigned int E = std::stoul(argParser.getCmdOption("-E"));
+        unsigned int E = 0;
         unsigned int maxDemand = 100;
         bool isGrid = argParser.cmdOptionExists("--grid");
         bool isEuclidean = argParser.cmdOptionExists("--euclidean");
+        bool isNearestNeighbours = argParser.cmdOptionExists("--knn");
         unsigned int seed = std::chrono::system_clock::now().time_since_epoch().count();
 
+        if (argParser.cmdOptionExists("-E")) {
+            E = std::stoul(argParser.getCmdOption("-E"));
+        }
+
         if (argParser.cmdOptionExists("--max-demand")) {
             maxDemand = std::stoul(argParser.getCmdOption("--max-demand"));
         }
@@ -21,20 +27,21 @@ int main (int argc, char * argv[]) {
             seed = std::stoul(argParser.getCmdOption("--seed"));
         }
 
-        Graph G;
+        std::ios_base::sync_with_stdio(false);
 
-        if (!isGrid) {
-            G = Graph::generateRandomConnectedGraph(V, E, maxDemand, isEuclidean, seed);
+        if (isNearestNeighbours) {
+            unsigned int k = std::stoul(argParser.getCmdOption("--knn"));
+            Graph::writeRandomNearestNeighboursGraph(std::cout, V, k, maxDemand, seed);
+        } else if (!isGrid) {
+            Graph::writeRandomConnectedGraph(std::cout, V, E, maxDemand, isEuclidean, seed);
         } else {
             unsigned int r, c;
             r = c = round(sqrt(V));
-            G = Graph::generateRandomConnectedGridGraph(r, c, E, maxDemand, isEuclidean, seed);
+            Graph::writeRandomConnectedGridGraph(std::cout, r, c, E, maxDemand, 
+                    isEuclidean, seed);
         }
-
-        G.write();
     } else {
-        std::cerr << "./GraphGeneratorExec -V <V> -E <E> --grid --euclidean " 
+        std::cerr << "./GraphGeneratorExec -V <V> (-E <E> | --knn <k>) --grid --euclidean " 
             << " --max-demand <maxDemand> --seed <seed>" << std::endl;
     }
 }
-
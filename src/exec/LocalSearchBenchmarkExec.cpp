@@ -0,0 +1,115 @@
+#include "../solver/heuristic/constructive/GreedyConstructiveHeuristic.hpp"
+#include "../solver/heuristic/fixer/SolutionFixer.hpp"
+#include "../solver/heuristic/localsearch/LocalSearchHeuristic.hpp"
+#include "ArgumentParser.hpp"
+#include <sstream>
+
+/*
+ * Splits the specified comma-separated list.
+ *
+ * @param list the comma-separated list.
+ *
+ * @return the items of the specified list.
+ */
+std::vector<std::string> split(const std::string & list) {
+    std::vector<std::string> items;
+    std::stringstream ss (list);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+
+    return items;
+}
+
+int main (int argc, char * argv[]) {
+    ArgumentParser argParser (argc, argv);
+
+    if (argParser.cmdOptionExists("--instances")) {
+        std::vector<std::string> instancesFilenames =
+            split(argParser.getCmdOption("--instances"));
+        unsigned int seedsNumber = 10;
+        unsigned int candidatesNumber = 3;
+        unsigned int threadsNumber = 1;
+        double alpha = 0.3;
+        bool vnd = argParser.cmdOptionExists("--vnd");
+        std::vector<unsigned int> strategies = {LocalSearchHeuristic::FIRST_IMPROVEMENT,
+                                                LocalSearchHeuristic::BEST_IMPROVEMENT,
+                                                LocalSearchHeuristic::CANDIDATE_LIST};
+        std::vector<std::string> strategiesNames = {"first", "best", "candidates"};
+
+        if (argParser.cmdOptionExists("--seeds")) {
+            seedsNumber = std::stoul(argParser.getCmdOption("--seeds"));
+        }
+
+        if (argParser.cmdOptionExists("--candidates")) {
+            candidatesNumber = std::stoul(argParser.getCmdOption("--candidates"));
+        }
+
+        if (argParser.cmdOptionExists("--threads")) {
+            threadsNumber = std::stoul(argParser.getCmdOption("--threads"));
+        }
+
+        if (argParser.cmdOptionExists("--alpha")) {
+            alpha = std::stod(argParser.getCmdOption("--alpha"));
+        }
+
+        std::cout << "instance strategy solutions value time" << std::endl;
+
+        for (const std::string & instanceFilename : instancesFilenames) {
+            Instance instance (instanceFilename);
+            std::vector<double> values (strategies.size(), 0.0);
+            std::vector<double> times (strategies.size(), 0.0);
+            unsigned int solutionsCounter = 0;
+
+            /* Every strategy improves the same constructed solutions */
+            for (unsigned int seed = 0; seed < seedsNumber; seed++) {
+                GreedyConstructiveHeuristic gcHeuristic (instance, seed, alpha);
+                Solution solution = gcHeuristic.constructSolution(60);
+
+                if (!solution.isFeasible()) {
+                    solution = SolutionFixer::fixSolution(solution, 60);
+                }
+
+                if (!solution.isFeasible()) {
+                    continue;
+                }
+
+                solutionsCounter++;
+
+                for (unsigned int i = 0; i < strategies.size(); i++) {
+                    LocalSearchHeuristic lsHeuristic (instance, seed);
+
+                    lsHeuristic.setVND(vnd);
+                    lsHeuristic.setStrategy(strategies[i], candidatesNumber);
+                    lsHeuristic.setThreadsNumber(threadsNumber);
+
+                    std::chrono::steady_clock::time_point startTime =
+                        std::chrono::steady_clock::now();
+                    Solution improvedSolution = lsHeuristic.improveSolution(solution, 60);
+
+                    times[i] += std::chrono::duration<double, std::milli>(
+                            std::chrono::steady_clock::now() - startTime).count();
+                    values[i] += improvedSolution.getValue();
+                }
+            }
+
+            for (unsigned int i = 0; i < strategies.size(); i++) {
+                std::cout << instanceFilename << " " << strategiesNames[i] << " " <<
+                    solutionsCounter << " " <<
+                    ((solutionsCounter > 0) ? values[i] / solutionsCounter : 0.0) << " " <<
+                    ((solutionsCounter > 0) ? times[i] / solutionsCounter : 0.0) << std::endl;
+            }
+        }
+    } else {
+        std::cerr << "./LocalSearchBenchmarkExec --instances <instanceFilename,...> " <<
+            "--seeds <seedsNumber> --candidates <candidatesNumber> --alpha <alpha> " <<
+            "--threads <threadsNumber> " <<
+            "--vnd" << std::endl;
+    }
+
+    return 0;
+}
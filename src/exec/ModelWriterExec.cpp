@@ -0,0 +1,45 @@
+#include "../solver/exact/branch-and-bound/LGFFModel.hpp"
+#include "ArgumentParser.hpp"
+#include <chrono>
+
+int main (int argc, char * argv[]) {
+    ArgumentParser argParser (argc, argv);
+
+    if (argParser.cmdOptionExists("--instance")) {
+        std::string instanceFilename = argParser.getCmdOption("--instance");
+        bool isCompact = argParser.cmdOptionExists("--compact");
+        bool isNamed = argParser.cmdOptionExists("--names");
+
+        try {
+            Instance instance (instanceFilename);
+
+            std::chrono::steady_clock::time_point startTime =
+                std::chrono::steady_clock::now();
+
+            LGFFModel model (instance, isCompact, isNamed);
+
+            double buildingTime = std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - startTime).count();
+
+            std::cout << "Variables: " << model.getVariablesNumber() << std::endl;
+            std::cout << "Constraints: " << model.getConstraintsNumber() << std::endl;
+            std::cout << "Nonzeros: " << model.getNonZerosNumber() << std::endl;
+            std::cout << "Building time: " << buildingTime << std::endl;
+
+            if (argParser.cmdOptionExists("--model")) {
+                model.write(argParser.getCmdOption("--model"));
+            }
+        } catch (const char * e) {
+            std::cerr << e << std::endl;
+        }
+    } else {
+        std::cerr << "./ModelWriterExec "
+                  << "--instance <instanceFilename> "
+                  << "--compact "
+                  << "--names "
+                  << "--model <modelFilename>"
+                  << std::endl;
+    }
+
+    return 0;
+}
@@ -5,6 +5,7 @@
 #include <cfloat>
 #include <fstream>
 #include <queue>
+#include <unordered_set>
 
 /* White color constant */
 const unsigned int Graph::WHITE = 0;
@@ -226,6 +227,33 @@ std::set<Edge> Graph::getSpanningTree(const std::vector<Edge> E) {
     return T;
 }
 
+/*
+ * Returns a random weight for the edge between the specified vertices.
+ *
+ * @param u           the first end of the edge.
+ * @param v           the second end of the edge.
+ * @param maxDistance the greatest distance between two vertices.
+ * @param maxDemand   the maximum demand of each edge.
+ * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+ * @param generator   the pseudo-random numbers generator.
+ *
+ * @return a random weight for the edge between the specified vertices.
+ */
+double Graph::getRandomWeight(const Vertex & u, const Vertex & v, 
+        double maxDistance, unsigned int maxDemand, bool isEuclidean, 
+        std::mt19937 & generator) {
+    if (isEuclidean) {
+        double dx = v.x - u.x;
+        double dy = v.y - u.y;
+
+        return round((((double) maxDemand) / maxDistance) * sqrt(dx * dx + dy * dy));
+    }
+
+    std::uniform_int_distribution<int> weightDistribution(0, maxDemand);
+
+    return weightDistribution(generator);
+}
+
 /*
  * Verifies whether this graph is empty.
  *
@@ -1896,16 +1924,8 @@ Graph Graph::generateRandomCompleteGraph(unsigned int n,
 
         for (unsigned int j = i + 1; j < n; j++) {
             Vertex v = verticesVector[j];
-            double dx = u.x - v.x;
-            double dy = u.y - v.y;
-            double w = 0.0;
-
-            if (isEuclidean) {
-                w = round((((double) maxDemand) / sqrt(2.0)) * sqrt(dx * dx + dy - dy));
-            } else {
-                std::uniform_int_distribution<int> weightDistribution(0, maxDemand);
-                w = weightDistribution(generator);
-            }
+            double w = Graph::getRandomWeight(u, v, sqrt(2.0), maxDemand, 
+                    isEuclidean, generator);
 
             edges.insert(Edge(u, v, w));
         }
@@ -2027,16 +2047,8 @@ Graph Graph::generateRandomCompleteGridGraph(unsigned int r, unsigned int c,
 
             if (j < c - 1) {
                 Vertex v = verticesMatrix[i][j + 1];
-                double dx = v.x - u.x;
-                double dy = v.y - u.y;
-                double w = 0.0;
-
-                if (isEuclidean) {
-                    w = round((((double) maxDemand) / sqrt(2.5)) * sqrt(dx * dx + dy - dy));
-                } else {
-                    std::uniform_int_distribution<int> weightDistribution(0, maxDemand);
-                    w = weightDistribution(generator);
-                }
+                double w = Graph::getRandomWeight(u, v, sqrt(2.5), maxDemand, 
+                        isEuclidean, generator);
 
                 Edge e (u, v, w);
 
@@ -2045,16 +2057,8 @@ Graph Graph::generateRandomCompleteGridGraph(unsigned int r, unsigned int c,
 
             if (i < r - 1) {
                 Vertex v = verticesMatrix[i + 1][j];
-                double dx = v.x - u.x;
-                double dy = v.y - u.y;
-                double w = 0.0;
-
-                if (isEuclidean) {
-                    w = round((((double) maxDemand) / sqrt(2.5)) * sqrt(dx * dx + dy - dy));
-                } else {
-                    std::uniform_int_distribution<int> weightDistribution(0, maxDemand);
-                    w = weightDistribution(generator);
-                }
+                double w = Graph::getRandomWeight(u, v, sqrt(2.5), maxDemand, 
+                        isEuclidean, generator);
 
                 Edge e (u, v, w);
 
@@ -2127,3 +2131,481 @@ Graph Graph::generateRandomConnectedGridGraph(unsigned int r, unsigned int c,
     return Graph::generateRandomConnectedGridGraph(r, c, m, maxDemand, isEuclidean, seed);
 }
 
+
+/*
+ * Generates a new random connected graph and writes it into the specified
+ * output stream without building it in memory. The graph is a random
+ * recursive spanning tree plus uniformly sampled extra edges, preferring, as
+ * generateRandomConnectedGraph does, the edges whose weights lie between the
+ * first and the third quartiles. Dense graphs are delegated to
+ * generateRandomConnectedGraph.
+ *
+ * @param os          the output stream to write into.
+ * @param n           the size of the vertex set.
+ * @param m           the size of the edge set.
+ * @param maxDemand   the maximum demand of each edge.
+ * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+ * @param seed        the seed for the pseudo-random numbers generator.
+ */
+void Graph::writeRandomConnectedGraph(std::ostream & os, unsigned int n, 
+        unsigned int m, unsigned int maxDemand, bool isEuclidean, 
+        unsigned int seed) {
+    std::vector<Vertex> vertices;
+    std::vector<Edge> edges;
+
+    Graph::writeRandomConnectedGraph(os, n, m, maxDemand, isEuclidean, seed, vertices, edges);
+}
+
+/*
+ * Generates a new random connected graph, writes it into the specified output
+ * stream as writeRandomConnectedGraph does, and stores its vertices and its
+ * edges, in the order this class keeps them, into the specified vectors.
+ *
+ * @param os          the output stream to write into.
+ * @param n           the size of the vertex set.
+ * @param m           the size of the edge set.
+ * @param maxDemand   the maximum demand of each edge.
+ * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+ * @param seed        the seed for the pseudo-random numbers generator.
+ * @param vertices    the vector to store the vertices into.
+ * @param edges       the vector to store the edges into.
+ *
+ * @return the sum of the weights of the graph's edges.
+ */
+double Graph::writeRandomConnectedGraph(std::ostream & os, unsigned int n, 
+        unsigned int m, unsigned int maxDemand, bool isEuclidean, 
+        unsigned int seed, std::vector<Vertex> & vertices, 
+        std::vector<Edge> & edges) {
+    unsigned long long pairs = ((unsigned long long) n) * (n - 1) / 2;
+
+    if (n == 0 || m < n - 1 || m > pairs) {
+        Graph().write(os);
+        return 0.0;
+    }
+
+    /* Rejection sampling only pays off while most pairs are not edges */
+    if (n < 3 || 4 * ((unsigned long long) m) > pairs) {
+        Graph G = Graph::generateRandomConnectedGraph(n, m, maxDemand, isEuclidean, seed);
+        std::set<Vertex> V = G.getVertices();
+        std::set<Edge> E = G.getEdges();
+
+        G.write(os);
+        vertices.assign(V.begin(), V.end());
+        edges.assign(E.begin(), E.end());
+
+        return G.getEdgesWeight();
+    }
+
+    std::mt19937 generator (seed);
+    std::uniform_real_distribution <double> distribution (0.0, 1.0);
+    std::uniform_int_distribution<unsigned int> vertexDistribution (0, n - 1);
+    double edgesWeight = 0.0;
+
+    vertices.clear();
+    vertices.reserve(n);
+    edges.clear();
+    edges.reserve(m);
+
+    os << n << "\n" << m << "\n";
+
+    for (unsigned int v = 0; v < n; v++) {
+        double x = distribution(generator);
+        double y = distribution(generator);
+
+        vertices.push_back(Vertex(v, x, y));
+        os << x << " " << y << "\n";
+    }
+
+    /* Estimates the quartiles of the weights from a sample of pairs */
+    std::vector<double> sample;
+
+    for (unsigned int i = 0; i < 4096; i++) {
+        unsigned int u = vertexDistribution(generator);
+        unsigned int v = vertexDistribution(generator);
+
+        if (u != v) {
+            sample.push_back(Graph::getRandomWeight(vertices[u], vertices[v], 
+                        sqrt(2.0), maxDemand, isEuclidean, generator));
+        }
+    }
+
+    std::sort(sample.begin(), sample.end());
+
+    double minWeight = sample[sample.size() / 4];
+    double maxWeight = sample[(3 * sample.size()) / 4];
+
+    std::unordered_set<unsigned long long> pairsSet;
+    std::vector<unsigned int> order (n);
+
+    pairsSet.reserve(m);
+
+    for (unsigned int v = 0; v < n; v++) {
+        order[v] = v;
+    }
+
+    shuffle(order.begin(), order.end(), generator);
+
+    /* Links each vertex to a random earlier one, trying to keep the weight inside the quartiles */
+    for (unsigned int i = 1; i < n; i++) {
+        std::uniform_int_distribution<unsigned int> earlierDistribution (0, i - 1);
+        unsigned int v = order[i];
+        unsigned int u = order[earlierDistribution(generator)];
+        double w = Graph::getRandomWeight(vertices[u], vertices[v], sqrt(2.0), 
+                maxDemand, isEuclidean, generator);
+
+        for (unsigned int tries = 1; tries < 64 && (w < minWeight || w > maxWeight); tries++) {
+            u = order[earlierDistribution(generator)];
+            w = Graph::getRandomWeight(vertices[u], vertices[v], sqrt(2.0), 
+                    maxDemand, isEuclidean, generator);
+        }
+
+        if (u > v) {
+            std::swap(u, v);
+        }
+
+        pairsSet.insert(((unsigned long long) u) * n + v);
+        edges.push_back(Edge(vertices[u], vertices[v], w));
+        edgesWeight += w;
+        os << u << " " << v << " " << w << "\n";
+    }
+
+    /* Adds uniformly sampled extra edges, accepting any weight once the quartiles are exhausted */
+    unsigned int rejections = 0;
+
+    while (pairsSet.size() < m) {
+        unsigned int u = vertexDistribution(generator);
+        unsigned int v = vertexDistribution(generator);
+
+        if (u == v) {
+            continue;
+        }
+
+        if (u > v) {
+            std::swap(u, v);
+        }
+
+        if (pairsSet.find(((unsigned long long) u) * n + v) != pairsSet.end()) {
+            continue;
+        }
+
+        double w = Graph::getRandomWeight(vertices[u], vertices[v], sqrt(2.0), 
+                maxDemand, isEuclidean, generator);
+
+        if (rejections < 1024 && (w < minWeight || w > maxWeight)) {
+            rejections++;
+            continue;
+        }
+
+        rejections = 0;
+        pairsSet.insert(((unsigned long long) u) * n + v);
+        edges.push_back(Edge(vertices[u], vertices[v], w));
+        edgesWeight += w;
+        os << u << " " << v << " " << w << "\n";
+    }
+
+    os.flush();
+    std::sort(edges.begin(), edges.end());
+
+    return edgesWeight;
+}
+
+/*
+ * Generates a new random connected grid graph and writes it into the
+ * specified output stream without building it in memory.
+ *
+ * @param os          the output stream to write into.
+ * @param r           the number of rows of the grid graph.
+ * @param c           the number of columns of the grid graph.
+ * @param m           the size of the edge set.
+ * @param maxDemand   the maximum demand of each edge.
+ * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+ * @param seed        the seed for the pseudo-random numbers generator.
+ */
+void Graph::writeRandomConnectedGridGraph(std::ostream & os, unsigned int r, 
+        unsigned int c, unsigned int m, unsigned int maxDemand, 
+        bool isEuclidean, unsigned int seed) {
+    std::vector<Vertex> vertices;
+    std::vector<Edge> edges;
+
+    Graph::writeRandomConnectedGridGraph(os, r, c, m, maxDemand, isEuclidean, seed, vertices, 
+            edges);
+}
+
+/*
+ * Generates a new random connected grid graph, writes it into the specified
+ * output stream as writeRandomConnectedGridGraph does, and stores its vertices
+ * and its edges, in the order this class keeps them, into the specified
+ * vectors.
+ *
+ * @param os          the output stream to write into.
+ * @param r           the number of rows of the grid graph.
+ * @param c           the number of columns of the grid graph.
+ * @param m           the size of the edge set.
+ * @param maxDemand   the maximum demand of each edge.
+ * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+ * @param seed        the seed for the pseudo-random numbers generator.
+ * @param vertices    the vector to store the vertices into.
+ * @param edges       the vector to store the edges into.
+ *
+ * @return the sum of the weights of the graph's edges.
+ */
+double Graph::writeRandomConnectedGridGraph(std::ostream & os, unsigned int r, 
+        unsigned int c, unsigned int m, unsigned int maxDemand, 
+        bool isEuclidean, unsigned int seed, std::vector<Vertex> & vertices, 
+        std::vector<Edge> & edges) {
+    unsigned int n = r * c;
+
+    if (n == 0 || m < n - 1 || m > 2 * n - r - c) {
+        Graph().write(os);
+        return 0.0;
+    }
+
+    std::mt19937 generator (seed);
+    std::uniform_real_distribution <double> distribution (0.0, 0.5);
+    std::vector<Edge> allEdges;
+    double edgesWeight = 0.0;
+
+    vertices.clear();
+    vertices.reserve(n);
+    edges.clear();
+    edges.reserve(m);
+    allEdges.reserve(2 * n - r - c);
+
+    os << n << "\n" << m << "\n";
+
+    for (unsigned int i = 0; i < r; i++) {
+        for (unsigned int j = 0; j < c; j++) {
+            double x = i + distribution(generator);
+            double y = j + distribution(generator);
+
+            vertices.push_back(Vertex(i * c + j, x, y));
+            os << x << " " << y << "\n";
+        }
+    }
+
+    for (unsigned int i = 0; i < r; i++) {
+        for (unsigned int j = 0; j < c; j++) {
+            const Vertex & u = vertices[i * c + j];
+
+            if (j < c - 1) {
+                const Vertex & v = vertices[i * c + j + 1];
+
+                allEdges.push_back(Edge(u, v, Graph::getRandomWeight(u, v, 
+                                sqrt(2.5), maxDemand, isEuclidean, generator)));
+            }
+
+            if (i < r - 1) {
+                const Vertex & v = vertices[(i + 1) * c + j];
+
+                allEdges.push_back(Edge(u, v, Graph::getRandomWeight(u, v, 
+                                sqrt(2.5), maxDemand, isEuclidean, generator)));
+            }
+        }
+    }
+
+    shuffle(allEdges.begin(), allEdges.end(), generator);
+
+    /* Kruskal over the shuffled edges yields the spanning tree; the first non-tree edges complete it */
+    DisjointSets S (n);
+    std::vector<bool> isTreeEdge (allEdges.size(), false);
+    unsigned int extraEdges = m - (n - 1);
+
+    for (unsigned int v = 0; v < n; v++) {
+        S.makeSet(v);
+    }
+
+    for (unsigned int i = 0; i < allEdges.size(); i++) {
+        const Edge & e = allEdges[i];
+
+        if (S.findSet(e.u.v) != S.findSet(e.v.v)) {
+            isTreeEdge[i] = true;
+            S.unionSets(e.u.v, e.v.v);
+        }
+    }
+
+    for (unsigned int i = 0; i < allEdges.size(); i++) {
+        const Edge & e = allEdges[i];
+
+        if (isTreeEdge[i] || extraEdges > 0) {
+            if (!isTreeEdge[i]) {
+                extraEdges--;
+            }
+
+            edges.push_back(e);
+            edgesWeight += e.w;
+            os << e.u.v << " " << e.v.v << " " << e.w << "\n";
+        }
+    }
+
+    os.flush();
+    std::sort(edges.begin(), edges.end());
+
+    return edgesWeight;
+}
+
+/*
+ * Generates a new random euclidean graph linking each vertex to its k nearest
+ * neighbours and writes it into the specified output stream without building
+ * it in memory. Vertices are bucketed in a uniform grid of cells, and the
+ * components that remain are linked along a serpentine walk of the cells.
+ *
+ * @param os        the output stream to write into.
+ * @param n         the size of the vertex set.
+ * @param k         the number of nearest neighbours of each vertex.
+ * @param maxDemand the maximum demand of each edge.
+ * @param seed      the seed for the pseudo-random numbers generator.
+ */
+void Graph::writeRandomNearestNeighboursGraph(std::ostream & os, unsigned int n, 
+        unsigned int k, unsigned int maxDemand, unsigned int seed) {
+    if (n == 0) {
+        Graph().write(os);
+        return;
+    }
+
+    std::mt19937 generator (seed);
+    std::uniform_real_distribution <double> distribution (0.0, 1.0);
+    std::vector<Vertex> vertices;
+
+    vertices.reserve(n);
+
+    for (unsigned int v = 0; v < n; v++) {
+        double x = distribution(generator);
+        double y = distribution(generator);
+
+        vertices.push_back(Vertex(v, x, y));
+    }
+
+    /* Buckets the vertices into g × g cells holding about two vertices each */
+    unsigned int g = std::max(1U, (unsigned int) sqrt(n / 2.0));
+    double cellSize = 1.0 / g;
+    std::vector<unsigned int> cellsOffsets (g * g + 1, 0);
+    std::vector<unsigned int> cellsVertices (n);
+    std::vector<unsigned int> verticesCell (n);
+
+    for (unsigned int v = 0; v < n; v++) {
+        unsigned int i = std::min(g - 1, (unsigned int) (vertices[v].x * g));
+        unsigned int j = std::min(g - 1, (unsigned int) (vertices[v].y * g));
+
+        verticesCell[v] = i * g + j;
+        cellsOffsets[verticesCell[v] + 1]++;
+    }
+
+    for (unsigned int cell = 0; cell < g * g; cell++) {
+        cellsOffsets[cell + 1] += cellsOffsets[cell];
+    }
+
+    std::vector<unsigned int> cellsNext (cellsOffsets.begin(), cellsOffsets.end() - 1);
+
+    for (unsigned int v = 0; v < n; v++) {
+        cellsVertices[cellsNext[verticesCell[v]]++] = v;
+    }
+
+    std::unordered_set<unsigned long long> edgesSet;
+    std::vector<std::pair<unsigned int, unsigned int> > edges;
+    std::vector<std::pair<double, unsigned int> > nearest;
+
+    k = std::min(k, n - 1);
+    edgesSet.reserve(((unsigned long long) n) * k);
+    edges.reserve(((unsigned long long) n) * k);
+
+    for (unsigned int v = 0; v < n; v++) {
+        const Vertex & p = vertices[v];
+        int vi = verticesCell[v] / g;
+        int vj = verticesCell[v] % g;
+
+        nearest.clear();
+
+        /* Visits the rings of cells around v until no unvisited vertex can be nearer */
+        for (int ring = 0; ring <= (int) g; ring++) {
+            for (int i = vi - ring; i <= vi + ring; i++) {
+                for (int j = vj - ring; j <= vj + ring; j++) {
+                    if (i < 0 || j < 0 || i >= (int) g || j >= (int) g || 
+                            (abs(i - vi) != ring && abs(j - vj) != ring)) {
+                        continue;
+                    }
+
+                    for (unsigned int l = cellsOffsets[i * g + j]; 
+                            l < cellsOffsets[i * g + j + 1]; l++) {
+                        unsigned int u = cellsVertices[l];
+                        double dx = vertices[u].x - p.x;
+                        double dy = vertices[u].y - p.y;
+                        double d = dx * dx + dy * dy;
+
+                        if (u == v) {
+                            continue;
+                        }
+
+                        if (nearest.size() < k) {
+                            nearest.push_back(std::make_pair(d, u));
+                            std::push_heap(nearest.begin(), nearest.end());
+                        } else if (k > 0 && d < nearest.front().first) {
+                            std::pop_heap(nearest.begin(), nearest.end());
+                            nearest.back() = std::make_pair(d, u);
+                            std::push_heap(nearest.begin(), nearest.end());
+                        }
+                    }
+                }
+            }
+
+            double reach = ring * cellSize;
+
+            if (nearest.size() == k && (k == 0 || nearest.front().first <= reach * reach)) {
+                break;
+            }
+        }
+
+        for (const std::pair<double, unsigned int> & q : nearest) {
+            unsigned int a = std::min(v, q.second);
+            unsigned int b = std::max(v, q.second);
+
+            if (edgesSet.insert(((unsigned long long) a) * n + b).second) {
+                edges.push_back(std::make_pair(a, b));
+            }
+        }
+    }
+
+    /* Links the remaining components along a serpentine walk of the cells */
+    DisjointSets S (n);
+    unsigned int previous = n;
+
+    for (unsigned int v = 0; v < n; v++) {
+        S.makeSet(v);
+    }
+
+    for (const std::pair<unsigned int, unsigned int> & e : edges) {
+        S.unionSets(e.first, e.second);
+    }
+
+    for (unsigned int i = 0; i < g; i++) {
+        for (unsigned int jj = 0; jj < g; jj++) {
+            unsigned int j = (i % 2 == 0) ? jj : g - 1 - jj;
+
+            for (unsigned int l = cellsOffsets[i * g + j]; 
+                    l < cellsOffsets[i * g + j + 1]; l++) {
+                unsigned int v = cellsVertices[l];
+
+                if (previous < n && S.findSet(previous) != S.findSet(v)) {
+                    S.unionSets(previous, v);
+                    edges.push_back(std::make_pair(std::min(previous, v), 
+                                std::max(previous, v)));
+                }
+
+                previous = v;
+            }
+        }
+    }
+
+    os << n << "\n" << edges.size() << "\n";
+
+    for (const Vertex & v : vertices) {
+        os << v.x << " " << v.y << "\n";
+    }
+
+    for (const std::pair<unsigned int, unsigned int> & e : edges) {
+        os << e.first << " " << e.second << " " << Graph::getRandomWeight(
+                vertices[e.first], vertices[e.second], sqrt(2.0), maxDemand, 
+                true, generator) << "\n";
+    }
+
+    os.flush();
+}
@@ -82,6 +82,22 @@ class Graph {
          */
         static std::set<Edge> getSpanningTree(const std::vector<Edge> E);
 
+        /*
+         * Returns a random weight for the edge between the specified vertices.
+         *
+         * @param u           the first end of the edge.
+         * @param v           the second end of the edge.
+         * @param maxDistance the greatest distance between two vertices.
+         * @param maxDemand   the maximum demand of each edge.
+         * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+         * @param generator   the pseudo-random numbers generator.
+         *
+         * @return a random weight for the edge between the specified vertices.
+         */
+        static double getRandomWeight(const Vertex & u, const Vertex & v, 
+                double maxDistance, unsigned int maxDemand, bool isEuclidean, 
+                std::mt19937 & generator);
+
     public:
         /* White color constant */
         static const unsigned int WHITE;
@@ -1115,5 +1131,102 @@ class Graph {
         static Graph generateRandomConnectedGridGraph(unsigned int r, 
                 unsigned int c, double d, unsigned int maxDemand, 
                 bool isEuclidean, unsigned int seed);
+
+        /*
+         * Generates a new random connected graph and writes it into the
+         * specified output stream without building it in memory. The graph
+         * is a random recursive spanning tree plus uniformly sampled extra
+         * edges, preferring, as generateRandomConnectedGraph does, the edges
+         * whose weights lie between the first and the third quartiles. Dense
+         * graphs are delegated to generateRandomConnectedGraph.
+         *
+         * @param os          the output stream to write into.
+         * @param n           the size of the vertex set.
+         * @param m           the size of the edge set.
+         * @param maxDemand   the maximum demand of each edge.
+         * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+         * @param seed        the seed for the pseudo-random numbers generator.
+         */
+        static void writeRandomConnectedGraph(std::ostream & os, unsigned int n, 
+                unsigned int m, unsigned int maxDemand, bool isEuclidean, 
+                unsigned int seed);
+
+        /*
+         * Generates a new random connected graph, writes it into the
+         * specified output stream as writeRandomConnectedGraph does, and
+         * stores its vertices and its edges, in the order this class keeps
+         * them, into the specified vectors.
+         *
+         * @param os          the output stream to write into.
+         * @param n           the size of the vertex set.
+         * @param m           the size of the edge set.
+         * @param maxDemand   the maximum demand of each edge.
+         * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+         * @param seed        the seed for the pseudo-random numbers generator.
+         * @param vertices    the vector to store the vertices into.
+         * @param edges       the vector to store the edges into.
+         *
+         * @return the sum of the weights of the graph's edges.
+         */
+        static double writeRandomConnectedGraph(std::ostream & os, unsigned int n, 
+                unsigned int m, unsigned int maxDemand, bool isEuclidean, 
+                unsigned int seed, std::vector<Vertex> & vertices, 
+                std::vector<Edge> & edges);
+
+        /*
+         * Generates a new random connected grid graph and writes it into the
+         * specified output stream without building it in memory.
+         *
+         * @param os          the output stream to write into.
+         * @param r           the number of rows of the grid graph.
+         * @param c           the number of columns of the grid graph.
+         * @param m           the size of the edge set.
+         * @param maxDemand   the maximum demand of each edge.
+         * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+         * @param seed        the seed for the pseudo-random numbers generator.
+         */
+        static void writeRandomConnectedGridGraph(std::ostream & os, 
+                unsigned int r, unsigned int c, unsigned int m, 
+                unsigned int maxDemand, bool isEuclidean, unsigned int seed);
+
+        /*
+         * Generates a new random connected grid graph, writes it into the
+         * specified output stream as writeRandomConnectedGridGraph does, and
+         * stores its vertices and its edges, in the order this class keeps
+         * them, into the specified vectors.
+         *
+         * @param os          the output stream to write into.
+         * @param r           the number of rows of the grid graph.
+         * @param c           the number of columns of the grid graph.
+         * @param m           the size of the edge set.
+         * @param maxDemand   the maximum demand of each edge.
+         * @param isEuclidean the flag indicating whether the graph is euclidean or not.
+         * @param seed        the seed for the pseudo-random numbers generator.
+         * @param vertices    the vector to store the vertices into.
+         * @param edges       the vector to store the edges into.
+         *
+         * @return the sum of the weights of the graph's edges.
+         */
+        static double writeRandomConnectedGridGraph(std::ostream & os, 
+                unsigned int r, unsigned int c, unsigned int m, 
+                unsigned int maxDemand, bool isEuclidean, unsigned int seed, 
+                std::vector<Vertex> & vertices, std::vector<Edge> & edges);
+
+        /*
+         * Generates a new random euclidean graph linking each vertex to its k
+         * nearest neighbours and writes it into the specified output stream
+         * without building it in memory. Vertices are bucketed in a uniform
+         * grid of cells, and the components that remain are linked along a
+         * serpentine walk of the cells.
+         *
+         * @param os        the output stream to write into.
+         * @param n         the size of the vertex set.
+         * @param k         the number of nearest neighbours of each vertex.
+         * @param maxDemand the maximum demand of each edge.
+         * @param seed      the seed for the pseudo-random numbers generator.
+         */
+        static void writeRandomNearestNeighboursGraph(std::ostream & os, 
+                unsigned int n, unsigned int k, unsigned int maxDemand, 
+                unsigned int seed);
 };
 
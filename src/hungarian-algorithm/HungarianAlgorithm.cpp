@@ -0,0 +1,193 @@
+#include "HungarianAlgorithm.hpp"
+#include <algorithm>
+#include <cfloat>
+
+/*
+ * Constructs a new solver.
+ *
+ * @param n the new solver's number of rows (and columns).
+ */
+HungarianAlgorithm::HungarianAlgorithm(unsigned int n) {
+    this->reset(n);
+}
+
+/*
+ * Constructs a new empty solver.
+ */
+HungarianAlgorithm::HungarianAlgorithm() : HungarianAlgorithm::HungarianAlgorithm(0) {}
+
+/*
+ * Returns this solver's number of rows (and columns).
+ *
+ * @return this solver's number of rows (and columns).
+ */
+unsigned int HungarianAlgorithm::size() const {
+    return this->n;
+}
+
+/*
+ * Resizes this solver and sets all of its costs to zero.
+ *
+ * @param n the new number of rows (and columns).
+ */
+void HungarianAlgorithm::reset(unsigned int n) {
+    this->n = n;
+    this->cost.assign(n * n, 0.0);
+    this->u.resize(n + 1);
+    this->v.resize(n + 1);
+    this->p.resize(n + 1);
+    this->way.resize(n + 1);
+    this->minv.resize(n + 1);
+    this->used.resize(n + 1);
+    this->assignment.resize(n);
+
+    for (unsigned int i = 0; i < n; i++) {
+        this->assignment[i] = i;
+    }
+}
+
+/*
+ * Returns the cost of assigning the specified row to the specified column.
+ *
+ * @param i the row.
+ * @param j the column.
+ *
+ * @return the cost of assigning the specified row to the specified column.
+ */
+double HungarianAlgorithm::getCost(unsigned int i, unsigned int j) const {
+    return this->cost[i * this->n + j];
+}
+
+/*
+ * Sets the cost of assigning the specified row to the specified column.
+ *
+ * @param i     the row.
+ * @param j     the column.
+ * @param value the new cost.
+ */
+void HungarianAlgorithm::setCost(unsigned int i, unsigned int j, double value) {
+    this->cost[i * this->n + j] = value;
+}
+
+/*
+ * Returns the costs of assigning the specified row to each column.
+ *
+ * @param i the row.
+ *
+ * @return a pointer to the n costs of the specified row.
+ */
+double * HungarianAlgorithm::getRow(unsigned int i) {
+    return this->cost.data() + i * this->n;
+}
+
+/*
+ * Solves the assignment problem minimizing the total cost, where each cost is
+ * multiplied by the specified sign.
+ *
+ * Rows and columns are numbered from 1 to n internally; the row 0 and the
+ * column 0 are used as the root of each augmenting path.
+ *
+ * @param sign 1 to minimize the total cost; -1 to maximize it.
+ */
+void HungarianAlgorithm::solve(double sign) {
+    std::fill(this->u.begin(), this->u.end(), 0.0);
+    std::fill(this->v.begin(), this->v.end(), 0.0);
+    std::fill(this->p.begin(), this->p.end(), 0);
+    std::fill(this->way.begin(), this->way.end(), 0);
+
+    /* ∀ i ∈ {1, ..., n} */
+    for (unsigned int i = 1; i <= this->n; i++) {
+        unsigned int j0 = 0;
+
+        this->p[0] = i;
+        std::fill(this->minv.begin(), this->minv.end(), DBL_MAX);
+        std::fill(this->used.begin(), this->used.end(), false);
+
+        /* Grows an alternating tree until a free column is reached */
+        do {
+            unsigned int i0 = this->p[j0];
+            unsigned int j1 = 0;
+            double delta = DBL_MAX;
+            const double * row = this->cost.data() + (i0 - 1) * this->n;
+
+            this->used[j0] = true;
+
+            for (unsigned int j = 1; j <= this->n; j++) {
+                if (!this->used[j]) {
+                    double reducedCost = sign * row[j - 1] - this->u[i0] - this->v[j];
+
+                    if (reducedCost < this->minv[j]) {
+                        this->minv[j] = reducedCost;
+                        this->way[j] = j0;
+                    }
+
+                    if (this->minv[j] < delta) {
+                        delta = this->minv[j];
+                        j1 = j;
+                    }
+                }
+            }
+
+            for (unsigned int j = 0; j <= this->n; j++) {
+                if (this->used[j]) {
+                    this->u[this->p[j]] += delta;
+                    this->v[j] -= delta;
+                } else {
+                    this->minv[j] -= delta;
+                }
+            }
+
+            j0 = j1;
+        } while (this->p[j0] != 0);
+
+        /* Augments the matching along the path */
+        do {
+            unsigned int j1 = this->way[j0];
+
+            this->p[j0] = this->p[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+
+    for (unsigned int j = 1; j <= this->n; j++) {
+        this->assignment[this->p[j] - 1] = j - 1;
+    }
+}
+
+/*
+ * Solves the assignment problem maximizing the total cost.
+ *
+ * @return the column assigned to each row.
+ */
+const std::vector<unsigned int> & HungarianAlgorithm::maxCostAssignment() {
+    this->solve(-1.0);
+
+    return this->assignment;
+}
+
+/*
+ * Solves the assignment problem minimizing the total cost.
+ *
+ * @return the column assigned to each row.
+ */
+const std::vector<unsigned int> & HungarianAlgorithm::minCostAssignment() {
+    this->solve(1.0);
+
+    return this->assignment;
+}
+
+/*
+ * Verifies whether the last computed assignment maps each row to the column
+ * with the same index.
+ *
+ * @return true if the last assignment is the identity; false otherwise.
+ */
+bool HungarianAlgorithm::isIdentity() const {
+    for (unsigned int i = 0; i < this->n; i++) {
+        if (this->assignment[i] != i) {
+            return false;
+        }
+    }
+
+    return true;
+}
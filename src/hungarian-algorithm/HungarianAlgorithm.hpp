@@ -0,0 +1,124 @@
+#pragma once
+
+#include <vector>
+
+/*
+ * The HungarianAlgorithm class represents a solver for the assignment problem
+ * on a square matrix of real costs. Its buffers are kept between calls so
+ * that repeated assignments of the same size perform no allocation.
+ */
+class HungarianAlgorithm {
+    private:
+        /* This solver's number of rows (and columns). */
+        unsigned int n;
+
+        /* This solver's costs, stored row by row. */
+        std::vector<double> cost;
+
+        /* This solver's potential of each row. */
+        std::vector<double> u;
+
+        /* This solver's potential of each column. */
+        std::vector<double> v;
+
+        /* This solver's row matched to each column. */
+        std::vector<unsigned int> p;
+
+        /* This solver's previous column in the augmenting path of each column. */
+        std::vector<unsigned int> way;
+
+        /* This solver's minimum reduced cost of each column. */
+        std::vector<double> minv;
+
+        /* This solver's flag indicating whether each column was visited. */
+        std::vector<bool> used;
+
+        /* This solver's column assigned to each row. */
+        std::vector<unsigned int> assignment;
+
+        /*
+         * Solves the assignment problem minimizing the total cost, where each
+         * cost is multiplied by the specified sign.
+         *
+         * @param sign 1 to minimize the total cost; -1 to maximize it.
+         */
+        void solve(double sign);
+
+    public:
+        /*
+         * Constructs a new solver.
+         *
+         * @param n the new solver's number of rows (and columns).
+         */
+        HungarianAlgorithm(unsigned int n);
+
+        /*
+         * Constructs a new empty solver.
+         */
+        HungarianAlgorithm();
+
+        /*
+         * Returns this solver's number of rows (and columns).
+         *
+         * @return this solver's number of rows (and columns).
+         */
+        unsigned int size() const;
+
+        /*
+         * Resizes this solver and sets all of its costs to zero.
+         *
+         * @param n the new number of rows (and columns).
+         */
+        void reset(unsigned int n);
+
+        /*
+         * Returns the cost of assigning the specified row to the specified column.
+         *
+         * @param i the row.
+         * @param j the column.
+         *
+         * @return the cost of assigning the specified row to the specified column.
+         */
+        double getCost(unsigned int i, unsigned int j) const;
+
+        /*
+         * Sets the cost of assigning the specified row to the specified column.
+         *
+         * @param i     the row.
+         * @param j     the column.
+         * @param value the new cost.
+         */
+        void setCost(unsigned int i, unsigned int j, double value);
+
+        /*
+         * Returns the costs of assigning the specified row to each column.
+         *
+         * @param i the row.
+         *
+         * @return a pointer to the n costs of the specified row.
+         */
+        double * getRow(unsigned int i);
+
+        /*
+         * Solves the assignment problem maximizing the total cost.
+         *
+         * @return the column assigned to each row.
+         */
+        const std::vector<unsigned int> & maxCostAssignment();
+
+        /*
+         * Solves the assignment problem minimizing the total cost.
+         *
+         * @return the column assigned to each row.
+         */
+        const std::vector<unsigned int> & minCostAssignment();
+
+        /*
+         * Verifies whether the last computed assignment maps each row to
+         * the column with the same index.
+         *
+         * @return true if the last assignment is the identity; false otherwise.
+         */
+        bool isIdentity() const;
+};
+
@@ -4,8 +4,8 @@
 
 /* Define this instance's minimum and maximum allowed demand. */
 void Instance::defineMinimumAndMaximumDemand() {
-    this->minimumDemand = 2.0 * this->G.getEdgesWeight();
-    this->maximumDemand = 2.0 * this->G.getEdgesWeight();;
+    this->minimumDemand = 2.0 * this->data->G.getEdgesWeight();
+    this->maximumDemand = 2.0 * this->data->G.getEdgesWeight();;
 
     this->minimumDemand *= (1.0 - this->B) / ((double) this->m);
     this->maximumDemand *= (1.0 + this->B) / ((double) this->m);
@@ -15,39 +15,81 @@ void Instance::defineMinimumAndMaximumDemand() {
     }
 }
 
+/* Define this instance's edges and the edges adjacent to each edge. */
+void Instance::defineAdjacentEdges() {
+    this->data->edges = std::vector<Edge> (this->data->G.getMaxEid() + 1);
+    this->data->adjacentEdgesOffsets = std::vector<unsigned int> (this->data->G.getMaxEid() + 1, 0);
+    this->data->adjacentEdgesIds.clear();
+
+    for (unsigned int eId = 1; eId <= this->data->G.getMaxEid(); eId++) {
+        this->data->adjacentEdgesOffsets[eId - 1] = this->data->adjacentEdgesIds.size();
+
+        if (this->data->G.hasEdgeId(eId)) {
+            this->data->edges[eId] = this->data->G.getEdgeById(eId);
+
+            for (const Edge & f : this->data->G.getAdjacentEdges(this->data->edges[eId])) {
+                this->data->adjacentEdgesIds.push_back(this->data->G.getEdgeId(f));
+            }
+        }
+    }
+
+    this->data->adjacentEdgesOffsets[this->data->G.getMaxEid()] = 
+        this->data->adjacentEdgesIds.size();
+}
+
+/*
+ * Define this instance's random key of each pair (edge, district). The keys
+ * depend only on the instance's size, so that equal solutions of copies of
+ * the same instance have equal hashes.
+ */
+void Instance::defineZobristKeys() {
+    std::mt19937_64 generator (this->data->G.m() * 1000003ULL + this->m);
+
+    this->data->zobristKeys = std::vector<unsigned long long> (this->data->G.m() * this->m);
+
+    for (unsigned long long & key : this->data->zobristKeys) {
+        key = generator();
+    }
+}
+
 /*
  * Initializes a new instance.
  *
  * @param is the input stream to read from.
  */
 void Instance::init(std::istream & is) {
+    this->data = std::make_shared<Data>();
+
     is >> this->m >> this->D >> this->B;
 
     /* G = (V, E) */
-    this->G = Graph(is);
+    this->data->G = Graph(is);
     /* L(G) = (U, A) */
-    this->LG = this->G.getLineGraph();
+    this->data->LG = this->data->G.getLineGraph();
     /* G′ = (U′, A′) */
-    this->GPrime = Graph(this->LG);
+    this->data->GPrime = Graph(this->data->LG);
     /* e′ */
-    this->ePrime = Vertex(this->LG.getMaxV() + 1);
+    this->ePrime = Vertex(this->data->LG.getMaxV() + 1);
     /* U′ = U ∪ {e′} */
-    this->GPrime.addVertex(ePrime);
+    this->data->GPrime.addVertex(ePrime);
 
     /* A′ = A ∪ {{e′, e} : e ∈ U} */
-    for (const Vertex & e : this->LG.getVertices()) {
-        this->GPrime.addEdge(ePrime, e);
+    for (const Vertex & e : this->data->LG.getVertices()) {
+        this->data->GPrime.addEdge(ePrime, e);
     }
 
-    this->c = std::vector<std::vector<double> > (this->G.m(), std::vector<double> (this->m));
+    this->data->c = std::vector<std::vector<double> > (this->data->G.m(), 
+            std::vector<double> (this->m));
 
-    for (unsigned int e = 0; e < this->G.m(); e++) {
+    for (unsigned int e = 0; e < this->data->G.m(); e++) {
         for (unsigned int j = 0; j < this->m; j++) {
-            is >> this->c[e][j];
+            is >> this->data->c[e][j];
         }
     }
 
     this->defineMinimumAndMaximumDemand();
+    this->defineAdjacentEdges();
+    this->defineZobristKeys();
 }
 
 /*
@@ -62,36 +104,40 @@ void Instance::init(std::istream & is) {
 void Instance::init(unsigned int m, unsigned int D, double B, const Graph & G, 
         std::mt19937 generator) {
     generator.discard(1000);
+    this->data = std::make_shared<Data>();
     this->m = m;
     this->D = D;
     this->B = B;
     /* G = (V, E) */
-    this->G = Graph(G);
+    this->data->G = Graph(G);
     /* L(G) = (U, A) */
-    this->LG = this->G.getLineGraph();
+    this->data->LG = this->data->G.getLineGraph();
     /* G′ = (U′, A′) */
-    this->GPrime = Graph(this->LG);
+    this->data->GPrime = Graph(this->data->LG);
     /* e′ */
-    this->ePrime = Vertex(this->LG.getMaxV() + 1);
+    this->ePrime = Vertex(this->data->LG.getMaxV() + 1);
     /* U′ = U ∪ {e′} */
-    this->GPrime.addVertex(ePrime);
+    this->data->GPrime.addVertex(ePrime);
 
     /* A′ = A ∪ {{e′, e} : e ∈ U} */
-    for (const Vertex & e : this->LG.getVertices()) {
-        this->GPrime.addEdge(ePrime, e);
+    for (const Vertex & e : this->data->LG.getVertices()) {
+        this->data->GPrime.addEdge(ePrime, e);
     }
 
-    this->c = std::vector<std::vector<double> > (this->G.m(), std::vector<double> (this->m));
+    this->data->c = std::vector<std::vector<double> > (this->data->G.m(), 
+            std::vector<double> (this->m));
 
-    std::uniform_int_distribution<unsigned int> distribution(0, this->m * this->G.m() - 1);
+    std::uniform_int_distribution<unsigned int> distribution(0, this->m * this->data->G.m() - 1);
 
-    for (unsigned int e = 0; e < this->G.m(); e++) {
+    for (unsigned int e = 0; e < this->data->G.m(); e++) {
         for (unsigned int j = 0; j < this->m; j++) {
-            this->c[e][j] = distribution(generator);
+            this->data->c[e][j] = distribution(generator);
         }
     }
 
     this->defineMinimumAndMaximumDemand();
+    this->defineAdjacentEdges();
+    this->defineZobristKeys();
 }
         
 /*
@@ -104,8 +150,13 @@ void Instance::init(unsigned int m, unsigned int D, double B, const Graph & G,
  * @param c the new instance's profit obtained by allocating each edge in each district.
  */
 Instance::Instance(unsigned int m, unsigned int D, double B, const Graph & G, 
-        std::vector<std::vector<double> > c) : m(m), D(D), B(B), G(G), c(c) {
+        std::vector<std::vector<double> > c) : m(m), D(D), B(B), 
+    data(std::make_shared<Data>()) {
+    this->data->G = G;
+    this->data->c = c;
     this->defineMinimumAndMaximumDemand();
+    this->defineAdjacentEdges();
+    this->defineZobristKeys();
 }
 
 /*
@@ -214,7 +265,8 @@ Instance::Instance(const Graph & G) : Instance::Instance(G,
 /*
  * Constructs a new empty instance.
  */
-Instance::Instance() : m(0), D(0), B(0.0), G(), c(), minimumDemand(0.0), maximumDemand(0.0) {}
+Instance::Instance() : m(0), D(0), B(0.0), minimumDemand(0.0), maximumDemand(0.0), 
+    data(std::make_shared<Data>()) {}
 
 /*
  * Verifies whether this instance is empty.
@@ -222,7 +274,7 @@ Instance::Instance() : m(0), D(0), B(0.0), G(), c(), minimumDemand(0.0), maximum
  * @return true if this instance is empty; false otherwise.
  */
 bool Instance::isEmpty() const {
-    return (this->G.isEmpty() && this->c.empty());
+    return (this->data->G.isEmpty() && this->data->c.empty());
 }
 
 /*
@@ -257,8 +309,8 @@ double Instance::getB() const {
  *
  * @return this instance's connected undirected weighted graph.
  */
-Graph Instance::getG() const {
-    return this->G;
+const Graph & Instance::getG() const {
+    return this->data->G;
 }
 
 /*
@@ -266,8 +318,8 @@ Graph Instance::getG() const {
  *
  * @return this instance's line graph.
  */
-Graph Instance::getLG() const {
-    return this->LG;
+const Graph & Instance::getLG() const {
+    return this->data->LG;
 }
 
 /*
@@ -275,8 +327,8 @@ Graph Instance::getLG() const {
  *
  * @return this instance's G'.
  */
-Graph Instance::getGPrime() const {
-    return this->GPrime;
+const Graph & Instance::getGPrime() const {
+    return this->data->GPrime;
 }
 
 /* 
@@ -294,7 +346,7 @@ Vertex Instance::getEPrime() const {
  * @return this instance's profit obtained by allocating each edge in each district.
  */
 std::vector<std::vector<double> > Instance::getC() const {
-    return std::vector<std::vector<double> >(this->c);
+    return std::vector<std::vector<double> >(this->data->c);
 }
 
 /*
@@ -308,8 +360,8 @@ std::vector<std::vector<double> > Instance::getC() const {
  *         edge in the specified district.
  */
 double Instance::getC(unsigned int eId, unsigned int j) const {
-    if (eId >= 1 && eId <= this->G.m() && j < this->m) {
-        return this->c[eId - 1][j];
+    if (eId >= 1 && eId <= this->data->G.m() && j < this->m) {
+        return this->data->c[eId - 1][j];
     }
 
     return 0.0;
@@ -326,11 +378,64 @@ double Instance::getC(unsigned int eId, unsigned int j) const {
  *         edge in the specified district.
  */
 double Instance::getC(Edge e, unsigned int j) const {
-    unsigned int eId = this->G.getEdgeId(e);
+    unsigned int eId = this->data->G.getEdgeId(e);
 
     return this->getC(eId, j);
 }
 
+/*
+ * Returns this instance's edge with the specified id.
+ *
+ * @param eId the edge id.
+ *
+ * @return this instance's edge with the specified id.
+ */
+const Edge & Instance::getEdge(unsigned int eId) const {
+    return this->data->edges[eId];
+}
+
+/*
+ * Returns an iterator to the id of the first edge adjacent to the specified
+ * edge.
+ *
+ * @param eId the edge id.
+ *
+ * @return an iterator to the id of the first edge adjacent to the specified
+ *         edge.
+ */
+std::vector<unsigned int>::const_iterator Instance::getAdjacentEdgesIdsBegin(
+        unsigned int eId) const {
+    return this->data->adjacentEdgesIds.begin() + this->data->adjacentEdgesOffsets[eId - 1];
+}
+
+/*
+ * Returns an iterator past the id of the last edge adjacent to the specified
+ * edge.
+ *
+ * @param eId the edge id.
+ *
+ * @return an iterator past the id of the last edge adjacent to the specified
+ *         edge.
+ */
+std::vector<unsigned int>::const_iterator Instance::getAdjacentEdgesIdsEnd(
+        unsigned int eId) const {
+    return this->data->adjacentEdgesIds.begin() + this->data->adjacentEdgesOffsets[eId];
+}
+
+/*
+ * Returns this instance's random key of the specified edge allocated to the
+ * specified district.
+ *
+ * @param eId the id of the edge.
+ * @param j   the district.
+ *
+ * @return this instance's random key of the specified edge allocated to the
+ *         specified district.
+ */
+unsigned long long Instance::getZobristKey(unsigned int eId, unsigned int j) const {
+    return this->data->zobristKeys[(eId - 1) * this->m + j];
+}
+
 /*
  * Returns this instance's minimum allowed demand for each district.
  *
@@ -359,15 +464,15 @@ void Instance::write(std::ostream & os) const {
     os << this->D << std::endl;
     os << this->B << std::endl;
 
-    this->G.write(os);
+    this->data->G.write(os);
 
-    for (unsigned int e = 0; e < this->G.m(); e++) {
+    for (unsigned int e = 0; e < this->data->G.m(); e++) {
         if (this->m > 0) {
-            os << this->c[e][0];
+            os << this->data->c[e][0];
         }
 
         for (unsigned int j = 1; j < this->m; j++) {
-            os << " " << this->c[e][j];
+            os << " " << this->data->c[e][j];
         }
 
         os << std::endl;
@@ -398,3 +503,75 @@ void Instance::write() const {
     this->write(std::cout);
 }
 
+
+/*
+ * Writes a new instance with random costs into the specified output stream.
+ * The output is the same as the one of Instance(m, D, B, G, seed).write(os),
+ * but neither the line graph nor G′ is built.
+ *
+ * @param os   the output stream to write into.
+ * @param m    the new instance's number of districts.
+ * @param D    the new instance's maximum capacity of each district.
+ * @param B    the new instance's maximum imbalance allowed for each district.
+ * @param G    the new instance's connected undirected graph.
+ * @param seed the seed for the pseudo-random numbers generator.
+ */
+void Instance::writeRandomInstance(std::ostream & os, unsigned int m, 
+        unsigned int D, double B, const Graph & G, unsigned int seed) {
+    std::set<Vertex> vertices = G.getVertices();
+    std::set<Edge> edges = G.getEdges();
+
+    Instance::writeRandomInstance(os, m, D, B, 
+            std::vector<Vertex>(vertices.begin(), vertices.end()), 
+            std::vector<Edge>(edges.begin(), edges.end()), seed);
+}
+
+/*
+ * Writes a new instance with random costs into the specified output stream.
+ * The output is the same as the one of writeRandomInstance(os, m, D, B, G,
+ * seed) for the graph G whose vertices and edges, in the order Graph keeps
+ * them, are the specified ones, but G is not built.
+ *
+ * @param os       the output stream to write into.
+ * @param m        the new instance's number of districts.
+ * @param D        the new instance's maximum capacity of each district.
+ * @param B        the new instance's maximum imbalance allowed for each district.
+ * @param vertices the vertices of the new instance's graph.
+ * @param edges    the edges of the new instance's graph.
+ * @param seed     the seed for the pseudo-random numbers generator.
+ */
+void Instance::writeRandomInstance(std::ostream & os, unsigned int m, 
+        unsigned int D, double B, const std::vector<Vertex> & vertices, 
+        const std::vector<Edge> & edges, unsigned int seed) {
+    std::mt19937 generator (seed);
+
+    generator.discard(1000);
+
+    os << m << std::endl;
+    os << D << std::endl;
+    os << B << std::endl;
+    os << vertices.size() << std::endl;
+    os << edges.size() << std::endl;
+
+    for (const Vertex & v : vertices) {
+        v.write(os);
+    }
+
+    for (const Edge & e : edges) {
+        e.write(os);
+    }
+
+    std::uniform_int_distribution<unsigned int> distribution(0, m * edges.size() - 1);
+
+    for (unsigned int e = 0; e < edges.size(); e++) {
+        for (unsigned int j = 0; j < m; j++) {
+            if (j > 0) {
+                os << " ";
+            }
+
+            os << (double) distribution(generator);
+        }
+
+        os << std::endl;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../graph/Graph.hpp"
+#include <memory>
 
 /*
  * The Instance class represents an instance of the CEDP.
@@ -16,30 +17,61 @@ class Instance {
         /* This instance's maximum imbalance allowed for each district. */
         double B;
 
-        /* This instance's connected undirected weighted graph. */
-        Graph G;
+        /*
+         * The Data struct holds the graphs, the profits and the edge indices
+         * of an instance, which are never modified once the instance is
+         * built, so that the copies of an instance share them.
+         */
+        struct Data {
+            /* The connected undirected weighted graph. */
+            Graph G;
+
+            /* The line graph. */
+            Graph LG;
+
+            /* The G' */
+            Graph GPrime;
+
+            /* The profit obtained by allocating each edge in each district. */
+            std::vector<std::vector<double> > c;
+
+            /* The edges, indexed by their ids. */
+            std::vector<Edge> edges;
 
-        /* This instance's line graph. */
-        Graph LG;
+            /*
+             * The position in adjacentEdgesIds of the first edge adjacent to
+             * each edge, followed by the total number of positions.
+             */
+            std::vector<unsigned int> adjacentEdgesOffsets;
 
-        /* This instance's G' */
-        Graph GPrime;
+            /* The ids of the edges adjacent to each edge, stored contiguously. */
+            std::vector<unsigned int> adjacentEdgesIds;
+
+            /* The random key of each pair (edge, district), used to hash solutions. */
+            std::vector<unsigned long long> zobristKeys;
+        };
 
         /* This instance's G' artificial vertex. */
         Vertex ePrime;
 
-        /* This instance's profit obtained by allocating each edge in each district. */
-        std::vector<std::vector<double> > c;
-
         /* This instance's minimum allowed demand for each district. */
         double minimumDemand;
 
         /* This instance's maximum allowed demand for each district. */
         double maximumDemand;
 
+        /* This instance's graphs, profits and edge indices, shared with its copies. */
+        std::shared_ptr<Data> data;
+
         /* Define this instance's minimum and maximum allowed demand. */
         void defineMinimumAndMaximumDemand();
 
+        /* Define this instance's edges and the edges adjacent to each edge. */
+        void defineAdjacentEdges();
+
+        /* Define this instance's random key of each pair (edge, district). */
+        void defineZobristKeys();
+
         /*
          * Initializes a new instance.
          *
@@ -187,21 +219,21 @@ class Instance {
          *
          * @return this instance's connected undirected weighted graph.
          */
-        Graph getG() const;
+        const Graph & getG() const;
 
         /*
          * Returns this instance's line graph.
          *
          * @return this instance's line graph.
          */
-        Graph getLG() const;
+        const Graph & getLG() const;
 
         /*
          * Returns this instance's G'.
          *
          * @return this instance's G'.
          */
-        Graph getGPrime() const;
+        const Graph & getGPrime() const;
 
         /* 
          * Returns this instance's G' artificial vertex.
@@ -241,6 +273,51 @@ class Instance {
          */
         double getC(Edge e, unsigned int j) const;
 
+        /*
+         * Returns this instance's edge with the specified id.
+         *
+         * @param eId the edge id.
+         *
+         * @return this instance's edge with the specified id.
+         */
+        const Edge & getEdge(unsigned int eId) const;
+
+        /*
+         * Returns an iterator to the id of the first edge adjacent to the
+         * specified edge.
+         *
+         * @param eId the edge id.
+         *
+         * @return an iterator to the id of the first edge adjacent to the
+         *         specified edge.
+         */
+        std::vector<unsigned int>::const_iterator getAdjacentEdgesIdsBegin(
+                unsigned int eId) const;
+
+        /*
+         * Returns an iterator past the id of the last edge adjacent to the
+         * specified edge.
+         *
+         * @param eId the edge id.
+         *
+         * @return an iterator past the id of the last edge adjacent to the
+         *         specified edge.
+         */
+        std::vector<unsigned int>::const_iterator getAdjacentEdgesIdsEnd(
+                unsigned int eId) const;
+
+        /*
+         * Returns this instance's random key of the specified edge allocated
+         * to the specified district.
+         *
+         * @param eId the id of the edge.
+         * @param j   the district.
+         *
+         * @return this instance's random key of the specified edge allocated
+         *         to the specified district.
+         */
+        unsigned long long getZobristKey(unsigned int eId, unsigned int j) const;
+
         /*
          * Returns this instance's minimum allowed demand for each district.
          *
@@ -273,5 +350,40 @@ class Instance {
          * Write this instance into the standard output stream.
          */
         void write() const;
+
+        /*
+         * Writes a new instance with random costs into the specified output
+         * stream. The output is the same as the one of
+         * Instance(m, D, B, G, seed).write(os), but neither the line graph
+         * nor G′ is built.
+         *
+         * @param os   the output stream to write into.
+         * @param m    the new instance's number of districts.
+         * @param D    the new instance's maximum capacity of each district.
+         * @param B    the new instance's maximum imbalance allowed for each district.
+         * @param G    the new instance's connected undirected graph.
+         * @param seed the seed for the pseudo-random numbers generator.
+         */
+        static void writeRandomInstance(std::ostream & os, unsigned int m, 
+                unsigned int D, double B, const Graph & G, unsigned int seed);
+
+        /*
+         * Writes a new instance with random costs into the specified output
+         * stream. The output is the same as the one of
+         * writeRandomInstance(os, m, D, B, G, seed) for the graph G whose
+         * vertices and edges, in the order Graph keeps them, are the
+         * specified ones, but G is not built.
+         *
+         * @param os       the output stream to write into.
+         * @param m        the new instance's number of districts.
+         * @param D        the new instance's maximum capacity of each district.
+         * @param B        the new instance's maximum imbalance allowed for each district.
+         * @param vertices the vertices of the new instance's graph.
+         * @param edges    the edges of the new instance's graph.
+         * @param seed     the seed for the pseudo-random numbers generator.
+         */
+        static void writeRandomInstance(std::ostream & os, unsigned int m, 
+                unsigned int D, double B, const std::vector<Vertex> & vertices, 
+                const std::vector<Edge> & edges, unsigned int seed);
 };
 
@@ -0,0 +1,446 @@
+#include "LinearModel.hpp"
+#include <fstream>
+#include <limits>
+
+/* Binary variable type constant. */
+const char LinearModel::BINARY = 'B';
+
+/* Continuous variable type constant. */
+const char LinearModel::CONTINUOUS = 'C';
+
+/* Less-than-or-equal constraint sense constant. */
+const char LinearModel::LESS_EQUAL = '<';
+
+/* Greater-than-or-equal constraint sense constant. */
+const char LinearModel::GREATER_EQUAL = '>';
+
+/* Equality constraint sense constant. */
+const char LinearModel::EQUAL = '=';
+
+/*
+ * Constructs a new empty model.
+ *
+ * @param isMaximization the flag indicating whether the objective is
+ *                       maximized.
+ */
+LinearModel::LinearModel(bool isMaximization) : isMaximization(isMaximization),
+    constraintsOffsets(1, 0) {}
+
+/*
+ * Constructs a new empty maximization model.
+ */
+LinearModel::LinearModel() : LinearModel::LinearModel(true) {}
+
+/*
+ * Returns the name of the specified variable, or a generated one.
+ *
+ * @param i the variable's index.
+ *
+ * @return the variable's name.
+ */
+std::string LinearModel::getVariableName(unsigned int i) const {
+    if (i < this->variablesNames.size() && !this->variablesNames[i].empty()) {
+        return this->variablesNames[i];
+    }
+
+    return "v" + std::to_string(i);
+}
+
+/*
+ * Returns the name of the specified constraint, or a generated one.
+ *
+ * @param i the constraint's index.
+ *
+ * @return the constraint's name.
+ */
+std::string LinearModel::getConstraintName(unsigned int i) const {
+    if (i < this->constraintsNames.size() && !this->constraintsNames[i].empty()) {
+        return this->constraintsNames[i];
+    }
+
+    return "r" + std::to_string(i);
+}
+
+/*
+ * Adds a variable to this model.
+ *
+ * @param lowerBound the variable's lower bound.
+ * @param upperBound the variable's upper bound.
+ * @param objective  the variable's objective coefficient.
+ * @param type       the variable's type (BINARY or CONTINUOUS).
+ * @param name       the variable's name; empty if not named.
+ *
+ * @return the variable's index.
+ */
+unsigned int LinearModel::addVariable(double lowerBound, double upperBound,
+        double objective, char type, const std::string & name) {
+    this->lowerBounds.push_back(lowerBound);
+    this->upperBounds.push_back(upperBound);
+    this->objective.push_back(objective);
+    this->types.push_back(type);
+
+    /* Names are only stored once the first one is given */
+    if (!name.empty() || !this->variablesNames.empty()) {
+        this->variablesNames.resize(this->lowerBounds.size() - 1);
+        this->variablesNames.push_back(name);
+    }
+
+    return this->lowerBounds.size() - 1;
+}
+
+/*
+ * Adds a constraint to this model.
+ *
+ * @param indices      the constraint's variables.
+ * @param coefficients the constraint's coefficients.
+ * @param sense        the constraint's sense (LESS_EQUAL, GREATER_EQUAL or
+ *                     EQUAL).
+ * @param rhs          the constraint's right-hand side.
+ * @param name         the constraint's name; empty if not named.
+ *
+ * @return the constraint's index.
+ */
+unsigned int LinearModel::addConstraint(const std::vector<unsigned int> & indices,
+        const std::vector<double> & coefficients, char sense, double rhs,
+        const std::string & name) {
+    this->indices.insert(this->indices.end(), indices.begin(), indices.end());
+    this->coefficients.insert(this->coefficients.end(), coefficients.begin(),
+            coefficients.end());
+    this->constraintsOffsets.push_back(this->indices.size());
+    this->senses.push_back(sense);
+    this->rhs.push_back(rhs);
+
+    if (!name.empty() || !this->constraintsNames.empty()) {
+        this->constraintsNames.resize(this->senses.size() - 1);
+        this->constraintsNames.push_back(name);
+    }
+
+    return this->senses.size() - 1;
+}
+
+/*
+ * Verifies whether the objective is maximized.
+ *
+ * @return true if the objective is maximized; false otherwise.
+ */
+bool LinearModel::getIsMaximization() const {
+    return this->isMaximization;
+}
+
+/*
+ * Returns the number of variables.
+ *
+ * @return the number of variables.
+ */
+unsigned int LinearModel::getVariablesNumber() const {
+    return this->lowerBounds.size();
+}
+
+/*
+ * Returns the number of constraints.
+ *
+ * @return the number of constraints.
+ */
+unsigned int LinearModel::getConstraintsNumber() const {
+    return this->senses.size();
+}
+
+/*
+ * Returns the number of nonzero coefficients in the constraints.
+ *
+ * @return the number of nonzero coefficients in the constraints.
+ */
+unsigned int LinearModel::getNonZerosNumber() const {
+    return this->indices.size();
+}
+
+/*
+ * Returns the lower bound of each variable.
+ *
+ * @return the lower bound of each variable.
+ */
+const std::vector<double> & LinearModel::getLowerBounds() const {
+    return this->lowerBounds;
+}
+
+/*
+ * Returns the upper bound of each variable.
+ *
+ * @return the upper bound of each variable.
+ */
+const std::vector<double> & LinearModel::getUpperBounds() const {
+    return this->upperBounds;
+}
+
+/*
+ * Returns the objective coefficient of each variable.
+ *
+ * @return the objective coefficient of each variable.
+ */
+const std::vector<double> & LinearModel::getObjective() const {
+    return this->objective;
+}
+
+/*
+ * Returns the type of each variable.
+ *
+ * @return the type of each variable.
+ */
+const std::vector<char> & LinearModel::getTypes() const {
+    return this->types;
+}
+
+/*
+ * Returns the name of each variable; empty if the model is not named.
+ *
+ * @return the name of each variable.
+ */
+const std::vector<std::string> & LinearModel::getVariablesNames() const {
+    return this->variablesNames;
+}
+
+/*
+ * Returns the offset of each constraint's first coefficient, followed by the
+ * number of coefficients.
+ *
+ * @return the offset of each constraint's first coefficient.
+ */
+const std::vector<unsigned int> & LinearModel::getConstraintsOffsets() const {
+    return this->constraintsOffsets;
+}
+
+/*
+ * Returns the variable of each coefficient, constraint by constraint.
+ *
+ * @return the variable of each coefficient.
+ */
+const std::vector<unsigned int> & LinearModel::getIndices() const {
+    return this->indices;
+}
+
+/*
+ * Returns the coefficients, constraint by constraint.
+ *
+ * @return the coefficients.
+ */
+const std::vector<double> & LinearModel::getCoefficients() const {
+    return this->coefficients;
+}
+
+/*
+ * Returns the sense of each constraint.
+ *
+ * @return the sense of each constraint.
+ */
+const std::vector<char> & LinearModel::getSenses() const {
+    return this->senses;
+}
+
+/*
+ * Returns the right-hand side of each constraint.
+ *
+ * @return the right-hand side of each constraint.
+ */
+const std::vector<double> & LinearModel::getRhs() const {
+    return this->rhs;
+}
+
+/*
+ * Returns the name of each constraint; empty if the model is not named.
+ *
+ * @return the name of each constraint.
+ */
+const std::vector<std::string> & LinearModel::getConstraintsNames() const {
+    return this->constraintsNames;
+}
+
+/*
+ * Returns the number of constraints violated by the specified point.
+ *
+ * @param point     the value of each variable.
+ * @param tolerance the violation tolerance.
+ *
+ * @return the number of constraints violated by the point.
+ */
+unsigned int LinearModel::getViolatedConstraintsNumber(const std::vector<double> & point,
+        double tolerance) const {
+    unsigned int violatedConstraintsNumber = 0;
+
+    for (unsigned int i = 0; i < this->senses.size(); i++) {
+        double lhs = 0.0;
+
+        for (unsigned int k = this->constraintsOffsets[i]; k < this->constraintsOffsets[i + 1]; k++) {
+            lhs += this->coefficients[k] * point[this->indices[k]];
+        }
+
+        if ((this->senses[i] != LinearModel::GREATER_EQUAL && lhs > this->rhs[i] + tolerance) ||
+                (this->senses[i] != LinearModel::LESS_EQUAL && lhs < this->rhs[i] - tolerance)) {
+            violatedConstraintsNumber++;
+        }
+    }
+
+    return violatedConstraintsNumber;
+}
+
+/*
+ * Write this model into the specified output stream in the LP format.
+ *
+ * @param os the output stream to write into.
+ */
+void LinearModel::writeLP(std::ostream & os) const {
+    std::streamsize precision = os.precision(std::numeric_limits<double>::max_digits10);
+
+    /* Writes the terms of a linear expression, a few per line */
+    auto writeTerm = [&] (double coefficient, unsigned int i, unsigned int k) {
+        if (k > 0 && k % 8 == 0) {
+            os << std::endl << "  ";
+        }
+
+        os << (coefficient < 0.0 ? " - " : (k > 0 ? " + " : " ")) <<
+            (coefficient < 0.0 ? -coefficient : coefficient) << " " <<
+            this->getVariableName(i);
+    };
+
+    os << (this->isMaximization ? "Maximize" : "Minimize") << std::endl;
+    os << " obj:";
+
+    for (unsigned int i = 0, k = 0; i < this->objective.size(); i++) {
+        if (this->objective[i] != 0.0) {
+            writeTerm(this->objective[i], i, k++);
+        }
+    }
+
+    os << std::endl << "Subject To" << std::endl;
+
+    for (unsigned int i = 0; i < this->senses.size(); i++) {
+        os << " " << this->getConstraintName(i) << ":";
+
+        for (unsigned int k = this->constraintsOffsets[i]; k < this->constraintsOffsets[i + 1]; k++) {
+            writeTerm(this->coefficients[k], this->indices[k], k - this->constraintsOffsets[i]);
+        }
+
+        if (this->constraintsOffsets[i] == this->constraintsOffsets[i + 1]) {
+            os << " 0 " << this->getVariableName(0);
+        }
+
+        os << " " << (this->senses[i] == LinearModel::LESS_EQUAL ? "<=" :
+                (this->senses[i] == LinearModel::GREATER_EQUAL ? ">=" : "=")) <<
+            " " << this->rhs[i] << std::endl;
+    }
+
+    os << "Bounds" << std::endl;
+
+    for (unsigned int i = 0; i < this->types.size(); i++) {
+        if (this->types[i] == LinearModel::CONTINUOUS) {
+            os << " " << this->lowerBounds[i] << " <= " << this->getVariableName(i) <<
+                " <= " << this->upperBounds[i] << std::endl;
+        }
+    }
+
+    os << "Binaries" << std::endl;
+
+    for (unsigned int i = 0; i < this->types.size(); i++) {
+        if (this->types[i] == LinearModel::BINARY) {
+            os << " " << this->getVariableName(i) << std::endl;
+        }
+    }
+
+    os << "End" << std::endl;
+
+    os.precision(precision);
+}
+
+/*
+ * Write this model into the specified output stream in the free MPS format.
+ *
+ * @param os the output stream to write into.
+ */
+void LinearModel::writeMPS(std::ostream & os) const {
+    std::streamsize precision = os.precision(std::numeric_limits<double>::max_digits10);
+    std::vector<std::vector<std::pair<unsigned int, double> > > columns (
+            this->lowerBounds.size());
+
+    /* The coefficients are listed column by column */
+    for (unsigned int i = 0; i < this->senses.size(); i++) {
+        for (unsigned int k = this->constraintsOffsets[i]; k < this->constraintsOffsets[i + 1]; k++) {
+            columns[this->indices[k]].push_back(std::make_pair(i, this->coefficients[k]));
+        }
+    }
+
+    os << "NAME CEDP" << std::endl;
+    os << "OBJSENSE" << std::endl;
+    os << "    " << (this->isMaximization ? "MAX" : "MIN") << std::endl;
+    os << "ROWS" << std::endl;
+    os << " N obj" << std::endl;
+
+    for (unsigned int i = 0; i < this->senses.size(); i++) {
+        os << " " << (this->senses[i] == LinearModel::LESS_EQUAL ? "L" :
+                (this->senses[i] == LinearModel::GREATER_EQUAL ? "G" : "E")) << " " <<
+            this->getConstraintName(i) << std::endl;
+    }
+
+    os << "COLUMNS" << std::endl;
+
+    for (unsigned int i = 0; i < columns.size(); i++) {
+        std::string name = this->getVariableName(i);
+
+        os << "    " << name << " obj " << this->objective[i] << std::endl;
+
+        for (const std::pair<unsigned int, double> & entry : columns[i]) {
+            os << "    " << name << " " << this->getConstraintName(entry.first) << " " <<
+                entry.second << std::endl;
+        }
+    }
+
+    os << "RHS" << std::endl;
+
+    for (unsigned int i = 0; i < this->senses.size(); i++) {
+        if (this->rhs[i] != 0.0) {
+            os << "    rhs " << this->getConstraintName(i) << " " << this->rhs[i] << std::endl;
+        }
+    }
+
+    os << "BOUNDS" << std::endl;
+
+    for (unsigned int i = 0; i < this->types.size(); i++) {
+        std::string name = this->getVariableName(i);
+
+        if (this->types[i] == LinearModel::BINARY) {
+            os << " BV bnd " << name << std::endl;
+        } else {
+            if (this->lowerBounds[i] != 0.0) {
+                os << " LO bnd " << name << " " << this->lowerBounds[i] << std::endl;
+            }
+
+            os << " UP bnd " << name << " " << this->upperBounds[i] << std::endl;
+        }
+    }
+
+    os << "ENDATA" << std::endl;
+
+    os.precision(precision);
+}
+
+/*
+ * Write this model into the specified file, in the MPS format if its extension
+ * is .mps and in the LP format otherwise.
+ *
+ * @param filename the file to write into.
+ */
+void LinearModel::write(const std::string & filename) const {
+    std::ofstream ofs;
+
+    ofs.open(filename);
+
+    if (!ofs.is_open()) {
+        throw "File not created.";
+    }
+
+    if (filename.size() >= 4 && filename.compare(filename.size() - 4, 4, ".mps") == 0) {
+        this->writeMPS(ofs);
+    } else {
+        this->writeLP(ofs);
+    }
+
+    ofs.close();
+}
@@ -0,0 +1,266 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * The LinearModel class represents a mixed integer linear program stored row
+ * by row, independently of any MIP solver, so that it can be inspected,
+ * written in the LP or MPS formats and loaded into a solver in bulk.
+ */
+class LinearModel {
+    private:
+        /* The flag indicating whether the objective is maximized. */
+        bool isMaximization;
+
+        /* The lower bound of each variable. */
+        std::vector<double> lowerBounds;
+
+        /* The upper bound of each variable. */
+        std::vector<double> upperBounds;
+
+        /* The objective coefficient of each variable. */
+        std::vector<double> objective;
+
+        /* The type of each variable (BINARY or CONTINUOUS). */
+        std::vector<char> types;
+
+        /* The name of each variable; empty if the model is not named. */
+        std::vector<std::string> variablesNames;
+
+        /* The offset of each constraint's first coefficient. */
+        std::vector<unsigned int> constraintsOffsets;
+
+        /* The variable of each coefficient, constraint by constraint. */
+        std::vector<unsigned int> indices;
+
+        /* The coefficients, constraint by constraint. */
+        std::vector<double> coefficients;
+
+        /* The sense of each constraint (LESS_EQUAL, GREATER_EQUAL or EQUAL). */
+        std::vector<char> senses;
+
+        /* The right-hand side of each constraint. */
+        std::vector<double> rhs;
+
+        /* The name of each constraint; empty if the model is not named. */
+        std::vector<std::string> constraintsNames;
+
+        /*
+         * Returns the name of the specified variable, or a generated one.
+         *
+         * @param i the variable's index.
+         *
+         * @return the variable's name.
+         */
+        std::string getVariableName(unsigned int i) const;
+
+        /*
+         * Returns the name of the specified constraint, or a generated one.
+         *
+         * @param i the constraint's index.
+         *
+         * @return the constraint's name.
+         */
+        std::string getConstraintName(unsigned int i) const;
+
+    public:
+        /* Binary variable type constant. */
+        static const char BINARY;
+
+        /* Continuous variable type constant. */
+        static const char CONTINUOUS;
+
+        /* Less-than-or-equal constraint sense constant. */
+        static const char LESS_EQUAL;
+
+        /* Greater-than-or-equal constraint sense constant. */
+        static const char GREATER_EQUAL;
+
+        /* Equality constraint sense constant. */
+        static const char EQUAL;
+
+        /*
+         * Constructs a new empty model.
+         *
+         * @param isMaximization the flag indicating whether the objective is
+         *                       maximized.
+         */
+        LinearModel(bool isMaximization);
+
+        /*
+         * Constructs a new empty maximization model.
+         */
+        LinearModel();
+
+        /*
+         * Adds a variable to this model.
+         *
+         * @param lowerBound the variable's lower bound.
+         * @param upperBound the variable's upper bound.
+         * @param objective  the variable's objective coefficient.
+         * @param type       the variable's type (BINARY or CONTINUOUS).
+         * @param name       the variable's name; empty if not named.
+         *
+         * @return the variable's index.
+         */
+        unsigned int addVariable(double lowerBound, double upperBound,
+                double objective, char type, const std::string & name);
+
+        /*
+         * Adds a constraint to this model.
+         *
+         * @param indices      the constraint's variables.
+         * @param coefficients the constraint's coefficients.
+         * @param sense        the constraint's sense (LESS_EQUAL,
+         *                     GREATER_EQUAL or EQUAL).
+         * @param rhs          the constraint's right-hand side.
+         * @param name         the constraint's name; empty if not named.
+         *
+         * @return the constraint's index.
+         */
+        unsigned int addConstraint(const std::vector<unsigned int> & indices,
+                const std::vector<double> & coefficients, char sense, double rhs,
+                const std::string & name);
+
+        /*
+         * Verifies whether the objective is maximized.
+         *
+         * @return true if the objective is maximized; false otherwise.
+         */
+        bool getIsMaximization() const;
+
+        /*
+         * Returns the number of variables.
+         *
+         * @return the number of variables.
+         */
+        unsigned int getVariablesNumber() const;
+
+        /*
+         * Returns the number of constraints.
+         *
+         * @return the number of constraints.
+         */
+        unsigned int getConstraintsNumber() const;
+
+        /*
+         * Returns the number of nonzero coefficients in the constraints.
+         *
+         * @return the number of nonzero coefficients in the constraints.
+         */
+        unsigned int getNonZerosNumber() const;
+
+        /*
+         * Returns the lower bound of each variable.
+         *
+         * @return the lower bound of each variable.
+         */
+        const std::vector<double> & getLowerBounds() const;
+
+        /*
+         * Returns the upper bound of each variable.
+         *
+         * @return the upper bound of each variable.
+         */
+        const std::vector<double> & getUpperBounds() const;
+
+        /*
+         * Returns the objective coefficient of each variable.
+         *
+         * @return the objective coefficient of each variable.
+         */
+        const std::vector<double> & getObjective() const;
+
+        /*
+         * Returns the type of each variable.
+         *
+         * @return the type of each variable.
+         */
+        const std::vector<char> & getTypes() const;
+
+        /*
+         * Returns the name of each variable; empty if the model is not named.
+         *
+         * @return the name of each variable.
+         */
+        const std::vector<std::string> & getVariablesNames() const;
+
+        /*
+         * Returns the offset of each constraint's first coefficient, followed
+         * by the number of coefficients.
+         *
+         * @return the offset of each constraint's first coefficient.
+         */
+        const std::vector<unsigned int> & getConstraintsOffsets() const;
+
+        /*
+         * Returns the variable of each coefficient, constraint by constraint.
+         *
+         * @return the variable of each coefficient.
+         */
+        const std::vector<unsigned int> & getIndices() const;
+
+        /*
+         * Returns the coefficients, constraint by constraint.
+         *
+         * @return the coefficients.
+         */
+        const std::vector<double> & getCoefficients() const;
+
+        /*
+         * Returns the sense of each constraint.
+         *
+         * @return the sense of each constraint.
+         */
+        const std::vector<char> & getSenses() const;
+
+        /*
+         * Returns the right-hand side of each constraint.
+         *
+         * @return the right-hand side of each constraint.
+         */
+        const std::vector<double> & getRhs() const;
+
+        /*
+         * Returns the name of each constraint; empty if the model is not named.
+         *
+         * @return the name of each constraint.
+         */
+        const std::vector<std::string> & getConstraintsNames() const;
+
+        /*
+         * Returns the number of constraints violated by the specified point.
+         *
+         * @param point     the value of each variable.
+         * @param tolerance the violation tolerance.
+         *
+         * @return the number of constraints violated by the point.
+         */
+        unsigned int getViolatedConstraintsNumber(const std::vector<double> & point,
+                double tolerance) const;
+
+        /*
+         * Write this model into the specified output stream in the LP format.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeLP(std::ostream & os) const;
+
+        /*
+         * Write this model into the specified output stream in the free MPS
+         * format.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeMPS(std::ostream & os) const;
+
+        /*
+         * Write this model into the specified file, in the MPS format if its
+         * extension is .mps and in the LP format otherwise.
+         *
+         * @param filename the file to write into.
+         */
+        void write(const std::string & filename) const;
+};
@@ -10,6 +10,8 @@
 void Solution::init(const Instance & instance, const std::vector<std::set<Edge> > & districts) {
     this->instance = instance;
     this->districts = std::vector<std::set<Edge> > (this->instance.getM());
+    this->districtsBitsets = std::vector<Bitset> (this->instance.getM(),
+            Bitset(this->instance.getG().m()));
     this->edgesDistrict = std::vector<unsigned int> (
             this->instance.getG().m(), this->instance.getM());
     this->x = std::vector<std::vector<bool> > (this->instance.getG().m(), 
@@ -17,6 +19,7 @@ void Solution::init(const Instance & instance, const std::vector<std::set<Edge>
     this->districtsDemand = std::vector<double> (this->instance.getM(), 0.0);
     this->districtsValue = std::vector<double> (this->instance.getM(), 0.0);
     this->value = 0.0;
+    this->hash = 0;
 
     for (unsigned int j = 0; j < this->instance.getM(); j++) {
         for (const Edge & e : districts[j]) {
@@ -40,6 +43,8 @@ void Solution::init(const Instance & instance, const std::vector<std::set<Edge>
 void Solution::init(const Instance & instance, const std::vector<unsigned int> & edgesDistrict) {
     this->instance = instance;
     this->districts = std::vector<std::set<Edge> > (this->instance.getM());
+    this->districtsBitsets = std::vector<Bitset> (this->instance.getM(),
+            Bitset(this->instance.getG().m()));
     this->edgesDistrict = std::vector<unsigned int> (
             this->instance.getG().m(), this->instance.getM());
     this->x = std::vector<std::vector<bool> > (this->instance.getG().m(), 
@@ -47,6 +52,7 @@ void Solution::init(const Instance & instance, const std::vector<unsigned int> &
     this->districtsDemand = std::vector<double> (this->instance.getM(), 0.0);
     this->districtsValue = std::vector<double> (this->instance.getM(), 0.0);
     this->value = 0.0;
+    this->hash = 0;
 
     this->setEdgesDistrict(edgesDistrict);
 }
@@ -60,6 +66,8 @@ void Solution::init(const Instance & instance, const std::vector<unsigned int> &
 void Solution::init(const Instance & instance, const std::vector<std::vector<bool> > & x) {
     this->instance = instance;
     this->districts = std::vector<std::set<Edge> > (this->instance.getM());
+    this->districtsBitsets = std::vector<Bitset> (this->instance.getM(),
+            Bitset(this->instance.getG().m()));
     this->edgesDistrict = std::vector<unsigned int> (
             this->instance.getG().m(), this->instance.getM());
     this->x = std::vector<std::vector<bool> > (this->instance.getG().m(), 
@@ -67,6 +75,7 @@ void Solution::init(const Instance & instance, const std::vector<std::vector<boo
     this->districtsDemand = std::vector<double> (this->instance.getM(), 0.0);
     this->districtsValue = std::vector<double> (this->instance.getM(), 0.0);
     this->value = 0.0;
+    this->hash = 0;
 
     for (unsigned int eId = 1; eId <= x.size(); eId++) {
         for (unsigned int j = 0; j < this->instance.getM(); j++) {
@@ -211,7 +220,7 @@ bool Solution::isEmpty() const {
  *
  * @return this solution's instance.
  */
-Instance Solution::getInstance() const {
+const Instance & Solution::getInstance() const {
     return this->instance;
 }
 
@@ -269,7 +278,9 @@ void Solution::setDistricts(const std::vector<std::set<Edge> > & districts) {
  */
 void Solution::unsetDistrict(unsigned int j) {
     if (j < this->instance.getM()) {
-        for (const Edge & e : this->districts[j]) {
+        std::set<Edge> district = this->districts[j];
+
+        for (const Edge & e : district) {
             this->unsetEdgeDistrict(e);
         }
     }
@@ -324,13 +335,16 @@ void Solution::setEdgeDistrict(unsigned int eId, unsigned int j) {
 
         if (k < this->instance.getM()) {
             this->districts[k].erase(e);
+            this->districtsBitsets[k].reset(eId - 1);
             this->x[eId - 1][k] = false;
             this->districtsDemand[k] -= 2 * e.w;
             this->districtsValue[k] -= this->instance.getC(eId, k);
             this->value -= this->instance.getC(eId, k);
+            this->hash ^= this->instance.getZobristKey(eId, k);
         }
 
         this->districts[j].insert(e);
+        this->districtsBitsets[j].set(eId - 1);
         this->edgesDistrict[eId - 1] = j;
         this->x[eId - 1][j] = true;
         this->unallocatedEdges.erase(e);
@@ -338,6 +352,7 @@ void Solution::setEdgeDistrict(unsigned int eId, unsigned int j) {
         this->districtsDemand[j] += 2 * e.w;
         this->districtsValue[j] += this->instance.getC(eId, j);
         this->value += this->instance.getC(eId, j);
+        this->hash ^= this->instance.getZobristKey(eId, j);
     }
 }
 
@@ -366,15 +381,21 @@ void Solution::setEdgesDistrict(const std::set<Edge> edges, unsigned int j) {
 }
 
 /*
- * Sets the district of each edge.
+ * Sets the district of each edge, unsetting the edges whose district is m and
+ * leaving the edges already in their district untouched.
  *
  * @param edgesDistrict the district of each edge.
  */
 void Solution::setEdgesDistrict(const std::vector<unsigned int> & edgesDistrict) {
     for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
         unsigned int j = edgesDistrict[eId - 1];
+        unsigned int k = this->getEdgeDistrict(eId);
 
-        this->setEdgeDistrict(eId, j);
+        if (j < this->instance.getM() && j != k) {
+            this->setEdgeDistrict(eId, j);
+        } else if (j >= this->instance.getM() && k < this->instance.getM()) {
+            this->unsetEdgeDistrict(eId);
+        }
     }
 }
 
@@ -386,19 +407,20 @@ void Solution::setEdgesDistrict(const std::vector<unsigned int> & edgesDistrict)
 void Solution::unsetEdgeDistrict(unsigned int eId) {
     if (eId >= 1 && eId <= this->instance.getG().m()) {
         Edge e = this->instance.getG().getEdgeById(eId);
+        unsigned int k = this->edgesDistrict[eId - 1];
 
         this->edgesDistrict[eId - 1] = this->instance.getM();
         this->unallocatedEdges.insert(e);
         this->allocatedEdges.erase(e);
 
-        unsigned int k = this->edgesDistrict[eId - 1];
-
         if (k < this->instance.getM()) {
             this->districts[k].erase(e);
+            this->districtsBitsets[k].reset(eId - 1);
             this->x[eId - 1][k] = false;
             this->districtsDemand[k] -= 2 * e.w;
             this->districtsValue[k] -= this->instance.getC(eId, k);
             this->value -= this->instance.getC(eId, k);
+            this->hash ^= this->instance.getZobristKey(eId, k);
         }
     }
 }
@@ -530,6 +552,16 @@ double Solution::getValue() const {
     return this->value;
 }
 
+/*
+ * Returns this solution's Zobrist hash, the exclusive or of the keys of its
+ * pairs (edge, district).
+ *
+ * @return this solution's Zobrist hash.
+ */
+unsigned long long Solution::getHash() const {
+    return this->hash;
+}
+
 /*
  * Verifies whether the edges of this solution's instance are allocated to
  * exactly one distrist in this solution.
@@ -537,8 +569,8 @@ double Solution::getValue() const {
  * @return true if all the edges are allocated to exactly one district; false otherwise.
  */
 bool Solution::isPartition() const {
-    for (const Edge & e : this->instance.getG().getEdges()) {
-        if (this->getEdgeDistrict(e) >= this->instance.getM()) {
+    for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+        if (this->getEdgeDistrict(eId) >= this->instance.getM()) {
             return false;
         }
     }
@@ -552,10 +584,38 @@ bool Solution::isPartition() const {
  * @return true if all districts are connected; false otherwise.
  */
 bool Solution::isConnected() const {
+    Bitset visited (this->instance.getG().m());
+    std::vector<unsigned int> Q;
+
     /* ∀ E_{j} ∈ ℰ */
-    for (const std::set<Edge> & district : this->districts) {
-        /* if G[E_{j}] is not connected */
-        if (!this->instance.getG().getInducedSubGraph(district).isConnected()) {
+    for (const Bitset & district : this->districtsBitsets) {
+        unsigned int sId = district.findNext(0) + 1;
+
+        if (sId > district.size()) {
+            continue;
+        }
+
+        /* The edges of E_{j} reachable from the first one through adjacent edges of E_{j} */
+        visited.clear();
+        visited.set(sId - 1);
+        Q.clear();
+        Q.push_back(sId);
+
+        for (unsigned int i = 0; i < Q.size(); i++) {
+            unsigned int eId = Q[i];
+
+            for (std::vector<unsigned int>::const_iterator fIdIt = 
+                    this->instance.getAdjacentEdgesIdsBegin(eId); 
+                    fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+                if (district.test(*fIdIt - 1) && !visited.test(*fIdIt - 1)) {
+                    visited.set(*fIdIt - 1);
+                    Q.push_back(*fIdIt);
+                }
+            }
+        }
+
+        /* if G[E_{j}] is not connected: E_{j} \ visited ≠ ∅ */
+        if (district.countAndNot(visited) > 0) {
             return false;
         }
     }
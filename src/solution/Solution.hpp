@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../bitset/Bitset.hpp"
 #include "../instance/Instance.hpp"
 
 /*
@@ -13,6 +14,9 @@ class Solution {
         /* This solution's districts. */
         std::vector<std::set<Edge> > districts;
 
+        /* This solution's edges of each district, as bitsets over the edges' ids. */
+        std::vector<Bitset> districtsBitsets;
+
         /* This solution's district of each edge. */
         std::vector<unsigned int> edgesDistrict;
 
@@ -34,6 +38,9 @@ class Solution {
         /* This solution's value. */
         double value;
 
+        /* This solution's Zobrist hash over its pairs (edge, district). */
+        unsigned long long hash;
+
         /*
          * Initializes a new solution.
          *
@@ -139,7 +146,7 @@ class Solution {
          *
          * @return this solution's instance.
          */
-        Instance getInstance() const;
+        const Instance & getInstance() const;
 
         /*
          * Returns this solution's districts.
@@ -229,7 +236,8 @@ class Solution {
         void setEdgesDistrict(const std::set<Edge> edges, unsigned int j);
 
         /*
-         * Sets the district of each edge.
+         * Sets the district of each edge, unsetting the edges whose district
+         * is m and leaving the edges already in their district untouched.
          *
          * @param edgesDistrict the district of each edge.
          */
@@ -333,6 +341,14 @@ class Solution {
          */
         double getValue() const;
 
+        /*
+         * Returns this solution's Zobrist hash, the exclusive or of the keys
+         * of its pairs (edge, district).
+         *
+         * @return this solution's Zobrist hash.
+         */
+        unsigned long long getHash() const;
+
         /*
          * Verifies whether the edges of this solution's instance are allocated 
          * to exactly one distrist in this solution.
@@ -0,0 +1,90 @@
+#include "IncumbentChannel.hpp"
+
+/*
+ * Constructs a new empty channel.
+ */
+IncumbentChannel::IncumbentChannel() : value(-1.0), version(0), isClosed(false) {}
+
+/*
+ * Offers the specified solution, which becomes the incumbent if it is
+ * feasible and better than the current one.
+ *
+ * @param solution the solution.
+ *
+ * @return the new incumbent's version if the solution was accepted; 0
+ *         otherwise.
+ */
+unsigned long long IncumbentChannel::offer(const Solution & solution) {
+    /* Worse solutions are discarded before the costlier feasibility check */
+    if (solution.isEmpty() || solution.getValue() <= this->value ||
+            !solution.isFeasible()) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock (this->mutex);
+
+    if (solution.getValue() <= this->value) {
+        return 0;
+    }
+
+    this->incumbent = solution;
+    this->value = solution.getValue();
+
+    return ++this->version;
+}
+
+/*
+ * Retrieves the incumbent if it is newer than the specified version.
+ *
+ * @param version  the version of the last incumbent seen, updated to the
+ *                 retrieved one's.
+ * @param solution the retrieved incumbent.
+ *
+ * @return true if a newer incumbent was retrieved; false otherwise.
+ */
+bool IncumbentChannel::poll(unsigned long long & version, Solution & solution) const {
+    if (this->version <= version) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock (this->mutex);
+
+    solution = this->incumbent;
+    version = this->version;
+
+    return true;
+}
+
+/*
+ * Returns the incumbent's value.
+ *
+ * @return the incumbent's value; negative if there is no incumbent.
+ */
+double IncumbentChannel::getValue() const {
+    return this->value;
+}
+
+/*
+ * Returns the number of incumbents offered so far.
+ *
+ * @return the number of incumbents offered so far.
+ */
+unsigned long long IncumbentChannel::getVersion() const {
+    return this->version;
+}
+
+/*
+ * Requests the concurrent solvers to stop.
+ */
+void IncumbentChannel::close() {
+    this->isClosed = true;
+}
+
+/*
+ * Verifies whether the concurrent solvers must stop.
+ *
+ * @return true if the solvers must stop; false otherwise.
+ */
+bool IncumbentChannel::getIsClosed() const {
+    return this->isClosed;
+}
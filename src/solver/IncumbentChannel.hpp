@@ -0,0 +1,87 @@
+#pragma once
+
+#include "../solution/Solution.hpp"
+#include <atomic>
+#include <mutex>
+
+/*
+ * The IncumbentChannel class represents the best feasible solution shared by
+ * solvers running concurrently, such as GRASP workers and an exact search.
+ * Each solver offers the solutions it improves and polls the ones offered by
+ * the others, remembering the version of the last one it has seen.
+ */
+class IncumbentChannel {
+    private:
+        /* The mutex guarding the incumbent. */
+        mutable std::mutex mutex;
+
+        /* The best solution offered so far. */
+        Solution incumbent;
+
+        /* The incumbent's value; negative while there is no incumbent. */
+        std::atomic<double> value;
+
+        /* The number of incumbents offered so far. */
+        std::atomic<unsigned long long> version;
+
+        /* The flag indicating whether the concurrent solvers must stop. */
+        std::atomic<bool> isClosed;
+
+    public:
+        /*
+         * Constructs a new empty channel.
+         */
+        IncumbentChannel();
+
+        IncumbentChannel(const IncumbentChannel &) = delete;
+
+        IncumbentChannel & operator = (const IncumbentChannel &) = delete;
+
+        /*
+         * Offers the specified solution, which becomes the incumbent if it is
+         * feasible and better than the current one.
+         *
+         * @param solution the solution.
+         *
+         * @return the new incumbent's version if the solution was accepted;
+         *         0 otherwise.
+         */
+        unsigned long long offer(const Solution & solution);
+
+        /*
+         * Retrieves the incumbent if it is newer than the specified version.
+         *
+         * @param version  the version of the last incumbent seen, updated to
+         *                 the retrieved one's.
+         * @param solution the retrieved incumbent.
+         *
+         * @return true if a newer incumbent was retrieved; false otherwise.
+         */
+        bool poll(unsigned long long & version, Solution & solution) const;
+
+        /*
+         * Returns the incumbent's value.
+         *
+         * @return the incumbent's value; negative if there is no incumbent.
+         */
+        double getValue() const;
+
+        /*
+         * Returns the number of incumbents offered so far.
+         *
+         * @return the number of incumbents offered so far.
+         */
+        unsigned long long getVersion() const;
+
+        /*
+         * Requests the concurrent solvers to stop.
+         */
+        void close();
+
+        /*
+         * Verifies whether the concurrent solvers must stop.
+         *
+         * @return true if the solvers must stop; false otherwise.
+         */
+        bool getIsClosed() const;
+};
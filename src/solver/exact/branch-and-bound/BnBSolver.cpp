@@ -1,7 +1,12 @@
 #include "BnBSolver.hpp"
-#include "../../metaheuristic/grasp/GRASPSolver.hpp"
+#include "../../metaheuristic/grasp/GRASPWorkers.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
+#include "BnBSolverCallback.hpp"
+#include "LGFFModel.hpp"
 #include "gurobi_c++.h"
 #include <algorithm>
+#include <fstream>
+#include <sstream>
 
 /*
  * Constructs a new solver.
@@ -31,12 +36,17 @@ BnBSolver::BnBSolver(const Instance & instance,
       warmStartPercentageTime(warmStartPercentageTime),
       m(m),
       k(k),
-      statisticalFilter(statisticalFilter) {}
+      statisticalFilter(statisticalFilter),
+      checkpointInterval(60),
+      isCompactModel(false),
+      isNamedModel(false),
+      graspThreadsNumber(0) {}
 
 /*
  * Constructs a new empty solver.
  */
-BnBSolver::BnBSolver() : CEDPSolver::CEDPSolver() {}
+BnBSolver::BnBSolver() : CEDPSolver::CEDPSolver(), checkpointInterval(60),
+    isCompactModel(false), isNamedModel(false), graspThreadsNumber(0) {}
 
 /*
  * Returns the percentage of time to find a warm start solution.
@@ -75,16 +85,123 @@ bool BnBSolver::getStatisticalFilter() const {
     return this->statisticalFilter;
 }
 
+/*
+ * Makes this solver write its incumbent into the specified file once its warm
+ * start finishes, and its GRASP write its state every specified number of
+ * seconds.
+ *
+ * @param filename the file to write into; an empty name disables checkpoints.
+ * @param interval the time in seconds between each checkpoint of the GRASP.
+ */
+void BnBSolver::setCheckpoint(const std::string & filename, unsigned int interval) {
+    this->checkpointFilename = filename;
+    this->checkpointInterval = interval;
+}
+
+/*
+ * Sets how this solver assembles its model and where it exports it.
+ *
+ * @param isCompact the flag indicating whether the rows enforcing the root of
+ *                  each district are aggregated.
+ * @param isNamed   the flag indicating whether the variables and the
+ *                  constraints are named.
+ * @param filename  the LP or MPS file into which the model is written before
+ *                  solving; an empty name disables the export.
+ */
+void BnBSolver::setModel(bool isCompact, bool isNamed, const std::string & filename) {
+    this->isCompactModel = isCompact;
+    this->isNamedModel = isNamed;
+    this->modelFilename = filename;
+}
+
+/*
+ * Sets the number of GRASP threads feeding the search with incumbents while it
+ * runs, which in turn restart from the search's.
+ *
+ * @param graspThreadsNumber the number of GRASP threads; zero if the GRASP
+ *                           only runs as a warm start.
+ */
+void BnBSolver::setConcurrentGRASP(unsigned int graspThreadsNumber) {
+    this->graspThreadsNumber = graspThreadsNumber;
+}
+
+/*
+ * Makes the next call to solve continue the interrupted run whose checkpoint
+ * is in the specified file, either inside its warm start or with its
+ * incumbent.
+ *
+ * @param filename the file to read from.
+ */
+void BnBSolver::resume(const std::string & filename) {
+    this->resumeFilename = filename;
+}
+
+/*
+ * Writes this solver's incumbent into the specified output stream, in the
+ * format of a checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void BnBSolver::writeCheckpoint(std::ostream & os) const {
+    unsigned long long elapsedTime = 
+        std::chrono::duration_cast<std::chrono::milliseconds> (
+                std::chrono::steady_clock::now() - this->startTime).count();
+
+    Checkpoint::writeHeader(os, Checkpoint::EXACT, this->instance);
+    Checkpoint::write(os, elapsedTime);
+    Checkpoint::write(os, this->solutionsCounter);
+    Checkpoint::write(os, this->bestPrimalBound);
+    Checkpoint::write(os, this->bestPrimalSolution);
+}
+
+/*
+ * Writes this solver's state into a checkpoint handed to the specified writer,
+ * which writes it into the disk in background.
+ *
+ * @param checkpointWriter the checkpoint writer.
+ */
+void BnBSolver::submitCheckpoint(CheckpointWriter & checkpointWriter) const {
+    std::stringstream ss;
+
+    this->writeCheckpoint(ss);
+    checkpointWriter.submit(ss.str());
+}
+
 /*
  * Solve this solver's instance.
  */
 void BnBSolver::solve() {
     this->startTime = std::chrono::steady_clock::now();
 
+    unsigned int checkpointKind = Checkpoint::GRASP;
+
+    if (!this->resumeFilename.empty()) {
+        std::ifstream ifs (this->resumeFilename, std::ios::binary);
+        unsigned long long resumedTime = 0;
+
+        if (!ifs.is_open()) {
+            throw "File not found.";
+        }
+
+        /* Both kinds of checkpoint begin with the time elapsed in the interrupted run */
+        checkpointKind = Checkpoint::readHeader(ifs, this->instance);
+        Checkpoint::read(ifs, resumedTime);
+        this->startTime -= std::chrono::milliseconds(resumedTime);
+
+        if (checkpointKind == Checkpoint::EXACT) {
+            Checkpoint::read(ifs, this->solutionsCounter);
+            Checkpoint::read(ifs, this->bestPrimalBound);
+            this->bestPrimalSolution = Checkpoint::readSolution(ifs, this->instance);
+        }
+
+        ifs.close();
+    }
+
     unsigned int graspTimeLimit =
         round(this->warmStartPercentageTime*this->timeLimit);
 
-    if (graspTimeLimit > 0) {
+    /* The warm start is skipped if the interrupted run had already finished it */
+    if (graspTimeLimit > 0 && checkpointKind == Checkpoint::GRASP) {
         GRASPSolver solver(this->instance,
                            round(this->warmStartPercentageTime*this->timeLimit),
                            this->seed,
@@ -92,6 +209,12 @@ void BnBSolver::solve() {
                            this->k,
                            this->statisticalFilter);
 
+        solver.setCheckpoint(this->checkpointFilename, this->checkpointInterval);
+
+        if (!this->resumeFilename.empty()) {
+            solver.resume(this->resumeFilename);
+        }
+
         solver.solve();
 
         this->bestPrimalSolution = solver.getBestPrimalSolution();
@@ -102,382 +225,101 @@ void BnBSolver::solve() {
         }
     }
 
-    GRBEnv * env = 0;
-
-    try {
-        env = new GRBEnv();
-        GRBModel model = GRBModel(* env);
-
-        std::vector<std::vector<GRBVar> > x (this->instance.getLG().n(), 
-                std::vector<GRBVar> (this->instance.getM()));
-        std::vector<std::vector<GRBVar> > y (this->instance.getLG().n(), 
-                std::vector<GRBVar> (this->instance.getM()));
-        std::vector<std::vector<GRBVar> > z (
-                2 * this->instance.getGPrime().m(), 
-                std::vector<GRBVar> (this->instance.getM()));
-
-        std::set<Vertex> vertices = this->instance.getLG().getVertices();
+    CheckpointWriter checkpointWriter (this->checkpointFilename);
 
-        /* ∀ e ∈ U′ */
-        for (const Vertex & e : vertices) {
-            unsigned int eId = this->instance.getLG().getVertexId(e);
-
-            /* ∀ j ∈ {1, ..., m} */
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                unsigned int obj = this->instance.getC(eId, j);
-
-                /* x_{e, j} ∈ {0, 1} */
-                x[eId - 1][j] = model.addVar(0.0, 1.0, obj, GRB_BINARY, "x_" + 
-                        std::to_string(eId - 1) + "_" + std::to_string(j));
-            }
-        }
+    if (checkpointWriter.isEnabled()) {
+        this->submitCheckpoint(checkpointWriter);
+    }
 
-        /* ∀ {e′, e} ∈ A′\A */
-        for (const Vertex & e : vertices) {
-            unsigned int eId = this->instance.getLG().getVertexId(e);
+    LGFFModel lgffModel (this->instance, this->isCompactModel, this->isNamedModel);
 
-            /* ∀ j ∈ {1, ..., m} */
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                /* y_{{e′, e}, j} ∈ {0, 1} */
-                y[eId - 1][j] = model.addVar(0.0, 1.0, 0.0, GRB_BINARY, "x_" + 
-                        std::to_string(eId - 1) + "_" + std::to_string(j));
-            }
-        }
+    /* The model is exported before any license is required */
+    if (!this->modelFilename.empty()) {
+        lgffModel.write(this->modelFilename);
+    }
 
-        /* ∀ {e, f} ∈ A′ */
-        for (const Edge & ef : this->instance.getGPrime().getEdges()) {
-            unsigned int efId = this->instance.getGPrime().getEdgeId(ef);
+    IncumbentChannel incumbentChannel;
+    GRASPWorkers graspWorkers (this->instance, this->seed + 1, this->m, this->k,
+            this->statisticalFilter, this->graspThreadsNumber, incumbentChannel);
+    GRBEnv * env = 0;
+    GRBVar * vars = 0;
 
-            /* ∀ j ∈ {1, ..., m} */
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                /* y_{e, f, j} ∈ [0, |U|] */
-                z[efId - 1][j] = model.addVar(0.0, this->instance.getLG().n(), 
-                        0.0, GRB_CONTINUOUS, "y_" + std::to_string(efId - 1) + 
-                        "_" + std::to_string(j));
-
-                /* y_{f, e, j} ∈ [0, |U|] */
-                z[this->instance.getGPrime().m() + efId - 1][j] = model.addVar(
-                        0.0, this->instance.getLG().n(), 0.0, GRB_CONTINUOUS, 
-                        "y_" + std::to_string(this->instance.getGPrime().m() + 
-                            efId - 1) + "_" + std::to_string(j));
-            }
-        }
+    try {
+        env = new GRBEnv();
+        GRBModel model = GRBModel(* env);
 
-        model.update();
+        vars = model.addVars(lgffModel.getLowerBounds().data(),
+                lgffModel.getUpperBounds().data(), lgffModel.getObjective().data(),
+                lgffModel.getTypes().data(), lgffModel.getVariablesNames().empty() ?
+                NULL : lgffModel.getVariablesNames().data(),
+                lgffModel.getVariablesNumber());
 
         /* obj = ∑_{e ∈ U}{∑_{j = 1}^{m}{c_{e, j} * x_{e, j}}} */
         model.set(GRB_IntAttr_ModelSense, GRB_MAXIMIZE);
 
-        /* ∀ e ∈ U */
-        for (const Vertex & e : vertices) {
-            unsigned int eId = this->instance.getLG().getVertexId(e);
+        const std::vector<unsigned int> & offsets = lgffModel.getConstraintsOffsets();
+        const std::vector<unsigned int> & indices = lgffModel.getIndices();
+        const std::vector<double> & coefficients = lgffModel.getCoefficients();
+        std::vector<GRBVar> rowVars;
 
-            /* ∑_{j = 1}^{m}{x_{e, j}} = 1 */
-            GRBLinExpr constr01 = 0.0;
+        /* Each row is built in bulk from the model's coefficients */
+        for (unsigned int i = 0; i < lgffModel.getConstraintsNumber(); i++) {
+            GRBLinExpr constr = 0.0;
 
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                constr01 += x[eId - 1][j];
-            }
-
-            model.addConstr(constr01 == 1, "c_01_" + std::to_string(eId - 1));
-        }
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /*
-             * 2 * ∑_{e ∈ U}{d_{e} * x_{e, j}} <= 
-             * min{D, ((2 * (1 + B)) / m) * ∑_{e ∈ U}{d_{e}}
-             */
-            GRBLinExpr constr02 = 0.0;
+            rowVars.clear();
 
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                constr02 += 2.0 * e.w * x[eId - 1][j];
+            for (unsigned int k = offsets[i]; k < offsets[i + 1]; k++) {
+                rowVars.push_back(vars[indices[k]]);
             }
 
-            double rhs = this->instance.getMaximumDemand();
+            constr.addTerms(coefficients.data() + offsets[i], rowVars.data(),
+                    rowVars.size());
 
-            model.addConstr(constr02 <= rhs, "c_02_" + std::to_string(j));
+            model.addConstr(constr, lgffModel.getSenses()[i], lgffModel.getRhs()[i],
+                    lgffModel.getConstraintsNames().empty() ? "" :
+                    lgffModel.getConstraintsNames()[i]);
         }
 
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* 
-             * 2 * ∑_{e ∈ U}{d_{e} * x_{e, j}} >= 
-             * ((2 * (1 - B)) / m) * ∑_{e ∈ U}{d_{e}}
-             */
-            GRBLinExpr constr03 = 0.0;
-
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                constr03 += 2.0 * e.w * x[eId - 1][j];
-            }
-
-            double rhs = this->instance.getMinimumDemand();
-
-            model.addConstr(constr03 >= rhs, "c_03_" + std::to_string(j));
-        }
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∑_{e ∈  U}{y_{{e′, e}, j}} = 1 */
-            GRBLinExpr constr04 = 0.0;
-
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                constr04 += y[eId - 1][j];
-            }
-
-            model.addConstr(constr04 == 1, "c_04_" + std::to_string(j));
-        }
-
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∀ e ∈ U */
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                /* x_{e, j} - y_{{e′, e}, j} >= 0 */
-                GRBLinExpr constr05 = x[eId - 1][j] - y[eId - 1][j];
-                model.addConstr(constr05 >= 0.0, "c_05_" + 
-                        std::to_string(eId) + "_" + std::to_string(j));
-            }
-        }
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∀ e ∈ U */
-            for (std::set<Vertex>::iterator eIt = vertices.begin(); 
-                    eIt != vertices.end(); eIt++) {
-                unsigned int eId = this->instance.getLG().getVertexId(*eIt);
-
-                /* ∀ f ∈ U, f > e */
-                for (std::set<Vertex>::iterator fIt = std::next(eIt); 
-                        fIt != vertices.end(); fIt++) {
-                    unsigned int fId = 
-                        this->instance.getLG().getVertexId(*fIt);
-
-                    GRBLinExpr constr06 = x[eId - 1][j] - y[eId - 1][j] + 
-                        y[fId - 1][j];
-                    model.addConstr(constr06 <= 1.0, "c_06_" + 
-                            std::to_string(fId) + "_" + std::to_string(eId) + 
-                            "_" + std::to_string(j));
-                }
-            }
-        }
-
-        /* ∑_{j = 1}^{m}{∑_{e ∈ U}{z_{e′, e, j}}} = |U| */
-        GRBLinExpr constr07 = 0.0;
-
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            for (const Edge & ePrimeE : 
-                    this->instance.getGPrime().getIncidentEdges(
-                        this->instance.getEPrime())) {
-                unsigned int ePrimeEId = 
-                    this->instance.getGPrime().getEdgeId(ePrimeE);
-                Vertex e = ePrimeE.u;
-
-                if (e == this->instance.getEPrime()) {
-                    e = e.v;
-                }
-
-                if (this->instance.getEPrime() < e) {
-                    constr07 += z[ePrimeEId - 1][j];
-                } else {
-                    constr07 += z[this->instance.getGPrime().m() + ePrimeEId - 1][j];
-                }
-            }
-        }
-
-        model.addConstr(constr07 == this->instance.getLG().n(), "c_07");
-
-        unsigned int M = 0;
-        double sumD = 0;
-        std::vector<Vertex> verticesVector (vertices.begin(), vertices.end());
-        std::sort(verticesVector.begin(), verticesVector.end(), 
-                Vertex::weightComparator);
-
-        for (M = 0; M < verticesVector.size() && 
-                sumD < this->instance.getMaximumDemand(); M++) {
-            sumD += verticesVector[M].w;
-        }
-
-        while (sumD > this->instance.getMaximumDemand()) {
-            M--;
-            sumD -= verticesVector[M].w;
-        }
-
-        if (M >= verticesVector.size()) {
-            M--;
-        }
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-                unsigned int ePrimeEId = this->instance.getGPrime().getEdgeId(
-                        this->instance.getEPrime(), e);
-
-                /* z_{e′, e, j} - |U| y_{{e′, e}, j} <= 0 */
-                GRBLinExpr constr08 = 0.0;
-
-                if (e > this->instance.getEPrime()) {
-                    constr08 += z[ePrimeEId - 1][j];
-                } else {
-                    constr08 += z[this->instance.getGPrime().m() + ePrimeEId - 1][j];
-                }
-
-                constr08 -= M * y[eId - 1][j];
-
-                model.addConstr(constr08 <= 0, "c_08_" + std::to_string(eId) 
-                        + "_" + std::to_string(j));
-            }
-        }
-
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∀ e ∈ U */
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                /* ∀ {e, f} ∈ σ_{L(G)}({e}) */
-                for (const Edge & ef : this->instance.getLG().getIncidentEdges(e)) {
-                    unsigned int efId = this->instance.getLG().getEdgeId(ef);
-                    Vertex f = ef.u;
-
-                    if (f == e) {
-                        f = ef.v;
-                    }
-
-                    unsigned int fId = this->instance.getLG().getVertexId(f);
-
-                    /* z_{e, f, j} - |U| * x_{e, j} <= 0 */
-                    GRBLinExpr constr09 = 0.0;
-
-                    if (e < f) {
-                        constr09 += z[efId - 1][j];
-                    } else {
-                        constr09 += z[this->instance.getGPrime().m() + efId - 1][j];
-                    }
-
-                    constr09 -= M * x[eId - 1][j];
-
-                    model.addConstr(constr09 <= 0, "c_09_" + 
-                            std::to_string(fId) + "_" + std::to_string(eId) + 
-                            "_" + std::to_string(j));
-                }
+        for (unsigned int eId = 1; eId <= this->instance.getLG().n(); eId++) {
+            for (unsigned int j = 0; j < this->instance.getM(); j++) {
+                vars[lgffModel.getX(eId, j)].set(GRB_DoubleAttr_Start, 0.0);
             }
         }
 
-        /* ∀ j ∈ {1, ..., m} */
         for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∀ e ∈ U */
-            for (const Vertex & e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-
-                /* ∀ {e, f} ∈ σ_{L(G)}({e}) */
-                for (const Edge & ef : this->instance.getLG().getIncidentEdges(e)) {
-                    unsigned int efId = this->instance.getLG().getEdgeId(ef);
-                    Vertex f = ef.u;
-
-                    if (f == e) {
-                        f = ef.v;
-                    }
-
-                    unsigned int fId = this->instance.getLG().getVertexId(f);
-
-                    /* z_{f, e, j} - |U| * x_{e, j} <= 0 */
-                    GRBLinExpr constr10 = 0.0;
-
-                    if (f < e) {
-                        constr10 += z[efId - 1][j];
-                    } else {
-                        constr10 += z[this->instance.getGPrime().m() + efId - 1][j];
-                    }
-
-                    constr10 -= M * x[eId - 1][j];
+            for (const Edge & e : this->bestPrimalSolution.getDistrict(j)) {
+                unsigned int eId = this->instance.getG().getEdgeId(e);
 
-                    model.addConstr(constr10 <= 0, "c_10_" + 
-                            std::to_string(eId) + "_" + std::to_string(fId) + 
-                            "_" + std::to_string(j));
-                }
+                vars[lgffModel.getX(eId, j)].set(GRB_DoubleAttr_Start, 1.0);
             }
         }
 
-        /* ∀ j ∈ {1, ..., m} */
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            /* ∀ e ∈ U */
-            for (Vertex e : vertices) {
-                unsigned int eId = this->instance.getLG().getVertexId(e);
-                /*
-                 * ∑_{f ∈ σ_{G′}(e)}{z_{e, f, j}} - 
-                 * ∑_{f ∈ σ_{G′}(e)}{y_{f, e, j}} + x_{e, j} = 0 
-                 */
-                GRBLinExpr constr11 = 0.0;
-
-                for (const Edge & ef : this->instance.getGPrime().getIncidentEdges(e)) {
-                    unsigned int efId = this->instance.getGPrime().getEdgeId(ef);
-                    Vertex f = ef.u;
-
-                    if (f == e) {
-                        f = ef.v;
-                    }
-
-                    if (f < e) {
-                        constr11 -= z[efId - 1][j];
-                    } else {
-                        constr11 -= z[this->instance.getGPrime().m() + efId - 1][j];
-                    }
-                }
-
-                for (const Edge & ef : this->instance.getGPrime().getIncidentEdges(e)) {
-                    unsigned int efId = this->instance.getGPrime().getEdgeId(ef);
-                    Vertex f = ef.u;
-
-                    if (f == e) {
-                        f = ef.v;
-                    }
-
-                    if (e < f) {
-                        constr11 += z[efId - 1][j];
-                    } else {
-                        constr11 += z[this->instance.getGPrime().m() + efId - 1][j];
-                    }
-                }
-
-                constr11 += x[eId - 1][j];
+        unsigned int elapsedTime = this->getElapsedTime();
+        unsigned int remainingTime = 0;
 
-                model.addConstr(constr11 == 0, "c_11_" +  std::to_string(eId) 
-                        + "_" + std::to_string(j));
-            }
+        if (this->timeLimit > elapsedTime) {
+            remainingTime = this->timeLimit - elapsedTime;
         }
 
-        for (const Vertex & e : vertices) {
-            unsigned int eId = this->instance.getLG().getVertexId(e);
+        std::vector<std::vector<GRBVar> > x (this->instance.getG().m(),
+                std::vector<GRBVar> (this->instance.getM()));
 
+        for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
             for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                x[eId - 1][j].set(GRB_DoubleAttr_Start, 0.0);
+                x[eId - 1][j] = vars[lgffModel.getX(eId, j)];
             }
         }
 
+        BnBSolverCallback callback (this->instance, x, incumbentChannel);
 
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            for (const Edge & e : this->bestPrimalSolution.getDistrict(j)) {
-                unsigned int eId = this->instance.getG().getEdgeId(e);
-
-                x[eId - 1][j].set(GRB_DoubleAttr_Start, 1.0);
+        /* The GRASP keeps running next to the search, each feeding the other's incumbent */
+        if (this->graspThreadsNumber > 0) {
+            if (this->solutionsCounter > 0) {
+                incumbentChannel.offer(this->bestPrimalSolution);
             }
-        }
-
-        unsigned int elapsedTime = this->getElapsedTime();
-        unsigned int remainingTime = 0;
 
-        if (this->timeLimit > elapsedTime) {
-            remainingTime = this->timeLimit - elapsedTime;
+            model.setCallback(&callback);
+            graspWorkers.start(remainingTime);
         }
 
         model.set(GRB_DoubleParam_TimeLimit, ((double) remainingTime));
@@ -488,6 +330,8 @@ void BnBSolver::solve() {
 
         model.optimize();
 
+        graspWorkers.stop();
+
         this->bestDualBound = model.get(GRB_DoubleAttr_ObjBound);
 
         if (model.get(GRB_IntAttr_SolCount) > 0) {
@@ -497,7 +341,7 @@ void BnBSolver::solve() {
                 for (const Edge & e : this->instance.getG().getEdges()) {
                     unsigned int eId = this->instance.getG().getEdgeId(e);
 
-                    if (x[eId - 1][j].get(GRB_DoubleAttr_X) >= 0.5) {
+                    if (vars[lgffModel.getX(eId, j)].get(GRB_DoubleAttr_X) >= 0.5) {
                         districts[j].insert(e);
                     }
                 }
@@ -521,6 +365,28 @@ void BnBSolver::solve() {
         std::cerr << "Error during optimization" << std::endl;
     }
 
+    delete[] vars;
+    delete env;
+
+    graspWorkers.stop();
+
+    if (this->graspThreadsNumber > 0) {
+        unsigned long long version = 0;
+        Solution solution;
+
+        if (incumbentChannel.poll(version, solution) &&
+                solution.getValue() > this->bestPrimalBound) {
+            this->bestPrimalBound = solution.getValue();
+            this->bestPrimalSolution = solution;
+        }
+
+        this->solutionsCounter += graspWorkers.getSolutionsCounter();
+    }
+
     this->solvingTime = this->getElapsedTime();
+
+    if (checkpointWriter.isEnabled()) {
+        this->submitCheckpoint(checkpointWriter);
+    }
 }
 
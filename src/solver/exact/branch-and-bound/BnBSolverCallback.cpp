@@ -0,0 +1,76 @@
+#include "BnBSolverCallback.hpp"
+
+/**
+ * Constructs a new callback.
+ *
+ * @param instance         the new callback's instance.
+ * @param x                the new callback's variables.
+ * @param incumbentChannel the channel shared with the concurrent solvers.
+ */
+BnBSolverCallback::BnBSolverCallback(const Instance & instance,
+        const std::vector<std::vector<GRBVar> > & x,
+        IncumbentChannel & incumbentChannel) :
+    instance(instance), x(x), incumbentChannel(incumbentChannel),
+    incumbentVersion(0) {}
+
+/**
+ * Hands the channel's incumbent to the search if it is newer than the last one
+ * seen.
+ */
+void BnBSolverCallback::importIncumbent() {
+    Solution solution;
+
+    if (!this->incumbentChannel.poll(this->incumbentVersion, solution)) {
+        return;
+    }
+
+    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
+    std::vector<GRBVar> vars;
+    std::vector<double> values;
+
+    /* The search completes the flow and root variables by itself */
+    for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+        for (unsigned int j = 0; j < this->instance.getM(); j++) {
+            vars.push_back(this->x[eId - 1][j]);
+            values.push_back(edgesDistrict[eId - 1] == j ? 1.0 : 0.0);
+        }
+    }
+
+    this->setSolution(vars.data(), values.data(), vars.size());
+}
+
+/**
+ * The callback function.
+ */
+void BnBSolverCallback::callback() {
+    try {
+        if (this->where == GRB_CB_MIPSOL) {
+            std::vector<unsigned int> edgesDistrict (this->instance.getG().m(),
+                    this->instance.getM());
+
+            for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+                for (unsigned int j = 0; j < this->instance.getM(); j++) {
+                    if (this->getSolution(this->x[eId - 1][j]) >= 0.5) {
+                        edgesDistrict[eId - 1] = j;
+                    }
+                }
+            }
+
+            /* Each solution of the search is a restart point for the concurrent solvers */
+            unsigned long long version = this->incumbentChannel.offer(
+                    Solution(this->instance, edgesDistrict));
+
+            if (version > 0) {
+                this->incumbentVersion = version;
+            }
+        } else if (this->where == GRB_CB_MIPNODE &&
+                this->incumbentChannel.getVersion() > this->incumbentVersion) {
+            this->importIncumbent();
+        }
+    } catch (GRBException e) {
+        std::cerr << "Error number: " << e.getErrorCode() << std::endl;
+        std::cerr << e.getMessage() << std::endl;
+    } catch (...) {
+        std::cerr << "Error during callback" << std::endl;
+    }
+}
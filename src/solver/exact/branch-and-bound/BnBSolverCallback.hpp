@@ -0,0 +1,57 @@
+#pragma once
+
+#include "gurobi_c++.h"
+#include "../../IncumbentChannel.hpp"
+#include "../../../instance/Instance.hpp"
+
+/**
+ * The BnBSolverCallback class represents a BnBSolver's callback class that
+ * exchanges incumbents with solvers running concurrently: it offers each
+ * solution found by the search and hands theirs to the search.
+ */
+class BnBSolverCallback : public GRBCallback {
+    private:
+        /**
+         * This callback's instance.
+         */
+        Instance instance;
+
+        /**
+         * This callback's variables.
+         */
+        std::vector<std::vector<GRBVar> > x;
+
+        /**
+         * The channel through which this callback exchanges incumbents with
+         * concurrent solvers.
+         */
+        IncumbentChannel & incumbentChannel;
+
+        /**
+         * The version of the last incumbent seen in the channel.
+         */
+        unsigned long long incumbentVersion;
+
+        /**
+         * Hands the channel's incumbent to the search if it is newer than the
+         * last one seen.
+         */
+        void importIncumbent();
+    protected:
+        /**
+         * The callback function.
+         */
+        void callback();
+    public:
+        /**
+         * Constructs a new callback.
+         *
+         * @param instance         the new callback's instance.
+         * @param x                the new callback's variables.
+         * @param incumbentChannel the channel shared with the concurrent
+         *                         solvers.
+         */
+        BnBSolverCallback(const Instance & instance,
+                const std::vector<std::vector<GRBVar> > & x,
+                IncumbentChannel & incumbentChannel);
+};
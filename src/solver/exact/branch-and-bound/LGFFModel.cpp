@@ -0,0 +1,391 @@
+#include "LGFFModel.hpp"
+#include <algorithm>
+
+/*
+ * Constructs a new model.
+ *
+ * @param instance  the new model's instance.
+ * @param isCompact the flag indicating whether the rows enforcing the root of
+ *                  each district are aggregated.
+ * @param isNamed   the flag indicating whether the variables and the
+ *                  constraints are named.
+ */
+LGFFModel::LGFFModel(const Instance & instance, bool isCompact, bool isNamed)
+    : LinearModel::LinearModel(true),
+      n(instance.getLG().n()),
+      mPrime(instance.getGPrime().m()),
+      m(instance.getM()),
+      isCompact(isCompact),
+      M(0) {
+    std::set<Vertex> vertices = instance.getLG().getVertices();
+    std::vector<Vertex> verticesVector (vertices.begin(), vertices.end());
+    std::vector<unsigned int> verticesIds;
+    Vertex ePrime = instance.getEPrime();
+    std::vector<unsigned int> indices;
+    std::vector<double> coefficients;
+    std::string name;
+
+    for (const Vertex & e : verticesVector) {
+        verticesIds.push_back(instance.getLG().getVertexId(e));
+    }
+
+    /* The arc of G′'s edge efId leaving the vertex u towards the vertex v */
+    auto getArcId = [this] (unsigned int efId, const Vertex & u, const Vertex & v) {
+        return (u < v) ? efId : this->mPrime + efId;
+    };
+
+    /* Names are only built when requested, as they dominate the assembly */
+    auto getName = [isNamed] (const std::string & prefix,
+            std::initializer_list<unsigned int> subscripts) {
+        std::string name;
+
+        if (isNamed) {
+            name = prefix;
+
+            for (unsigned int subscript : subscripts) {
+                name += "_" + std::to_string(subscript);
+            }
+        }
+
+        return name;
+    };
+
+    /* ∀ e ∈ U′, ∀ j ∈ {1, ..., m}: x_{e, j} ∈ {0, 1} */
+    for (unsigned int eId = 1; eId <= this->n; eId++) {
+        for (unsigned int j = 0; j < this->m; j++) {
+            this->addVariable(0.0, 1.0, instance.getC(eId, j), LinearModel::BINARY,
+                    getName("x", {eId - 1, j}));
+        }
+    }
+
+    /* ∀ {e′, e} ∈ A′\A, ∀ j ∈ {1, ..., m}: y_{{e′, e}, j} ∈ {0, 1} */
+    for (unsigned int eId = 1; eId <= this->n; eId++) {
+        for (unsigned int j = 0; j < this->m; j++) {
+            this->addVariable(0.0, 1.0, 0.0, LinearModel::BINARY,
+                    getName("y", {eId - 1, j}));
+        }
+    }
+
+    /* ∀ a ∈ A′, ∀ j ∈ {1, ..., m}: z_{a, j} ∈ [0, |U|] */
+    for (unsigned int aId = 1; aId <= 2 * this->mPrime; aId++) {
+        for (unsigned int j = 0; j < this->m; j++) {
+            this->addVariable(0.0, this->n, 0.0, LinearModel::CONTINUOUS,
+                    getName("z", {aId - 1, j}));
+        }
+    }
+
+    /* ∀ e ∈ U: ∑_{j = 1}^{m}{x_{e, j}} = 1 */
+    for (unsigned int eId : verticesIds) {
+        indices.clear();
+        coefficients.assign(this->m, 1.0);
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            indices.push_back(this->getX(eId, j));
+        }
+
+        this->addConstraint(indices, coefficients, LinearModel::EQUAL, 1.0,
+                getName("c_01", {eId - 1}));
+    }
+
+    /* ∀ j ∈ {1, ..., m}: 2 * ∑_{e ∈ U}{d_{e} * x_{e, j}} <= min{D, (1 + B) ...} */
+    coefficients.clear();
+
+    for (const Vertex & e : verticesVector) {
+        coefficients.push_back(2.0 * e.w);
+    }
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        indices.clear();
+
+        for (unsigned int eId : verticesIds) {
+            indices.push_back(this->getX(eId, j));
+        }
+
+        this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL,
+                instance.getMaximumDemand(), getName("c_02", {j}));
+    }
+
+    /* ∀ j ∈ {1, ..., m}: 2 * ∑_{e ∈ U}{d_{e} * x_{e, j}} >= (1 - B) ... */
+    for (unsigned int j = 0; j < this->m; j++) {
+        indices.clear();
+
+        for (unsigned int eId : verticesIds) {
+            indices.push_back(this->getX(eId, j));
+        }
+
+        this->addConstraint(indices, coefficients, LinearModel::GREATER_EQUAL,
+                instance.getMinimumDemand(), getName("c_03", {j}));
+    }
+
+    /* ∀ j ∈ {1, ..., m}: ∑_{e ∈  U}{y_{{e′, e}, j}} = 1 */
+    coefficients.assign(this->n, 1.0);
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        indices.clear();
+
+        for (unsigned int eId : verticesIds) {
+            indices.push_back(this->getY(eId, j));
+        }
+
+        this->addConstraint(indices, coefficients, LinearModel::EQUAL, 1.0,
+                getName("c_04", {j}));
+    }
+
+    /* ∀ j ∈ {1, ..., m}, ∀ e ∈ U: x_{e, j} - y_{{e′, e}, j} >= 0 */
+    coefficients = {1.0, -1.0};
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (unsigned int eId : verticesIds) {
+            indices = {this->getX(eId, j), this->getY(eId, j)};
+
+            this->addConstraint(indices, coefficients, LinearModel::GREATER_EQUAL,
+                    0.0, getName("c_05", {eId, j}));
+        }
+    }
+
+    /* The largest number of edges that fit in a district */
+    double sumD = 0;
+    std::vector<Vertex> sortedVertices (verticesVector);
+    std::sort(sortedVertices.begin(), sortedVertices.end(), Vertex::weightComparator);
+
+    for (this->M = 0; this->M < sortedVertices.size() &&
+            sumD < instance.getMaximumDemand(); this->M++) {
+        sumD += sortedVertices[this->M].w;
+    }
+
+    while (sumD > instance.getMaximumDemand()) {
+        this->M--;
+        sumD -= sortedVertices[this->M].w;
+    }
+
+    if (this->M >= sortedVertices.size()) {
+        this->M--;
+    }
+
+    if (!this->isCompact) {
+        /* ∀ j ∈ {1, ..., m}, ∀ e, f ∈ U, e < f: x_{e, j} - y_{{e′, e}, j} + y_{{e′, f}, j} <= 1 */
+        coefficients = {1.0, -1.0, 1.0};
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            for (unsigned int e = 0; e < verticesIds.size(); e++) {
+                for (unsigned int f = e + 1; f < verticesIds.size(); f++) {
+                    indices = {this->getX(verticesIds[e], j), this->getY(verticesIds[e], j),
+                        this->getY(verticesIds[f], j)};
+
+                    this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL,
+                            1.0, getName("c_06", {verticesIds[f], verticesIds[e], j}));
+                }
+            }
+        }
+    } else {
+        /*
+         * ∀ j ∈ {1, ..., m}, ∀ f ∈ U:
+         * ∑_{e ∈ U, e < f}{x_{e, j} - y_{{e′, e}, j}} + M_f y_{{e′, f}, j} <= M_f,
+         * with M_f = min{|{e ∈ U : e < f}|, M}. Every term of the sum is
+         * nonnegative and at most M of them are positive, so the row is
+         * satisfied when f is not the root and, otherwise, it forbids any
+         * smaller edge in the district exactly as the pairwise rows do.
+         */
+        for (unsigned int j = 0; j < this->m; j++) {
+            indices.clear();
+            coefficients.clear();
+
+            for (unsigned int f = 0; f < verticesIds.size(); f++) {
+                if (f > 0) {
+                    double Mf = std::min(f, this->M);
+
+                    indices.push_back(this->getY(verticesIds[f], j));
+                    coefficients.push_back(Mf);
+
+                    this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL,
+                            Mf, getName("c_06", {verticesIds[f], j}));
+
+                    indices.pop_back();
+                    coefficients.pop_back();
+                }
+
+                indices.push_back(this->getX(verticesIds[f], j));
+                indices.push_back(this->getY(verticesIds[f], j));
+                coefficients.push_back(1.0);
+                coefficients.push_back(-1.0);
+            }
+        }
+    }
+
+    /* ∑_{j = 1}^{m}{∑_{e ∈ U}{z_{e′, e, j}}} = |U| */
+    std::set<Edge> ePrimeEdges = instance.getGPrime().getIncidentEdges(ePrime);
+
+    indices.clear();
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (const Edge & ePrimeE : ePrimeEdges) {
+            Vertex e = (ePrimeE.u == ePrime) ? ePrimeE.v : ePrimeE.u;
+
+            indices.push_back(this->getZ(getArcId(
+                            instance.getGPrime().getEdgeId(ePrimeE), ePrime, e), j));
+        }
+    }
+
+    coefficients.assign(indices.size(), 1.0);
+
+    this->addConstraint(indices, coefficients, LinearModel::EQUAL, this->n,
+            getName("c_07", {}));
+
+    /* ∀ j ∈ {1, ..., m}, ∀ e ∈ U: z_{e′, e, j} - M y_{{e′, e}, j} <= 0 */
+    std::vector<unsigned int> ePrimeArcsIds;
+
+    for (const Vertex & e : verticesVector) {
+        ePrimeArcsIds.push_back(getArcId(instance.getGPrime().getEdgeId(ePrime, e),
+                    ePrime, e));
+    }
+
+    coefficients = {1.0, - (double) this->M};
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (unsigned int e = 0; e < verticesIds.size(); e++) {
+            indices = {this->getZ(ePrimeArcsIds[e], j), this->getY(verticesIds[e], j)};
+
+            this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL, 0.0,
+                    getName("c_08", {verticesIds[e], j}));
+        }
+    }
+
+    /* The arcs of L(G) leaving and entering each edge, with their ends' ids */
+    std::vector<std::vector<unsigned int> > outArcsIds (verticesVector.size());
+    std::vector<std::vector<unsigned int> > inArcsIds (verticesVector.size());
+    std::vector<std::vector<unsigned int> > neighboursIds (verticesVector.size());
+
+    for (unsigned int e = 0; e < verticesVector.size(); e++) {
+        for (const Edge & ef : instance.getLG().getIncidentEdges(verticesVector[e])) {
+            unsigned int efId = instance.getLG().getEdgeId(ef);
+            Vertex f = (ef.u == verticesVector[e]) ? ef.v : ef.u;
+
+            outArcsIds[e].push_back(getArcId(efId, verticesVector[e], f));
+            inArcsIds[e].push_back(getArcId(efId, f, verticesVector[e]));
+            neighboursIds[e].push_back(instance.getLG().getVertexId(f));
+        }
+    }
+
+    /* ∀ j ∈ {1, ..., m}, ∀ e ∈ U, ∀ {e, f} ∈ σ_{L(G)}({e}): z_{e, f, j} - M x_{e, j} <= 0 */
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (unsigned int e = 0; e < verticesIds.size(); e++) {
+            for (unsigned int k = 0; k < outArcsIds[e].size(); k++) {
+                indices = {this->getZ(outArcsIds[e][k], j), this->getX(verticesIds[e], j)};
+
+                this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL, 0.0,
+                        getName("c_09", {neighboursIds[e][k], verticesIds[e], j}));
+            }
+        }
+    }
+
+    /* ∀ j ∈ {1, ..., m}, ∀ e ∈ U, ∀ {e, f} ∈ σ_{L(G)}({e}): z_{f, e, j} - M x_{e, j} <= 0 */
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (unsigned int e = 0; e < verticesIds.size(); e++) {
+            for (unsigned int k = 0; k < inArcsIds[e].size(); k++) {
+                indices = {this->getZ(inArcsIds[e][k], j), this->getX(verticesIds[e], j)};
+
+                this->addConstraint(indices, coefficients, LinearModel::LESS_EQUAL, 0.0,
+                        getName("c_10", {verticesIds[e], neighboursIds[e][k], j}));
+            }
+        }
+    }
+
+    /*
+     * ∀ j ∈ {1, ..., m}, ∀ e ∈ U:
+     * ∑_{f ∈ σ_{G′}(e)}{z_{e, f, j}} - ∑_{f ∈ σ_{G′}(e)}{z_{f, e, j}} + x_{e, j} = 0
+     */
+    for (unsigned int e = 0; e < verticesVector.size(); e++) {
+        unsigned int ePrimeEId = instance.getGPrime().getEdgeId(ePrime, verticesVector[e]);
+
+        outArcsIds[e].push_back(getArcId(ePrimeEId, verticesVector[e], ePrime));
+        inArcsIds[e].push_back(getArcId(ePrimeEId, ePrime, verticesVector[e]));
+    }
+
+    for (unsigned int j = 0; j < this->m; j++) {
+        for (unsigned int e = 0; e < verticesIds.size(); e++) {
+            indices.clear();
+            coefficients.clear();
+
+            for (unsigned int aId : inArcsIds[e]) {
+                indices.push_back(this->getZ(aId, j));
+                coefficients.push_back(-1.0);
+            }
+
+            for (unsigned int aId : outArcsIds[e]) {
+                indices.push_back(this->getZ(aId, j));
+                coefficients.push_back(1.0);
+            }
+
+            indices.push_back(this->getX(verticesIds[e], j));
+            coefficients.push_back(1.0);
+
+            this->addConstraint(indices, coefficients, LinearModel::EQUAL, 0.0,
+                    getName("c_11", {verticesIds[e], j}));
+        }
+    }
+}
+
+/*
+ * Constructs a new empty model.
+ */
+LGFFModel::LGFFModel() : LinearModel::LinearModel(true), n(0), mPrime(0), m(0),
+    isCompact(false), M(0) {}
+
+/*
+ * Verifies whether the rows enforcing the root of each district are
+ * aggregated.
+ *
+ * @return true if the rows are aggregated; false otherwise.
+ */
+bool LGFFModel::getIsCompact() const {
+    return this->isCompact;
+}
+
+/*
+ * Returns the largest number of edges that fit in a district.
+ *
+ * @return the largest number of edges that fit in a district.
+ */
+unsigned int LGFFModel::getMaximumDistrictSize() const {
+    return this->M;
+}
+
+/*
+ * Returns the index of the variable x_{e, j}, which indicates whether the edge
+ * e is in the district j.
+ *
+ * @param eId the edge's id.
+ * @param j   the district.
+ *
+ * @return the index of the variable x_{e, j}.
+ */
+unsigned int LGFFModel::getX(unsigned int eId, unsigned int j) const {
+    return (eId - 1) * this->m + j;
+}
+
+/*
+ * Returns the index of the variable y_{{e′, e}, j}, which indicates whether
+ * the edge e is the root of the district j.
+ *
+ * @param eId the edge's id.
+ * @param j   the district.
+ *
+ * @return the index of the variable y_{{e′, e}, j}.
+ */
+unsigned int LGFFModel::getY(unsigned int eId, unsigned int j) const {
+    return (this->n + eId - 1) * this->m + j;
+}
+
+/*
+ * Returns the index of the variable z_{a, j}, the flow of the district j on
+ * the arc a of G′. The arc efId goes from the smaller to the larger end of the
+ * edge efId of G′, and the arc |A′| + efId goes the other way.
+ *
+ * @param aId the arc's id.
+ * @param j   the district.
+ *
+ * @return the index of the variable z_{a, j}.
+ */
+unsigned int LGFFModel::getZ(unsigned int aId, unsigned int j) const {
+    return (2 * this->n + aId - 1) * this->m + j;
+}
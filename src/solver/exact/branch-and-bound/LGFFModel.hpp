@@ -0,0 +1,100 @@
+#pragma once
+
+#include "../../../instance/Instance.hpp"
+#include "../../../model/LinearModel.hpp"
+
+/*
+ * The LGFFModel class represents the line graph flow formulation of the CEDP
+ * solved by the BnBSolver. A flow leaves the artificial vertex e′ through the
+ * root of each district and each edge of the district consumes one unit of
+ * it, which makes the district connected. The root of each district is its
+ * smallest edge; in the compact form, the O(|U|² m) pairwise rows enforcing
+ * it are aggregated into one row per edge and district.
+ */
+class LGFFModel : public LinearModel {
+    private:
+        /* The number of vertices of the line graph. */
+        unsigned int n;
+
+        /* The number of edges of G′. */
+        unsigned int mPrime;
+
+        /* The number of districts. */
+        unsigned int m;
+
+        /* The flag indicating whether the root rows are aggregated. */
+        bool isCompact;
+
+        /*
+         * The largest number of edges that fit in a district, which bounds
+         * the flow on each arc.
+         */
+        unsigned int M;
+
+    public:
+        /*
+         * Constructs a new model.
+         *
+         * @param instance  the new model's instance.
+         * @param isCompact the flag indicating whether the rows enforcing the
+         *                  root of each district are aggregated.
+         * @param isNamed   the flag indicating whether the variables and the
+         *                  constraints are named.
+         */
+        LGFFModel(const Instance & instance, bool isCompact, bool isNamed);
+
+        /*
+         * Constructs a new empty model.
+         */
+        LGFFModel();
+
+        /*
+         * Verifies whether the rows enforcing the root of each district are
+         * aggregated.
+         *
+         * @return true if the rows are aggregated; false otherwise.
+         */
+        bool getIsCompact() const;
+
+        /*
+         * Returns the largest number of edges that fit in a district.
+         *
+         * @return the largest number of edges that fit in a district.
+         */
+        unsigned int getMaximumDistrictSize() const;
+
+        /*
+         * Returns the index of the variable x_{e, j}, which indicates whether
+         * the edge e is in the district j.
+         *
+         * @param eId the edge's id.
+         * @param j   the district.
+         *
+         * @return the index of the variable x_{e, j}.
+         */
+        unsigned int getX(unsigned int eId, unsigned int j) const;
+
+        /*
+         * Returns the index of the variable y_{{e′, e}, j}, which indicates
+         * whether the edge e is the root of the district j.
+         *
+         * @param eId the edge's id.
+         * @param j   the district.
+         *
+         * @return the index of the variable y_{{e′, e}, j}.
+         */
+        unsigned int getY(unsigned int eId, unsigned int j) const;
+
+        /*
+         * Returns the index of the variable z_{a, j}, the flow of the district
+         * j on the arc a of G′. The arc efId goes from the smaller to the
+         * larger end of the edge efId of G′, and the arc |A′| + efId goes the
+         * other way.
+         *
+         * @param aId the arc's id.
+         * @param j   the district.
+         *
+         * @return the index of the variable z_{a, j}.
+         */
+        unsigned int getZ(unsigned int aId, unsigned int j) const;
+};
@@ -1,6 +1,9 @@
 #include "BnCSolver.hpp"
 #include "BnCSolverCallback.hpp"
-#include "../../metaheuristic/grasp/GRASPSolver.hpp"
+#include "../../metaheuristic/grasp/GRASPWorkers.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
+#include <fstream>
+#include <sstream>
 
 /*
  * Constructs a new solver.
@@ -30,12 +33,15 @@ BnCSolver::BnCSolver(const Instance & instance,
       warmStartPercentageTime(warmStartPercentageTime),
       m(m),
       k(k),
-      statisticalFilter(statisticalFilter) {}
+      statisticalFilter(statisticalFilter),
+      checkpointInterval(60),
+      graspThreadsNumber(0) {}
 
 /*
  * Constructs a new empty solver.
  */
-BnCSolver::BnCSolver() : CEDPSolver::CEDPSolver() {}
+BnCSolver::BnCSolver() : CEDPSolver::CEDPSolver(), checkpointInterval(60),
+    graspThreadsNumber(0) {}
 
 /*
  * Returns the percentage of time to find a warm start solution.
@@ -74,16 +80,107 @@ bool BnCSolver::getStatisticalFilter() const {
     return this->statisticalFilter;
 }
 
+/*
+ * Makes this solver write its incumbent into the specified file once its warm
+ * start finishes, and its GRASP write its state every specified number of
+ * seconds.
+ *
+ * @param filename the file to write into; an empty name disables checkpoints.
+ * @param interval the time in seconds between each checkpoint of the GRASP.
+ */
+void BnCSolver::setCheckpoint(const std::string & filename, unsigned int interval) {
+    this->checkpointFilename = filename;
+    this->checkpointInterval = interval;
+}
+
+/*
+ * Sets the number of GRASP threads feeding the search with incumbents while it
+ * runs, which in turn restart from the search's.
+ *
+ * @param graspThreadsNumber the number of GRASP threads; zero if the GRASP
+ *                           only runs as a warm start.
+ */
+void BnCSolver::setConcurrentGRASP(unsigned int graspThreadsNumber) {
+    this->graspThreadsNumber = graspThreadsNumber;
+}
+
+/*
+ * Makes the next call to solve continue the interrupted run whose checkpoint
+ * is in the specified file, either inside its warm start or with its
+ * incumbent.
+ *
+ * @param filename the file to read from.
+ */
+void BnCSolver::resume(const std::string & filename) {
+    this->resumeFilename = filename;
+}
+
+/*
+ * Writes this solver's incumbent into the specified output stream, in the
+ * format of a checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void BnCSolver::writeCheckpoint(std::ostream & os) const {
+    unsigned long long elapsedTime = 
+        std::chrono::duration_cast<std::chrono::milliseconds> (
+                std::chrono::steady_clock::now() - this->startTime).count();
+
+    Checkpoint::writeHeader(os, Checkpoint::EXACT, this->instance);
+    Checkpoint::write(os, elapsedTime);
+    Checkpoint::write(os, this->solutionsCounter);
+    Checkpoint::write(os, this->bestPrimalBound);
+    Checkpoint::write(os, this->bestPrimalSolution);
+}
+
+/*
+ * Writes this solver's state into a checkpoint handed to the specified writer,
+ * which writes it into the disk in background.
+ *
+ * @param checkpointWriter the checkpoint writer.
+ */
+void BnCSolver::submitCheckpoint(CheckpointWriter & checkpointWriter) const {
+    std::stringstream ss;
+
+    this->writeCheckpoint(ss);
+    checkpointWriter.submit(ss.str());
+}
+
 /*
  * Solve this solver's instance.
  */
 void BnCSolver::solve() {
     this->startTime = std::chrono::steady_clock::now();
 
+    unsigned int checkpointKind = Checkpoint::GRASP;
+
+    if (!this->resumeFilename.empty()) {
+        std::ifstream ifs (this->resumeFilename, std::ios::binary);
+        unsigned long long resumedTime = 0;
+
+        if (!ifs.is_open()) {
+            throw "File not found.";
+        }
+
+        /* Both kinds of checkpoint begin with the time elapsed in the interrupted run */
+        checkpointKind = Checkpoint::readHeader(ifs, this->instance);
+        Checkpoint::read(ifs, resumedTime);
+        this->startTime -= std::chrono::milliseconds(resumedTime);
+
+        if (checkpointKind == Checkpoint::EXACT) {
+            Checkpoint::read(ifs, this->solutionsCounter);
+            Checkpoint::read(ifs, this->bestPrimalBound);
+            this->bestPrimalSolution = Checkpoint::readSolution(ifs, this->instance);
+        }
+
+        ifs.close();
+    }
+
     unsigned int graspTimeLimit =
         round(this->warmStartPercentageTime*this->timeLimit);
 
-    if (graspTimeLimit > 0) {
+    /* The warm start is skipped if the interrupted run had already finished it */
+    if (graspTimeLimit > 0 && checkpointKind == Checkpoint::GRASP) {
         GRASPSolver solver(this->instance,
                            round(this->warmStartPercentageTime*this->timeLimit),
                            this->seed,
@@ -91,6 +188,12 @@ void BnCSolver::solve() {
                            this->k,
                            this->statisticalFilter);
 
+        solver.setCheckpoint(this->checkpointFilename, this->checkpointInterval);
+
+        if (!this->resumeFilename.empty()) {
+            solver.resume(this->resumeFilename);
+        }
+
         solver.solve();
 
         this->bestPrimalSolution = solver.getBestPrimalSolution();
@@ -101,6 +204,15 @@ void BnCSolver::solve() {
         }
     }
 
+    CheckpointWriter checkpointWriter (this->checkpointFilename);
+
+    if (checkpointWriter.isEnabled()) {
+        this->submitCheckpoint(checkpointWriter);
+    }
+
+    IncumbentChannel incumbentChannel;
+    GRASPWorkers graspWorkers (this->instance, this->seed + 1, this->m, this->k,
+            this->statisticalFilter, this->graspThreadsNumber, incumbentChannel);
     GRBEnv * env = 0;
 
     try {
@@ -204,15 +316,28 @@ void BnCSolver::solve() {
         BnCSolverCallback callback (this->instance, x);
         model.setCallback(&callback);
 
+        /* The GRASP keeps running next to the search, each feeding the other's incumbent */
+        if (this->graspThreadsNumber > 0) {
+            if (this->solutionsCounter > 0) {
+                incumbentChannel.offer(this->bestPrimalSolution);
+            }
+
+            callback.setIncumbentChannel(&incumbentChannel);
+            graspWorkers.start(remainingTime);
+        }
+
         model.set(GRB_DoubleParam_TimeLimit, ((double) remainingTime));
         model.set(GRB_IntParam_OutputFlag, 0);
         model.set(GRB_IntParam_LazyConstraints, 1);
+        model.set(GRB_IntParam_PreCrush, 1);
         model.set(GRB_IntParam_Threads, 1);
 
         model.update();
 
         model.optimize();
 
+        graspWorkers.stop();
+
         this->bestDualBound = model.get(GRB_DoubleAttr_ObjBound);
 
         if (model.get(GRB_IntAttr_SolCount) > 0) {
@@ -246,6 +371,25 @@ void BnCSolver::solve() {
         std::cerr << "Error during optimization" << std::endl;
     }
 
+    graspWorkers.stop();
+
+    if (this->graspThreadsNumber > 0) {
+        unsigned long long version = 0;
+        Solution solution;
+
+        if (incumbentChannel.poll(version, solution) &&
+                solution.getValue() > this->bestPrimalBound) {
+            this->bestPrimalBound = solution.getValue();
+            this->bestPrimalSolution = solution;
+        }
+
+        this->solutionsCounter += graspWorkers.getSolutionsCounter();
+    }
+
     this->solvingTime = this->getElapsedTime();
+
+    if (checkpointWriter.isEnabled()) {
+        this->submitCheckpoint(checkpointWriter);
+    }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../CEDPSolver.hpp"
+#include "../../../checkpoint/CheckpointWriter.hpp"
 
 /*
  * The BnCSolver class represents a solver for the CEDP using the Branch-and-Cut method.
@@ -28,6 +29,37 @@ class BnCSolver : public CEDPSolver {
          * local search.
          */
         bool statisticalFilter;
+
+        /*
+         * The file into which this solver and its GRASP periodically write
+         * their state; empty if checkpoints are disabled.
+         */
+        std::string checkpointFilename;
+
+        /*
+         * The time in seconds between each checkpoint of the GRASP.
+         */
+        unsigned int checkpointInterval;
+
+        /*
+         * The checkpoint from which the next call to solve continues an
+         * interrupted run; empty if the run starts from scratch.
+         */
+        std::string resumeFilename;
+
+        /*
+         * The number of GRASP threads feeding the search with incumbents
+         * while it runs; zero if the GRASP only runs as a warm start.
+         */
+        unsigned int graspThreadsNumber;
+
+        /*
+         * Writes this solver's state into a checkpoint handed to the
+         * specified writer, which writes it into the disk in background.
+         *
+         * @param checkpointWriter the checkpoint writer.
+         */
+        void submitCheckpoint(CheckpointWriter & checkpointWriter) const;
         
     public:
         /*
@@ -92,6 +124,44 @@ class BnCSolver : public CEDPSolver {
          */
         bool getStatisticalFilter() const;
 
+        /*
+         * Makes this solver write its incumbent into the specified file once
+         * its warm start finishes, and its GRASP write its state every
+         * specified number of seconds.
+         *
+         * @param filename the file to write into; an empty name disables
+         *                 checkpoints.
+         * @param interval the time in seconds between each checkpoint of the
+         *                 GRASP.
+         */
+        void setCheckpoint(const std::string & filename, unsigned int interval);
+
+        /*
+         * Sets the number of GRASP threads feeding the search with incumbents
+         * while it runs, which in turn restart from the search's.
+         *
+         * @param graspThreadsNumber the number of GRASP threads; zero if the
+         *                           GRASP only runs as a warm start.
+         */
+        void setConcurrentGRASP(unsigned int graspThreadsNumber);
+
+        /*
+         * Makes the next call to solve continue the interrupted run whose
+         * checkpoint is in the specified file, either inside its warm start
+         * or with its incumbent.
+         *
+         * @param filename the file to read from.
+         */
+        void resume(const std::string & filename);
+
+        /*
+         * Writes this solver's incumbent into the specified output stream, in
+         * the format of a checkpoint.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeCheckpoint(std::ostream & os) const;
+
         /*
          * Solve this solver's instance.
          */
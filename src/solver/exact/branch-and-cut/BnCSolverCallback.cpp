@@ -8,68 +8,123 @@
  */
 BnCSolverCallback::BnCSolverCallback(const Instance & instance, 
         const std::vector<std::vector<GRBVar> > & x) : 
-    instance(instance), x(x) {}
+    instance(instance), x(x), separator(instance), incumbentChannel(0),
+    incumbentVersion(0) {}
 
 /**
- * The callback function.
+ * Makes this callback offer the search's incumbents through the specified
+ * channel and hand the channel's ones to the search.
+ *
+ * @param incumbentChannel the channel; null if the search runs alone.
  */
-void BnCSolverCallback::callback() {
-    try {
-        if (this->where == GRB_CB_MIPSOL) {
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                std::set<Edge> district;
+void BnCSolverCallback::setIncumbentChannel(IncumbentChannel * incumbentChannel) {
+    this->incumbentChannel = incumbentChannel;
+}
 
-                for (const Edge & e : this->instance.getG().getEdges()) {
-                    unsigned int eId = this->instance.getG().getEdgeId(e);
+/**
+ * Returns the left-hand side of the specified cut-set inequality.
+ *
+ * @param cut the cut-set inequality.
+ *
+ * @return the left-hand side of the cut-set inequality.
+ */
+GRBLinExpr BnCSolverCallback::getCutExpr(const ConnectivityCut & cut) const {
+    /* x_{e, j} + x_{f, j} - ∑_{g ∈ S}{x_{g, j}} */
+    GRBLinExpr cutExpr = this->x[cut.eId - 1][cut.j] + this->x[cut.fId - 1][cut.j];
 
-                    if (this->getSolution(this->x[eId - 1][j]) >= 0.5) {
-                        district.insert(e);
-                    }
-                }
+    for (unsigned int gId : cut.separator) {
+        cutExpr -= this->x[gId - 1][cut.j];
+    }
 
-                std::vector<Graph> connectedComponents = 
-                    this->instance.getG().getInducedSubGraph(district).
-                    getConnectedComponents();
+    return cutExpr;
+}
+
+/**
+ * Hands the channel's incumbent to the search if it is newer than the last one
+ * seen.
+ */
+void BnCSolverCallback::importIncumbent() {
+    Solution solution;
 
-                if (connectedComponents.size() > 1) {
-                    std::vector<unsigned int> edgeComponent (this->instance.getG().getMaxEid(),
-                            connectedComponents.size());
-                    std::vector<GRBLinExpr> cutExpr (connectedComponents.size(), 0);
+    if (!this->incumbentChannel->poll(this->incumbentVersion, solution)) {
+        return;
+    }
 
-                    for (unsigned int i = 0; i < connectedComponents.size(); i++) {
-                        std::set<Edge> componentEdges = connectedComponents[i].getEdges();
+    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
+    std::vector<GRBVar> vars;
+    std::vector<double> values;
 
-                        for (const Edge & e : componentEdges) {
-                            unsigned int eId = connectedComponents[i].getEdgeId(e);
+    for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+        for (unsigned int j = 0; j < this->instance.getM(); j++) {
+            vars.push_back(this->x[eId - 1][j]);
+            values.push_back(edgesDistrict[eId - 1] == j ? 1.0 : 0.0);
+        }
+    }
 
-                            edgeComponent[eId - 1] = i;
-                        }
+    this->setSolution(vars.data(), values.data(), vars.size());
+}
 
-                        std::set<Edge> cutEdges =
-                            this->instance.getG().getAdjacentEdges(componentEdges);
+/**
+ * The callback function.
+ */
+void BnCSolverCallback::callback() {
+    try {
+        if (this->where == GRB_CB_MIPSOL) {
+            std::vector<std::vector<double> > x (this->instance.getG().m(),
+                    std::vector<double> (this->instance.getM()));
 
-                        for (const Edge & e : cutEdges) {
-                            unsigned int eId = this->instance.getG().getEdgeId(e);
+            for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+                for (unsigned int j = 0; j < this->instance.getM(); j++) {
+                    x[eId - 1][j] = this->getSolution(this->x[eId - 1][j]);
+                }
+            }
 
-                            cutExpr[i] += this->x[eId - 1][j];
+            std::vector<ConnectivityCut> cuts = this->separator.separate(x);
+
+            /* A disconnected district violates the cut separating two of its components */
+            for (const ConnectivityCut & cut : cuts) {
+                this->addLazy(this->getCutExpr(cut) <= 1);
+            }
+
+            /* A connected solution is handed to the concurrent solvers as a restart point */
+            if (cuts.empty() && this->incumbentChannel) {
+                std::vector<unsigned int> edgesDistrict (this->instance.getG().m(),
+                        this->instance.getM());
+
+                for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+                    for (unsigned int j = 0; j < this->instance.getM(); j++) {
+                        if (x[eId - 1][j] >= 0.5) {
+                            edgesDistrict[eId - 1] = j;
                         }
                     }
+                }
 
-                    for (const Edge & e : district) {
-                        unsigned int eId = this->instance.getG().getEdgeId(e);
+                unsigned long long version = this->incumbentChannel->offer(
+                        Solution(this->instance, edgesDistrict));
 
-                        for (const Edge & f : district) {
-                            unsigned int fId = this->instance.getG().getEdgeId(f);
+                if (version > 0) {
+                    this->incumbentVersion = version;
+                }
+            }
+        } else if (this->where == GRB_CB_MIPNODE) {
+            if (this->incumbentChannel &&
+                    this->incumbentChannel->getVersion() > this->incumbentVersion) {
+                this->importIncumbent();
+            }
 
-                            if (edgeComponent[eId - 1] != edgeComponent[fId - 1]) {
-                                GRBLinExpr constr = this->x[eId - 1][j] + this->x[fId - 1][j] -
-                                    cutExpr[edgeComponent[eId - 1]];
+            if (this->getIntInfo(GRB_CB_MIPNODE_STATUS) == GRB_OPTIMAL) {
+                std::vector<std::vector<double> > x (this->instance.getG().m(),
+                        std::vector<double> (this->instance.getM()));
 
-                                this->addLazy(constr <= 1);
-                            }
-                        }
+                for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+                    for (unsigned int j = 0; j < this->instance.getM(); j++) {
+                        x[eId - 1][j] = this->getNodeRel(this->x[eId - 1][j]);
                     }
                 }
+
+                for (const ConnectivityCut & cut : this->separator.separate(x)) {
+                    this->addCut(this->getCutExpr(cut) <= 1);
+                }
             }
         }
     } catch (GRBException e) {
@@ -79,4 +134,3 @@ void BnCSolverCallback::callback() {
         std::cerr << "Error during callback" << std::endl;
     }
 }
-
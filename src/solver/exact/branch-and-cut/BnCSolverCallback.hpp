@@ -1,11 +1,14 @@
 #pragma once
 
 #include "gurobi_c++.h"
+#include "ConnectivitySeparator.hpp"
+#include "../../IncumbentChannel.hpp"
 #include "../../../instance/Instance.hpp"
 
 /**
  * The BnCSolverCallback class represents a BnCSolver's callback class that 
- * cuts-off solution with disconnected districts.
+ * cuts-off solution with disconnected districts, and tightens the relaxation
+ * of each node with the violated cut-set inequalities.
  */
 class BnCSolverCallback : public GRBCallback {
     private:
@@ -18,6 +21,37 @@ class BnCSolverCallback : public GRBCallback {
          * This callback's variables.
          */
         std::vector<std::vector<GRBVar> > x;
+
+        /**
+         * This callback's separator of cut-set inequalities.
+         */
+        ConnectivitySeparator separator;
+
+        /**
+         * The channel through which this callback exchanges incumbents with
+         * concurrent solvers; null if the search runs alone.
+         */
+        IncumbentChannel * incumbentChannel;
+
+        /**
+         * The version of the last incumbent seen in the channel.
+         */
+        unsigned long long incumbentVersion;
+
+        /**
+         * Returns the left-hand side of the specified cut-set inequality.
+         *
+         * @param cut the cut-set inequality.
+         *
+         * @return the left-hand side of the cut-set inequality.
+         */
+        GRBLinExpr getCutExpr(const ConnectivityCut & cut) const;
+
+        /**
+         * Hands the channel's incumbent to the search if it is newer than the
+         * last one seen.
+         */
+        void importIncumbent();
     protected:
         /**
          * The callback function.
@@ -32,5 +66,13 @@ class BnCSolverCallback : public GRBCallback {
          */
         BnCSolverCallback(const Instance & instance, 
                 const std::vector<std::vector<GRBVar> > & x);
+
+        /**
+         * Makes this callback offer the search's incumbents through the
+         * specified channel and hand the channel's ones to the search.
+         *
+         * @param incumbentChannel the channel; null if the search runs alone.
+         */
+        void setIncumbentChannel(IncumbentChannel * incumbentChannel);
 };
 
@@ -0,0 +1,15 @@
+#include "ConnectivityCut.hpp"
+
+/*
+ * Constructs a new cut.
+ *
+ * @param j         the new cut's district.
+ * @param eId       the id of the new cut's first edge.
+ * @param fId       the id of the new cut's second edge.
+ * @param separator the ids of the edges separating the new cut's edges.
+ * @param violation the amount by which the separated point violates the new
+ *                  cut.
+ */
+ConnectivityCut::ConnectivityCut(unsigned int j, unsigned int eId, unsigned int fId,
+        const std::vector<unsigned int> & separator, double violation) :
+    j(j), eId(eId), fId(fId), separator(separator), violation(violation) {}
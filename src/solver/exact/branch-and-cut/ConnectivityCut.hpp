@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+/*
+ * The ConnectivityCut class represents a cut-set inequality of a district:
+ * x_{e, j} + x_{f, j} - ∑_{g ∈ S}{x_{g, j}} <= 1, where S is a set of edges
+ * whose removal from the line graph separates the edges e and f.
+ */
+class ConnectivityCut {
+    public:
+        /* The cut's district. */
+        unsigned int j;
+
+        /* The id of the cut's first edge. */
+        unsigned int eId;
+
+        /* The id of the cut's second edge. */
+        unsigned int fId;
+
+        /* The ids of the edges separating the cut's edges. */
+        std::vector<unsigned int> separator;
+
+        /* The amount by which the separated point violates the cut. */
+        double violation;
+
+        /*
+         * Constructs a new cut.
+         *
+         * @param j         the new cut's district.
+         * @param eId       the id of the new cut's first edge.
+         * @param fId       the id of the new cut's second edge.
+         * @param separator the ids of the edges separating the new cut's edges.
+         * @param violation the amount by which the separated point violates
+         *                  the new cut.
+         */
+        ConnectivityCut(unsigned int j, unsigned int eId, unsigned int fId,
+                const std::vector<unsigned int> & separator, double violation);
+};
@@ -0,0 +1,303 @@
+#include "ConnectivitySeparator.hpp"
+#include <algorithm>
+#include <climits>
+#include <map>
+
+/*
+ * Constructs a new separator.
+ *
+ * @param instance             the new separator's instance.
+ * @param maximumCutsNumber    the maximum number of cuts returned for each
+ *                             district.
+ * @param maximumSourcesNumber the maximum number of source edges tried for
+ *                             each district.
+ * @param epsilon              the tolerance below which a violation is
+ *                             ignored.
+ */
+ConnectivitySeparator::ConnectivitySeparator(const Instance & instance,
+                                             unsigned int maximumCutsNumber,
+                                             unsigned int maximumSourcesNumber,
+                                             double epsilon)
+    : n(instance.getG().m()),
+      m(instance.getM()),
+      epsilon(epsilon),
+      maximumCutsNumber(maximumCutsNumber),
+      maximumSourcesNumber(maximumSourcesNumber) {
+    std::vector<std::vector<unsigned int> > nodesArcsLists (2 * this->n);
+    double infinity = this->n + 1.0;
+
+    /* The edge g is split into the arc (2 g, 2 g + 1) of capacity x̄_{g, j} */
+    for (unsigned int g = 0; g < this->n; g++) {
+        nodesArcsLists[2 * g].push_back(this->arcsHead.size());
+        this->arcsHead.push_back(2 * g + 1);
+        this->arcsCapacity.push_back(1.0);
+
+        nodesArcsLists[2 * g + 1].push_back(this->arcsHead.size());
+        this->arcsHead.push_back(2 * g);
+        this->arcsCapacity.push_back(0.0);
+    }
+
+    /* Each adjacency {g, h} of the line graph leads from g's tail to h's head */
+    for (unsigned int g = 0; g < this->n; g++) {
+        for (std::vector<unsigned int>::const_iterator hIdIt =
+                instance.getAdjacentEdgesIdsBegin(g + 1);
+                hIdIt != instance.getAdjacentEdgesIdsEnd(g + 1); hIdIt++) {
+            unsigned int h = *hIdIt - 1;
+
+            nodesArcsLists[2 * g + 1].push_back(this->arcsHead.size());
+            this->arcsHead.push_back(2 * h);
+            this->arcsCapacity.push_back(infinity);
+
+            nodesArcsLists[2 * h].push_back(this->arcsHead.size());
+            this->arcsHead.push_back(2 * g + 1);
+            this->arcsCapacity.push_back(0.0);
+        }
+    }
+
+    this->nodesArcsOffsets.push_back(0);
+
+    for (const std::vector<unsigned int> & nodeArcs : nodesArcsLists) {
+        this->nodesArcs.insert(this->nodesArcs.end(), nodeArcs.begin(), nodeArcs.end());
+        this->nodesArcsOffsets.push_back(this->nodesArcs.size());
+    }
+}
+
+/*
+ * Constructs a new separator with default parameters.
+ *
+ * @param instance the new separator's instance.
+ */
+ConnectivitySeparator::ConnectivitySeparator(const Instance & instance) :
+    ConnectivitySeparator::ConnectivitySeparator(instance, 5, 3, 1e-4) {}
+
+/*
+ * Constructs a new empty separator.
+ */
+ConnectivitySeparator::ConnectivitySeparator() : n(0), m(0), epsilon(1e-4),
+    maximumCutsNumber(0), maximumSourcesNumber(0), nodesArcsOffsets(1, 0) {}
+
+/*
+ * Pushes flow from the node v towards the node t along the level graph.
+ *
+ * @param v        the current node.
+ * @param t        the sink node.
+ * @param amount   the maximum flow to push.
+ * @param residual the residual capacity of each arc.
+ * @param level    the distance of each node from the source.
+ * @param nextArc  the next arc to try from each node.
+ *
+ * @return the flow pushed.
+ */
+double ConnectivitySeparator::augment(unsigned int v, unsigned int t, double amount,
+        std::vector<double> & residual, const std::vector<unsigned int> & level,
+        std::vector<unsigned int> & nextArc) const {
+    if (v == t) {
+        return amount;
+    }
+
+    for (; nextArc[v] < this->nodesArcsOffsets[v + 1]; nextArc[v]++) {
+        unsigned int a = this->nodesArcs[nextArc[v]];
+        unsigned int w = this->arcsHead[a];
+
+        if (residual[a] <= this->epsilon || level[w] != level[v] + 1) {
+            continue;
+        }
+
+        double pushed = this->augment(w, t, std::min(amount, residual[a]), residual,
+                level, nextArc);
+
+        if (pushed > 0.0) {
+            residual[a] -= pushed;
+            residual[a ^ 1] += pushed;
+
+            return pushed;
+        }
+    }
+
+    return 0.0;
+}
+
+/*
+ * Computes a maximum flow from the node s to the node t with Dinic's
+ * algorithm, stopping as soon as it reaches the specified limit.
+ *
+ * @param s        the source node.
+ * @param t        the sink node.
+ * @param residual the residual capacity of each arc.
+ * @param limit    the flow value at which to stop.
+ *
+ * @return the flow value, which is at least the limit if it was reached.
+ */
+double ConnectivitySeparator::getMaximumFlow(unsigned int s, unsigned int t,
+        std::vector<double> & residual, double limit) const {
+    std::vector<unsigned int> level (2 * this->n);
+    std::vector<unsigned int> nextArc (2 * this->n);
+    std::vector<unsigned int> queue (2 * this->n);
+    double flow = 0.0;
+
+    while (flow < limit) {
+        unsigned int head = 0;
+        unsigned int tail = 0;
+
+        std::fill(level.begin(), level.end(), UINT_MAX);
+        level[s] = 0;
+        queue[tail++] = s;
+
+        while (head < tail) {
+            unsigned int v = queue[head++];
+
+            for (unsigned int i = this->nodesArcsOffsets[v]; i < this->nodesArcsOffsets[v + 1]; i++) {
+                unsigned int a = this->nodesArcs[i];
+                unsigned int w = this->arcsHead[a];
+
+                if (residual[a] > this->epsilon && level[w] == UINT_MAX) {
+                    level[w] = level[v] + 1;
+                    queue[tail++] = w;
+                }
+            }
+        }
+
+        if (level[t] == UINT_MAX) {
+            break;
+        }
+
+        std::copy(this->nodesArcsOffsets.begin(), this->nodesArcsOffsets.end() - 1,
+                nextArc.begin());
+
+        while (flow < limit) {
+            double pushed = this->augment(s, t, limit - flow, residual, level, nextArc);
+
+            if (pushed <= 0.0) {
+                break;
+            }
+
+            flow += pushed;
+        }
+    }
+
+    return flow;
+}
+
+/*
+ * Finds the cut-set inequalities most violated by the specified point.
+ *
+ * @param x the value of each edge in each district, indexed by the edge's id
+ *          minus one.
+ *
+ * @return the violated cuts, in non-increasing order of violation within
+ *         each district.
+ */
+std::vector<ConnectivityCut> ConnectivitySeparator::separate(
+        const std::vector<std::vector<double> > & x) const {
+    std::vector<ConnectivityCut> cuts;
+    std::vector<unsigned char> isReached (2 * this->n);
+    std::vector<unsigned int> queue (2 * this->n);
+
+    /* ∀ j ∈ {1, ..., m} */
+    for (unsigned int j = 0; j < this->m; j++) {
+        std::vector<unsigned int> edges;
+        std::vector<double> capacity (this->arcsCapacity);
+        std::map<std::vector<unsigned int>, ConnectivityCut> separatorsCut;
+
+        for (unsigned int g = 0; g < this->n; g++) {
+            capacity[2 * g] = std::max(0.0, x[g][j]);
+
+            if (x[g][j] > this->epsilon) {
+                edges.push_back(g);
+            }
+        }
+
+        std::stable_sort(edges.begin(), edges.end(), [&x, j] (unsigned int g, unsigned int h) {
+            return x[g][j] > x[h][j];
+        });
+
+        /* x̄_{e, j} + x̄_{f, j} > 1 requires x̄_{e, j} > 1/2 for the larger one */
+        for (unsigned int s = 0; s < edges.size() && s < this->maximumSourcesNumber &&
+                x[edges[s]][j] > 0.5; s++) {
+            unsigned int e = edges[s];
+
+            for (unsigned int f : edges) {
+                double rhs = x[e][j] + x[f][j] - 1.0;
+
+                if (rhs <= this->epsilon) {
+                    break;
+                }
+
+                if (f == e) {
+                    continue;
+                }
+
+                /* The flow from e's tail to f's head is the cheapest separator's value */
+                std::vector<double> residual (capacity);
+                double flow = this->getMaximumFlow(2 * e + 1, 2 * f, residual,
+                        rhs - this->epsilon);
+
+                if (flow >= rhs - this->epsilon) {
+                    continue;
+                }
+
+                std::vector<unsigned int> separator;
+                unsigned int head = 0;
+                unsigned int tail = 0;
+
+                std::fill(isReached.begin(), isReached.end(), 0);
+                isReached[2 * e + 1] = 1;
+                queue[tail++] = 2 * e + 1;
+
+                while (head < tail) {
+                    unsigned int v = queue[head++];
+
+                    for (unsigned int i = this->nodesArcsOffsets[v];
+                            i < this->nodesArcsOffsets[v + 1]; i++) {
+                        unsigned int a = this->nodesArcs[i];
+                        unsigned int w = this->arcsHead[a];
+
+                        if (residual[a] > this->epsilon && !isReached[w]) {
+                            isReached[w] = 1;
+                            queue[tail++] = w;
+                        }
+                    }
+                }
+
+                /* The separator is made of the edges whose split arc crosses the minimum cut */
+                for (unsigned int g = 0; g < this->n; g++) {
+                    if (g != e && g != f && isReached[2 * g] && !isReached[2 * g + 1]) {
+                        separator.push_back(g + 1);
+                    }
+                }
+
+                double violation = rhs - flow;
+                std::map<std::vector<unsigned int>, ConnectivityCut>::iterator it =
+                    separatorsCut.find(separator);
+
+                if (it == separatorsCut.end()) {
+                    separatorsCut.emplace(separator, ConnectivityCut(j, e + 1, f + 1,
+                                separator, violation));
+                } else if (violation > it->second.violation) {
+                    it->second = ConnectivityCut(j, e + 1, f + 1, separator, violation);
+                }
+            }
+        }
+
+        std::vector<ConnectivityCut> districtCuts;
+
+        for (const std::pair<const std::vector<unsigned int>, ConnectivityCut> & separatorCut :
+                separatorsCut) {
+            districtCuts.push_back(separatorCut.second);
+        }
+
+        std::stable_sort(districtCuts.begin(), districtCuts.end(),
+                [] (const ConnectivityCut & a, const ConnectivityCut & b) {
+            return a.violation > b.violation;
+        });
+
+        if (districtCuts.size() > this->maximumCutsNumber) {
+            districtCuts.erase(districtCuts.begin() + this->maximumCutsNumber,
+                    districtCuts.end());
+        }
+
+        cuts.insert(cuts.end(), districtCuts.begin(), districtCuts.end());
+    }
+
+    return cuts;
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "ConnectivityCut.hpp"
+#include "../../../instance/Instance.hpp"
+
+/*
+ * The ConnectivitySeparator class represents a separation routine for the
+ * cut-set inequalities of the CEDP. Given a fractional point x̄, it finds, for
+ * each district, pairs of edges whose values sum above one but that are
+ * joined in the line graph only through edges of small total value. The
+ * smallest such separator is a minimum vertex cut of the line graph, found by
+ * a maximum flow in which each edge of the graph is split into an arc of
+ * capacity x̄_{g, j}.
+ */
+class ConnectivitySeparator {
+    private:
+        /* The number of edges. */
+        unsigned int n;
+
+        /* The number of districts. */
+        unsigned int m;
+
+        /* The tolerance below which a violation is ignored. */
+        double epsilon;
+
+        /* The maximum number of cuts returned for each district. */
+        unsigned int maximumCutsNumber;
+
+        /* The maximum number of source edges tried for each district. */
+        unsigned int maximumSourcesNumber;
+
+        /*
+         * The head of each arc of the flow network, in which the edge g is
+         * split into the nodes 2 g and 2 g + 1; the reverse of the arc a is
+         * the arc a ^ 1.
+         */
+        std::vector<unsigned int> arcsHead;
+
+        /* The capacity of each arc of the flow network, with unit edge values. */
+        std::vector<double> arcsCapacity;
+
+        /* The offset of each node's first arc in nodesArcs. */
+        std::vector<unsigned int> nodesArcsOffsets;
+
+        /* The arcs leaving each node, node by node. */
+        std::vector<unsigned int> nodesArcs;
+
+        /*
+         * Pushes flow from the node v towards the node t along the level
+         * graph.
+         *
+         * @param v        the current node.
+         * @param t        the sink node.
+         * @param amount   the maximum flow to push.
+         * @param residual the residual capacity of each arc.
+         * @param level    the distance of each node from the source.
+         * @param nextArc  the next arc to try from each node.
+         *
+         * @return the flow pushed.
+         */
+        double augment(unsigned int v, unsigned int t, double amount,
+                std::vector<double> & residual, const std::vector<unsigned int> & level,
+                std::vector<unsigned int> & nextArc) const;
+
+        /*
+         * Computes a maximum flow from the node s to the node t with Dinic's
+         * algorithm, stopping as soon as it reaches the specified limit.
+         *
+         * @param s        the source node.
+         * @param t        the sink node.
+         * @param residual the residual capacity of each arc.
+         * @param limit    the flow value at which to stop.
+         *
+         * @return the flow value, which is at least the limit if it was
+         *         reached.
+         */
+        double getMaximumFlow(unsigned int s, unsigned int t,
+                std::vector<double> & residual, double limit) const;
+
+    public:
+        /*
+         * Constructs a new separator.
+         *
+         * @param instance             the new separator's instance.
+         * @param maximumCutsNumber    the maximum number of cuts returned for
+         *                             each district.
+         * @param maximumSourcesNumber the maximum number of source edges
+         *                             tried for each district.
+         * @param epsilon              the tolerance below which a violation
+         *                             is ignored.
+         */
+        ConnectivitySeparator(const Instance & instance,
+                              unsigned int maximumCutsNumber,
+                              unsigned int maximumSourcesNumber,
+                              double epsilon);
+
+        /*
+         * Constructs a new separator with default parameters.
+         *
+         * @param instance the new separator's instance.
+         */
+        ConnectivitySeparator(const Instance & instance);
+
+        /*
+         * Constructs a new empty separator.
+         */
+        ConnectivitySeparator();
+
+        /*
+         * Finds the cut-set inequalities most violated by the specified point.
+         *
+         * @param x the value of each edge in each district, indexed by the
+         *          edge's id minus one.
+         *
+         * @return the violated cuts, in non-increasing order of violation
+         *         within each district.
+         */
+        std::vector<ConnectivityCut> separate(
+                const std::vector<std::vector<double> > & x) const;
+};
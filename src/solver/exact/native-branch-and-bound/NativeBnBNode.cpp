@@ -0,0 +1,32 @@
+#include "NativeBnBNode.hpp"
+#include <cfloat>
+
+/*
+ * Constructs a new subproblem in which no edge is allocated.
+ *
+ * @param n the number of edges.
+ * @param m the number of districts.
+ */
+NativeBnBNode::NativeBnBNode(unsigned int n, unsigned int m) :
+    edgesDistrict(n, m), districtsDemand(m, 0.0), districtsSize(m, 0),
+    value(0.0), bound(DBL_MAX) {}
+
+/*
+ * Constructs a new empty subproblem.
+ */
+NativeBnBNode::NativeBnBNode() : NativeBnBNode::NativeBnBNode(0, 0) {}
+
+/*
+ * Allocates the specified edge to the specified district.
+ *
+ * @param e the edge's index.
+ * @param j the district.
+ * @param c the profit of allocating the edge to the district.
+ * @param d the edge's demand.
+ */
+void NativeBnBNode::allocate(unsigned int e, unsigned int j, double c, double d) {
+    this->edgesDistrict[e] = j;
+    this->districtsDemand[j] += d;
+    this->districtsSize[j]++;
+    this->value += c;
+}
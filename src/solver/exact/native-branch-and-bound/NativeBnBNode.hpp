@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+/*
+ * The NativeBnBNode class represents a subproblem of the native
+ * Branch-and-Bound, in which some edges are already allocated to districts.
+ */
+class NativeBnBNode {
+    public:
+        /* The district of each edge, or m if the edge is not allocated yet. */
+        std::vector<unsigned int> edgesDistrict;
+
+        /* The demand of each district. */
+        std::vector<double> districtsDemand;
+
+        /* The number of edges allocated to each district. */
+        std::vector<unsigned int> districtsSize;
+
+        /* The profit of the edges already allocated. */
+        double value;
+
+        /* An upper bound for the value of any solution in this subproblem. */
+        double bound;
+
+        /*
+         * Constructs a new subproblem in which no edge is allocated.
+         *
+         * @param n the number of edges.
+         * @param m the number of districts.
+         */
+        NativeBnBNode(unsigned int n, unsigned int m);
+
+        /*
+         * Constructs a new empty subproblem.
+         */
+        NativeBnBNode();
+
+        /*
+         * Allocates the specified edge to the specified district.
+         *
+         * @param e the edge's index.
+         * @param j the district.
+         * @param c the profit of allocating the edge to the district.
+         * @param d the edge's demand.
+         */
+        void allocate(unsigned int e, unsigned int j, double c, double d);
+};
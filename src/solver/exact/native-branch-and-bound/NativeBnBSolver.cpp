@@ -0,0 +1,314 @@
+#include "NativeBnBSolver.hpp"
+#include "NativeBnBTree.hpp"
+#include "../../metaheuristic/grasp/GRASPWorkers.hpp"
+#include "../../relaxation/LagrangianRelaxation.hpp"
+#include <cfloat>
+#include <fstream>
+
+/*
+ * Constructs a new solver.
+ *
+ * @param instance                the new solver's instance.
+ * @param timeLimit               the new solver's time limit.
+ * @param seed                    the seed for the new solver's pseudo-random
+ *                                numbers generator.
+ * @param warmStartPercentageTime the percentage of time to find a warm start
+ *                                solution.
+ * @param m                       the number of values for the GRASP's threshold
+ *                                parameter.
+ * @param k                       The number of iterations between each update
+ *                                in the GRASP's threshold parameter
+ *                                probabilities.
+ * @param statisticalFilter       the flag indicating whether to filter
+ *                                semi-greedy solutions from local search.
+ * @param threadsNumber           the number of threads exploring the tree.
+ */
+NativeBnBSolver::NativeBnBSolver(const Instance & instance,
+                                 unsigned int timeLimit,
+                                 unsigned int seed,
+                                 double warmStartPercentageTime,
+                                 unsigned int m,
+                                 unsigned int k,
+                                 bool statisticalFilter,
+                                 unsigned int threadsNumber)
+    : CEDPSolver::CEDPSolver(instance, timeLimit, seed),
+      warmStartPercentageTime(warmStartPercentageTime),
+      m(m),
+      k(k),
+      statisticalFilter(statisticalFilter),
+      threadsNumber(threadsNumber),
+      nodesCounter(0),
+      stealsCounter(0),
+      rootDualBound(DBL_MAX),
+      graspThreadsNumber(0),
+      graspIterationsCounter(0) {}
+
+/*
+ * Constructs a new empty solver.
+ */
+NativeBnBSolver::NativeBnBSolver() : CEDPSolver::CEDPSolver(), threadsNumber(1),
+    nodesCounter(0), stealsCounter(0), rootDualBound(DBL_MAX), graspThreadsNumber(0),
+    graspIterationsCounter(0) {}
+
+/*
+ * Returns the percentage of time to find a warm start solution.
+ *
+ * @return the percentage of time to find a warm start solution.
+ */
+double NativeBnBSolver::getWarmStartPercentageTime() const {
+    return this->warmStartPercentageTime;
+}
+
+/*
+ * Returns the number of values for the GRASP's threshold parameter.
+ *
+ * @return the number of values for the GRASP's threshold parameter.
+ */
+unsigned int NativeBnBSolver::getM() const {
+    return this->m;
+}
+
+/*
+ * Returns the number of iterations between each update in the GRASP's threshold parameter.
+ *
+ * @return the number of iterations between each update in the GRASP's threshold parameter.
+ */
+unsigned int NativeBnBSolver::getK() const {
+    return this->k;
+}
+
+/*
+ * Returns the flag indicating whether to filter semi-greedy solution from
+ * local search.
+ *
+ * @returns true if the filter is activated; false otherwise.
+ */
+bool NativeBnBSolver::getStatisticalFilter() const {
+    return this->statisticalFilter;
+}
+
+/*
+ * Sets the number of GRASP threads feeding the tree with incumbents while it
+ * is explored, which in turn restart from the tree's.
+ *
+ * @param graspThreadsNumber the number of GRASP threads; zero if the GRASP
+ *                           only runs as a warm start.
+ */
+void NativeBnBSolver::setConcurrentGRASP(unsigned int graspThreadsNumber) {
+    this->graspThreadsNumber = graspThreadsNumber;
+}
+
+/*
+ * Returns the number of GRASP threads feeding the tree with incumbents.
+ *
+ * @return the number of GRASP threads feeding the tree with incumbents.
+ */
+unsigned int NativeBnBSolver::getGRASPThreadsNumber() const {
+    return this->graspThreadsNumber;
+}
+
+/*
+ * Returns the number of iterations of the concurrent GRASP threads.
+ *
+ * @return the number of iterations of the concurrent GRASP threads.
+ */
+unsigned int NativeBnBSolver::getGRASPIterationsCounter() const {
+    return this->graspIterationsCounter;
+}
+
+/*
+ * Returns the number of threads exploring the tree.
+ *
+ * @return the number of threads exploring the tree.
+ */
+unsigned int NativeBnBSolver::getThreadsNumber() const {
+    return this->threadsNumber;
+}
+
+/*
+ * Returns the number of subproblems explored.
+ *
+ * @return the number of subproblems explored.
+ */
+unsigned long long NativeBnBSolver::getNodesCounter() const {
+    return this->nodesCounter;
+}
+
+/*
+ * Returns the number of subproblems stolen between threads.
+ *
+ * @return the number of subproblems stolen between threads.
+ */
+unsigned long long NativeBnBSolver::getStealsCounter() const {
+    return this->stealsCounter;
+}
+
+/*
+ * Returns the upper bound of the Lagrangian relaxation at the root.
+ *
+ * @return the upper bound of the Lagrangian relaxation at the root.
+ */
+double NativeBnBSolver::getRootDualBound() const {
+    return this->rootDualBound;
+}
+
+/*
+ * Solve this solver's instance.
+ */
+void NativeBnBSolver::solve() {
+    this->startTime = std::chrono::steady_clock::now();
+
+    unsigned int graspTimeLimit =
+        round(this->warmStartPercentageTime*this->timeLimit);
+
+    if (graspTimeLimit > 0) {
+        GRASPSolver solver(this->instance,
+                           graspTimeLimit,
+                           this->seed,
+                           this->m,
+                           this->k,
+                           this->statisticalFilter);
+
+        solver.solve();
+
+        this->bestPrimalSolution = solver.getBestPrimalSolution();
+
+        if (this->bestPrimalSolution.isFeasible()) {
+            this->solutionsCounter++;
+            this->bestPrimalBound = this->bestPrimalSolution.getValue();
+        }
+    }
+
+    unsigned int elapsedTime = this->getElapsedTime();
+    unsigned int remainingTime = 0;
+
+    if (this->timeLimit > elapsedTime) {
+        remainingTime = this->timeLimit - elapsedTime;
+    }
+
+    /* The root's Lagrangian bound closes the gap by itself on easy instances */
+    LagrangianRelaxation relaxation (this->instance);
+
+    if (this->solutionsCounter > 0) {
+        relaxation.setPrimalBound(this->bestPrimalBound);
+    }
+
+    relaxation.solve(remainingTime);
+
+    this->rootDualBound = relaxation.getBound();
+    this->bestDualBound = this->rootDualBound;
+
+    if (!this->areTerminationCriteriaMet()) {
+        NativeBnBTree tree (this->instance, this->threadsNumber);
+        IncumbentChannel incumbentChannel;
+        GRASPWorkers graspWorkers (this->instance, this->seed + 1, this->m, this->k,
+                this->statisticalFilter, this->graspThreadsNumber, incumbentChannel);
+
+        if (this->solutionsCounter > 0) {
+            tree.setIncumbent(this->bestPrimalSolution);
+            incumbentChannel.offer(this->bestPrimalSolution);
+        }
+
+        /* The GRASP keeps running next to the tree, each feeding the other's incumbent */
+        if (this->graspThreadsNumber > 0) {
+            elapsedTime = this->getElapsedTime();
+            remainingTime = 0;
+
+            if (this->timeLimit > elapsedTime) {
+                remainingTime = this->timeLimit - elapsedTime;
+            }
+
+            tree.setIncumbentChannel(&incumbentChannel);
+            graspWorkers.start(remainingTime);
+        }
+
+        tree.solve(this->startTime + std::chrono::seconds(this->timeLimit));
+
+        graspWorkers.stop();
+
+        this->solutionsCounter += tree.getSolutionsCounter();
+
+        if (!tree.getIncumbent().isEmpty() &&
+                tree.getIncumbent().getValue() > this->bestPrimalBound) {
+            this->bestPrimalSolution = tree.getIncumbent();
+            this->bestPrimalBound = this->bestPrimalSolution.getValue();
+        }
+
+        if (this->graspThreadsNumber > 0) {
+            unsigned long long version = 0;
+            Solution solution;
+
+            if (incumbentChannel.poll(version, solution) &&
+                    solution.getValue() > this->bestPrimalBound) {
+                this->bestPrimalSolution = solution;
+                this->bestPrimalBound = solution.getValue();
+            }
+
+            this->solutionsCounter += graspWorkers.getSolutionsCounter();
+            this->graspIterationsCounter = graspWorkers.getIterationsCounter();
+        }
+
+        /* An exhausted tree proves that no solution beats the incumbent */
+        if (tree.isSolved()) {
+            this->bestDualBound = this->bestPrimalBound;
+        } else {
+            this->bestDualBound = std::min(this->bestDualBound, tree.getDualBound());
+        }
+
+        this->nodesCounter = tree.getNodesCounter();
+        this->stealsCounter = tree.getStealsCounter();
+    }
+
+    this->solvingTime = this->getElapsedTime();
+}
+
+/*
+ * Write this solver's statistics into the specified output stream.
+ *
+ * @param os the output stream to write into.
+ */
+void NativeBnBSolver::write(std::ostream & os) const {
+    CEDPSolver::write(os);
+    os << "Root dual bound: " << this->rootDualBound << std::endl;
+    os << "Threads: " << this->threadsNumber << std::endl;
+    os << "Nodes explored: " << this->nodesCounter << std::endl;
+    os << "Nodes stolen: " << this->stealsCounter << std::endl;
+
+    if (this->graspThreadsNumber > 0) {
+        os << "Concurrent GRASP threads: " << this->graspThreadsNumber << std::endl;
+        os << "Concurrent GRASP iterations: " << this->graspIterationsCounter << std::endl;
+    }
+}
+
+/*
+ * Write this solver's statistics into the specified file.
+ *
+ * @param filename the file to write into.
+ */
+void NativeBnBSolver::write(const char * filename) const {
+    std::ofstream ofs;
+    ofs.open(filename);
+
+    if (ofs.is_open()) {
+        this->write(ofs);
+        ofs.close();
+    } else {
+        throw "File not created.";
+    }
+}
+
+/*
+ * Write this solver's statistics into the specified file.
+ *
+ * @param filename the file to write into.
+ */
+void NativeBnBSolver::write(const std::string & filename) const {
+    this->write(filename.c_str());
+}
+
+/*
+ * Write this solver's statistics into the standard output stream.
+ */
+void NativeBnBSolver::write() const {
+    this->write(std::cout);
+}
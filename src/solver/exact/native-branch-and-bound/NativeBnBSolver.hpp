@@ -0,0 +1,216 @@
+#pragma once
+
+#include "../../CEDPSolver.hpp"
+
+/*
+ * The NativeBnBSolver class represents a solver for the CEDP using a
+ * Branch-and-Bound that does not depend on a MIP solver, so that it runs where
+ * no Gurobi license is available. It is warm started by the GRASP, bounded by
+ * the Lagrangian relaxation at the root and by a combinatorial bound at each
+ * subproblem, and explored by several threads with work stealing.
+ */
+class NativeBnBSolver : public CEDPSolver {
+    private:
+        /*
+         * The percentage of time to find a warm start solution.
+         */
+        double warmStartPercentageTime;
+
+        /*
+         * The number of values for the GRASP's threshold parameter.
+         */
+        unsigned int m;
+
+        /*
+         * The number of iterations between each update in the GRASP's
+         * threshold parameter probabilities.
+         */
+        unsigned int k;
+
+        /*
+         * The flag indicating whether to filter semi-greedy solutions from
+         * local search.
+         */
+        bool statisticalFilter;
+
+        /*
+         * The number of threads exploring the tree.
+         */
+        unsigned int threadsNumber;
+
+        /*
+         * The number of subproblems explored.
+         */
+        unsigned long long nodesCounter;
+
+        /*
+         * The number of subproblems stolen between threads.
+         */
+        unsigned long long stealsCounter;
+
+        /*
+         * The upper bound of the Lagrangian relaxation at the root.
+         */
+        double rootDualBound;
+
+        /*
+         * The number of GRASP threads feeding the tree with incumbents while
+         * it is explored; zero if the GRASP only runs as a warm start.
+         */
+        unsigned int graspThreadsNumber;
+
+        /*
+         * The number of iterations of the concurrent GRASP threads.
+         */
+        unsigned int graspIterationsCounter;
+
+    public:
+        /*
+         * Constructs a new solver.
+         *
+         * @param instance                the new solver's instance.
+         * @param timeLimit               the new solver's time limit.
+         * @param seed                    the seed for the new solver's
+         *                                pseudo-random numbers generator.
+         * @param warmStartPercentageTime the percentage of time to find a warm
+         *                                start solution.
+         * @param m                       the number of values for the GRASP's
+         *                                threshold parameter.
+         * @param k                       The number of iterations between each
+         *                                update in the GRASP's threshold
+         *                                parameter probabilities.
+         * @param statisticalFilter       the flag indicating whether to filter
+         *                                semi-greedy solutions from local
+         *                                search.
+         * @param threadsNumber           the number of threads exploring the
+         *                                tree.
+         */
+        NativeBnBSolver(const Instance & instance,
+                        unsigned int timeLimit,
+                        unsigned int seed,
+                        double warmStartPercentageTime,
+                        unsigned int m,
+                        unsigned int k,
+                        bool statisticalFilter,
+                        unsigned int threadsNumber);
+
+        /*
+         * Constructs a new empty solver.
+         */
+        NativeBnBSolver();
+
+        /*
+         * Returns the percentage of time to find a warm start solution.
+         *
+         * @return the percentage of time to find a warm start solution.
+         */
+        double getWarmStartPercentageTime() const;
+
+        /*
+         * Returns the number of values for the GRASP's threshold parameter.
+         *
+         * @return the number of values for the GRASP's threshold parameter.
+         */
+        unsigned int getM() const;
+
+        /*
+         * Returns the number of iterations between each update in the
+         * GRASP's threshold parameter.
+         *
+         * @return the number of iterations between each update in the
+         *         GRASP's threshold parameter.
+         */
+        unsigned int getK() const;
+
+        /*
+         * Returns the flag indicating whether to filter semi-greedy solution
+         * from local search.
+         *
+         * @returns true if the filter is activated; false otherwise.
+         */
+        bool getStatisticalFilter() const;
+
+        /*
+         * Sets the number of GRASP threads feeding the tree with incumbents
+         * while it is explored, which in turn restart from the tree's.
+         *
+         * @param graspThreadsNumber the number of GRASP threads; zero if the
+         *                           GRASP only runs as a warm start.
+         */
+        void setConcurrentGRASP(unsigned int graspThreadsNumber);
+
+        /*
+         * Returns the number of GRASP threads feeding the tree with
+         * incumbents.
+         *
+         * @return the number of GRASP threads feeding the tree with
+         *         incumbents.
+         */
+        unsigned int getGRASPThreadsNumber() const;
+
+        /*
+         * Returns the number of iterations of the concurrent GRASP threads.
+         *
+         * @return the number of iterations of the concurrent GRASP threads.
+         */
+        unsigned int getGRASPIterationsCounter() const;
+
+        /*
+         * Returns the number of threads exploring the tree.
+         *
+         * @return the number of threads exploring the tree.
+         */
+        unsigned int getThreadsNumber() const;
+
+        /*
+         * Returns the number of subproblems explored.
+         *
+         * @return the number of subproblems explored.
+         */
+        unsigned long long getNodesCounter() const;
+
+        /*
+         * Returns the number of subproblems stolen between threads.
+         *
+         * @return the number of subproblems stolen between threads.
+         */
+        unsigned long long getStealsCounter() const;
+
+        /*
+         * Returns the upper bound of the Lagrangian relaxation at the root.
+         *
+         * @return the upper bound of the Lagrangian relaxation at the root.
+         */
+        double getRootDualBound() const;
+
+        /*
+         * Solve this solver's instance.
+         */
+        void solve();
+
+        /*
+         * Write this solver's statistics into the specified output stream.
+         *
+         * @param os the output stream to write into.
+         */
+        void write(std::ostream & os) const;
+
+        /*
+         * Write this solver's statistics into the specified file.
+         *
+         * @param filename the file to write into.
+         */
+        void write(const char * filename) const;
+
+        /*
+         * Write this solver's statistics into the specified file.
+         *
+         * @param filename the file to write into.
+         */
+        void write(const std::string & filename) const;
+
+        /*
+         * Write this solver's statistics into the standard output stream.
+         */
+        void write() const;
+};
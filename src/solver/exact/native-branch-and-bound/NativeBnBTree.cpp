@@ -0,0 +1,628 @@
+#include "NativeBnBTree.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <thread>
+
+/*
+ * Constructs a new tree whose root is the whole instance.
+ *
+ * @param instance      the new tree's instance.
+ * @param threadsNumber the number of threads exploring the new tree.
+ */
+NativeBnBTree::NativeBnBTree(const Instance & instance, unsigned int threadsNumber) :
+    instance(instance), m(instance.getM()), n(instance.getG().m()),
+    c(instance.getM() * instance.getG().m()), d(instance.getG().m()),
+    minimumDemand(instance.getMinimumDemand()),
+    maximumDemand(std::min(instance.getMaximumDemand(), (double) instance.getD())),
+    isIntegral(true), threadsNumber(std::max(threadsNumber, 1u)),
+    deques(std::max(threadsNumber, 1u)), dequesMutex(std::max(threadsNumber, 1u)),
+    pendingNodesCounter(0), nodesCounter(0), stealsCounter(0), isStopped(false),
+    incumbentValue(-DBL_MAX), solutionsCounter(0), incumbentChannel(0),
+    incumbentVersion(0) {
+    for (unsigned int eId = 1; eId <= this->n; eId++) {
+        this->d[eId - 1] = 2 * instance.getEdge(eId).w;
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            double cej = instance.getC(eId, j);
+
+            this->c[(eId - 1) * this->m + j] = cej;
+
+            if (cej != floor(cej)) {
+                this->isIntegral = false;
+            }
+        }
+    }
+}
+
+/*
+ * Verifies whether a subproblem with the specified upper bound cannot contain a
+ * solution better than the incumbent.
+ *
+ * @param bound the subproblem's upper bound.
+ *
+ * @return true if the subproblem can be pruned; false otherwise.
+ */
+bool NativeBnBTree::isPrunable(double bound) const {
+    return bound <= this->incumbentValue + 1e-9;
+}
+
+/*
+ * Allocates the edges that can only go to a single district until no such edge
+ * remains, and computes the subproblem's upper bound and the edge to branch on.
+ *
+ * @param node       the subproblem.
+ * @param branchEdge the edge to branch on, or n if every edge is allocated.
+ * @param candidates the districts the edge to branch on can go to, in
+ *                   non-increasing order of profit.
+ *
+ * @return false if the subproblem is infeasible; true otherwise.
+ */
+bool NativeBnBTree::propagate(NativeBnBNode & node, unsigned int & branchEdge,
+        std::vector<unsigned int> & candidates) const {
+    std::vector<unsigned int> firstEdge (this->m);
+    std::vector<unsigned char> isReached (this->m * this->n);
+    std::vector<unsigned int> component (this->n);
+    std::vector<double> componentsDemand;
+    std::vector<unsigned int> queue (this->n);
+    std::vector<std::pair<unsigned int, unsigned int> > forcedEdges;
+
+    /* Checks whether the edge e can still be allocated to the district j */
+    auto isAllowed = [&] (unsigned int e, unsigned int j) {
+        if (node.districtsDemand[j] + this->d[e] > this->maximumDemand + 1e-9) {
+            return false;
+        }
+
+        if (node.districtsSize[j] > 0) {
+            return isReached[j * this->n + e] != 0;
+        }
+
+        return componentsDemand[component[e]] >= this->minimumDemand - 1e-9;
+    };
+
+    while (true) {
+        double unallocatedDemand = 0.0;
+        double missingDemand = 0.0;
+        double room = 0.0;
+
+        std::fill(firstEdge.begin(), firstEdge.end(), this->n);
+        std::fill(isReached.begin(), isReached.end(), 0);
+
+        for (unsigned int e = 0; e < this->n; e++) {
+            unsigned int j = node.edgesDistrict[e];
+
+            if (j == this->m) {
+                unallocatedDemand += this->d[e];
+            } else if (firstEdge[j] == this->n) {
+                firstEdge[j] = e;
+            }
+        }
+
+        /* The unallocated edges must fill every district up to its minimum and fit in the rest */
+        for (unsigned int j = 0; j < this->m; j++) {
+            missingDemand += std::max(0.0, this->minimumDemand - node.districtsDemand[j]);
+            room += std::max(0.0, this->maximumDemand - node.districtsDemand[j]);
+        }
+
+        if (missingDemand > unallocatedDemand + 1e-9 || room < unallocatedDemand - 1e-9) {
+            return false;
+        }
+
+        /*
+         * Each district must stay connected through its own and unallocated
+         * edges, which must also hold enough demand for its minimum
+         */
+        for (unsigned int j = 0; j < this->m; j++) {
+            if (firstEdge[j] == this->n) {
+                continue;
+            }
+
+            unsigned char * reached = isReached.data() + j * this->n;
+            unsigned int head = 0;
+            unsigned int tail = 0;
+            unsigned int reachedSize = 0;
+            double reachableDemand = 0.0;
+
+            reached[firstEdge[j]] = 1;
+            queue[tail++] = firstEdge[j];
+
+            while (head < tail) {
+                unsigned int e = queue[head++];
+
+                if (node.edgesDistrict[e] == j) {
+                    reachedSize++;
+                }
+
+                reachableDemand += this->d[e];
+
+                for (std::vector<unsigned int>::const_iterator fIdIt =
+                        this->instance.getAdjacentEdgesIdsBegin(e + 1);
+                        fIdIt != this->instance.getAdjacentEdgesIdsEnd(e + 1); fIdIt++) {
+                    unsigned int f = *fIdIt - 1;
+
+                    if (!reached[f] && (node.edgesDistrict[f] == j ||
+                                node.edgesDistrict[f] == this->m)) {
+                        reached[f] = 1;
+                        queue[tail++] = f;
+                    }
+                }
+            }
+
+            if (reachedSize < node.districtsSize[j] ||
+                    reachableDemand < this->minimumDemand - 1e-9) {
+                return false;
+            }
+        }
+
+        /* An empty district can only be opened in a component of unallocated edges with enough demand */
+        double maximumComponentDemand = 0.0;
+
+        componentsDemand.clear();
+        std::fill(component.begin(), component.end(), UINT_MAX);
+
+        for (unsigned int s = 0; s < this->n; s++) {
+            if (node.edgesDistrict[s] != this->m || component[s] != UINT_MAX) {
+                continue;
+            }
+
+            unsigned int head = 0;
+            unsigned int tail = 0;
+            double componentDemand = 0.0;
+
+            component[s] = componentsDemand.size();
+            queue[tail++] = s;
+
+            while (head < tail) {
+                unsigned int e = queue[head++];
+
+                componentDemand += this->d[e];
+
+                for (std::vector<unsigned int>::const_iterator fIdIt =
+                        this->instance.getAdjacentEdgesIdsBegin(e + 1);
+                        fIdIt != this->instance.getAdjacentEdgesIdsEnd(e + 1); fIdIt++) {
+                    unsigned int f = *fIdIt - 1;
+
+                    if (node.edgesDistrict[f] == this->m && component[f] == UINT_MAX) {
+                        component[f] = componentsDemand.size();
+                        queue[tail++] = f;
+                    }
+                }
+            }
+
+            componentsDemand.push_back(componentDemand);
+            maximumComponentDemand = std::max(maximumComponentDemand, componentDemand);
+        }
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            if (node.districtsSize[j] == 0 &&
+                    maximumComponentDemand < this->minimumDemand - 1e-9) {
+                return false;
+            }
+        }
+
+        /*
+         * Each unallocated edge contributes its best profit among the
+         * districts it can still go to; the edge to branch on has the fewest
+         * such districts, preferring edges next to allocated ones and then
+         * the largest regret
+         */
+        double bound = node.value;
+        unsigned int bestCount = UINT_MAX;
+        bool bestIsAdjacent = false;
+        double bestRegret = -DBL_MAX;
+
+        branchEdge = this->n;
+        forcedEdges.clear();
+
+        for (unsigned int e = 0; e < this->n; e++) {
+            if (node.edgesDistrict[e] != this->m) {
+                continue;
+            }
+
+            unsigned int count = 0;
+            unsigned int firstJ = this->m;
+            double firstC = -DBL_MAX;
+            double secondC = -DBL_MAX;
+
+            for (unsigned int j = 0; j < this->m; j++) {
+                if (!isAllowed(e, j)) {
+                    continue;
+                }
+
+                double cej = this->c[e * this->m + j];
+
+                count++;
+
+                if (cej > firstC) {
+                    secondC = firstC;
+                    firstC = cej;
+                    firstJ = j;
+                } else if (cej > secondC) {
+                    secondC = cej;
+                }
+            }
+
+            if (count == 0) {
+                return false;
+            }
+
+            bound += firstC;
+
+            if (count == 1) {
+                forcedEdges.push_back(std::make_pair(e, firstJ));
+            }
+
+            if (!forcedEdges.empty()) {
+                continue;
+            }
+
+            bool isAdjacent = false;
+
+            for (std::vector<unsigned int>::const_iterator fIdIt =
+                    this->instance.getAdjacentEdgesIdsBegin(e + 1);
+                    fIdIt != this->instance.getAdjacentEdgesIdsEnd(e + 1) && !isAdjacent;
+                    fIdIt++) {
+                isAdjacent = node.edgesDistrict[*fIdIt - 1] != this->m;
+            }
+
+            double regret = firstC - secondC;
+
+            if (count < bestCount || (count == bestCount && (isAdjacent > bestIsAdjacent ||
+                            (isAdjacent == bestIsAdjacent && regret > bestRegret)))) {
+                branchEdge = e;
+                bestCount = count;
+                bestIsAdjacent = isAdjacent;
+                bestRegret = regret;
+            }
+        }
+
+        if (forcedEdges.empty()) {
+            if (this->isIntegral) {
+                bound = floor(bound + 1e-6);
+            }
+
+            node.bound = std::min(node.bound, bound);
+            break;
+        }
+
+        /* The forced edges are allocated and the subproblem is propagated again */
+        for (const std::pair<unsigned int, unsigned int> & forcedEdge : forcedEdges) {
+            unsigned int e = forcedEdge.first;
+            unsigned int j = forcedEdge.second;
+
+            if (node.districtsDemand[j] + this->d[e] > this->maximumDemand + 1e-9) {
+                return false;
+            }
+
+            node.allocate(e, j, this->c[e * this->m + j], this->d[e]);
+        }
+    }
+
+    candidates.clear();
+
+    if (branchEdge < this->n) {
+        for (unsigned int j = 0; j < this->m; j++) {
+            if (isAllowed(branchEdge, j)) {
+                candidates.push_back(j);
+            }
+        }
+
+        const double * ce = this->c.data() + branchEdge * this->m;
+
+        std::stable_sort(candidates.begin(), candidates.end(),
+                [ce] (unsigned int i, unsigned int j) { return ce[i] > ce[j]; });
+    }
+
+    return true;
+}
+
+/*
+ * Replaces the incumbent with the specified complete subproblem if it is
+ * better.
+ *
+ * @param node the complete subproblem.
+ */
+void NativeBnBTree::updateIncumbent(const NativeBnBNode & node) {
+    std::lock_guard<std::mutex> lock (this->incumbentMutex);
+
+    if (node.value <= this->incumbentValue) {
+        return;
+    }
+
+    Solution solution (this->instance, node.edgesDistrict);
+
+    if (!solution.isFeasible()) {
+        return;
+    }
+
+    this->incumbent = solution;
+    this->incumbentValue = solution.getValue();
+    this->solutionsCounter++;
+
+    if (this->incumbentChannel) {
+        unsigned long long version = this->incumbentChannel->offer(solution);
+
+        if (version > 0) {
+            this->incumbentVersion = version;
+        }
+    }
+}
+
+/*
+ * Replaces the incumbent by the channel's if it is newer and better.
+ */
+void NativeBnBTree::importIncumbent() {
+    std::lock_guard<std::mutex> lock (this->incumbentMutex);
+    unsigned long long version = this->incumbentVersion;
+    Solution solution;
+
+    if (!this->incumbentChannel->poll(version, solution)) {
+        return;
+    }
+
+    this->incumbentVersion = version;
+
+    /* A better incumbent only tightens the pruning of the open subproblems */
+    if (solution.getValue() > this->incumbentValue) {
+        this->incumbent = solution;
+        this->incumbentValue = solution.getValue();
+    }
+}
+
+/*
+ * Pushes the specified subproblem into the specified thread's deque.
+ *
+ * @param workerId the thread.
+ * @param node     the subproblem.
+ */
+void NativeBnBTree::push(unsigned int workerId, NativeBnBNode && node) {
+    this->pendingNodesCounter++;
+
+    std::lock_guard<std::mutex> lock (this->dequesMutex[workerId]);
+
+    this->deques[workerId].push_back(std::move(node));
+}
+
+/*
+ * Pops the deepest subproblem of the specified thread's deque.
+ *
+ * @param workerId the thread.
+ * @param node     the popped subproblem.
+ *
+ * @return true if a subproblem was popped; false otherwise.
+ */
+bool NativeBnBTree::pop(unsigned int workerId, NativeBnBNode & node) {
+    std::lock_guard<std::mutex> lock (this->dequesMutex[workerId]);
+
+    if (this->deques[workerId].empty()) {
+        return false;
+    }
+
+    node = std::move(this->deques[workerId].back());
+    this->deques[workerId].pop_back();
+
+    return true;
+}
+
+/*
+ * Steals the shallowest subproblem of another thread's deque.
+ *
+ * @param workerId  the thief.
+ * @param node      the stolen subproblem.
+ * @param generator the pseudo-random numbers generator choosing the first
+ *                  victim.
+ *
+ * @return true if a subproblem was stolen; false otherwise.
+ */
+bool NativeBnBTree::steal(unsigned int workerId, NativeBnBNode & node,
+        std::mt19937 & generator) {
+    unsigned int offset = generator() % this->threadsNumber;
+
+    for (unsigned int i = 0; i < this->threadsNumber; i++) {
+        unsigned int victimId = (offset + i) % this->threadsNumber;
+
+        if (victimId == workerId) {
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock (this->dequesMutex[victimId]);
+
+        /* The shallowest subproblem is the root of the largest remaining subtree */
+        if (!this->deques[victimId].empty()) {
+            node = std::move(this->deques[victimId].front());
+            this->deques[victimId].pop_front();
+            this->stealsCounter++;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Explores the specified subproblem, either pruning it, updating the incumbent
+ * or pushing its children.
+ *
+ * @param workerId the thread.
+ * @param node     the subproblem.
+ */
+void NativeBnBTree::explore(unsigned int workerId, NativeBnBNode & node) {
+    unsigned int branchEdge = this->n;
+    std::vector<unsigned int> candidates;
+
+    this->nodesCounter++;
+
+    if (this->isPrunable(node.bound) || !this->propagate(node, branchEdge, candidates) ||
+            this->isPrunable(node.bound)) {
+        return;
+    }
+
+    if (branchEdge == this->n) {
+        this->updateIncumbent(node);
+        return;
+    }
+
+    double bound = node.bound;
+    double bestC = this->c[branchEdge * this->m + candidates.front()];
+
+    /* The most profitable district is pushed last, so that it is explored first */
+    for (unsigned int i = candidates.size(); i-- > 0;) {
+        unsigned int j = candidates[i];
+        double cej = this->c[branchEdge * this->m + j];
+        NativeBnBNode child = i > 0 ? node : std::move(node);
+
+        child.allocate(branchEdge, j, cej, this->d[branchEdge]);
+        child.bound = bound - (bestC - cej);
+
+        if (!this->isPrunable(child.bound)) {
+            this->push(workerId, std::move(child));
+        }
+    }
+}
+
+/*
+ * Explores subproblems until the tree is exhausted or the deadline.
+ *
+ * @param workerId the thread.
+ * @param deadline the deadline.
+ */
+void NativeBnBTree::work(unsigned int workerId,
+        std::chrono::steady_clock::time_point deadline) {
+    std::mt19937 generator (workerId);
+    NativeBnBNode node;
+
+    while (!this->isStopped) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            this->isStopped = true;
+            break;
+        }
+
+        if (this->incumbentChannel &&
+                this->incumbentChannel->getVersion() > this->incumbentVersion) {
+            this->importIncumbent();
+        }
+
+        if (this->pop(workerId, node) || this->steal(workerId, node, generator)) {
+            this->explore(workerId, node);
+            this->pendingNodesCounter--;
+        } else if (this->pendingNodesCounter == 0) {
+            break;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+/*
+ * Sets a feasible solution as the incumbent, such as a GRASP one.
+ *
+ * @param solution the feasible solution.
+ */
+void NativeBnBTree::setIncumbent(const Solution & solution) {
+    std::lock_guard<std::mutex> lock (this->incumbentMutex);
+
+    this->incumbent = solution;
+    this->incumbentValue = solution.getValue();
+}
+
+/*
+ * Makes the tree share its incumbent through the specified channel, polled by
+ * every thread between two subproblems.
+ *
+ * @param incumbentChannel the channel; null if the tree runs alone.
+ */
+void NativeBnBTree::setIncumbentChannel(IncumbentChannel * incumbentChannel) {
+    this->incumbentChannel = incumbentChannel;
+}
+
+/*
+ * Returns the best solution found so far.
+ *
+ * @return the best solution found so far.
+ */
+const Solution & NativeBnBTree::getIncumbent() const {
+    return this->incumbent;
+}
+
+/*
+ * Returns the number of improving solutions found by this tree.
+ *
+ * @return the number of improving solutions found by this tree.
+ */
+unsigned int NativeBnBTree::getSolutionsCounter() const {
+    return this->solutionsCounter;
+}
+
+/*
+ * Returns the number of subproblems explored.
+ *
+ * @return the number of subproblems explored.
+ */
+unsigned long long NativeBnBTree::getNodesCounter() const {
+    return this->nodesCounter;
+}
+
+/*
+ * Returns the number of subproblems stolen between threads.
+ *
+ * @return the number of subproblems stolen between threads.
+ */
+unsigned long long NativeBnBTree::getStealsCounter() const {
+    return this->stealsCounter;
+}
+
+/*
+ * Verifies whether the tree was exhausted, which proves the incumbent optimal
+ * or the instance infeasible.
+ *
+ * @return true if the tree was exhausted; false otherwise.
+ */
+bool NativeBnBTree::isSolved() const {
+    return this->pendingNodesCounter == 0;
+}
+
+/*
+ * Returns an upper bound for the CEDP given by the incumbent and the open
+ * subproblems.
+ *
+ * @return an upper bound for the CEDP.
+ */
+double NativeBnBTree::getDualBound() const {
+    double dualBound = this->incumbentValue;
+
+    for (const std::deque<NativeBnBNode> & deque : this->deques) {
+        for (const NativeBnBNode & node : deque) {
+            dualBound = std::max(dualBound, node.bound);
+        }
+    }
+
+    return dualBound;
+}
+
+/*
+ * Explores the tree with this tree's threads until it is exhausted or the
+ * deadline.
+ *
+ * @param deadline the deadline.
+ */
+void NativeBnBTree::solve(std::chrono::steady_clock::time_point deadline) {
+    std::vector<std::thread> threads;
+
+    this->isStopped = false;
+
+    if (this->pendingNodesCounter == 0 && this->nodesCounter == 0) {
+        this->push(0, NativeBnBNode(this->n, this->m));
+    }
+
+    for (unsigned int workerId = 1; workerId < this->threadsNumber; workerId++) {
+        threads.push_back(std::thread(&NativeBnBTree::work, this, workerId, deadline));
+    }
+
+    this->work(0, deadline);
+
+    for (std::thread & thread : threads) {
+        thread.join();
+    }
+}
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "NativeBnBNode.hpp"
+#include "../../../instance/Instance.hpp"
+#include "../../../solution/Solution.hpp"
+#include "../../IncumbentChannel.hpp"
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <random>
+
+/*
+ * The NativeBnBTree class represents the search tree of a Branch-and-Bound for
+ * the CEDP that does not depend on a MIP solver. Each subproblem allocates one
+ * more edge to a district; its upper bound gives each remaining edge the
+ * highest profit among the districts that can still reach it through
+ * unallocated edges and still have room for its demand. Subproblems are
+ * explored depth-first by several threads, each with its own deque, and idle
+ * threads steal the shallowest subproblems of the others.
+ */
+class NativeBnBTree {
+    private:
+        /* The tree's instance. */
+        const Instance & instance;
+
+        /* The number of districts. */
+        unsigned int m;
+
+        /* The number of edges. */
+        unsigned int n;
+
+        /* The profit of allocating each edge to each district, row by row. */
+        std::vector<double> c;
+
+        /* The demand 2 d_{e} of each edge. */
+        std::vector<double> d;
+
+        /* The minimum allowed demand for each district. */
+        double minimumDemand;
+
+        /* The maximum allowed demand for each district, including the capacity. */
+        double maximumDemand;
+
+        /* The flag indicating whether every profit is an integer. */
+        bool isIntegral;
+
+        /* The number of threads exploring the tree. */
+        unsigned int threadsNumber;
+
+        /* The open subproblems of each thread. */
+        std::vector<std::deque<NativeBnBNode> > deques;
+
+        /* The mutex of each thread's deque. */
+        std::vector<std::mutex> dequesMutex;
+
+        /* The number of subproblems either open or being explored. */
+        std::atomic<unsigned long long> pendingNodesCounter;
+
+        /* The number of subproblems explored. */
+        std::atomic<unsigned long long> nodesCounter;
+
+        /* The number of subproblems stolen from another thread's deque. */
+        std::atomic<unsigned long long> stealsCounter;
+
+        /* The flag indicating whether the threads must stop. */
+        std::atomic<bool> isStopped;
+
+        /* The value of the incumbent. */
+        std::atomic<double> incumbentValue;
+
+        /* The mutex of the incumbent. */
+        std::mutex incumbentMutex;
+
+        /* The best solution found so far. */
+        Solution incumbent;
+
+        /* The number of improving solutions found by the tree. */
+        unsigned int solutionsCounter;
+
+        /*
+         * The channel through which the tree shares its incumbent with
+         * concurrent solvers; null if it runs alone.
+         */
+        IncumbentChannel * incumbentChannel;
+
+        /* The version of the last incumbent seen in the channel. */
+        std::atomic<unsigned long long> incumbentVersion;
+
+        /*
+         * Replaces the incumbent by the channel's if it is newer and better.
+         */
+        void importIncumbent();
+
+        /*
+         * Verifies whether a subproblem with the specified upper bound cannot
+         * contain a solution better than the incumbent.
+         *
+         * @param bound the subproblem's upper bound.
+         *
+         * @return true if the subproblem can be pruned; false otherwise.
+         */
+        bool isPrunable(double bound) const;
+
+        /*
+         * Allocates the edges that can only go to a single district until no
+         * such edge remains, and computes the subproblem's upper bound and
+         * the edge to branch on.
+         *
+         * @param node       the subproblem.
+         * @param branchEdge the edge to branch on, or n if every edge is
+         *                   allocated.
+         * @param candidates the districts the edge to branch on can go to,
+         *                   in non-increasing order of profit.
+         *
+         * @return false if the subproblem is infeasible; true otherwise.
+         */
+        bool propagate(NativeBnBNode & node, unsigned int & branchEdge,
+                std::vector<unsigned int> & candidates) const;
+
+        /*
+         * Replaces the incumbent with the specified complete subproblem if it
+         * is better.
+         *
+         * @param node the complete subproblem.
+         */
+        void updateIncumbent(const NativeBnBNode & node);
+
+        /*
+         * Pushes the specified subproblem into the specified thread's deque.
+         *
+         * @param workerId the thread.
+         * @param node     the subproblem.
+         */
+        void push(unsigned int workerId, NativeBnBNode && node);
+
+        /*
+         * Pops the deepest subproblem of the specified thread's deque.
+         *
+         * @param workerId the thread.
+         * @param node     the popped subproblem.
+         *
+         * @return true if a subproblem was popped; false otherwise.
+         */
+        bool pop(unsigned int workerId, NativeBnBNode & node);
+
+        /*
+         * Steals the shallowest subproblem of another thread's deque.
+         *
+         * @param workerId  the thief.
+         * @param node      the stolen subproblem.
+         * @param generator the pseudo-random numbers generator choosing the
+         *                  first victim.
+         *
+         * @return true if a subproblem was stolen; false otherwise.
+         */
+        bool steal(unsigned int workerId, NativeBnBNode & node, std::mt19937 & generator);
+
+        /*
+         * Explores the specified subproblem, either pruning it, updating the
+         * incumbent or pushing its children.
+         *
+         * @param workerId the thread.
+         * @param node     the subproblem.
+         */
+        void explore(unsigned int workerId, NativeBnBNode & node);
+
+        /*
+         * Explores subproblems until the tree is exhausted or the deadline.
+         *
+         * @param workerId the thread.
+         * @param deadline the deadline.
+         */
+        void work(unsigned int workerId, std::chrono::steady_clock::time_point deadline);
+
+    public:
+        /*
+         * Constructs a new tree whose root is the whole instance.
+         *
+         * @param instance      the new tree's instance.
+         * @param threadsNumber the number of threads exploring the new tree.
+         */
+        NativeBnBTree(const Instance & instance, unsigned int threadsNumber);
+
+        NativeBnBTree(const NativeBnBTree &) = delete;
+
+        NativeBnBTree & operator = (const NativeBnBTree &) = delete;
+
+        /*
+         * Sets a feasible solution as the incumbent, such as a GRASP one.
+         *
+         * @param solution the feasible solution.
+         */
+        void setIncumbent(const Solution & solution);
+
+        /*
+         * Makes the tree share its incumbent through the specified channel,
+         * polled by every thread between two subproblems.
+         *
+         * @param incumbentChannel the channel; null if the tree runs alone.
+         */
+        void setIncumbentChannel(IncumbentChannel * incumbentChannel);
+
+        /*
+         * Returns the best solution found so far.
+         *
+         * @return the best solution found so far.
+         */
+        const Solution & getIncumbent() const;
+
+        /*
+         * Returns the number of improving solutions found by this tree.
+         *
+         * @return the number of improving solutions found by this tree.
+         */
+        unsigned int getSolutionsCounter() const;
+
+        /*
+         * Returns the number of subproblems explored.
+         *
+         * @return the number of subproblems explored.
+         */
+        unsigned long long getNodesCounter() const;
+
+        /*
+         * Returns the number of subproblems stolen between threads.
+         *
+         * @return the number of subproblems stolen between threads.
+         */
+        unsigned long long getStealsCounter() const;
+
+        /*
+         * Verifies whether the tree was exhausted, which proves the incumbent
+         * optimal or the instance infeasible.
+         *
+         * @return true if the tree was exhausted; false otherwise.
+         */
+        bool isSolved() const;
+
+        /*
+         * Returns an upper bound for the CEDP given by the incumbent and the
+         * open subproblems.
+         *
+         * @return an upper bound for the CEDP.
+         */
+        double getDualBound() const;
+
+        /*
+         * Explores the tree with this tree's threads until it is exhausted
+         * or the deadline.
+         *
+         * @param deadline the deadline.
+         */
+        void solve(std::chrono::steady_clock::time_point deadline);
+};
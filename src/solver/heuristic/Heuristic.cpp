@@ -7,7 +7,8 @@
  * @param seed     the seed for the new heuristic's pseudo-random numbers generator.
  */
 Heuristic::Heuristic(const Instance & instance, unsigned int seed)
-    : instance(instance), generator(seed) {
+    : instance(instance), generator(seed),
+    memoryResource(std::pmr::get_default_resource()) {
     this->generator.discard(1000);
 }
 
@@ -16,6 +17,44 @@ Heuristic::Heuristic(const Instance & instance, unsigned int seed)
  */
 Heuristic::Heuristic() : Heuristic::Heuristic(Instance(), 0) {}
 
+/*
+ * Returns this heuristic's pseudo-random numbers generator.
+ *
+ * @return this heuristic's pseudo-random numbers generator.
+ */
+const std::mt19937 & Heuristic::getGenerator() const {
+    return this->generator;
+}
+
+/*
+ * Sets this heuristic's pseudo-random numbers generator, as when resuming an
+ * interrupted run.
+ *
+ * @param generator this heuristic's new pseudo-random numbers generator.
+ */
+void Heuristic::setGenerator(const std::mt19937 & generator) {
+    this->generator = generator;
+}
+
+/*
+ * Returns the memory resource of this heuristic's temporaries.
+ *
+ * @return the memory resource of this heuristic's temporaries.
+ */
+std::pmr::memory_resource * Heuristic::getMemoryResource() const {
+    return this->memoryResource;
+}
+
+/*
+ * Sets the memory resource of this heuristic's temporaries, such as an arena
+ * released after each iteration of a metaheuristic.
+ *
+ * @param memoryResource the new memory resource.
+ */
+void Heuristic::setMemoryResource(std::pmr::memory_resource * memoryResource) {
+    this->memoryResource = memoryResource;
+}
+
 /*
  * Returns the elapsed time.
  *
@@ -2,6 +2,7 @@
 
 #include "../../instance/Instance.hpp"
 #include <chrono>
+#include <memory_resource>
 
 /* The Heuristic abstract class represents a heuristic for the CEDP. */
 class Heuristic {
@@ -11,6 +12,9 @@ class Heuristic {
 
         /* This heuristic's pseudo-random numbers generator. */
         std::mt19937 generator;
+
+        /* The memory resource of this heuristic's temporaries. */
+        std::pmr::memory_resource * memoryResource;
     public:
         /*
          * Constructs a new heuristic.
@@ -25,6 +29,36 @@ class Heuristic {
          */
         Heuristic();
 
+        /*
+         * Returns this heuristic's pseudo-random numbers generator.
+         *
+         * @return this heuristic's pseudo-random numbers generator.
+         */
+        const std::mt19937 & getGenerator() const;
+
+        /*
+         * Sets this heuristic's pseudo-random numbers generator, as when
+         * resuming an interrupted run.
+         *
+         * @param generator this heuristic's new pseudo-random numbers generator.
+         */
+        void setGenerator(const std::mt19937 & generator);
+
+        /*
+         * Returns the memory resource of this heuristic's temporaries.
+         *
+         * @return the memory resource of this heuristic's temporaries.
+         */
+        std::pmr::memory_resource * getMemoryResource() const;
+
+        /*
+         * Sets the memory resource of this heuristic's temporaries, such as
+         * an arena released after each iteration of a metaheuristic.
+         *
+         * @param memoryResource the new memory resource.
+         */
+        void setMemoryResource(std::pmr::memory_resource * memoryResource);
+
         /*
          * Returns the elapsed time.
          *
@@ -0,0 +1,64 @@
+#include "CountingMemoryResource.hpp"
+
+/*
+ * Constructs a new memory resource that has served no allocation.
+ */
+CountingMemoryResource::CountingMemoryResource() : allocationsCounter(0),
+    allocatedBytes(0) {}
+
+/*
+ * Allocates the specified number of bytes from the global heap.
+ *
+ * @param bytes     the number of bytes.
+ * @param alignment the alignment.
+ *
+ * @return the allocated memory.
+ */
+void * CountingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    this->allocationsCounter++;
+    this->allocatedBytes += bytes;
+
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+/*
+ * Deallocates the specified memory to the global heap.
+ *
+ * @param p         the memory.
+ * @param bytes     the number of bytes.
+ * @param alignment the alignment.
+ */
+void CountingMemoryResource::do_deallocate(void * p, std::size_t bytes,
+        std::size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+/*
+ * Verifies whether the specified memory resource is this one.
+ *
+ * @param other the memory resource.
+ *
+ * @return true if the memory resource is this one; false otherwise.
+ */
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource & other) const
+        noexcept {
+    return this == &other;
+}
+
+/*
+ * Returns the number of allocations served by this memory resource.
+ *
+ * @return the number of allocations served.
+ */
+unsigned long long CountingMemoryResource::getAllocationsCounter() const {
+    return this->allocationsCounter;
+}
+
+/*
+ * Returns the number of bytes allocated by this memory resource.
+ *
+ * @return the number of bytes allocated.
+ */
+unsigned long long CountingMemoryResource::getAllocatedBytes() const {
+    return this->allocatedBytes;
+}
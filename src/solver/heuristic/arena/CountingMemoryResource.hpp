@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory_resource>
+
+/*
+ * The CountingMemoryResource class represents a memory resource that forwards
+ * every request to the global heap and counts the allocations it serves.
+ */
+class CountingMemoryResource : public std::pmr::memory_resource {
+    private:
+        /* The number of allocations served. */
+        unsigned long long allocationsCounter;
+
+        /* The number of bytes allocated. */
+        unsigned long long allocatedBytes;
+
+        /*
+         * Allocates the specified number of bytes from the global heap.
+         *
+         * @param bytes     the number of bytes.
+         * @param alignment the alignment.
+         *
+         * @return the allocated memory.
+         */
+        void * do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        /*
+         * Deallocates the specified memory to the global heap.
+         *
+         * @param p         the memory.
+         * @param bytes     the number of bytes.
+         * @param alignment the alignment.
+         */
+        void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override;
+
+        /*
+         * Verifies whether the specified memory resource is this one.
+         *
+         * @param other the memory resource.
+         *
+         * @return true if the memory resource is this one; false otherwise.
+         */
+        bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+    public:
+        /*
+         * Constructs a new memory resource that has served no allocation.
+         */
+        CountingMemoryResource();
+
+        /*
+         * Returns the number of allocations served by this memory resource.
+         *
+         * @return the number of allocations served.
+         */
+        unsigned long long getAllocationsCounter() const;
+
+        /*
+         * Returns the number of bytes allocated by this memory resource.
+         *
+         * @return the number of bytes allocated.
+         */
+        unsigned long long getAllocatedBytes() const;
+};
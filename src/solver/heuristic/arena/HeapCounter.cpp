@@ -0,0 +1,95 @@
+#include "HeapCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+/* The number of allocations served by the global operator new to this thread. */
+static thread_local unsigned long long allocationsCounter = 0;
+
+/*
+ * Returns the number of allocations served by the global operator new to the
+ * calling thread since it started.
+ *
+ * @return the number of allocations served to the calling thread.
+ */
+unsigned long long HeapCounter::getAllocationsCounter() {
+    return allocationsCounter;
+}
+
+/*
+ * Allocates the specified number of bytes from the heap and counts the
+ * allocation. The array and non-throwing forms of operator new call this one.
+ *
+ * @param size the number of bytes.
+ *
+ * @return the allocated memory.
+ */
+void * operator new(std::size_t size) {
+    allocationsCounter++;
+
+    void * p = std::malloc(size > 0 ? size : 1);
+
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+/*
+ * Allocates the specified number of bytes from the heap with the specified
+ * alignment and counts the allocation.
+ *
+ * @param size      the number of bytes.
+ * @param alignment the alignment.
+ *
+ * @return the allocated memory.
+ */
+void * operator new(std::size_t size, std::align_val_t alignment) {
+    allocationsCounter++;
+
+    std::size_t a = static_cast<std::size_t>(alignment);
+    void * p = std::aligned_alloc(a, (size + a - 1) / a * a + (size == 0 ? a : 0));
+
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+/*
+ * Deallocates the specified memory to the heap.
+ *
+ * @param p the memory.
+ */
+void operator delete(void * p) noexcept {
+    std::free(p);
+}
+
+/*
+ * Deallocates the specified memory to the heap, whatever its number of bytes.
+ *
+ * @param p the memory.
+ */
+void operator delete(void * p, std::size_t) noexcept {
+    std::free(p);
+}
+
+/*
+ * Deallocates the specified aligned memory to the heap, whatever its alignment.
+ *
+ * @param p the memory.
+ */
+void operator delete(void * p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+/*
+ * Deallocates the specified aligned memory to the heap, whatever its number of
+ * bytes and its alignment.
+ *
+ * @param p the memory.
+ */
+void operator delete(void * p, std::size_t, std::align_val_t) noexcept {
+    std::free(p);
+}
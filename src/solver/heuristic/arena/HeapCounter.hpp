@@ -0,0 +1,19 @@
+#pragma once
+
+/*
+ * The HeapCounter class counts the allocations served by the global operator
+ * new in each thread, so that the allocations a thread makes outside the
+ * arenas can be measured while other threads run. Linking its translation
+ * unit replaces the global operator new and delete, so only test and
+ * instrumentation targets link it.
+ */
+class HeapCounter {
+    public:
+        /*
+         * Returns the number of allocations served by the global operator new
+         * to the calling thread since it started.
+         *
+         * @return the number of allocations served to the calling thread.
+         */
+        static unsigned long long getAllocationsCounter();
+};
@@ -0,0 +1,127 @@
+#include "IterationArena.hpp"
+#include <algorithm>
+
+/*
+ * Constructs a new arena.
+ *
+ * @param size the initial size in bytes of the arena's buffer.
+ */
+IterationArena::IterationArena(std::size_t size) : buffer(std::max<std::size_t>(size, 1)),
+    resource(new std::pmr::monotonic_buffer_resource(this->buffer.data(),
+                this->buffer.size(), &this->upstream)),
+    resetAllocatedBytes(0), resetsCounter(0), overflowsCounter(0), lastOverflowReset(0) {}
+
+/*
+ * Returns this arena's memory resource.
+ *
+ * @return this arena's memory resource.
+ */
+std::pmr::memory_resource * IterationArena::getResource() {
+    return this;
+}
+
+/*
+ * Allocates the specified number of bytes from this arena's buffer.
+ *
+ * @param bytes     the number of bytes.
+ * @param alignment the alignment.
+ *
+ * @return the allocated memory.
+ */
+void * IterationArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+    return this->resource->allocate(bytes, alignment);
+}
+
+/*
+ * Deallocates the specified memory, which is only released on reset.
+ *
+ * @param p         the memory.
+ * @param bytes     the number of bytes.
+ * @param alignment the alignment.
+ */
+void IterationArena::do_deallocate(void * p, std::size_t bytes, std::size_t alignment) {
+    this->resource->deallocate(p, bytes, alignment);
+}
+
+/*
+ * Verifies whether the specified memory resource is this arena.
+ *
+ * @param other the memory resource.
+ *
+ * @return true if the memory resource is this arena; false otherwise.
+ */
+bool IterationArena::do_is_equal(const std::pmr::memory_resource & other) const noexcept {
+    return this == &other;
+}
+
+/*
+ * Releases all the memory allocated from this arena since the last reset,
+ * growing its buffer if the iteration did not fit in it.
+ */
+void IterationArena::reset() {
+    unsigned long long overflowBytes = this->upstream.getAllocatedBytes() -
+        this->resetAllocatedBytes;
+
+    this->resource->release();
+    this->resetsCounter++;
+
+    if (overflowBytes > 0) {
+        /* The memory resource must not outlive the buffer it points to */
+        this->resource.reset();
+        this->buffer = std::vector<unsigned char> (this->buffer.size() + overflowBytes);
+        this->resource.reset(new std::pmr::monotonic_buffer_resource(this->buffer.data(),
+                    this->buffer.size(), &this->upstream));
+        this->overflowsCounter++;
+        this->lastOverflowReset = this->resetsCounter;
+    }
+
+    this->resetAllocatedBytes = this->upstream.getAllocatedBytes();
+}
+
+/*
+ * Returns the size in bytes of this arena's buffer.
+ *
+ * @return the size in bytes of this arena's buffer.
+ */
+std::size_t IterationArena::getSize() const {
+    return this->buffer.size();
+}
+
+/*
+ * Returns the number of allocations from the global heap made by this arena
+ * when its buffer ran out.
+ *
+ * @return the number of allocations from the global heap.
+ */
+unsigned long long IterationArena::getUpstreamAllocationsCounter() const {
+    return this->upstream.getAllocationsCounter();
+}
+
+/*
+ * Returns the number of resets of this arena.
+ *
+ * @return the number of resets.
+ */
+unsigned int IterationArena::getResetsCounter() const {
+    return this->resetsCounter;
+}
+
+/*
+ * Returns the number of iterations whose temporaries did not fit in this
+ * arena's buffer.
+ *
+ * @return the number of iterations that did not fit in the buffer.
+ */
+unsigned int IterationArena::getOverflowsCounter() const {
+    return this->overflowsCounter;
+}
+
+/*
+ * Returns the reset that ended the last iteration which did not fit in this
+ * arena's buffer; zero if all iterations fit.
+ *
+ * @return the reset that ended the last iteration which did not fit.
+ */
+unsigned int IterationArena::getLastOverflowReset() const {
+    return this->lastOverflowReset;
+}
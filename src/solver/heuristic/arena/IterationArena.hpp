@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CountingMemoryResource.hpp"
+#include <memory>
+#include <vector>
+
+/*
+ * The IterationArena class represents a monotonic memory resource for the
+ * temporaries of a single iteration, which are all released at once when the
+ * arena is reset. The arena serves its allocations from a buffer kept across
+ * iterations and falls back to the global heap when it runs out; on reset,
+ * the buffer grows by the memory taken from the global heap, so that once the
+ * buffer covers the largest iteration no further allocation reaches the
+ * global heap. The arena is itself the memory resource handed to its users,
+ * so that it stays valid when the buffer grows.
+ */
+class IterationArena : public std::pmr::memory_resource {
+    private:
+        /* The global heap, counting the allocations the buffer could not serve. */
+        CountingMemoryResource upstream;
+
+        /* The memory kept across iterations. */
+        std::vector<unsigned char> buffer;
+
+        /* The monotonic memory resource over the buffer. */
+        std::unique_ptr<std::pmr::monotonic_buffer_resource> resource;
+
+        /* The number of bytes taken from the global heap before the last reset. */
+        unsigned long long resetAllocatedBytes;
+
+        /* The number of resets. */
+        unsigned int resetsCounter;
+
+        /* The number of iterations whose temporaries did not fit in the buffer. */
+        unsigned int overflowsCounter;
+
+        /* The reset that ended the last iteration which did not fit in the buffer. */
+        unsigned int lastOverflowReset;
+
+        /*
+         * Allocates the specified number of bytes from this arena's buffer.
+         *
+         * @param bytes     the number of bytes.
+         * @param alignment the alignment.
+         *
+         * @return the allocated memory.
+         */
+        void * do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+        /*
+         * Deallocates the specified memory, which is only released on reset.
+         *
+         * @param p         the memory.
+         * @param bytes     the number of bytes.
+         * @param alignment the alignment.
+         */
+        void do_deallocate(void * p, std::size_t bytes, std::size_t alignment) override;
+
+        /*
+         * Verifies whether the specified memory resource is this arena.
+         *
+         * @param other the memory resource.
+         *
+         * @return true if the memory resource is this arena; false otherwise.
+         */
+        bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override;
+
+    public:
+        /*
+         * Constructs a new arena.
+         *
+         * @param size the initial size in bytes of the arena's buffer.
+         */
+        IterationArena(std::size_t size);
+
+        /*
+         * Returns this arena's memory resource.
+         *
+         * @return this arena's memory resource.
+         */
+        std::pmr::memory_resource * getResource();
+
+        /*
+         * Releases all the memory allocated from this arena since the last
+         * reset, growing its buffer if the iteration did not fit in it.
+         */
+        void reset();
+
+        /*
+         * Returns the size in bytes of this arena's buffer.
+         *
+         * @return the size in bytes of this arena's buffer.
+         */
+        std::size_t getSize() const;
+
+        /*
+         * Returns the number of allocations from the global heap made by this
+         * arena when its buffer ran out.
+         *
+         * @return the number of allocations from the global heap.
+         */
+        unsigned long long getUpstreamAllocationsCounter() const;
+
+        /*
+         * Returns the number of resets of this arena.
+         *
+         * @return the number of resets.
+         */
+        unsigned int getResetsCounter() const;
+
+        /*
+         * Returns the number of iterations whose temporaries did not fit in
+         * this arena's buffer.
+         *
+         * @return the number of iterations that did not fit in the buffer.
+         */
+        unsigned int getOverflowsCounter() const;
+
+        /*
+         * Returns the reset that ended the last iteration which did not fit in
+         * this arena's buffer; zero if all iterations fit.
+         *
+         * @return the reset that ended the last iteration which did not fit.
+         */
+        unsigned int getLastOverflowReset() const;
+};
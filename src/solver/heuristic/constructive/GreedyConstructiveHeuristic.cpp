@@ -60,35 +60,35 @@ void GreedyConstructiveHeuristic::setAlpha(double alpha) {
  */
 Solution GreedyConstructiveHeuristic::constructSolution(unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    std::vector<std::set<Edge> > districts (this->instance.getM());
-    std::vector<double> districtsDemand (this->instance.getM(), 0.0);
+    /* The temporaries are allocated from this heuristic's memory resource */
+    std::pmr::vector<unsigned int> districtsSize (this->instance.getM(), 0,
+            this->memoryResource);
+    std::pmr::vector<double> districtsDemand (this->instance.getM(), 0.0,
+            this->memoryResource);
     std::vector<unsigned int> edgesDistrict (this->instance.getG().m(), this->instance.getM());
-    std::vector<std::set<Edge> > edgesAdjacentEdges (this->instance.getG().m());
-    std::set<Edge> unallocatedEdges = this->instance.getG().getEdges();
-    std::vector<std::set<Edge> > districtsUnallocatedAdjacentEdges (this->instance.getM());
-    std::set<unsigned int> emptyDistricts;
+    std::pmr::set<Edge> unallocatedEdges (this->memoryResource);
+    std::pmr::vector<std::pmr::set<Edge> > districtsUnallocatedAdjacentEdges (
+            this->instance.getM(), this->memoryResource);
+    std::pmr::vector<std::pair<std::pair<Edge, unsigned int>, double> > candidateList (
+            this->memoryResource);
+    std::pmr::vector<std::pair<std::pair<Edge, unsigned int>, double> >
+        restrictedCandidateList (this->memoryResource);
     double maxDemand = this->instance.getMaximumDemand();
     double minDemand = this->instance.getMinimumDemand();
 
-    for (const Edge & e : this->instance.getG().getEdges()) {
-        unsigned int eId = this->instance.getG().getEdgeId(e);
-
-        edgesAdjacentEdges[eId - 1] = this->instance.getG().getAdjacentEdges(e);
-    }
-
-    for (unsigned int j = 0; j < this->instance.getM(); j++) {
-        emptyDistricts.insert(j);
+    for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+        unallocatedEdges.insert(this->instance.getEdge(eId));
     }
 
     /* while E \ ∪_{j = 1}^{m}{E_{j}} ≠ ∅ */
     while (!unallocatedEdges.empty() && Heuristic::getElapsedTime(startTime) < timeLimit) {
         /* CL ← ∅ */
-        std::vector<std::pair<std::pair<Edge, unsigned int>, double> > candidateList;
+        candidateList.clear();
 
         /* ∀ j ∈ {1, ..., m} */
         for (unsigned int j = 0; j < this->instance.getM(); j++) {
             /* if E_{j} ≠ ∅ ∧ d_{E_{j}} < (1 - B) \bar{d}_{ℰ} */
-            if (!districts[j].empty() && districtsDemand[j] < minDemand) {
+            if (districtsSize[j] > 0 && districtsDemand[j] < minDemand) {
                 /* Let V_{j} ⊆ V such that G[E_{j}] = (V_{j}, E_{j}) */
                 /* ∀ e ∈ σ_{G}(V_{j}) \ ∪_{k = 1}^{m}{E_{k}} */
                 for (const Edge & e : districtsUnallocatedAdjacentEdges[j]) {
@@ -108,7 +108,7 @@ Solution GreedyConstructiveHeuristic::constructSolution(unsigned int timeLimit)
             /* ∀ j ∈ {1, ..., m} */
             for (unsigned int j = 0; j < this->instance.getM(); j++) {
                 /* if E_{j} = ∅ */
-                if (districts[j].empty()) {
+                if (districtsSize[j] == 0) {
                     /* ∀ e ∈ E \ ∪_{k = 1}^{m}{E_{k}} */
                     for (const Edge & e : unallocatedEdges) {
                         /* CL ← CL ∪ {(e, j, c_{e, j})} */
@@ -181,7 +181,7 @@ Solution GreedyConstructiveHeuristic::constructSolution(unsigned int timeLimit)
         double threshold = maxC - this->alpha * (maxC - minC);
 
         /* RCL ← ∅ */
-        std::vector<std::pair<std::pair<Edge, unsigned int>, double> > restrictedCandidateList;
+        restrictedCandidateList.clear();
 
         /* ∀ (e, j, c_{e, j}) */
         for (const std::pair<std::pair<Edge, unsigned int>, double> & 
@@ -203,25 +203,26 @@ Solution GreedyConstructiveHeuristic::constructSolution(unsigned int timeLimit)
         unsigned int j = chosenCandidate.first.second;
 
         /* E_{j} ← E_{j} ∪ {e} */
-        districts[j].insert(e);
+        districtsSize[j]++;
         districtsDemand[j] += 2.0 * e.w;
         edgesDistrict[eId - 1] = j;
         unallocatedEdges.erase(e);
-        emptyDistricts.erase(j);
         districtsUnallocatedAdjacentEdges[j].erase(e);
 
-        for (const Edge & f : edgesAdjacentEdges[eId - 1]) {
-            unsigned int fId = this->instance.getG().getEdgeId(f);
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(eId); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            unsigned int fId = *fIdIt;
             unsigned int k = edgesDistrict[fId - 1];
 
             if (k < this->instance.getM()) {
                 districtsUnallocatedAdjacentEdges[k].erase(e);
             } else {
-                districtsUnallocatedAdjacentEdges[j].insert(f);
+                districtsUnallocatedAdjacentEdges[j].insert(this->instance.getEdge(fId));
             }
         }
     }
 
-    return Solution(this->instance, districts);
+    return Solution(this->instance, edgesDistrict);
 }
 
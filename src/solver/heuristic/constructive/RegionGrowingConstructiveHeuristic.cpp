@@ -0,0 +1,352 @@
+#include "RegionGrowingConstructiveHeuristic.hpp"
+#include <cfloat>
+#include <cmath>
+#include <queue>
+
+/* Euclidean seeding constant: the seeds are spread by the distance between the edges' midpoints. */
+const unsigned int RegionGrowingConstructiveHeuristic::EUCLIDEAN_SEEDING = 0;
+
+/* Line graph seeding constant: the seeds are spread by the distance in the line graph. */
+const unsigned int RegionGrowingConstructiveHeuristic::LINE_GRAPH_SEEDING = 1;
+
+/*
+ * Constructs a new constructive heuristic.
+ *
+ * @param instance the new constructive heuristic's instance.
+ * @param seed     the seed for the new constructive heuristic's pseudo-random
+ *                 numbers generator.
+ * @param alpha    the new constructive heuristic's threshold parameter.
+ * @param seeding  the new constructive heuristic's rule for spreading the
+ *                 seeds.
+ */
+RegionGrowingConstructiveHeuristic::RegionGrowingConstructiveHeuristic(
+        const Instance & instance, unsigned int seed, double alpha,
+        unsigned int seeding) : Heuristic::Heuristic(instance, seed), alpha(alpha),
+    seeding(seeding), hungarianAlgorithm(instance.getM()) {}
+
+/*
+ * Constructs a new constructive heuristic that spreads the seeds in the line
+ * graph.
+ *
+ * @param instance the new constructive heuristic's instance.
+ * @param seed     the seed for the new constructive heuristic's pseudo-random
+ *                 numbers generator.
+ */
+RegionGrowingConstructiveHeuristic::RegionGrowingConstructiveHeuristic(
+        const Instance & instance, unsigned int seed) :
+    RegionGrowingConstructiveHeuristic::RegionGrowingConstructiveHeuristic(instance,
+            seed, 0.0, LINE_GRAPH_SEEDING) {}
+
+/*
+ * Constructs a new empty constructive heuristic.
+ */
+RegionGrowingConstructiveHeuristic::RegionGrowingConstructiveHeuristic() :
+    Heuristic::Heuristic(), alpha(0.0), seeding(LINE_GRAPH_SEEDING) {}
+
+/*
+ * Returns this constructive heuristic's threshold parameter.
+ *
+ * @return this constructive heuristic's threshold parameter.
+ */
+double RegionGrowingConstructiveHeuristic::getAlpha() const {
+    return this->alpha;
+}
+
+/*
+ * Sets this constructive heuristic's threshold parameter.
+ *
+ * @param alpha the new threshold parameter.
+ */
+void RegionGrowingConstructiveHeuristic::setAlpha(double alpha) {
+    this->alpha = alpha;
+}
+
+/*
+ * Returns this constructive heuristic's rule for spreading the seeds.
+ *
+ * @return this constructive heuristic's rule for spreading the seeds.
+ */
+unsigned int RegionGrowingConstructiveHeuristic::getSeeding() const {
+    return this->seeding;
+}
+
+/*
+ * Sets this constructive heuristic's rule for spreading the seeds.
+ *
+ * @param seeding the new rule for spreading the seeds.
+ */
+void RegionGrowingConstructiveHeuristic::setSeeding(unsigned int seeding) {
+    this->seeding = seeding;
+}
+
+/*
+ * Updates the distance of each edge to its nearest seed with the specified
+ * new seed, by the Euclidean distance between the edges' midpoints.
+ *
+ * @param sId       the new seed's id.
+ * @param distances the distance of each edge to its nearest seed.
+ */
+void RegionGrowingConstructiveHeuristic::updateEuclideanDistances(unsigned int sId,
+        std::pmr::vector<double> & distances) const {
+    const Edge & s = this->instance.getEdge(sId);
+    double sx = (s.u.x + s.v.x) / 2.0;
+    double sy = (s.u.y + s.v.y) / 2.0;
+
+    for (unsigned int eId = 1; eId <= distances.size(); eId++) {
+        const Edge & e = this->instance.getEdge(eId);
+        double distance = hypot((e.u.x + e.v.x) / 2.0 - sx, (e.u.y + e.v.y) / 2.0 - sy);
+
+        if (distance < distances[eId - 1]) {
+            distances[eId - 1] = distance;
+        }
+    }
+}
+
+/*
+ * Updates the distance of each edge to its nearest seed with the specified
+ * new seed, by the number of edges in a shortest path of the line graph. Only
+ * the edges that get closer are visited.
+ *
+ * @param sId       the new seed's id.
+ * @param distances the distance of each edge to its nearest seed.
+ */
+void RegionGrowingConstructiveHeuristic::updateLineGraphDistances(unsigned int sId,
+        std::pmr::vector<double> & distances) const {
+    std::pmr::vector<unsigned int> Q (this->memoryResource);
+
+    distances[sId - 1] = 0.0;
+    Q.push_back(sId);
+
+    for (unsigned int i = 0; i < Q.size(); i++) {
+        unsigned int eId = Q[i];
+
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            if (distances[eId - 1] + 1.0 < distances[*fIdIt - 1]) {
+                distances[*fIdIt - 1] = distances[eId - 1] + 1.0;
+                Q.push_back(*fIdIt);
+            }
+        }
+    }
+}
+
+/*
+ * Chooses one seed edge for each district by the farthest-first rule: each
+ * seed is chosen at random among the edges whose distance to the nearest seed
+ * is within the threshold of the largest one. The seeds are then assigned to
+ * the districts of largest total profit.
+ *
+ * @return the seed of each district.
+ */
+std::pmr::vector<unsigned int> RegionGrowingConstructiveHeuristic::chooseSeeds() {
+    unsigned int m = this->instance.getM();
+    std::pmr::vector<double> distances (this->instance.getG().m(), DBL_MAX,
+            this->memoryResource);
+    std::pmr::vector<bool> isSeed (this->instance.getG().m(), false, this->memoryResource);
+    std::pmr::vector<unsigned int> seeds (this->memoryResource);
+    std::pmr::vector<unsigned int> restrictedCandidateList (this->memoryResource);
+    std::uniform_int_distribution<unsigned int> edgesDistribution (1,
+            this->instance.getG().m());
+
+    /* The first seed is any edge */
+    seeds.push_back(edgesDistribution(this->generator));
+
+    while (seeds.size() < m && seeds.size() < this->instance.getG().m()) {
+        isSeed[seeds.back() - 1] = true;
+
+        if (this->seeding == EUCLIDEAN_SEEDING) {
+            this->updateEuclideanDistances(seeds.back(), distances);
+        } else {
+            this->updateLineGraphDistances(seeds.back(), distances);
+        }
+
+        double minDistance = DBL_MAX, maxDistance = 0.0;
+
+        for (unsigned int eId = 1; eId <= distances.size(); eId++) {
+            if (!isSeed[eId - 1]) {
+                minDistance = std::min(minDistance, distances[eId - 1]);
+                maxDistance = std::max(maxDistance, distances[eId - 1]);
+            }
+        }
+
+        double threshold = maxDistance - this->alpha * (maxDistance - minDistance);
+
+        /* RCL ← {e ∈ E : dist(e, S) ≥ maxDist - α(maxDist - minDist)} */
+        restrictedCandidateList.clear();
+
+        for (unsigned int eId = 1; eId <= distances.size(); eId++) {
+            if (!isSeed[eId - 1] && distances[eId - 1] >= threshold) {
+                restrictedCandidateList.push_back(eId);
+            }
+        }
+
+        std::uniform_int_distribution<unsigned int> distribution (0,
+                restrictedCandidateList.size() - 1);
+        seeds.push_back(restrictedCandidateList[distribution(this->generator)]);
+    }
+
+    /* The districts are assigned the seeds of largest total profit */
+    this->hungarianAlgorithm.reset(m);
+
+    for (unsigned int i = 0; i < seeds.size(); i++) {
+        double * row = this->hungarianAlgorithm.getRow(i);
+
+        for (unsigned int j = 0; j < m; j++) {
+            row[j] = this->instance.getC(seeds[i], j);
+        }
+    }
+
+    const std::vector<unsigned int> & districtsIds =
+        this->hungarianAlgorithm.maxCostAssignment();
+    std::pmr::vector<unsigned int> districtsSeed (m, 0, this->memoryResource);
+
+    for (unsigned int i = 0; i < seeds.size(); i++) {
+        districtsSeed[districtsIds[i]] = seeds[i];
+    }
+
+    return districtsSeed;
+}
+
+/*
+ * Constructs a solution for this heuristic's instance. The district of least
+ * demand repeatedly takes its most profitable unallocated adjacent edge that
+ * keeps its demand within the maximum, until no district can grow; the edges
+ * left are then given to an adjacent district, so that the solution is a
+ * connected partition whenever the graph is connected.
+ *
+ * @param timeLimit the time limit.
+ *
+ * @return a solution for this heuristic's instance.
+ */
+Solution RegionGrowingConstructiveHeuristic::constructSolution(unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    unsigned int m = this->instance.getM();
+    double maxDemand = this->instance.getMaximumDemand();
+    std::vector<unsigned int> edgesDistrict (this->instance.getG().m(), m);
+
+    if (this->instance.getG().m() == 0) {
+        return Solution(this->instance, edgesDistrict);
+    }
+
+    std::pmr::vector<double> districtsDemand (m, 0.0, this->memoryResource);
+    /* The frontier of each district, keyed by the perturbed profit of each edge */
+    std::pmr::vector<std::priority_queue<std::pair<double, unsigned int>,
+        std::pmr::vector<std::pair<double, unsigned int> > > > frontiers (m,
+                this->memoryResource);
+    /* The districts that can grow, keyed by their demand, smallest first */
+    std::priority_queue<std::pair<double, unsigned int>,
+        std::pmr::vector<std::pair<double, unsigned int> >,
+        std::greater<std::pair<double, unsigned int> > > districtsQueue (
+                std::greater<std::pair<double, unsigned int> > (),
+                std::pmr::vector<std::pair<double, unsigned int> > (this->memoryResource));
+    std::uniform_real_distribution<double> noiseDistribution (0.0, 1.0);
+    double minC = DBL_MAX, maxC = -DBL_MAX;
+
+    for (unsigned int eId = 1; eId <= this->instance.getG().m(); eId++) {
+        for (unsigned int j = 0; j < m; j++) {
+            minC = std::min(minC, this->instance.getC(eId, j));
+            maxC = std::max(maxC, this->instance.getC(eId, j));
+        }
+    }
+
+    double noise = this->alpha * (maxC - minC);
+    std::pmr::vector<unsigned int> districtsSeed = this->chooseSeeds();
+
+    /* ∀ j ∈ {1, ..., m}: E_{j} ← {s_{j}} */
+    for (unsigned int j = 0; j < m; j++) {
+        unsigned int sId = districtsSeed[j];
+
+        if (sId == 0 || edgesDistrict[sId - 1] < m) {
+            continue;
+        }
+
+        edgesDistrict[sId - 1] = j;
+        districtsDemand[j] += 2.0 * this->instance.getEdge(sId).w;
+    }
+
+    for (unsigned int j = 0; j < m; j++) {
+        unsigned int sId = districtsSeed[j];
+
+        if (sId == 0 || edgesDistrict[sId - 1] != j) {
+            continue;
+        }
+
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(sId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(sId); fIdIt++) {
+            if (edgesDistrict[*fIdIt - 1] == m) {
+                frontiers[j].push(std::make_pair(this->instance.getC(*fIdIt, j) -
+                            noise * noiseDistribution(this->generator), *fIdIt));
+            }
+        }
+
+        districtsQueue.push(std::make_pair(districtsDemand[j], j));
+    }
+
+    /* The district of least demand takes its most profitable frontier edge */
+    for (unsigned int i = 0; !districtsQueue.empty(); i++) {
+        /* The time is checked every few edges, since each step is cheap */
+        if (i % 256 == 0 && Heuristic::getElapsedTime(startTime) >= timeLimit) {
+            break;
+        }
+
+        unsigned int j = districtsQueue.top().second;
+        districtsQueue.pop();
+
+        /* The edges taken by other districts or over the maximum demand leave the frontier */
+        while (!frontiers[j].empty() && (edgesDistrict[frontiers[j].top().second - 1] < m ||
+                    districtsDemand[j] + 2.0 * this->instance.getEdge(
+                        frontiers[j].top().second).w > maxDemand)) {
+            frontiers[j].pop();
+        }
+
+        /* E_{j} cannot grow any more */
+        if (frontiers[j].empty()) {
+            continue;
+        }
+
+        unsigned int eId = frontiers[j].top().second;
+        frontiers[j].pop();
+
+        /* E_{j} ← E_{j} ∪ {e} */
+        edgesDistrict[eId - 1] = j;
+        districtsDemand[j] += 2.0 * this->instance.getEdge(eId).w;
+
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            if (edgesDistrict[*fIdIt - 1] == m) {
+                frontiers[j].push(std::make_pair(this->instance.getC(*fIdIt, j) -
+                            noise * noiseDistribution(this->generator), *fIdIt));
+            }
+        }
+
+        districtsQueue.push(std::make_pair(districtsDemand[j], j));
+    }
+
+    /* The edges left join the district that reaches them first, keeping it connected */
+    std::pmr::vector<unsigned int> Q (this->memoryResource);
+
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        if (edgesDistrict[eId - 1] < m) {
+            Q.push_back(eId);
+        }
+    }
+
+    for (unsigned int i = 0; i < Q.size(); i++) {
+        unsigned int eId = Q[i];
+        unsigned int j = edgesDistrict[eId - 1];
+
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            if (edgesDistrict[*fIdIt - 1] == m) {
+                edgesDistrict[*fIdIt - 1] = j;
+                Q.push_back(*fIdIt);
+            }
+        }
+    }
+
+    return Solution(this->instance, edgesDistrict);
+}
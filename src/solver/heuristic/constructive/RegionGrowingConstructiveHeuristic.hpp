@@ -0,0 +1,144 @@
+#pragma once
+
+#include "../Heuristic.hpp"
+#include "../../../solution/Solution.hpp"
+#include "../../../hungarian-algorithm/HungarianAlgorithm.hpp"
+
+/*
+ * The RegionGrowingConstructiveHeuristic represents a constructive heuristic
+ * for the CEDP that chooses one seed edge per district, spread over the graph,
+ * and grows all the districts at once from their seeds, so that the districts
+ * are connected and of similar demand by construction.
+ */
+class RegionGrowingConstructiveHeuristic : public Heuristic {
+    private:
+        /*
+         * This constructive heuristic's threshold parameter for the random
+         * choice of the seeds and the perturbation of the edges' profits, in
+         * the interval [0, 1].
+         */
+        double alpha;
+
+        /* The rule for spreading the seeds. */
+        unsigned int seeding;
+
+        /* This constructive heuristic's solver for the seeds' assignment. */
+        HungarianAlgorithm hungarianAlgorithm;
+
+        /*
+         * Updates the distance of each edge to its nearest seed with the
+         * specified new seed, by the Euclidean distance between the edges'
+         * midpoints.
+         *
+         * @param sId       the new seed's id.
+         * @param distances the distance of each edge to its nearest seed.
+         */
+        void updateEuclideanDistances(unsigned int sId,
+                std::pmr::vector<double> & distances) const;
+
+        /*
+         * Updates the distance of each edge to its nearest seed with the
+         * specified new seed, by the number of edges in a shortest path of the
+         * line graph.
+         *
+         * @param sId       the new seed's id.
+         * @param distances the distance of each edge to its nearest seed.
+         */
+        void updateLineGraphDistances(unsigned int sId,
+                std::pmr::vector<double> & distances) const;
+
+        /*
+         * Chooses one seed edge for each district by the farthest-first rule:
+         * each seed is chosen at random among the edges whose distance to the
+         * nearest seed is within the threshold of the largest one. The seeds
+         * are then assigned to the districts of largest total profit.
+         *
+         * @return the seed of each district.
+         */
+        std::pmr::vector<unsigned int> chooseSeeds();
+
+    public:
+        /*
+         * Euclidean seeding constant: the seeds are spread by the distance
+         * between the edges' midpoints.
+         */
+        static const unsigned int EUCLIDEAN_SEEDING;
+
+        /*
+         * Line graph seeding constant: the seeds are spread by the distance
+         * in the line graph.
+         */
+        static const unsigned int LINE_GRAPH_SEEDING;
+
+        /*
+         * Constructs a new constructive heuristic.
+         *
+         * @param instance the new constructive heuristic's instance.
+         * @param seed     the seed for the new constructive heuristic's
+         *                 pseudo-random numbers generator.
+         * @param alpha    the new constructive heuristic's threshold
+         *                 parameter.
+         * @param seeding  the new constructive heuristic's rule for spreading
+         *                 the seeds.
+         */
+        RegionGrowingConstructiveHeuristic(const Instance & instance,
+                unsigned int seed, double alpha, unsigned int seeding);
+
+        /*
+         * Constructs a new constructive heuristic that spreads the seeds in
+         * the line graph.
+         *
+         * @param instance the new constructive heuristic's instance.
+         * @param seed     the seed for the new constructive heuristic's
+         *                 pseudo-random numbers generator.
+         */
+        RegionGrowingConstructiveHeuristic(const Instance & instance,
+                unsigned int seed);
+
+        /*
+         * Constructs a new empty constructive heuristic.
+         */
+        RegionGrowingConstructiveHeuristic();
+
+        /*
+         * Returns this constructive heuristic's threshold parameter.
+         *
+         * @return this constructive heuristic's threshold parameter.
+         */
+        double getAlpha() const;
+
+        /*
+         * Sets this constructive heuristic's threshold parameter.
+         *
+         * @param alpha the new threshold parameter.
+         */
+        void setAlpha(double alpha);
+
+        /*
+         * Returns this constructive heuristic's rule for spreading the seeds.
+         *
+         * @return this constructive heuristic's rule for spreading the seeds.
+         */
+        unsigned int getSeeding() const;
+
+        /*
+         * Sets this constructive heuristic's rule for spreading the seeds.
+         *
+         * @param seeding the new rule for spreading the seeds.
+         */
+        void setSeeding(unsigned int seeding);
+
+        /*
+         * Constructs a solution for this heuristic's instance. The district
+         * of least demand repeatedly takes its most profitable unallocated
+         * adjacent edge that keeps its demand within the maximum, until no
+         * district can grow; the edges left are then given to an adjacent
+         * district, so that the solution is a connected partition whenever
+         * the graph is connected.
+         *
+         * @param timeLimit the time limit.
+         *
+         * @return a solution for this heuristic's instance.
+         */
+        Solution constructSolution(unsigned int timeLimit);
+};
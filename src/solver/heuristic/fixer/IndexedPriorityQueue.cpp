@@ -0,0 +1,164 @@
+#include "IndexedPriorityQueue.hpp"
+
+/*
+ * Constructs a new empty indexed priority queue.
+ *
+ * @param n the largest id.
+ */
+IndexedPriorityQueue::IndexedPriorityQueue(unsigned int n)
+    : IndexedPriorityQueue::IndexedPriorityQueue(n, std::pmr::get_default_resource()) {}
+
+/*
+ * Constructs a new empty indexed priority queue allocated from the specified
+ * memory resource.
+ *
+ * @param n              the largest id.
+ * @param memoryResource the memory resource.
+ */
+IndexedPriorityQueue::IndexedPriorityQueue(unsigned int n,
+        std::pmr::memory_resource * memoryResource) : heap(memoryResource),
+    positions(n + 1, 0, memoryResource), keys(n + 1, memoryResource) {}
+
+/*
+ * Constructs a new empty indexed priority queue with no ids.
+ */
+IndexedPriorityQueue::IndexedPriorityQueue() : IndexedPriorityQueue::IndexedPriorityQueue(0) {}
+
+/*
+ * Swaps the ids in the specified positions of the heap.
+ *
+ * @param i the first position.
+ * @param j the second position.
+ */
+void IndexedPriorityQueue::swap(unsigned int i, unsigned int j) {
+    unsigned int id = this->heap[i];
+
+    this->heap[i] = this->heap[j];
+    this->heap[j] = id;
+    this->positions[this->heap[i]] = i + 1;
+    this->positions[this->heap[j]] = j + 1;
+}
+
+/*
+ * Moves the id in the specified position up while its key is greater than its
+ * parent's.
+ *
+ * @param i the position.
+ */
+void IndexedPriorityQueue::siftUp(unsigned int i) {
+    while (i > 0 && this->keys[this->heap[(i - 1) / 2]] < this->keys[this->heap[i]]) {
+        this->swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+}
+
+/*
+ * Moves the id in the specified position down while its key is less than one
+ * of its children's.
+ *
+ * @param i the position.
+ */
+void IndexedPriorityQueue::siftDown(unsigned int i) {
+    while (2 * i + 1 < this->heap.size()) {
+        unsigned int child = 2 * i + 1;
+
+        if (child + 1 < this->heap.size() &&
+                this->keys[this->heap[child]] < this->keys[this->heap[child + 1]]) {
+            child++;
+        }
+
+        if (!(this->keys[this->heap[i]] < this->keys[this->heap[child]])) {
+            break;
+        }
+
+        this->swap(i, child);
+        i = child;
+    }
+}
+
+/*
+ * Verifies whether this queue is empty.
+ *
+ * @return true if this queue is empty; false otherwise.
+ */
+bool IndexedPriorityQueue::isEmpty() const {
+    return this->heap.empty();
+}
+
+/*
+ * Verifies whether the specified id is in this queue.
+ *
+ * @param id the id.
+ *
+ * @return true if the id is in this queue; false otherwise.
+ */
+bool IndexedPriorityQueue::contains(unsigned int id) const {
+    return this->positions[id] != 0;
+}
+
+/*
+ * Returns the id with the greatest key.
+ *
+ * @return the id with the greatest key.
+ */
+unsigned int IndexedPriorityQueue::top() const {
+    return this->heap.front();
+}
+
+/*
+ * Returns the key of the specified id.
+ *
+ * @param id the id.
+ *
+ * @return the key of the id.
+ */
+const std::array<double, 3> & IndexedPriorityQueue::getKey(unsigned int id) const {
+    return this->keys[id];
+}
+
+/*
+ * Inserts the specified id with the specified key, or changes its key if it is
+ * already in this queue.
+ *
+ * @param id  the id.
+ * @param key the new key.
+ */
+void IndexedPriorityQueue::push(unsigned int id, const std::array<double, 3> & key) {
+    if (this->positions[id] == 0) {
+        this->heap.push_back(id);
+        this->positions[id] = this->heap.size();
+        this->keys[id] = key;
+        this->siftUp(this->heap.size() - 1);
+    } else if (this->keys[id] < key) {
+        this->keys[id] = key;
+        this->siftUp(this->positions[id] - 1);
+    } else {
+        this->keys[id] = key;
+        this->siftDown(this->positions[id] - 1);
+    }
+}
+
+/*
+ * Removes the specified id from this queue, if it is in it.
+ *
+ * @param id the id.
+ */
+void IndexedPriorityQueue::remove(unsigned int id) {
+    if (this->positions[id] == 0) {
+        return;
+    }
+
+    unsigned int i = this->positions[id] - 1;
+
+    this->swap(i, this->heap.size() - 1);
+    this->heap.pop_back();
+    this->positions[id] = 0;
+
+    /* The last id takes the removed one's position and may go either way */
+    if (i < this->heap.size()) {
+        unsigned int movedId = this->heap[i];
+
+        this->siftUp(i);
+        this->siftDown(this->positions[movedId] - 1);
+    }
+}
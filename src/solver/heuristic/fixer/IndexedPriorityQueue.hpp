@@ -0,0 +1,117 @@
+#pragma once
+
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+/*
+ * The IndexedPriorityQueue class represents a binary max-heap of ids in
+ * {1, ..., n}, each with a lexicographically compared key, which keeps the
+ * position of each id in the heap so that the key of any id can be changed or
+ * the id removed in logarithmic time.
+ */
+class IndexedPriorityQueue {
+    private:
+        /* The ids in heap order. */
+        std::pmr::vector<unsigned int> heap;
+
+        /* The position of each id in the heap plus one; 0 if the id is not in the heap. */
+        std::pmr::vector<unsigned int> positions;
+
+        /* The key of each id. */
+        std::pmr::vector<std::array<double, 3> > keys;
+
+        /*
+         * Swaps the ids in the specified positions of the heap.
+         *
+         * @param i the first position.
+         * @param j the second position.
+         */
+        void swap(unsigned int i, unsigned int j);
+
+        /*
+         * Moves the id in the specified position up while its key is greater
+         * than its parent's.
+         *
+         * @param i the position.
+         */
+        void siftUp(unsigned int i);
+
+        /*
+         * Moves the id in the specified position down while its key is less
+         * than one of its children's.
+         *
+         * @param i the position.
+         */
+        void siftDown(unsigned int i);
+
+    public:
+        /*
+         * Constructs a new empty indexed priority queue.
+         *
+         * @param n the largest id.
+         */
+        IndexedPriorityQueue(unsigned int n);
+
+        /*
+         * Constructs a new empty indexed priority queue allocated from the
+         * specified memory resource.
+         *
+         * @param n              the largest id.
+         * @param memoryResource the memory resource.
+         */
+        IndexedPriorityQueue(unsigned int n, std::pmr::memory_resource * memoryResource);
+
+        /*
+         * Constructs a new empty indexed priority queue with no ids.
+         */
+        IndexedPriorityQueue();
+
+        /*
+         * Verifies whether this queue is empty.
+         *
+         * @return true if this queue is empty; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /*
+         * Verifies whether the specified id is in this queue.
+         *
+         * @param id the id.
+         *
+         * @return true if the id is in this queue; false otherwise.
+         */
+        bool contains(unsigned int id) const;
+
+        /*
+         * Returns the id with the greatest key.
+         *
+         * @return the id with the greatest key.
+         */
+        unsigned int top() const;
+
+        /*
+         * Returns the key of the specified id.
+         *
+         * @param id the id.
+         *
+         * @return the key of the id.
+         */
+        const std::array<double, 3> & getKey(unsigned int id) const;
+
+        /*
+         * Inserts the specified id with the specified key, or changes its key
+         * if it is already in this queue.
+         *
+         * @param id  the id.
+         * @param key the new key.
+         */
+        void push(unsigned int id, const std::array<double, 3> & key);
+
+        /*
+         * Removes the specified id from this queue, if it is in it.
+         *
+         * @param id the id.
+         */
+        void remove(unsigned int id);
+};
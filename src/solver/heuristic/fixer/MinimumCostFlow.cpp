@@ -0,0 +1,117 @@
+#include "MinimumCostFlow.hpp"
+#include <algorithm>
+#include <cfloat>
+
+const double MinimumCostFlow::EPSILON = 1e-9;
+
+/*
+ * Constructs a new flow network without arcs.
+ *
+ * @param n the number of nodes.
+ */
+MinimumCostFlow::MinimumCostFlow(unsigned int n) : nodesArcs(n) {}
+
+/*
+ * Adds an arc to this network.
+ *
+ * @param u        the arc's tail.
+ * @param v        the arc's head.
+ * @param capacity the arc's capacity.
+ * @param cost     the arc's cost per unit of flow.
+ *
+ * @return the arc's id.
+ */
+unsigned int MinimumCostFlow::addArc(unsigned int u, unsigned int v, double capacity,
+        double cost) {
+    unsigned int a = this->heads.size();
+
+    this->nodesArcs[u].push_back(a);
+    this->heads.push_back(v);
+    this->capacities.push_back(capacity);
+    this->costs.push_back(cost);
+
+    this->nodesArcs[v].push_back(a + 1);
+    this->heads.push_back(u);
+    this->capacities.push_back(0.0);
+    this->costs.push_back(-cost);
+
+    return a;
+}
+
+/*
+ * Sends flow from the specified source to the specified sink along shortest
+ * augmenting paths while their cost is less than the specified one. The
+ * residual network of a minimum cost flow has no negative cycle, so the
+ * Bellman-Ford method stays valid after each augmentation.
+ *
+ * @param s       the source.
+ * @param t       the sink.
+ * @param maxCost the cost from which a path is not augmented.
+ *
+ * @return the cost of the flow sent.
+ */
+double MinimumCostFlow::solve(unsigned int s, unsigned int t, double maxCost) {
+    unsigned int n = this->nodesArcs.size();
+    double cost = 0.0;
+
+    while (true) {
+        std::vector<double> distances (n, DBL_MAX);
+        std::vector<unsigned int> predecessors (n, this->heads.size());
+        bool isUpdated = true;
+
+        distances[s] = 0.0;
+
+        for (unsigned int i = 0; i < n && isUpdated; i++) {
+            isUpdated = false;
+
+            for (unsigned int u = 0; u < n; u++) {
+                if (distances[u] == DBL_MAX) {
+                    continue;
+                }
+
+                for (unsigned int a : this->nodesArcs[u]) {
+                    unsigned int v = this->heads[a];
+
+                    if (this->capacities[a] > EPSILON &&
+                            distances[u] + this->costs[a] < distances[v] - EPSILON) {
+                        distances[v] = distances[u] + this->costs[a];
+                        predecessors[v] = a;
+                        isUpdated = true;
+                    }
+                }
+            }
+        }
+
+        if (distances[t] == DBL_MAX || distances[t] >= maxCost) {
+            break;
+        }
+
+        /* The path's bottleneck */
+        double flow = DBL_MAX;
+
+        for (unsigned int v = t; v != s; v = this->heads[predecessors[v] ^ 1]) {
+            flow = std::min(flow, this->capacities[predecessors[v]]);
+        }
+
+        for (unsigned int v = t; v != s; v = this->heads[predecessors[v] ^ 1]) {
+            this->capacities[predecessors[v]] -= flow;
+            this->capacities[predecessors[v] ^ 1] += flow;
+        }
+
+        cost += flow * distances[t];
+    }
+
+    return cost;
+}
+
+/*
+ * Returns the flow in the specified arc, which is the residual capacity of its
+ * reverse arc.
+ *
+ * @param a the arc's id.
+ *
+ * @return the flow in the arc.
+ */
+double MinimumCostFlow::getFlow(unsigned int a) const {
+    return this->capacities[a ^ 1];
+}
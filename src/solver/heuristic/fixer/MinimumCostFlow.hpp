@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+
+/*
+ * The MinimumCostFlow class represents a flow network on the nodes
+ * {0, ..., n - 1} whose arcs have real capacities and costs, solved by
+ * successive shortest augmenting paths. The shortest paths are found by the
+ * Bellman-Ford method, so arcs may have negative costs as long as the network
+ * has no negative cycle.
+ */
+class MinimumCostFlow {
+    private:
+        /* The adjacency list of each node, with the ids of its residual arcs. */
+        std::vector<std::vector<unsigned int> > nodesArcs;
+
+        /* The head of each residual arc; arc a ^ 1 is the reverse of arc a. */
+        std::vector<unsigned int> heads;
+
+        /* The residual capacity of each residual arc. */
+        std::vector<double> capacities;
+
+        /* The cost of each residual arc. */
+        std::vector<double> costs;
+
+    public:
+        /* The smallest amount of flow that is not treated as zero. */
+        static const double EPSILON;
+
+        /*
+         * Constructs a new flow network without arcs.
+         *
+         * @param n the number of nodes.
+         */
+        MinimumCostFlow(unsigned int n);
+
+        /*
+         * Adds an arc to this network.
+         *
+         * @param u        the arc's tail.
+         * @param v        the arc's head.
+         * @param capacity the arc's capacity.
+         * @param cost     the arc's cost per unit of flow.
+         *
+         * @return the arc's id.
+         */
+        unsigned int addArc(unsigned int u, unsigned int v, double capacity, double cost);
+
+        /*
+         * Sends flow from the specified source to the specified sink along
+         * shortest augmenting paths while their cost is less than the
+         * specified one.
+         *
+         * @param s       the source.
+         * @param t       the sink.
+         * @param maxCost the cost from which a path is not augmented.
+         *
+         * @return the cost of the flow sent.
+         */
+        double solve(unsigned int s, unsigned int t, double maxCost);
+
+        /*
+         * Returns the flow in the specified arc.
+         *
+         * @param a the arc's id.
+         *
+         * @return the flow in the arc.
+         */
+        double getFlow(unsigned int a) const;
+};
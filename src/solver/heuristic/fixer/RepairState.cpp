@@ -0,0 +1,263 @@
+#include "RepairState.hpp"
+#include <algorithm>
+
+/*
+ * Constructs a new repair state.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param edgesDistrict the district of each edge.
+ */
+RepairState::RepairState(const Instance & instance,
+        const std::vector<unsigned int> & edgesDistrict) : RepairState::RepairState(instance,
+            edgesDistrict, std::pmr::get_default_resource()) {}
+
+/*
+ * Constructs a new repair state allocated from the specified memory resource.
+ *
+ * @param instance       the instance of the repaired solution.
+ * @param edgesDistrict  the district of each edge.
+ * @param memoryResource the memory resource.
+ */
+RepairState::RepairState(const Instance & instance,
+        const std::vector<unsigned int> & edgesDistrict,
+        std::pmr::memory_resource * memoryResource) : instance(instance),
+    memoryResource(memoryResource), edgesPosition(edgesDistrict.size(), 0, memoryResource),
+    visitedStamps(edgesDistrict.size(), 0, memoryResource), visitedStamp(0),
+    discoveryTimes(edgesDistrict.size(), 0, memoryResource),
+    lowTimes(edgesDistrict.size(), 0, memoryResource),
+    edgesDistrict(edgesDistrict.begin(), edgesDistrict.end(), memoryResource),
+    districtsEdges(instance.getM() + 1, memoryResource),
+    districtsDemand(instance.getM(), 0.0, memoryResource),
+    isBridgeThatIsNotLeaf(edgesDistrict.size(), false, memoryResource) {
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        unsigned int j = std::min(edgesDistrict[eId - 1], instance.getM());
+
+        this->edgesDistrict[eId - 1] = j;
+        this->edgesPosition[eId - 1] = this->districtsEdges[j].size();
+        this->districtsEdges[j].push_back(eId);
+
+        if (j < instance.getM()) {
+            this->districtsDemand[j] += 2 * instance.getEdge(eId).w;
+        }
+    }
+
+    for (unsigned int j = 0; j < instance.getM(); j++) {
+        this->updateBridgesThatAreNotLeafs(j);
+    }
+}
+
+/*
+ * Returns the memory resource of this state and of the repair's temporaries.
+ *
+ * @return the memory resource.
+ */
+std::pmr::memory_resource * RepairState::getMemoryResource() const {
+    return this->memoryResource;
+}
+
+/*
+ * Visits the edges of the specified district reachable from the specified one
+ * in depth-first order, marking the edges whose removal disconnects the
+ * district's other edges, i.e., its bridges that are not leaf edges.
+ *
+ * @param j        the district.
+ * @param eId      the edge's id.
+ * @param parentId the id of the edge from which the edge was reached; 0 for
+ *                 the root.
+ * @param time     the current discovery time.
+ */
+void RepairState::visitEdges(unsigned int j, unsigned int eId, unsigned int parentId,
+        unsigned int & time) {
+    unsigned int childrenNumber = 0;
+
+    this->discoveryTimes[eId - 1] = ++time;
+    this->lowTimes[eId - 1] = time;
+
+    /* The edges sharing an endpoint are the neighbours of the district's line graph */
+    for (std::vector<unsigned int>::const_iterator fIdIt =
+            this->instance.getAdjacentEdgesIdsBegin(eId);
+            fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+        unsigned int fId = *fIdIt;
+
+        if (this->edgesDistrict[fId - 1] != j) {
+            continue;
+        }
+
+        if (this->discoveryTimes[fId - 1] == 0) {
+            childrenNumber++;
+            this->visitEdges(j, fId, eId, time);
+            this->lowTimes[eId - 1] = std::min(this->lowTimes[eId - 1],
+                    this->lowTimes[fId - 1]);
+
+            /* The edges below f only reach the rest of the district through e */
+            if (parentId != 0 && this->lowTimes[fId - 1] >= this->discoveryTimes[eId - 1]) {
+                this->isBridgeThatIsNotLeaf[eId - 1] = true;
+            }
+        } else {
+            this->lowTimes[eId - 1] = std::min(this->lowTimes[eId - 1],
+                    this->discoveryTimes[fId - 1]);
+        }
+    }
+
+    if (parentId == 0 && childrenNumber > 1) {
+        this->isBridgeThatIsNotLeaf[eId - 1] = true;
+    }
+}
+
+/*
+ * Moves the specified edge to the specified district.
+ *
+ * @param eId the edge's id.
+ * @param k   the district; m to unallocate the edge.
+ */
+void RepairState::moveEdge(unsigned int eId, unsigned int k) {
+    unsigned int j = this->edgesDistrict[eId - 1];
+    double demand = 2 * this->instance.getEdge(eId).w;
+
+    if (j == k) {
+        return;
+    }
+
+    /* The last edge of the district takes the moved edge's position */
+    unsigned int lastId = this->districtsEdges[j].back();
+
+    this->districtsEdges[j][this->edgesPosition[eId - 1]] = lastId;
+    this->edgesPosition[lastId - 1] = this->edgesPosition[eId - 1];
+    this->districtsEdges[j].pop_back();
+
+    if (j < this->instance.getM()) {
+        this->districtsDemand[j] -= demand;
+    }
+
+    this->edgesDistrict[eId - 1] = k;
+    this->edgesPosition[eId - 1] = this->districtsEdges[k].size();
+    this->districtsEdges[k].push_back(eId);
+    this->isBridgeThatIsNotLeaf[eId - 1] = false;
+
+    if (k < this->instance.getM()) {
+        this->districtsDemand[k] += demand;
+    }
+}
+
+/*
+ * Recomputes the bridges that are not leaf edges of the specified district.
+ * An edge is a bridge that is not a leaf edge exactly when removing it
+ * disconnects the district's other edges, i.e., when it is an articulation
+ * point of the district's line graph, which Tarjan's depth-first search finds
+ * directly on the edges' adjacency lists.
+ *
+ * @param j the district.
+ */
+void RepairState::updateBridgesThatAreNotLeafs(unsigned int j) {
+    unsigned int time = 0;
+
+    for (unsigned int eId : this->districtsEdges[j]) {
+        this->discoveryTimes[eId - 1] = 0;
+        this->isBridgeThatIsNotLeaf[eId - 1] = false;
+    }
+
+    for (unsigned int eId : this->districtsEdges[j]) {
+        if (this->discoveryTimes[eId - 1] == 0) {
+            this->visitEdges(j, eId, 0, time);
+        }
+    }
+}
+
+/*
+ * Returns the connected components of the specified district, allocated from
+ * this state's memory resource.
+ *
+ * @param j the district.
+ *
+ * @return the ids of the edges of each connected component.
+ */
+std::pmr::vector<std::pmr::vector<unsigned int> > RepairState::getConnectedComponents(
+        unsigned int j) {
+    std::pmr::vector<std::pmr::vector<unsigned int> > connectedComponents (
+            this->memoryResource);
+    unsigned int stamp = ++this->visitedStamp;
+
+    for (unsigned int eId : this->districtsEdges[j]) {
+        if (this->visitedStamps[eId - 1] == stamp) {
+            continue;
+        }
+
+        std::pmr::vector<unsigned int> Q (1, eId, this->memoryResource);
+
+        this->visitedStamps[eId - 1] = stamp;
+
+        for (unsigned int i = 0; i < Q.size(); i++) {
+            for (std::vector<unsigned int>::const_iterator fIdIt =
+                    this->instance.getAdjacentEdgesIdsBegin(Q[i]);
+                    fIdIt != this->instance.getAdjacentEdgesIdsEnd(Q[i]); fIdIt++) {
+                if (this->visitedStamps[*fIdIt - 1] != stamp &&
+                        this->edgesDistrict[*fIdIt - 1] == j) {
+                    this->visitedStamps[*fIdIt - 1] = stamp;
+                    Q.push_back(*fIdIt);
+                }
+            }
+        }
+
+        connectedComponents.push_back(std::move(Q));
+    }
+
+    return connectedComponents;
+}
+
+/*
+ * Returns the edges adjacent to the specified district that are not in it,
+ * allocated from this state's memory resource.
+ *
+ * @param j the district.
+ *
+ * @return the ids of the edges adjacent to the district.
+ */
+std::pmr::vector<unsigned int> RepairState::getAdjacentEdges(unsigned int j) {
+    std::pmr::vector<unsigned int> adjacentEdges (this->memoryResource);
+    unsigned int stamp = ++this->visitedStamp;
+
+    for (unsigned int eId : this->districtsEdges[j]) {
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            if (this->visitedStamps[*fIdIt - 1] != stamp &&
+                    this->edgesDistrict[*fIdIt - 1] != j) {
+                this->visitedStamps[*fIdIt - 1] = stamp;
+                adjacentEdges.push_back(*fIdIt);
+            }
+        }
+    }
+
+    return adjacentEdges;
+}
+
+/*
+ * Returns the repaired solution.
+ *
+ * @return the repaired solution.
+ */
+Solution RepairState::getSolution() const {
+    return Solution(this->instance, std::vector<unsigned int> (this->edgesDistrict.begin(),
+                this->edgesDistrict.end()));
+}
+
+/*
+ * Updates the specified solution, of the same instance, to the repaired one,
+ * changing only the edges whose district differs.
+ *
+ * @param solution the solution to be updated.
+ */
+void RepairState::updateSolution(Solution & solution) const {
+    unsigned int m = this->instance.getM();
+
+    for (unsigned int eId = 1; eId <= this->edgesDistrict.size(); eId++) {
+        unsigned int j = this->edgesDistrict[eId - 1];
+        unsigned int k = solution.getEdgeDistrict(eId);
+
+        if (j < m && j != k) {
+            solution.setEdgeDistrict(eId, j);
+        } else if (j >= m && k < m) {
+            solution.unsetEdgeDistrict(eId);
+        }
+    }
+}
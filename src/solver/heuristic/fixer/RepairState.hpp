@@ -0,0 +1,149 @@
+#pragma once
+
+#include "../../../solution/Solution.hpp"
+#include <memory_resource>
+
+/*
+ * The RepairState class represents the state of the repair of a solution, which
+ * is built once and updated in place by every phase of the solution fixer. The
+ * edges are referred to by their ids: the district of each edge, the edges of
+ * each district and the bridges that are not leaf edges are kept in arrays
+ * indexed by the edges' ids, while the allocated and unallocated edges adjacent
+ * to an edge are read from the instance's adjacency lists and the district of
+ * each edge.
+ */
+class RepairState {
+    private:
+        /* The instance of the repaired solution. */
+        const Instance & instance;
+
+        /* The memory resource of this state and of the repair's temporaries. */
+        std::pmr::memory_resource * memoryResource;
+
+        /* The position of each edge in the edges of its district. */
+        std::pmr::vector<unsigned int> edgesPosition;
+
+        /* The stamp of the last search that visited each edge. */
+        std::pmr::vector<unsigned int> visitedStamps;
+
+        /* The stamp of the last search. */
+        unsigned int visitedStamp;
+
+        /* The discovery time of each edge in the depth-first search for the bridges. */
+        std::pmr::vector<unsigned int> discoveryTimes;
+
+        /*
+         * The lowest discovery time reachable from the subtree of each edge in
+         * the depth-first search for the bridges.
+         */
+        std::pmr::vector<unsigned int> lowTimes;
+
+        /*
+         * Visits the edges of the specified district reachable from the
+         * specified one in depth-first order, marking the edges whose removal
+         * disconnects the district's other edges, i.e., its bridges that are
+         * not leaf edges.
+         *
+         * @param j        the district.
+         * @param eId      the edge's id.
+         * @param parentId the id of the edge from which the edge was reached;
+         *                 0 for the root.
+         * @param time     the current discovery time.
+         */
+        void visitEdges(unsigned int j, unsigned int eId, unsigned int parentId,
+                unsigned int & time);
+
+    public:
+        /* The district of each edge, or m if the edge is not allocated. */
+        std::pmr::vector<unsigned int> edgesDistrict;
+
+        /* The ids of the edges of each district, followed by the unallocated ones. */
+        std::pmr::vector<std::pmr::vector<unsigned int> > districtsEdges;
+
+        /* The demand of each district. */
+        std::pmr::vector<double> districtsDemand;
+
+        /*
+         * The flag of each edge indicating whether it is a bridge that is not
+         * a leaf edge of its district.
+         */
+        std::pmr::vector<bool> isBridgeThatIsNotLeaf;
+
+        /*
+         * Constructs a new repair state.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param edgesDistrict the district of each edge.
+         */
+        RepairState(const Instance & instance, const std::vector<unsigned int> & edgesDistrict);
+
+        /*
+         * Constructs a new repair state allocated from the specified memory
+         * resource.
+         *
+         * @param instance       the instance of the repaired solution.
+         * @param edgesDistrict  the district of each edge.
+         * @param memoryResource the memory resource.
+         */
+        RepairState(const Instance & instance, const std::vector<unsigned int> & edgesDistrict,
+                std::pmr::memory_resource * memoryResource);
+
+        /*
+         * Returns the memory resource of this state and of the repair's
+         * temporaries.
+         *
+         * @return the memory resource.
+         */
+        std::pmr::memory_resource * getMemoryResource() const;
+
+        /*
+         * Moves the specified edge to the specified district.
+         *
+         * @param eId the edge's id.
+         * @param k   the district; m to unallocate the edge.
+         */
+        void moveEdge(unsigned int eId, unsigned int k);
+
+        /*
+         * Recomputes the bridges that are not leaf edges of the specified
+         * district.
+         *
+         * @param j the district.
+         */
+        void updateBridgesThatAreNotLeafs(unsigned int j);
+
+        /*
+         * Returns the connected components of the specified district,
+         * allocated from this state's memory resource.
+         *
+         * @param j the district.
+         *
+         * @return the ids of the edges of each connected component.
+         */
+        std::pmr::vector<std::pmr::vector<unsigned int> > getConnectedComponents(unsigned int j);
+
+        /*
+         * Returns the edges adjacent to the specified district that are not in
+         * it, allocated from this state's memory resource.
+         *
+         * @param j the district.
+         *
+         * @return the ids of the edges adjacent to the district.
+         */
+        std::pmr::vector<unsigned int> getAdjacentEdges(unsigned int j);
+
+        /*
+         * Returns the repaired solution.
+         *
+         * @return the repaired solution.
+         */
+        Solution getSolution() const;
+
+        /*
+         * Updates the specified solution, of the same instance, to the
+         * repaired one, changing only the edges whose district differs.
+         *
+         * @param solution the solution to be updated.
+         */
+        void updateSolution(Solution & solution) const;
+};
@@ -2,47 +2,27 @@
 #include <algorithm>
 #include <cfloat>
 #include <climits>
+#include <utility>
 
 /*
- * Try to fix disconnected districts in the specified districts.
+ * Try to fix disconnected districts in the specified repair state.
  *
- * @param instance                       the instance of the districts.
- * @param districts                      the districts to be fixed.
- * @param adjacentEdges                  the edges adjacent to each edge.
- * @param edgesDistrict                  the current district of each edge.
- * @param allocatedEdges                 the current allocated edges.
- * @param unallocatedEdges               the current unallocated edges.
- * @param allocatedAdjacentEdges         the current allocated adjacent edges of each edge.
- * @param unallocatedAdjacentEdges       the current unallocated adjacent edges of each edge.
- * @param districtsDemand                the current demand of each district.
- * @param districtsBridgesThatAreNotLeaf the current bridges that are
- *                                       not leaf edges of each district.
- * @param startTime                      the start time.
- * @param timeLimit                      the time limit.
- *
- * @return possibly fixed districts.
+ * @param instance  the instance of the repaired solution.
+ * @param state     the repair state.
+ * @param startTime the start time.
+ * @param timeLimit the time limit.
  */
-std::vector<std::set<Edge> > SolutionFixer::fixDisconnectedDistricts(
-        const Instance & instance,
-        const std::vector<std::set<Edge> > & districts,
-        const std::vector<std::set<Edge> > & adjacentEdges,
-        std::vector<unsigned int> & edgesDistrict,
-        std::set<Edge> & allocatedEdges, std::set<Edge> & unallocatedEdges,
-        std::vector<std::set<Edge> > & allocatedAdjacentEdges,
-        std::vector<std::set<Edge> > & unallocatedAdjacentEdges,
-        std::vector<double> & districtsDemand,
-        std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs,
-        const std::chrono::steady_clock::time_point & startTime, 
+void SolutionFixer::fixDisconnectedDistricts(const Instance & instance,
+        RepairState & state, const std::chrono::steady_clock::time_point & startTime,
         unsigned int timeLimit) {
-    std::vector<std::set<Edge> > fixedDistricts (districts);
-
     /* ∀ j ∈ {1, ..., m} */
-    for (unsigned int j = 0; j < instance.getM() && Heuristic::getElapsedTime(startTime); j++) {
-        Graph inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[j]);
+    for (unsigned int j = 0; j < instance.getM() &&
+            Heuristic::getElapsedTime(startTime) < timeLimit; j++) {
+        std::pmr::vector<std::pmr::vector<unsigned int> > connectedComponents =
+            state.getConnectedComponents(j);
 
         /* If G[E_{j}] is disconnected */
-        if (!inducedSubGraph.isConnected()) {
-            std::vector<Graph> connectedComponents = inducedSubGraph.getConnectedComponents();
+        if (connectedComponents.size() > 1) {
             /* E^{*} ← ∅ */
             unsigned int bestComponent = connectedComponents.size();
             /* maxC ← -∞ */
@@ -51,16 +31,16 @@ std::vector<std::set<Edge> > SolutionFixer::fixDisconnectedDistricts(
             double maxEdges = -DBL_MAX;
 
             /* ∀ connected component G'=(V', E') of G[E_{j}] */
-            for (unsigned int i = 1; i < connectedComponents.size(); i++) {
+            for (unsigned int i = 0; i < connectedComponents.size(); i++) {
                 double componentValue = 0.0;
-                double componentEdges = connectedComponents[i].m();
+                double componentEdges = connectedComponents[i].size();
 
-                for (const Edge & e : connectedComponents[i].getEdges()) {
-                    componentValue += instance.getC(e, j);
+                for (unsigned int eId : connectedComponents[i]) {
+                    componentValue += instance.getC(eId, j);
                 }
 
                 /*
-                 * if maxC < ∑_{e ∈ E'}{c_{e, j}} ∨ 
+                 * if maxC < ∑_{e ∈ E'}{c_{e, j}} ∨
                  * (maxC = ∑_{e ∈ E'}{c_{e, j}} ∧ maxE < |E'|)
                  */
                 if ((maxValue < componentValue) ||
@@ -78,39 +58,15 @@ std::vector<std::set<Edge> > SolutionFixer::fixDisconnectedDistricts(
             /* E_{j} ← E^{*} */
             for (unsigned int i = 0; i < connectedComponents.size(); i++) {
                 if (i != bestComponent) {
-                    for (const Edge & e : connectedComponents[i].getEdges()) {
-                        unsigned int eId = instance.getG().getEdgeId(e);
-
-                        districtsDemand[j] -= 2 * e.w;
-                        edgesDistrict[eId - 1] = instance.getM();
-                        allocatedEdges.erase(e);
-                        unallocatedEdges.insert(e);
-
-                        for (const Edge & f : adjacentEdges[eId - 1]) {
-                            unsigned int fId = instance.getG().getEdgeId(f);
-
-                            allocatedAdjacentEdges[fId - 1].erase(e);
-                            unallocatedAdjacentEdges[fId - 1].insert(e);
-                        }
+                    for (unsigned int eId : connectedComponents[i]) {
+                        state.moveEdge(eId, instance.getM());
                     }
                 }
             }
 
-            fixedDistricts[j] = std::set<Edge>(connectedComponents[bestComponent].getEdges());
-
-            inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[j]);
-            std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-            std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-            districtsBridgesThatAreNotLeafs[j].clear();
-            std::set_difference(districtBridges.begin(),
-                    districtBridges.end(), districtLeafEdges.begin(),
-                    districtLeafEdges.end(), std::inserter(
-                        districtsBridgesThatAreNotLeafs[j],
-                        districtsBridgesThatAreNotLeafs[j].begin()));
+            state.updateBridgesThatAreNotLeafs(j);
         }
     }
-
-    return fixedDistricts;
 }
 
 /*
@@ -121,269 +77,190 @@ std::vector<std::set<Edge> > SolutionFixer::fixDisconnectedDistricts(
  *
  * @return a possibly fixed solution.
  */
-Solution SolutionFixer::fixDisconnectedDistricts(const Solution & solution, 
+Solution SolutionFixer::fixDisconnectedDistricts(const Solution & solution,
         unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Instance instance = solution.getInstance();
-    std::vector<std::set<Edge> > districts = solution.getDistricts();
-    std::vector<std::set<Edge> > adjacentEdges (instance.getG().m());
-    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
-    std::set<Edge> allocatedEdges = solution.getAllocatedEdges();
-    std::set<Edge> unallocatedEdges = solution.getUnallocatedEdges();
-    std::vector<std::set<Edge> > allocatedAdjacentEdges (instance.getG().m());
-    std::vector<std::set<Edge> > unallocatedAdjacentEdges (instance.getG().m());
-    std::vector<double> districtsDemand = solution.getDistrictsDemand();
-    std::vector<std::set<Edge> > districtsBridgesThatAreNotLeafs (instance.getM());
-
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-
-        adjacentEdges[eId - 1] = instance.getG().getAdjacentEdges(e);
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                adjacentEdges[eId - 1].begin(), adjacentEdges[eId - 1].end(),
-                std::inserter(allocatedAdjacentEdges[eId - 1],
-                    allocatedAdjacentEdges[eId - 1].begin()));
-        std::set_intersection(unallocatedEdges.begin(),
-                unallocatedEdges.end(), adjacentEdges[eId - 1].begin(),
-                adjacentEdges[eId - 1].end(), std::inserter(
-                    unallocatedAdjacentEdges[eId - 1],
-                    unallocatedAdjacentEdges[eId - 1].begin()));
-    }
-
-    for (unsigned int j = 0; j < instance.getM(); j++) {
-        Graph inducedSubGraph = instance.getG().getInducedSubGraph(districts[j]);
-        std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-        std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-        std::set_difference(districtBridges.begin(), districtBridges.end(),
-                districtLeafEdges.begin(), districtLeafEdges.end(),
-                std::inserter(districtsBridgesThatAreNotLeafs[j],
-                    districtsBridgesThatAreNotLeafs[j].begin()));
-    }
+    const Instance & instance = solution.getInstance();
+    RepairState state (instance, solution.getEdgesDistrict());
 
-    std::vector<std::set<Edge> > fixedDistricts =
-        SolutionFixer::fixDisconnectedDistricts(instance, districts, 
-                adjacentEdges, edgesDistrict, allocatedEdges, 
-                unallocatedEdges, allocatedAdjacentEdges, 
-                unallocatedAdjacentEdges, districtsDemand, 
-                districtsBridgesThatAreNotLeafs, startTime, timeLimit);
+    SolutionFixer::fixDisconnectedDistricts(instance, state, startTime, timeLimit);
 
-    return Solution(instance, fixedDistricts);
+    return state.getSolution();
 }
 
 /*
- * Try to fix districts with demand over the maximum in the specified districts.
+ * Returns the best move of the specified edge out of its district with demand
+ * over the maximum, keyed by the lowest profit in the district, then the
+ * largest demand and then the largest profit in the receiving district.
  *
- * @param instance                       the instance of the districts.
- * @param districts                      the districts to be fixed.
- * @param minimumDemand                  the minimum allowed demand for each district.
- * @param maximumDemand                  the maximum allowed demand for each district.
- * @param adjacentEdges                  the edges adjacent to each edge.
- * @param edgesDistrict                  the current district of each edge.
- * @param allocatedEdges                 the current allocated edges.
- * @param unallocatedEdges               the current unallocated edges.
- * @param allocatedAdjacentEdges         the current allocated adjacent edges of each edge.
- * @param unallocatedAdjacentEdges       the current unallocated adjacent edges of each edge.
- * @param districtsDemand                the current demand of each district.
- * @param districtsBridgesThatAreNotLeaf the current bridges that are not
- *                                       leaf edges of each district.
- * @param startTime                      the start time.
- * @param timeLimit                      the time limit.
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param j             the edge's district.
+ * @param fId           the edge's id.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param k             the receiving district.
+ * @param key           the move's key.
  *
- * @return possibly fixed districts.
+ * @return true if the edge can move to an adjacent district; false otherwise.
  */
-std::vector<std::set<Edge> > SolutionFixer::fixDistrictsWithDemandOverTheMaximum(
-        const Instance & instance,
-        const std::vector<std::set<Edge> > & districts, double minimumDemand,
-        double maximumDemand,
-        const std::vector<std::set<Edge> > & adjacentEdges,
-        std::vector<unsigned int> & edgesDistrict,
-        std::set<Edge> & allocatedEdges, std::set<Edge> & unallocatedEdges,
-        std::vector<std::set<Edge> > & allocatedAdjacentEdges,
-        std::vector<std::set<Edge> > & unallocatedAdjacentEdges,
-        std::vector<double> & districtsDemand,
-        std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs, 
-        const std::chrono::steady_clock::time_point & startTime, 
-        unsigned int timeLimit) {
-    std::vector<std::set<Edge> > fixedDistricts (districts);
-    std::vector<std::set<Edge> > allocatedAdjacentEdgesNotInDistrict (instance.getG().m());
-
-    for (const Edge & e : unallocatedEdges) {
-        unsigned int eId = instance.getG().getEdgeId(e);
+bool SolutionFixer::getDemandOverTheMaximumMove(const Instance & instance,
+        const RepairState & state, unsigned int j, unsigned int fId,
+        double minimumDemand, double maximumDemand, unsigned int & k,
+        std::array<double, 3> & key) {
+    double weight = instance.getEdge(fId).w;
+    /* maxC ← -∞ */
+    double maxValue = -DBL_MAX;
+    bool found = false;
+
+    /* d_{E_{j}} - 2 d_{f} ≥ (1 - B) \bar{d}_{ℰ} */
+    if (state.districtsDemand[j] - 2 * weight < minimumDemand) {
+        return false;
+    }
 
-        allocatedAdjacentEdgesNotInDistrict[eId - 1] =
-            std::set<Edge>(allocatedAdjacentEdges[eId - 1]);
+    /* ∀ g ∈ σ_{G}(f)∩(∪_{j = 1}^{m}{E_{j}}) \ E_{j} */
+    for (std::vector<unsigned int>::const_iterator gIdIt =
+            instance.getAdjacentEdgesIdsBegin(fId);
+            gIdIt != instance.getAdjacentEdgesIdsEnd(fId); gIdIt++) {
+        /* Let l ∈ {1, ..., m} such that g ∈ E_{l} */
+        unsigned int l = state.edgesDistrict[*gIdIt - 1];
+
+        /* d_{E_{l}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} ∧ maxC < c_{f, l} */
+        if (l != j && l != instance.getM() &&
+                state.districtsDemand[l] + 2 * weight <= maximumDemand &&
+                maxValue < instance.getC(fId, l)) {
+            found = true;
+            k = l;
+            maxValue = instance.getC(fId, l);
+        }
     }
 
-    for (const Edge & e : allocatedEdges) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-        unsigned int j = edgesDistrict[eId - 1];
+    /* (minC, maxD, maxC) */
+    key = {-instance.getC(fId, j), weight, maxValue};
 
-        std::set_difference(allocatedAdjacentEdges[eId - 1].begin(),
-                allocatedAdjacentEdges[eId - 1].end(),
-                fixedDistricts[j].begin(), fixedDistricts[j].end(),
-                std::inserter(allocatedAdjacentEdgesNotInDistrict[eId - 1],
-                    allocatedAdjacentEdgesNotInDistrict[eId - 1].begin()));
-    }
+    return found;
+}
 
+/*
+ * Try to fix districts with demand over the maximum in the specified repair
+ * state. The moves out of each district are kept in an indexed priority queue
+ * keyed by the same criterion as the scan it replaces. Stale keys only
+ * overestimate, since the district's demand only decreases and the receiving
+ * districts' only increase, so a move is revalidated when it reaches the top
+ * and only the moves of the edges adjacent to the last moved edge, which may
+ * gain a receiving district, are updated eagerly.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param startTime     the start time.
+ * @param timeLimit     the time limit.
+ */
+void SolutionFixer::fixDistrictsWithDemandOverTheMaximum(const Instance & instance,
+        RepairState & state, double minimumDemand, double maximumDemand,
+        const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) {
     /* ∀ j ∈ {1, ..., m} */
-    for (unsigned int j = 0; j < instance.getM() && 
+    for (unsigned int j = 0; j < instance.getM() &&
             Heuristic::getElapsedTime(startTime) < timeLimit; j++) {
+        if (state.districtsDemand[j] <= maximumDemand) {
+            continue;
+        }
+
+        IndexedPriorityQueue movesQueue (instance.getG().m(),
+                state.getMemoryResource());
+        IndexedPriorityQueue edgesQueue (instance.getG().m(),
+                state.getMemoryResource());
+        std::pmr::vector<unsigned int> bridges (state.getMemoryResource());
+        std::array<double, 3> key;
+        unsigned int k = j;
+
+        for (unsigned int fId : state.districtsEdges[j]) {
+            if (SolutionFixer::getDemandOverTheMaximumMove(instance, state, j, fId,
+                        minimumDemand, maximumDemand, k, key)) {
+                movesQueue.push(fId, key);
+            }
+
+            /* (minC, maxD) */
+            edgesQueue.push(fId, {-instance.getC(fId, j), instance.getEdge(fId).w, 0.0});
+        }
+
         /* while d_{E_{j}} > min{D, (1 + B) \bar{d}_{ℰ}} */
-        while (districtsDemand[j] > maximumDemand && 
+        while (state.districtsDemand[j] > maximumDemand &&
                 Heuristic::getElapsedTime(startTime) < timeLimit) {
             /* e ← ∅ */
             bool found = false;
-            Edge e;
             unsigned int eId = 0;
+
             /* k ← j */
-            unsigned int k = j;
-            /* minC ← ∞ */
-            double minValue = DBL_MAX;
-            /* maxD ← -∞ */
-            double maxWeight = -DBL_MAX;
+            k = j;
 
-            /* ∀ f ∈  E_{j} */
-            for (const Edge & f : fixedDistricts[j]) {
-                unsigned int fId = instance.getG().getEdgeId(f);
+            while (!movesQueue.isEmpty()) {
+                unsigned int fId = movesQueue.top();
+                unsigned int l = j;
 
                 /* if G[E_{j} \ {f}] is connected */
-                if (districtsBridgesThatAreNotLeafs[j].find(f) ==
-                        districtsBridgesThatAreNotLeafs[j].end()) {
-                    /* maxC ← -∞ */
-                    double maxValue = -DBL_MAX;
-                    double value = instance.getC(f, j);
-                    double weight = f.w;
-
-                    /* ∀ g ∈ σ_{G}(f)∩(∪_{j = 1}^{m}{E_{j}}) \ E_{j} */
-                    for (const Edge & g : allocatedAdjacentEdgesNotInDistrict[fId - 1]) {
-                        unsigned int gId = instance.getG().getEdgeId(g);
-                        /* Let l ∈ {1, ..., m} such that g ∈ E_{l} */
-                        unsigned int l = edgesDistrict[gId - 1];
-                        double newValue = instance.getC(f, l);
-
-                        /*
-                         * if d_{E_{j}} - 2 d_{f} ≥ (1 - B) \bar{d}_{ℰ} 
-                         * ∧ d_{E_{l}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} 
-                         * ∧ (e = ∅ ∨ minC > c_{f, j} ∨ (minC = c_{f, j} 
-                         * ∧ (maxD < d_{f} ∨ (maxD = d_{f} ∧ maxC < c_{f, l}))))
-                         */
-                        if (districtsDemand[j] - 2 * weight >= minimumDemand
-                                && districtsDemand[l] + 2 * weight <= maximumDemand
-                                && (!found || minValue > value ||
-                                    (minValue == value &&
-                                     (maxWeight < weight ||
-                                      (maxWeight == weight &&
-                                       maxValue < newValue))))) {
-                                /* e ← f */
-                                found = true;
-                                e = f;
-                                eId = fId;
-                                /* k ← l */
-                                k = l;
-                                /* minC ← c_{f, j} */
-                                minValue = value;
-                                /* maxD ← d_{f} */
-                                maxWeight = weight;
-                                /* maxC ← c_{f, l} */
-                                maxValue = newValue;
-                        }
-                    }
+                if (state.isBridgeThatIsNotLeaf[fId - 1]) {
+                    movesQueue.remove(fId);
+                    bridges.push_back(fId);
+                } else if (!SolutionFixer::getDemandOverTheMaximumMove(instance, state, j,
+                            fId, minimumDemand, maximumDemand, l, key)) {
+                    movesQueue.remove(fId);
+                } else if (key != movesQueue.getKey(fId)) {
+                    movesQueue.push(fId, key);
+                } else {
+                    /* e ← f, k ← l */
+                    found = true;
+                    eId = fId;
+                    k = l;
+                    break;
                 }
             }
 
-            /* if e = ∅ */
+            /* if e = ∅, e ← argmin_{f ∈ E_{j}}{(c_{f, j}, -d_{f})} */
             if (!found) {
-                /* ∀ f ∈ E_{j} */
-                for (const Edge & f : fixedDistricts[j]) {
-                    unsigned int fId = instance.getG().getEdgeId(f);
-                    double value = instance.getC(f, j);
-                    double weight = f.w;
-
-                    /* if e = ∅ ∨ minC > c_{f, j} ∨ (minC = c_{f, j} ∧ maxD < d_{f}) */
-                    if (!found || minValue > value || (minValue == value &&
-                                maxWeight < weight)) {
-                        /* e ← f */
-                        found = true;
-                        e = f;
-                        eId = fId;
-                        /* minC ← c_{f, j} */
-                        minValue = value;
-                        /* maxD ← d_{f} */
-                        maxWeight = weight;
-                    }
-                }
+                eId = edgesQueue.top();
             }
 
-            /* E_{j} ← E_{j} \ {e} */
-            fixedDistricts[j].erase(e);
-            districtsDemand[j] -= 2 * e.w;
-            edgesDistrict[eId - 1] = instance.getM();
-            allocatedEdges.erase(e);
-            unallocatedEdges.insert(e);
-            allocatedAdjacentEdgesNotInDistrict[eId - 1] =
-                std::set<Edge> (allocatedAdjacentEdges[eId - 1]);
-
-            for (const Edge & f : adjacentEdges[eId - 1]) {
-                unsigned int fId = instance.getG().getEdgeId(f);
-
-                allocatedAdjacentEdges[fId - 1].erase(e);
-                unallocatedAdjacentEdges[fId - 1].insert(e);
-                allocatedAdjacentEdgesNotInDistrict[fId - 1].erase(e);
-            }
+            movesQueue.remove(eId);
+            edgesQueue.remove(eId);
 
-            Graph inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[j]);
-            std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-            std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-            districtsBridgesThatAreNotLeafs[j].clear();
-            std::set_difference(districtBridges.begin(),
-                    districtBridges.end(), districtLeafEdges.begin(),
-                    districtLeafEdges.end(), std::inserter(
-                        districtsBridgesThatAreNotLeafs[j],
-                        districtsBridgesThatAreNotLeafs[j].begin()));
+            /* E_{j} ← E_{j} \ {e} */
+            state.moveEdge(eId, instance.getM());
+            state.updateBridgesThatAreNotLeafs(j);
 
             /* if k ≠ j */
             if (k != j) {
                 /* E_{k} ← E_{k} ∪ {e}*/
-                fixedDistricts[k].insert(e);
-                districtsDemand[k] += 2 * e.w;
-                edgesDistrict[eId - 1] = k;
-                allocatedEdges.insert(e);
-                unallocatedEdges.erase(e);
-                allocatedAdjacentEdgesNotInDistrict[eId - 1].clear();
-                std::set_difference(allocatedAdjacentEdges[eId - 1].begin(),
-                        allocatedAdjacentEdges[eId - 1].end(),
-                        fixedDistricts[k].begin(), fixedDistricts[k].end(),
-                        std::inserter(
-                            allocatedAdjacentEdgesNotInDistrict[eId - 1],
-                            allocatedAdjacentEdgesNotInDistrict[eId - 1].begin()));
-
-                for (const Edge & f : adjacentEdges[eId - 1]) {
-                    unsigned int fId = instance.getG().getEdgeId(f);
-
-                    allocatedAdjacentEdges[fId - 1].insert(e);
-                    unallocatedAdjacentEdges[fId - 1].erase(e);
-
-                    if (edgesDistrict[fId - 1] != k) {
-                        allocatedAdjacentEdgesNotInDistrict[fId - 1].insert(e);
-                    } else {
-                        allocatedAdjacentEdgesNotInDistrict[fId - 1].erase(e);
-                    }
+                state.moveEdge(eId, k);
+                state.updateBridgesThatAreNotLeafs(k);
+            }
+
+            /* The bridges may have become removable and the adjacent edges may reach k */
+            for (std::vector<unsigned int>::const_iterator fIdIt =
+                    instance.getAdjacentEdgesIdsBegin(eId);
+                    fIdIt != instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+                if (state.edgesDistrict[*fIdIt - 1] == j) {
+                    bridges.push_back(*fIdIt);
                 }
+            }
 
-                Graph inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[k]);
-                districtBridges = inducedSubGraph.getBridges();
-                districtLeafEdges = inducedSubGraph.getLeafEdges();
-                districtsBridgesThatAreNotLeafs[k].clear();
-                std::set_difference(districtBridges.begin(),
-                        districtBridges.end(), districtLeafEdges.begin(),
-                        districtLeafEdges.end(), std::inserter(
-                            districtsBridgesThatAreNotLeafs[k],
-                            districtsBridgesThatAreNotLeafs[k].begin()));
+            for (unsigned int fId : bridges) {
+                unsigned int l = j;
+
+                if (state.edgesDistrict[fId - 1] == j &&
+                        SolutionFixer::getDemandOverTheMaximumMove(instance, state, j, fId,
+                            minimumDemand, maximumDemand, l, key)) {
+                    movesQueue.push(fId, key);
+                } else {
+                    movesQueue.remove(fId);
+                }
             }
+
+            bridges.clear();
         }
     }
-
-    return fixedDistricts;
 }
 
 /*
@@ -397,257 +274,170 @@ std::vector<std::set<Edge> > SolutionFixer::fixDistrictsWithDemandOverTheMaximum
 Solution SolutionFixer::fixDistrictsWithDemandOverTheMaximum(
         const Solution & solution, unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Instance instance = solution.getInstance();
-    std::vector<std::set<Edge> > districts = solution.getDistricts();
-    double minimumDemand = instance.getMinimumDemand();
-    double maximumDemand = instance.getMaximumDemand();
-    std::vector<std::set<Edge> > adjacentEdges (instance.getG().m());
-    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
-    std::set<Edge> allocatedEdges = solution.getAllocatedEdges();
-    std::set<Edge> unallocatedEdges = solution.getUnallocatedEdges();
-    std::vector<std::set<Edge> > allocatedAdjacentEdges (instance.getG().m());
-    std::vector<std::set<Edge> > unallocatedAdjacentEdges (instance.getG().m());
-    std::vector<double> districtsDemand = solution.getDistrictsDemand();
-    std::vector<std::set<Edge> > districtsBridgesThatAreNotLeafs (instance.getM());
-
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-
-        adjacentEdges[eId - 1] = instance.getG().getAdjacentEdges(e);
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                adjacentEdges[eId - 1].begin(), adjacentEdges[eId - 1].end(),
-                std::inserter(allocatedAdjacentEdges[eId - 1],
-                    allocatedAdjacentEdges[eId - 1].begin()));
-        std::set_intersection(unallocatedEdges.begin(),
-                unallocatedEdges.end(), adjacentEdges[eId - 1].begin(),
-                adjacentEdges[eId - 1].end(), std::inserter(
-                    unallocatedAdjacentEdges[eId - 1],
-                    unallocatedAdjacentEdges[eId - 1].begin()));
-    }
+    const Instance & instance = solution.getInstance();
+    RepairState state (instance, solution.getEdgesDistrict());
 
-    for (unsigned int j = 0; j < instance.getM(); j++) {
-        Graph inducedSubGraph = instance.getG().getInducedSubGraph(districts[j]);
-        std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-        std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-        std::set_difference(districtBridges.begin(), districtBridges.end(),
-                districtLeafEdges.begin(), districtLeafEdges.end(),
-                std::inserter(districtsBridgesThatAreNotLeafs[j],
-                    districtsBridgesThatAreNotLeafs[j].begin()));
-    }
-
-    std::vector<std::set<Edge> > fixedDistricts =
-        SolutionFixer::fixDistrictsWithDemandOverTheMaximum(instance, 
-                districts, minimumDemand, maximumDemand, adjacentEdges, 
-                edgesDistrict, allocatedEdges, unallocatedEdges, 
-                allocatedAdjacentEdges, unallocatedAdjacentEdges, 
-                districtsDemand, districtsBridgesThatAreNotLeafs, startTime, 
-                timeLimit);
+    SolutionFixer::fixDistrictsWithDemandOverTheMaximum(instance, state,
+            instance.getMinimumDemand(), instance.getMaximumDemand(), startTime,
+            timeLimit);
 
-    return Solution(instance, fixedDistricts);
+    return state.getSolution();
 }
 
 /*
- * Try to fix districts with demand under the minimum in the specified districts.
+ * Inserts the move of the specified edge into the specified district with
+ * demand under the minimum into the queue of the unallocated edges, keyed by
+ * the largest profit in the district and then the largest demand, or into the
+ * queue of the allocated edges, keyed by the largest profit increase and then
+ * the largest demand; the move is removed when it is infeasible.
  *
- * @param instance                       the instance of the districts.
- * @param districts                      the districts to be fixed.
- * @param minimumDemand                  the minimum allowed demand for each district.
- * @param maximumDemand                  the maximum allowed demand for each district.
- * @param adjacentEdges                  the edges adjacent to each edge.
- * @param edgesDistrict                  the current district of each edge.
- * @param allocatedEdges                 the current allocated edges.
- * @param unallocatedEdges               the current unallocated edges.
- * @param allocatedAdjacentEdges         the current allocated adjacent edges
- *                                       of each edge.
- * @param unallocatedAdjacentEdges       the current unallocated adjacent
- *                                       edges of each edge.
- * @param districtsDemand                the current demand of each district.
- * @param districtsBridgesThatAreNotLeaf the current bridges that are not
- *                                       leaf edges of each district.
- * @param startTime                      the start time.
- * @param timeLimit                      the time limit.
- *
- * @return possibly fixed districts.
+ * @param instance         the instance of the repaired solution.
+ * @param state            the repair state.
+ * @param j                the receiving district.
+ * @param fId              the edge's id.
+ * @param minimumDemand    the minimum allowed demand for each district.
+ * @param maximumDemand    the maximum allowed demand for each district.
+ * @param unallocatedQueue the moves of the unallocated edges.
+ * @param allocatedQueue   the moves of the allocated edges.
  */
-std::vector<std::set<Edge> > SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(
-        const Instance & instance,
-        const std::vector<std::set<Edge> > & districts, double minimumDemand,
-        double maximumDemand,
-        const std::vector<std::set<Edge> > & adjacentEdges,
-        std::vector<unsigned int> & edgesDistrict,
-        std::set<Edge> & allocatedEdges, std::set<Edge> & unallocatedEdges,
-        std::vector<std::set<Edge> > & allocatedAdjacentEdges,
-        std::vector<std::set<Edge> > & unallocatedAdjacentEdges,
-        std::vector<double> & districtsDemand,
-        std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs,
-        const std::chrono::steady_clock::time_point & startTime, 
-        unsigned int timeLimit) {
-    std::vector<std::set<Edge> > fixedDistricts (districts);
-    std::vector<std::set<Edge> > districtsAdjacentEdges (instance.getM());
-    std::vector<std::set<Edge> > districtsAllocatedAdjacentEdges (instance.getM());
-    std::vector<std::set<Edge> > districtsUnallocatedAdjacentEdges (instance.getM());
-
-    for (unsigned int j = 0; j < instance.getM(); j++) {
-        districtsAdjacentEdges[j] = instance.getG().getAdjacentEdges(fixedDistricts[j]);
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                districtsAdjacentEdges[j].begin(),
-                districtsAdjacentEdges[j].end(), std::inserter(
-                    districtsAllocatedAdjacentEdges[j],
-                    districtsAllocatedAdjacentEdges[j].begin()));
-        std::set_intersection(unallocatedEdges.begin(),
-                unallocatedEdges.end(), districtsAdjacentEdges[j].begin(),
-                districtsAdjacentEdges[j].end(), std::inserter(
-                    districtsUnallocatedAdjacentEdges[j],
-                    districtsUnallocatedAdjacentEdges[j].begin()));
+void SolutionFixer::pushDemandUnderTheMinimumMove(const Instance & instance,
+        const RepairState & state, unsigned int j, unsigned int fId,
+        double minimumDemand, double maximumDemand,
+        IndexedPriorityQueue & unallocatedQueue, IndexedPriorityQueue & allocatedQueue) {
+    /* let l ∈ {1, ..., m} such that f ∈ E_{l} */
+    unsigned int l = state.edgesDistrict[fId - 1];
+    double weight = instance.getEdge(fId).w;
+
+    /* d_{E_{j}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} */
+    if (l == j || state.districtsDemand[j] + 2 * weight > maximumDemand) {
+        unallocatedQueue.remove(fId);
+        allocatedQueue.remove(fId);
+    } else if (l == instance.getM()) {
+        /* (maxC, maxD) */
+        unallocatedQueue.push(fId, {instance.getC(fId, j), weight, 0.0});
+    } else if (state.districtsDemand[l] - 2 * weight >= minimumDemand) {
+        /* d_{E_{l}} - 2 d_{f} ≥ (1 - B) \bar{d}_{ℰ}: (maxC, maxD) */
+        allocatedQueue.push(fId, {instance.getC(fId, j) - instance.getC(fId, l),
+                weight, 0.0});
+    } else {
+        allocatedQueue.remove(fId);
     }
+}
 
+/*
+ * Try to fix districts with demand under the minimum in the specified repair
+ * state. The edges adjacent to each district are kept in indexed priority
+ * queues keyed by the same criteria as the scans they replace. The keys do not
+ * change while the district grows, and a move only becomes infeasible, since
+ * the district's demand only increases and the giving districts' only
+ * decreases, so only the moves of the edges adjacent to the last moved edge
+ * are inserted.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param startTime     the start time.
+ * @param timeLimit     the time limit.
+ */
+void SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(const Instance & instance,
+        RepairState & state, double minimumDemand, double maximumDemand,
+        const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) {
     /* ∀ j ∈ {1, ..., m} */
-    for (unsigned int j = 0; j < instance.getM() && 
+    for (unsigned int j = 0; j < instance.getM() &&
             Heuristic::getElapsedTime(startTime) < timeLimit; j++) {
+        IndexedPriorityQueue unallocatedQueue (instance.getG().m(),
+                state.getMemoryResource());
+        IndexedPriorityQueue allocatedQueue (instance.getG().m(),
+                state.getMemoryResource());
+        std::pmr::vector<unsigned int> bridges (state.getMemoryResource());
+
+        for (unsigned int fId : state.getAdjacentEdges(j)) {
+            SolutionFixer::pushDemandUnderTheMinimumMove(instance, state, j, fId,
+                    minimumDemand, maximumDemand, unallocatedQueue, allocatedQueue);
+        }
+
         /* while d_{E_{j}} < (1 - B) \bar{d}_{ℰ} */
-        while (districtsDemand[j] < maximumDemand && 
+        while (state.districtsDemand[j] < maximumDemand &&
                 Heuristic::getElapsedTime(startTime) < timeLimit) {
             /* e ← ∅ */
             bool found = false;
-            Edge e;
             unsigned int eId = 0;
             /* k ← j */
             unsigned int k = j;
-            /* maxC ← -∞ */
-            double maxValue = -DBL_MAX;
-            /* minD ← -∞ */
-            double maxWeight = -DBL_MAX;
 
-            /* ∀ f ∈ σ_{G}(V_{j}) \ (∪_{l = 1}^{m}{E_{l}}) */
-            for (const Edge & f : districtsUnallocatedAdjacentEdges[j]) {
-                unsigned int fId = instance.getG().getEdgeId(f);
-                double value = instance.getC(f, j);
-                double weight = f.w;
+            /* e ← argmax_{f ∈ σ_{G}(V_{j}) \ (∪_{l = 1}^{m}{E_{l}})}{(c_{f, j}, d_{f})} */
+            while (!unallocatedQueue.isEmpty()) {
+                unsigned int fId = unallocatedQueue.top();
 
-                /*
-                 * d_{E_{j}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} ∧
-                 * (e = ∅ ∨ maxC < c_{f, j} ∨ (maxC = c_{f, j} ∧ maxD < d_{f}))
-                 */
-                if (districtsDemand[j] + 2 * weight <= maximumDemand &&
-                        (!found || maxValue < value || (maxValue == value &&
-                                                        maxWeight < weight))) {
-                    /* e ← f */
+                if (state.districtsDemand[j] + 2 * instance.getEdge(fId).w > maximumDemand) {
+                    unallocatedQueue.remove(fId);
+                } else {
                     found = true;
-                    e = f;
                     eId = fId;
-                    /* maxC ← c_{f, j} */
-                    maxValue = value;
-                    /* maxD ← d_{f} */
-                    maxWeight = weight;
+                    break;
                 }
             }
 
             /* if e = ∅ */
             if (!found) {
-                /* ∀ f ∈ σ_{G}(V_{j})∩(∪_{l = 1}^{m}{E_{l}}) */
-                for (const Edge & f : districtsAllocatedAdjacentEdges[j]) {
-                    unsigned int fId = instance.getG().getEdgeId(f);
+                /* e ← argmax_{f ∈ σ_{G}(V_{j})∩(∪_{l = 1}^{m}{E_{l}})}{(c_{f, j} - c_{f, l}, d_{f})} */
+                while (!allocatedQueue.isEmpty()) {
+                    unsigned int fId = allocatedQueue.top();
                     /* let l ∈ {1, ..., m} such that f ∈ E_{l} */
-                    unsigned int l = edgesDistrict[fId - 1];
-                    double value = instance.getC(f, j) - instance.getC(f, l);
-                    double weight = f.w;
-
-                    /*
-                     * if d_{E_{j}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} 
-                     * ∧ d_{E_{l}} - 2 d_{f} ≥ (1 - B) \bar{d}_{ℰ} ∧ 
-                     * G[E_{l}\{f}] is connected ∧ (e = ∅ ∨ 
-                     * maxC < c_{f, j} - c_{f, l} ∨ (maxC = c_{f, j} - c_{f, l} 
-                     * ∧ maxD < d_{f}))
-                     */
-                    if (districtsDemand[j] + 2 * weight <= maximumDemand &&
-                            districtsDemand[l] - 2 * weight >= minimumDemand
-                            && districtsBridgesThatAreNotLeafs[l].find(f) ==
-                            districtsBridgesThatAreNotLeafs[l].end() &&
-                            (!found || maxValue < value ||
-                             (maxValue == value && maxWeight < weight))) {
-                        /* e ← f */
+                    unsigned int l = state.edgesDistrict[fId - 1];
+                    double weight = instance.getEdge(fId).w;
+
+                    if (state.districtsDemand[j] + 2 * weight > maximumDemand ||
+                            state.districtsDemand[l] - 2 * weight < minimumDemand) {
+                        allocatedQueue.remove(fId);
+                    } else if (state.isBridgeThatIsNotLeaf[fId - 1]) {
+                        /* G[E_{l}\{f}] is disconnected */
+                        allocatedQueue.remove(fId);
+                        bridges.push_back(fId);
+                    } else {
                         found = true;
-                        e = f;
                         eId = fId;
-                        /* k ← l */
                         k = l;
-                        /* maxC ← c_{f, j} - c_{f, l} */
-                        maxValue = value;
-                        /* maxD ← d_{f} */
-                        maxWeight = weight;
+                        break;
                     }
                 }
             }
 
             /* if e ≠ ∅ */
             if (found) {
-                /* E_{j} ← E_{j} ∪ {e} */
-                fixedDistricts[j].insert(e);
-                districtsDemand[j] += 2 * e.w;
-                edgesDistrict[eId - 1] = j;
-                allocatedEdges.insert(e);
-                unallocatedEdges.erase(e);
-                districtsAdjacentEdges[j].erase(e);
-                districtsAllocatedAdjacentEdges[j].erase(e);
-                districtsUnallocatedAdjacentEdges[j].erase(e);
-
-                for (const Edge & f : adjacentEdges[eId - 1]) {
-                    unsigned int fId = instance.getG().getEdgeId(f);
-
-                    allocatedAdjacentEdges[fId - 1].insert(e);
-                    unallocatedAdjacentEdges[fId - 1].erase(e);
-
-                    if (edgesDistrict[fId - 1] != j) {
-                        districtsAdjacentEdges[j].insert(e);
-                    }
-                }
+                unallocatedQueue.remove(eId);
+                allocatedQueue.remove(eId);
 
-                for (const Edge & f : allocatedAdjacentEdges[eId - 1]) {
-                    unsigned int fId = instance.getG().getEdgeId(f);
+                /* E_{j} ← E_{j} ∪ {e}, E_{k} ← E_{k} \ {e} */
+                state.moveEdge(eId, j);
+                state.updateBridgesThatAreNotLeafs(j);
 
-                    if (edgesDistrict[fId - 1] != j) {
-                        districtsAllocatedAdjacentEdges[j].insert(f);
-                        districtsAllocatedAdjacentEdges[edgesDistrict[fId - 1]].insert(e);
-                    }
+                /* if k ≠ j */
+                if (k != j) {
+                    state.updateBridgesThatAreNotLeafs(k);
                 }
 
-                for (const Edge & f : unallocatedAdjacentEdges[eId - 1]) {
-                    districtsUnallocatedAdjacentEdges[j].insert(f);
+                /* The bridges may have become removable and e brings its adjacent edges */
+                for (std::vector<unsigned int>::const_iterator fIdIt =
+                        instance.getAdjacentEdgesIdsBegin(eId);
+                        fIdIt != instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+                    bridges.push_back(*fIdIt);
                 }
 
-                Graph inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[j]);
-                std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-                std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-                districtsBridgesThatAreNotLeafs[j].clear();
-                std::set_difference(districtBridges.begin(),
-                        districtBridges.end(), districtLeafEdges.begin(),
-                        districtLeafEdges.end(), std::inserter(
-                            districtsBridgesThatAreNotLeafs[j],
-                            districtsBridgesThatAreNotLeafs[j].begin()));
-
-                /* if k ≠ j */
-                if (k != j) {
-                    /* E_{k} ← E_{k} \ {e} */
-                    fixedDistricts[k].erase(e);
-                    districtsDemand[k] -= 2 * e.w;
-
-                    inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[k]);
-                    districtBridges = inducedSubGraph.getBridges();
-                    districtLeafEdges = inducedSubGraph.getLeafEdges();
-                    districtsBridgesThatAreNotLeafs[j].clear();
-                    std::set_difference(districtBridges.begin(),
-                            districtBridges.end(), districtLeafEdges.begin(),
-                            districtLeafEdges.end(), std::inserter(
-                                districtsBridgesThatAreNotLeafs[k],
-                                districtsBridgesThatAreNotLeafs[k].begin()));
+                for (unsigned int fId : bridges) {
+                    SolutionFixer::pushDemandUnderTheMinimumMove(instance, state, j, fId,
+                            minimumDemand, maximumDemand, unallocatedQueue,
+                            allocatedQueue);
                 }
+
+                bridges.clear();
             } else {
                 break;
             }
         }
     }
-
-    return fixedDistricts;
 }
 
 /*
@@ -661,159 +451,146 @@ std::vector<std::set<Edge> > SolutionFixer::fixDistrictsWithDemandUnderTheMinimu
 Solution SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(
         const Solution & solution, unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Instance instance = solution.getInstance();
-    std::vector<std::set<Edge> > districts = solution.getDistricts();
-    double minimumDemand = instance.getMinimumDemand();
-    double maximumDemand = instance.getMaximumDemand();
-    std::vector<std::set<Edge> > adjacentEdges (instance.getG().m());
-    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
-    std::set<Edge> allocatedEdges = solution.getAllocatedEdges();
-    std::set<Edge> unallocatedEdges = solution.getUnallocatedEdges();
-    std::vector<std::set<Edge> > allocatedAdjacentEdges (instance.getG().m());
-    std::vector<std::set<Edge> > unallocatedAdjacentEdges (instance.getG().m());
-    std::vector<double> districtsDemand = solution.getDistrictsDemand();
-    std::vector<std::set<Edge> > districtsBridgesThatAreNotLeafs (instance.getM());
-
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-
-        adjacentEdges[eId - 1] = instance.getG().getAdjacentEdges(e);
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                adjacentEdges[eId - 1].begin(), adjacentEdges[eId - 1].end(),
-                std::inserter(allocatedAdjacentEdges[eId - 1],
-                    allocatedAdjacentEdges[eId - 1].begin()));
-        std::set_intersection(unallocatedEdges.begin(),
-                unallocatedEdges.end(), adjacentEdges[eId - 1].begin(),
-                adjacentEdges[eId - 1].end(), std::inserter(
-                    unallocatedAdjacentEdges[eId - 1],
-                    unallocatedAdjacentEdges[eId - 1].begin()));
-    }
+    const Instance & instance = solution.getInstance();
+    RepairState state (instance, solution.getEdgesDistrict());
 
-    for (unsigned int j = 0; j < instance.getM(); j++) {
-        Graph inducedSubGraph = instance.getG().getInducedSubGraph(districts[j]);
-        std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-        std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-        std::set_difference(districtBridges.begin(), districtBridges.end(),
-                districtLeafEdges.begin(), districtLeafEdges.end(),
-                std::inserter(districtsBridgesThatAreNotLeafs[j],
-                    districtsBridgesThatAreNotLeafs[j].begin()));
-    }
-
-    std::vector<std::set<Edge> > fixedDistricts =
-        SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(instance, 
-                districts, minimumDemand, maximumDemand, adjacentEdges, 
-                edgesDistrict, allocatedEdges, unallocatedEdges, 
-                allocatedAdjacentEdges, unallocatedAdjacentEdges, 
-                districtsDemand, districtsBridgesThatAreNotLeafs, startTime, 
-                timeLimit);
+    SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(instance, state,
+            instance.getMinimumDemand(), instance.getMaximumDemand(), startTime,
+            timeLimit);
 
-    return Solution(instance, fixedDistricts);
+    return state.getSolution();
 }
 
 /*
- * Try to fix unallocated edges in the specified districts.
+ * Returns the best move of the specified unallocated edge into an adjacent
+ * district, keyed by the largest profit, then the smallest demand of the edge
+ * and then the smallest demand of the district.
  *
- * @param instance               the instance of the districts.
- * @param districts              the districts to be fixed.
- * @param maximumDemand          the maximum allowed demand for each district.
- * @param adjacentEdges          the edges adjacent to each edge.
- * @param edgesDistrict          the current district of each edge.
- * @param allocatedEdges         the current allocated edges.
- * @param unallocatedEdges       the current unallocated edges.
- * @param allocatedAdjacentEdges the current allocated adjacent edges of each edge.
- * @param districtsDemand        the current demand of each district.
- * @param startTime              the start time.
- * @param timeLimit              the time limit.
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param fId           the edge's id.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param j             the receiving district.
+ * @param key           the move's key.
  *
- * @return possibly fixed districts.
+ * @return true if the edge can move to an adjacent district; false otherwise.
  */
-std::vector<std::set<Edge> > SolutionFixer::fixUnallocatedEdges(
-        const Instance & instance,
-        const std::vector<std::set<Edge> > & districts, double maximumDemand,
-        const std::vector<std::set<Edge> > & adjacentEdges,
-        std::vector<unsigned int> & edgesDistrict,
-        std::set<Edge> & allocatedEdges, std::set<Edge> & unallocatedEdges,
-        std::vector<std::set<Edge> > & allocatedAdjacentEdges,
-        std::vector<double> & districtsDemand, 
-        const std::chrono::steady_clock::time_point & startTime, 
+bool SolutionFixer::getUnallocatedEdgeMove(const Instance & instance,
+        const RepairState & state, unsigned int fId, double maximumDemand,
+        unsigned int & j, std::array<double, 3> & key) {
+    double weight = instance.getEdge(fId).w;
+    bool found = false;
+
+    /* ∀ g ∈ σ_{G}(f)∩(∪_{k = 1}^{m}{E_{k}}) */
+    for (std::vector<unsigned int>::const_iterator gIdIt =
+            instance.getAdjacentEdgesIdsBegin(fId);
+            gIdIt != instance.getAdjacentEdgesIdsEnd(fId); gIdIt++) {
+        /* let k ∈ {1, ..., m} such that g ∈ E_{k} */
+        unsigned int k = state.edgesDistrict[*gIdIt - 1];
+
+        if (k == instance.getM() || state.districtsDemand[k] + 2 * weight > maximumDemand) {
+            continue;
+        }
+
+        /* (maxC, minW, minD) */
+        std::array<double, 3> newKey = {instance.getC(fId, k), -weight,
+            -state.districtsDemand[k]};
+
+        if (!found || key < newKey) {
+            found = true;
+            j = k;
+            key = newKey;
+        }
+    }
+
+    return found;
+}
+
+/*
+ * Try to fix unallocated edges in the specified repair state. The moves of the
+ * unallocated edges are kept in an indexed priority queue keyed by the same
+ * criterion as the scan it replaces. Stale keys only overestimate, since the
+ * districts' demand only increases, so a move is revalidated when it reaches
+ * the top and only the moves of the edges adjacent to the last allocated edge,
+ * which may gain a receiving district, are updated eagerly.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param startTime     the start time.
+ * @param timeLimit     the time limit.
+ */
+void SolutionFixer::fixUnallocatedEdges(const Instance & instance, RepairState & state,
+        double maximumDemand, const std::chrono::steady_clock::time_point & startTime,
         unsigned int timeLimit) {
-    std::vector<std::set<Edge> > fixedDistricts (districts);
+    const std::pmr::vector<unsigned int> & unallocatedEdges =
+        state.districtsEdges[instance.getM()];
+    IndexedPriorityQueue movesQueue (instance.getG().m(),
+            state.getMemoryResource());
+    std::array<double, 3> key;
+    unsigned int j = instance.getM();
+
+    for (unsigned int fId : unallocatedEdges) {
+        if (SolutionFixer::getUnallocatedEdgeMove(instance, state, fId, maximumDemand, j,
+                    key)) {
+            movesQueue.push(fId, key);
+        }
+    }
 
     /* while ∪_{j = 1}^{m}{E_{j}} ≠ E  */
     while (!unallocatedEdges.empty() && Heuristic::getElapsedTime(startTime) < timeLimit) {
         /* e ← ∅ */
         bool found = false;
-        Edge e;
         unsigned int eId = 0;
+
         /* j ← 0 */
-        unsigned int j = instance.getM();
-        /* maxC ← -∞ */
-        double maxValue = -DBL_MAX;
-        /* minW ← ∞ */
-        double minWeight = DBL_MAX;
-        /* minD ← ∞ */
-        double minDemand = DBL_MAX;
-
-        /* ∀ f ∈ E\(∪_{k = 1}^{m}{E_{k}}) */
-        for (const Edge & f : unallocatedEdges) {
-            unsigned int fId = instance.getG().getEdgeId(f);
-            double weight = f.w;
-
-            /* ∀ g ∈ σ_{G}(f)∩(∪_{k = 1}^{m}{E_{k}}) */
-            for (const Edge & g : allocatedAdjacentEdges[fId - 1]) {
-                unsigned int gId = instance.getG().getEdgeId(g);
-                /* let k ∈ {1, ..., m} such that g ∈ E_{k} */
-                unsigned int k = edgesDistrict[gId - 1];
-                double value = instance.getC(f, k);
+        j = instance.getM();
 
-                /*
-                 * if d_{E_{k}} + 2 d_{f} ≤ min{D, (1 + B) \bar{d}_{ℰ}} 
-                 * ∧ (e = ∅ ∨ maxC < c_{f, k} ∨ (maxC = c_{f, k} ∧ 
-                 * (minW > d_{f ∨ (minW = d_{f} ∧ minD > d_{E_{k}}))))
-                 */
-                if (districtsDemand[k] + 2 * weight <= maximumDemand &&
-                        (!found || maxValue < value ||
-                         (maxValue == value &&
-                          (minWeight > weight ||
-                           (minWeight == weight &&
-                            minDemand > districtsDemand[k]))))) {
-                    /* e ← f */
-                    found = true;
-                    e = f;
-                    eId = fId;
-                    /* j ← k */
-                    j = k;
-                    /* maxC ← c_{f, k} */
-                    maxValue = value;
-                    /* minW ← d_{f} */
-                    minWeight = weight;
-                    /* minD ← d_{E_{k}} */
-                    minDemand = districtsDemand[k];
-                }
+        while (!movesQueue.isEmpty()) {
+            unsigned int fId = movesQueue.top();
+            unsigned int k = instance.getM();
+
+            if (!SolutionFixer::getUnallocatedEdgeMove(instance, state, fId,
+                        maximumDemand, k, key)) {
+                movesQueue.remove(fId);
+            } else if (key != movesQueue.getKey(fId)) {
+                movesQueue.push(fId, key);
+            } else {
+                /* e ← f, j ← k */
+                found = true;
+                eId = fId;
+                j = k;
+                break;
             }
         }
 
         /* if e = ∅ */
         if (!found) {
+            /* maxC ← -∞ */
+            double maxValue = -DBL_MAX;
+            /* minW ← ∞ */
+            double minWeight = DBL_MAX;
+            /* minD ← ∞ */
+            double minDemand = DBL_MAX;
+
             /* ∀ f ∈ E\(∪_{k = 1}^{m}{E_{k}}) */
-            for (const Edge & f : unallocatedEdges) {
-                unsigned int fId = instance.getG().getEdgeId(f);
-                double weight = f.w;
+            for (unsigned int fId : unallocatedEdges) {
+                double weight = instance.getEdge(fId).w;
+
                 /* ∀ k ∈ {1, ..., m} */
                 for (unsigned int k = 0; k < instance.getM(); k++) {
-                    double value = instance.getC(f, k);
+                    double value = instance.getC(fId, k);
 
-                    /* 
-                     * if e = ∅ ∨ maxC < c_{f, k} ∨ (maxC = c_{f, k} ∧ 
+                    /*
+                     * if e = ∅ ∨ maxC < c_{f, k} ∨ (maxC = c_{f, k} ∧
                      * (minW > d_{f} ∨ (minW = d_{f} ∧ minD > d_{E_{k}})))
                      */
                     if (!found || maxValue < value || (maxValue == value &&
                                 (minWeight > weight ||
                                  (minWeight == weight &&
-                                  minDemand > districtsDemand[k])))) {
+                                  minDemand > state.districtsDemand[k])))) {
                         /* e ← f */
                         found = true;
-                        e = f;
                         eId = fId;
                         /* j ← k */
                         j = k;
@@ -822,27 +599,30 @@ std::vector<std::set<Edge> > SolutionFixer::fixUnallocatedEdges(
                         /* minW ← d_{f} */
                         minWeight = weight;
                         /* minD ← d_{E_{k}} */
-                        minDemand = districtsDemand[k];
+                        minDemand = state.districtsDemand[k];
                     }
                 }
             }
         }
 
-        /* E_{j} ← E_{j} ∪ {e} */
-        fixedDistricts[j].insert(e);
-        districtsDemand[j] += 2 * e.w;
-        edgesDistrict[eId - 1] = j;
-        allocatedEdges.insert(e);
-        unallocatedEdges.erase(e);
+        movesQueue.remove(eId);
 
-        for (const Edge & f : adjacentEdges[eId - 1]) {
-            unsigned int fId = instance.getG().getEdgeId(f);
-
-            allocatedAdjacentEdges[fId - 1].insert(e);
+        /* E_{j} ← E_{j} ∪ {e} */
+        state.moveEdge(eId, j);
+
+        /* The unallocated edges adjacent to e may now reach E_{j} */
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            unsigned int k = instance.getM();
+
+            if (state.edgesDistrict[*fIdIt - 1] == instance.getM() &&
+                    SolutionFixer::getUnallocatedEdgeMove(instance, state, *fIdIt,
+                        maximumDemand, k, key)) {
+                movesQueue.push(*fIdIt, key);
+            }
         }
     }
-
-    return fixedDistricts;
 }
 
 /*
@@ -854,126 +634,377 @@ std::vector<std::set<Edge> > SolutionFixer::fixUnallocatedEdges(
  */
 Solution SolutionFixer::fixUnallocatedEdges(const Solution & solution, unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Instance instance = solution.getInstance();
-    std::vector<std::set<Edge> > districts = solution.getDistricts();
-    double maximumDemand = instance.getMaximumDemand();
-    std::vector<std::set<Edge> > adjacentEdges (instance.getG().m());
-    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
-    std::set<Edge> allocatedEdges = solution.getAllocatedEdges();
-    std::set<Edge> unallocatedEdges = solution.getUnallocatedEdges();
-    std::vector<std::set<Edge> > allocatedAdjacentEdges (instance.getG().m());
-    std::vector<double> districtsDemand = solution.getDistrictsDemand();
-
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-
-        adjacentEdges[eId - 1] = instance.getG().getAdjacentEdges(e);
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                adjacentEdges[eId - 1].begin(), adjacentEdges[eId - 1].end(),
-                std::inserter(allocatedAdjacentEdges[eId - 1],
-                    allocatedAdjacentEdges[eId - 1].begin()));
+    const Instance & instance = solution.getInstance();
+    RepairState state (instance, solution.getEdgesDistrict());
+
+    SolutionFixer::fixUnallocatedEdges(instance, state, instance.getMaximumDemand(),
+            startTime, timeLimit);
+
+    return state.getSolution();
+}
+
+/*
+ * Returns the edge of the specified district whose move to the specified
+ * adjacent district transfers demand at the lowest profit loss per unit of
+ * demand, and then the largest demand, keeping both districts connected. The
+ * edge's demand must not exceed the demand to be transferred, unless both
+ * districts stay within the bounds.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param j             the giving district.
+ * @param k             the receiving district.
+ * @param demand        the demand to be transferred.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param eId           the edge's id.
+ *
+ * @return true if an edge can be moved; false otherwise.
+ */
+bool SolutionFixer::getTransferMove(const Instance & instance, const RepairState & state,
+        unsigned int j, unsigned int k, double demand, double minimumDemand,
+        double maximumDemand, unsigned int & eId) {
+    bool found = false;
+    /* minC ← ∞ */
+    double minValue = DBL_MAX;
+    /* maxW ← -∞ */
+    double maxWeight = -DBL_MAX;
+
+    if (state.districtsEdges[j].size() <= 1) {
+        return false;
+    }
+
+    /* ∀ f ∈ E_{j} */
+    for (unsigned int fId : state.districtsEdges[j]) {
+        double weight = instance.getEdge(fId).w;
+
+        /* G[E_{j}\{f}] is disconnected */
+        if (state.isBridgeThatIsNotLeaf[fId - 1]) {
+            continue;
+        }
+
+        /* 2 d_{f} > δ ∧ (d_{E_{k}} + 2 d_{f} > max ∨ d_{E_{j}} - 2 d_{f} < min) */
+        if (2 * weight > demand + MinimumCostFlow::EPSILON &&
+                (state.districtsDemand[k] + 2 * weight > maximumDemand ||
+                 state.districtsDemand[j] - 2 * weight < minimumDemand)) {
+            continue;
+        }
+
+        bool isAdjacent = false;
+
+        /* f ∈ σ_{G}(V_{k}) */
+        for (std::vector<unsigned int>::const_iterator gIdIt =
+                instance.getAdjacentEdgesIdsBegin(fId);
+                gIdIt != instance.getAdjacentEdgesIdsEnd(fId) && !isAdjacent; gIdIt++) {
+            isAdjacent = state.edgesDistrict[*gIdIt - 1] == k;
+        }
+
+        if (!isAdjacent) {
+            continue;
+        }
+
+        double value = (instance.getC(fId, j) - instance.getC(fId, k)) / (2 * weight);
+
+        /* if minC > (c_{f, j} - c_{f, k}) / 2 d_{f} ∨ (minC = ... ∧ maxW < d_{f}) */
+        if (minValue > value || (minValue == value && maxWeight < weight)) {
+            found = true;
+            eId = fId;
+            minValue = value;
+            maxWeight = weight;
+        }
+    }
+
+    return found;
+}
+
+/*
+ * Returns the demand to be transferred between each pair of districts of the
+ * specified repair state by a minimum cost flow on the districts' adjacency
+ * graph, whose arcs cost the lowest profit loss per unit of demand of the
+ * movable edges in the districts' frontier and have their total demand as
+ * capacity. The demand each district must give or receive is sent through
+ * penalized arcs, and the demand each district may give or receive within its
+ * bounds through free arcs, so that the flow fixes as much of the imbalance as
+ * possible at the lowest cost.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ *
+ * @return the demand to be transferred from each district to each other.
+ */
+std::vector<std::vector<double> > SolutionFixer::getTransferDemands(
+        const Instance & instance, const RepairState & state, double minimumDemand,
+        double maximumDemand) {
+    unsigned int m = instance.getM();
+    std::vector<std::vector<double> > transferCosts (m, std::vector<double>(m, DBL_MAX));
+    std::vector<std::vector<double> > transferCapacities (m, std::vector<double>(m, 0.0));
+    std::vector<unsigned int> lastEdges (m, 0);
+    double maxCost = 0.0;
+
+    /* ∀ j ∈ {1, ..., m} */
+    for (unsigned int j = 0; j < m; j++) {
+        if (state.districtsEdges[j].size() <= 1) {
+            continue;
+        }
+
+        /* ∀ e ∈ E_{j} such that G[E_{j}\{e}] is connected */
+        for (unsigned int eId : state.districtsEdges[j]) {
+            if (state.isBridgeThatIsNotLeaf[eId - 1]) {
+                continue;
+            }
+
+            double demand = 2 * instance.getEdge(eId).w;
+
+            /* ∀ k ∈ {1, ..., m} such that e ∈ σ_{G}(V_{k}) */
+            for (std::vector<unsigned int>::const_iterator fIdIt =
+                    instance.getAdjacentEdgesIdsBegin(eId);
+                    fIdIt != instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+                unsigned int k = state.edgesDistrict[*fIdIt - 1];
+
+                if (k == j || lastEdges[k] == eId) {
+                    continue;
+                }
+
+                lastEdges[k] = eId;
+
+                /* Profitable moves are left to the local search, so the network has no negative cycle */
+                double cost = std::max(0.0, (instance.getC(eId, j) -
+                            instance.getC(eId, k)) / demand);
+
+                transferCosts[j][k] = std::min(transferCosts[j][k], cost);
+                transferCapacities[j][k] += demand;
+                maxCost = std::max(maxCost, cost);
+            }
+        }
     }
 
-    std::vector<std::set<Edge> > fixedDistricts =
-        SolutionFixer::fixUnallocatedEdges(instance, districts, maximumDemand,
-                adjacentEdges, edgesDistrict, allocatedEdges,
-                unallocatedEdges, allocatedAdjacentEdges, districtsDemand, 
-                startTime, timeLimit);
+    /* Any path through a penalized arc is cheaper than any path without one */
+    double penalty = 2.0 * (m + 1) * maxCost + 1.0;
+    MinimumCostFlow flow (m + 2);
+    std::vector<std::vector<unsigned int> > transferArcs (m,
+            std::vector<unsigned int>(m, 0));
+
+    for (unsigned int j = 0; j < m; j++) {
+        double demand = state.districtsDemand[j];
+
+        if (demand > maximumDemand) {
+            flow.addArc(m, j, demand - maximumDemand, -penalty);
+        } else if (demand < minimumDemand) {
+            flow.addArc(j, m + 1, minimumDemand - demand, -penalty);
+        } else {
+            flow.addArc(m, j, demand - minimumDemand, 0.0);
+            flow.addArc(j, m + 1, maximumDemand - demand, 0.0);
+        }
 
-    return Solution(instance, fixedDistricts);
+        for (unsigned int k = 0; k < m; k++) {
+            if (transferCapacities[j][k] > 0.0) {
+                transferArcs[j][k] = flow.addArc(j, k, transferCapacities[j][k],
+                        transferCosts[j][k]);
+            }
+        }
+    }
+
+    flow.solve(m, m + 1, -penalty / 2.0);
+
+    std::vector<std::vector<double> > transferDemands (m, std::vector<double>(m, 0.0));
+
+    for (unsigned int j = 0; j < m; j++) {
+        for (unsigned int k = 0; k < m; k++) {
+            if (transferCapacities[j][k] > 0.0) {
+                transferDemands[j][k] = flow.getFlow(transferArcs[j][k]);
+            }
+        }
+    }
+
+    return transferDemands;
 }
 
 /*
- * Try to fix the specified solution.
+ * Try to fix districts with demand out of bounds in the specified repair
+ * state, if it is a connected partition. The demand transfers between
+ * adjacent districts are computed by a minimum cost flow and realised by
+ * moving frontier edges that keep both districts connected. Since the edges'
+ * demands are discrete and only the frontier is movable at once, the flow is
+ * recomputed while the total demand out of bounds decreases.
+ *
+ * @param instance      the instance of the repaired solution.
+ * @param state         the repair state.
+ * @param minimumDemand the minimum allowed demand for each district.
+ * @param maximumDemand the maximum allowed demand for each district.
+ * @param startTime     the start time.
+ * @param timeLimit     the time limit.
+ */
+void SolutionFixer::fixUnbalancedDistricts(const Instance & instance, RepairState & state,
+        double minimumDemand, double maximumDemand,
+        const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) {
+    unsigned int m = instance.getM();
+    double imbalance = DBL_MAX;
+
+    /* ∪_{j = 1}^{m}{E_{j}} ≠ E */
+    if (!state.districtsEdges[m].empty()) {
+        return;
+    }
+
+    for (unsigned int j = 0; j < m; j++) {
+        /* G[E_{j}] is disconnected */
+        if (state.getConnectedComponents(j).size() > 1) {
+            return;
+        }
+    }
+
+    while (Heuristic::getElapsedTime(startTime) < timeLimit) {
+        double newImbalance = 0.0;
+
+        for (unsigned int j = 0; j < m; j++) {
+            newImbalance += std::max(0.0, state.districtsDemand[j] - maximumDemand) +
+                std::max(0.0, minimumDemand - state.districtsDemand[j]);
+        }
+
+        if (newImbalance <= MinimumCostFlow::EPSILON ||
+                newImbalance >= imbalance - MinimumCostFlow::EPSILON) {
+            break;
+        }
+
+        imbalance = newImbalance;
+
+        std::vector<std::vector<double> > transferDemands =
+            SolutionFixer::getTransferDemands(instance, state, minimumDemand,
+                    maximumDemand);
+        bool isMoved = true;
+
+        /* Realising the flow one edge per transfer at a time */
+        while (isMoved && Heuristic::getElapsedTime(startTime) < timeLimit) {
+            isMoved = false;
+
+            for (unsigned int j = 0; j < m; j++) {
+                for (unsigned int k = 0; k < m; k++) {
+                    unsigned int eId = 0;
+
+                    if (transferDemands[j][k] <= MinimumCostFlow::EPSILON ||
+                            !SolutionFixer::getTransferMove(instance, state, j, k,
+                                transferDemands[j][k], minimumDemand, maximumDemand,
+                                eId)) {
+                        continue;
+                    }
+
+                    transferDemands[j][k] -= 2 * instance.getEdge(eId).w;
+
+                    /* E_{k} ← E_{k} ∪ {e}, E_{j} ← E_{j} \ {e} */
+                    state.moveEdge(eId, k);
+                    state.updateBridgesThatAreNotLeafs(j);
+                    state.updateBridgesThatAreNotLeafs(k);
+                    isMoved = true;
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Try to fix districts with demand out of bounds in the specified solution.
  *
  * @param solution  the solution to be fixed.
  * @param timeLimit the time limit.
  *
- * @return a possible fixed solution.
+ * @return a possibly fixed solution.
  */
-Solution SolutionFixer::fixSolution(const Solution & solution, unsigned int timeLimit) {
+Solution SolutionFixer::fixUnbalancedDistricts(const Solution & solution,
+        unsigned int timeLimit) {
     std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Instance instance = solution.getInstance();
-    std::vector<std::set<Edge> > fixedDistricts = solution.getDistricts();
-    double minimumDemand = instance.getMinimumDemand();
-    double maximumDemand = instance.getMaximumDemand();
+    const Instance & instance = solution.getInstance();
+    RepairState state (instance, solution.getEdgesDistrict());
 
-    std::vector<std::set<Edge> > adjacentEdges (instance.getG().m());
-    std::vector<double> districtsDemand = solution.getDistrictsDemand();
+    SolutionFixer::fixUnbalancedDistricts(instance, state, instance.getMinimumDemand(),
+            instance.getMaximumDemand(), startTime, timeLimit);
 
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
+    return state.getSolution();
+}
 
-        adjacentEdges[eId - 1] = instance.getG().getAdjacentEdges(e);
-    }
+/*
+ * Try to fix the specified solution. The repair state is built once and
+ * updated in place by every phase.
+ *
+ * @param solution  the solution to be fixed.
+ * @param timeLimit the time limit.
+ *
+ * @return a possible fixed solution.
+ */
+Solution SolutionFixer::fixSolution(Solution solution, unsigned int timeLimit) {
+    return SolutionFixer::fixSolution(std::move(solution), timeLimit, false);
+}
 
-    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
-    std::set<Edge> allocatedEdges = solution.getAllocatedEdges();
-    std::set<Edge> unallocatedEdges = solution.getUnallocatedEdges();
-    std::vector<std::set<Edge> > allocatedAdjacentEdges (instance.getG().m());
-    std::vector<std::set<Edge> > unallocatedAdjacentEdges (instance.getG().m());
-    std::vector<std::set<Edge> > districtsBridgesThatAreNotLeafs (instance.getM());
-
-    for (const Edge & e : instance.getG().getEdges()) {
-        unsigned int eId = instance.getG().getEdgeId(e);
-
-        std::set_intersection(allocatedEdges.begin(), allocatedEdges.end(),
-                adjacentEdges[eId - 1].begin(), adjacentEdges[eId - 1].end(),
-                std::inserter(allocatedAdjacentEdges[eId - 1],
-                    allocatedAdjacentEdges[eId - 1].begin()));
-        std::set_intersection(unallocatedEdges.begin(),
-                unallocatedEdges.end(), adjacentEdges[eId - 1].begin(),
-                adjacentEdges[eId - 1].end(), std::inserter(
-                    unallocatedAdjacentEdges[eId - 1],
-                    unallocatedAdjacentEdges[eId - 1].begin()));
-    }
+/*
+ * Try to fix the specified solution, first rebalancing it by a minimum cost
+ * flow if it is a connected partition and the flag is set.
+ *
+ * @param solution        the solution to be fixed.
+ * @param timeLimit       the time limit.
+ * @param flowRebalancing the flag indicating whether to rebalance connected
+ *                        partitions by a minimum cost flow.
+ *
+ * @return a possible fixed solution.
+ */
+Solution SolutionFixer::fixSolution(Solution solution, unsigned int timeLimit,
+        bool flowRebalancing) {
+    return SolutionFixer::fixSolution(std::move(solution), timeLimit, flowRebalancing,
+            std::pmr::get_default_resource());
+}
+
+/*
+ * Try to fix the specified solution, allocating the repair state and the
+ * repair's temporaries from the specified memory resource. The solution is
+ * updated in place, so that moving it in copies nothing.
+ *
+ * @param solution        the solution to be fixed.
+ * @param timeLimit       the time limit.
+ * @param flowRebalancing the flag indicating whether to rebalance connected
+ *                        partitions by a minimum cost flow.
+ * @param memoryResource  the memory resource.
+ *
+ * @return a possible fixed solution.
+ */
+Solution SolutionFixer::fixSolution(Solution solution, unsigned int timeLimit,
+        bool flowRebalancing, std::pmr::memory_resource * memoryResource) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    const Instance & instance = solution.getInstance();
+    double minimumDemand = instance.getMinimumDemand();
+    double maximumDemand = instance.getMaximumDemand();
+    RepairState state (instance, solution.getEdgesDistrict(), memoryResource);
 
-    for (unsigned int j = 0; j < instance.getM(); j++) {
-        Graph inducedSubGraph = instance.getG().getInducedSubGraph(fixedDistricts[j]);
-        std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-        std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-        std::set_difference(districtBridges.begin(), districtBridges.end(),
-                districtLeafEdges.begin(), districtLeafEdges.end(),
-                std::inserter(districtsBridgesThatAreNotLeafs[j],
-                    districtsBridgesThatAreNotLeafs[j].begin()));
+    /* Fixing districts with demand out of bounds by a minimum cost flow */
+    if (flowRebalancing) {
+        SolutionFixer::fixUnbalancedDistricts(instance, state, minimumDemand,
+                maximumDemand, startTime, timeLimit);
     }
 
     /* Fixing disconnected districts */
-    fixedDistricts = SolutionFixer::fixDisconnectedDistricts(instance,
-            fixedDistricts, adjacentEdges, edgesDistrict, allocatedEdges,
-            unallocatedEdges, allocatedAdjacentEdges,
-            unallocatedAdjacentEdges, districtsDemand,
-            districtsBridgesThatAreNotLeafs, startTime, timeLimit);
+    SolutionFixer::fixDisconnectedDistricts(instance, state, startTime, timeLimit);
 
     /* Fixing district with demand over the maximum */
-    fixedDistricts = SolutionFixer::fixDistrictsWithDemandOverTheMaximum(
-            instance, fixedDistricts, minimumDemand, maximumDemand, 
-            adjacentEdges, edgesDistrict, allocatedEdges, unallocatedEdges, 
-            allocatedAdjacentEdges, unallocatedAdjacentEdges, 
-            districtsDemand, districtsBridgesThatAreNotLeafs, startTime, 
-            timeLimit);
+    SolutionFixer::fixDistrictsWithDemandOverTheMaximum(instance, state, minimumDemand,
+            maximumDemand, startTime, timeLimit);
 
     /* Fixing disconnected districts */
-    fixedDistricts = SolutionFixer::fixDisconnectedDistricts(instance,
-            fixedDistricts, adjacentEdges, edgesDistrict, allocatedEdges,
-            unallocatedEdges, allocatedAdjacentEdges,
-            unallocatedAdjacentEdges, districtsDemand,
-            districtsBridgesThatAreNotLeafs, startTime, timeLimit);
+    SolutionFixer::fixDisconnectedDistricts(instance, state, startTime, timeLimit);
 
     /* Fixing district with demand under the minimum */
-    fixedDistricts = SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(
-            instance, fixedDistricts, minimumDemand, maximumDemand, 
-            adjacentEdges, edgesDistrict, allocatedEdges, unallocatedEdges, 
-            allocatedAdjacentEdges, unallocatedAdjacentEdges, 
-            districtsDemand, districtsBridgesThatAreNotLeafs, startTime, 
-            timeLimit);
+    SolutionFixer::fixDistrictsWithDemandUnderTheMinimum(instance, state, minimumDemand,
+            maximumDemand, startTime, timeLimit);
 
     /* Fixing unallocated edges */
-    fixedDistricts = SolutionFixer::fixUnallocatedEdges(instance, 
-            fixedDistricts, maximumDemand, adjacentEdges, edgesDistrict, 
-            allocatedEdges, unallocatedEdges, allocatedAdjacentEdges, 
-            districtsDemand, startTime, timeLimit);
+    SolutionFixer::fixUnallocatedEdges(instance, state, maximumDemand, startTime,
+            timeLimit);
 
-    return Solution(instance, fixedDistricts);
-}
+    /* Fixing districts with demand out of bounds left by the greedy phases */
+    if (flowRebalancing) {
+        SolutionFixer::fixUnbalancedDistricts(instance, state, minimumDemand,
+                maximumDemand, startTime, timeLimit);
+    }
+
+    state.updateSolution(solution);
 
+    return solution;
+}
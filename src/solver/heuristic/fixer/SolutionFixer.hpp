@@ -2,41 +2,128 @@
 
 #include "../../../solution/Solution.hpp"
 #include "../Heuristic.hpp"
+#include "IndexedPriorityQueue.hpp"
+#include "MinimumCostFlow.hpp"
+#include "RepairState.hpp"
 
 class SolutionFixer {
+    private:
+        /*
+         * Returns the best move of the specified edge out of its district
+         * with demand over the maximum, keyed by the lowest profit in the
+         * district, then the largest demand and then the largest profit in
+         * the receiving district.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param j             the edge's district.
+         * @param fId           the edge's id.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param k             the receiving district.
+         * @param key           the move's key.
+         *
+         * @return true if the edge can move to an adjacent district; false
+         *         otherwise.
+         */
+        static bool getDemandOverTheMaximumMove(const Instance & instance,
+                const RepairState & state, unsigned int j, unsigned int fId,
+                double minimumDemand, double maximumDemand, unsigned int & k,
+                std::array<double, 3> & key);
+
+        /*
+         * Inserts the move of the specified edge into the specified district
+         * with demand under the minimum into the queue of the unallocated
+         * edges, keyed by the largest profit in the district and then the
+         * largest demand, or into the queue of the allocated edges, keyed by
+         * the largest profit increase and then the largest demand; the move
+         * is removed when it is infeasible.
+         *
+         * @param instance         the instance of the repaired solution.
+         * @param state            the repair state.
+         * @param j                the receiving district.
+         * @param fId              the edge's id.
+         * @param minimumDemand    the minimum allowed demand for each district.
+         * @param maximumDemand    the maximum allowed demand for each district.
+         * @param unallocatedQueue the moves of the unallocated edges.
+         * @param allocatedQueue   the moves of the allocated edges.
+         */
+        static void pushDemandUnderTheMinimumMove(const Instance & instance,
+                const RepairState & state, unsigned int j, unsigned int fId,
+                double minimumDemand, double maximumDemand,
+                IndexedPriorityQueue & unallocatedQueue,
+                IndexedPriorityQueue & allocatedQueue);
+
+        /*
+         * Returns the best move of the specified unallocated edge into an
+         * adjacent district, keyed by the largest profit, then the smallest
+         * demand of the edge and then the smallest demand of the district.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param fId           the edge's id.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param j             the receiving district.
+         * @param key           the move's key.
+         *
+         * @return true if the edge can move to an adjacent district; false
+         *         otherwise.
+         */
+        static bool getUnallocatedEdgeMove(const Instance & instance,
+                const RepairState & state, unsigned int fId, double maximumDemand,
+                unsigned int & j, std::array<double, 3> & key);
+
+        /*
+         * Returns the edge of the specified district whose move to the
+         * specified adjacent district transfers demand at the lowest profit
+         * loss per unit of demand, and then the largest demand, keeping both
+         * districts connected. The edge's demand must not exceed the demand
+         * to be transferred, unless both districts stay within the bounds.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param j             the giving district.
+         * @param k             the receiving district.
+         * @param demand        the demand to be transferred.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param eId           the edge's id.
+         *
+         * @return true if an edge can be moved; false otherwise.
+         */
+        static bool getTransferMove(const Instance & instance, const RepairState & state,
+                unsigned int j, unsigned int k, double demand, double minimumDemand,
+                double maximumDemand, unsigned int & eId);
+
+        /*
+         * Returns the demand to be transferred between each pair of districts
+         * of the specified repair state by a minimum cost flow on the
+         * districts' adjacency graph, which fixes as much of the imbalance as
+         * possible at the lowest profit loss.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         *
+         * @return the demand to be transferred from each district to each
+         *         other.
+         */
+        static std::vector<std::vector<double> > getTransferDemands(
+                const Instance & instance, const RepairState & state,
+                double minimumDemand, double maximumDemand);
+
     public:
         /*
-         * Try to fix disconnected districts in the specified districts.
-         *
-         * @param instance                       the instance of the districts.
-         * @param districts                      the districts to be fixed.
-         * @param adjacentEdges                  the edges adjacent to each edge.
-         * @param edgesDistrict                  the current district of each edge.
-         * @param allocatedEdges                 the current allocated edges.
-         * @param unallocatedEdges               the current unallocated edges.
-         * @param allocatedAdjacentEdges         the current allocated 
-         *                                       adjacent edges of each edge.
-         * @param unallocatedAdjacentEdges       the current unallocated 
-         *                                       adjacent edges of each edge.
-         * @param districtsDemand                the current demand of each district.
-         * @param districtsBridgesThatAreNotLeaf the current bridges that are 
-         *                                       not leaf edges of each district.
-         * @param startTime                      the start time.
-         * @param timeLimit                      the time limit.
-         *
-         * @return possibly fixed districts.
-         */
-        static std::vector<std::set<Edge> > fixDisconnectedDistricts(
-                const Instance & instance, 
-                const std::vector<std::set<Edge> > & districts, 
-                const std::vector<std::set<Edge> > & adjacentEdges, 
-                std::vector<unsigned int> & edgesDistrict, 
-                std::set<Edge> & allocatedEdges, 
-                std::set<Edge> & unallocatedEdges, 
-                std::vector<std::set<Edge> > & allocatedAdjacentEdges, 
-                std::vector<std::set<Edge> > & unallocatedAdjacentEdges, 
-                std::vector<double> & districtsDemand, 
-                std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs,
+         * Try to fix disconnected districts in the specified repair state.
+         *
+         * @param instance  the instance of the repaired solution.
+         * @param state     the repair state.
+         * @param startTime the start time.
+         * @param timeLimit the time limit.
+         */
+        static void fixDisconnectedDistricts(const Instance & instance,
+                RepairState & state,
                 const std::chrono::steady_clock::time_point & startTime,
                 unsigned int timeLimit);
 
@@ -48,45 +135,23 @@ class SolutionFixer {
          *
          * @return a possibly fixed solution.
          */
-        static Solution fixDisconnectedDistricts(const Solution & solution, 
+        static Solution fixDisconnectedDistricts(const Solution & solution,
                 unsigned int timeLimit);
 
         /*
-         * Try to fix districts with demand over the maximum in the specified districts.
-         *
-         * @param instance                       the instance of the districts.
-         * @param districts                      the districts to be fixed.
-         * @param minimumDemand                  the minimum allowed demand for each district.
-         * @param maximumDemand                  the maximum allowed demand for each district.
-         * @param adjacentEdges                  the edges adjacent to each edge.
-         * @param edgesDistrict                  the current district of each edge.
-         * @param allocatedEdges                 the current allocated edges.
-         * @param unallocatedEdges               the current unallocated edges.
-         * @param allocatedAdjacentEdges         the current allocated 
-         *                                       adjacent edges of each edge.
-         * @param unallocatedAdjacentEdges       the current unallocated 
-         *                                       adjacent edges of each edge.
-         * @param districtsDemand                the current demand of each district.
-         * @param districtsBridgesThatAreNotLeaf the current bridges that are 
-         *                                       not leaf edges of each district.
-         * @param startTime                      the start time.
-         * @param timeLimit                      the time limit.
-         *
-         * @return possibly fixed districts.
-         */
-        static std::vector<std::set<Edge> > fixDistrictsWithDemandOverTheMaximum(
-                const Instance & instance, 
-                const std::vector<std::set<Edge> > & districts, 
-                double minimumDemand, double maximumDemand, 
-                const std::vector<std::set<Edge> > & adjacentEdges, 
-                std::vector<unsigned int> & edgesDistrict, 
-                std::set<Edge> & allocatedEdges, 
-                std::set<Edge> & unallocatedEdges, 
-                std::vector<std::set<Edge> > & allocatedAdjacentEdges, 
-                std::vector<std::set<Edge> > & unallocatedAdjacentEdges, 
-                std::vector<double> & districtsDemand, 
-                std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs, 
-                const std::chrono::steady_clock::time_point & startTime, 
+         * Try to fix districts with demand over the maximum in the specified
+         * repair state.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param startTime     the start time.
+         * @param timeLimit     the time limit.
+         */
+        static void fixDistrictsWithDemandOverTheMaximum(const Instance & instance,
+                RepairState & state, double minimumDemand, double maximumDemand,
+                const std::chrono::steady_clock::time_point & startTime,
                 unsigned int timeLimit);
 
         /*
@@ -101,41 +166,19 @@ class SolutionFixer {
                 const Solution & solution, unsigned int timeLimit);
 
         /*
-         * Try to fix districts with demand under the minimum in the specified districts.
-         *
-         * @param instance                       the instance of the districts.
-         * @param districts                      the districts to be fixed.
-         * @param minimumDemand                  the minimum allowed demand for each district.
-         * @param maximumDemand                  the maximum allowed demand for each district.
-         * @param adjacentEdges                  the edges adjacent to each edge.
-         * @param edgesDistrict                  the current district of each edge.
-         * @param allocatedEdges                 the current allocated edges.
-         * @param unallocatedEdges               the current unallocated edges.
-         * @param allocatedAdjacentEdges         the current allocated 
-         *                                       adjacent edges of each edge.
-         * @param unallocatedAdjacentEdges       the current unallocated 
-         *                                       adjacent edges of each edge.
-         * @param districtsDemand                the current demand of each district.
-         * @param districtsBridgesThatAreNotLeaf the current bridges that are 
-         *                                       not leaf edges of each district.
-         * @param startTime                      the start time.
-         * @param timeLimit                      the time limit.
-         *
-         * @return possibly fixed districts.
-         */
-        static std::vector<std::set<Edge> > fixDistrictsWithDemandUnderTheMinimum(
-                const Instance & instance, 
-                const std::vector<std::set<Edge> > & districts, 
-                double minimumDemand, double maximumDemand, 
-                const std::vector<std::set<Edge> > & adjacentEdges, 
-                std::vector<unsigned int> & edgesDistrict, 
-                std::set<Edge> & allocatedEdges, 
-                std::set<Edge> & unallocatedEdges, 
-                std::vector<std::set<Edge> > & allocatedAdjacentEdges, 
-                std::vector<std::set<Edge> > & unallocatedAdjacentEdges, 
-                std::vector<double> & districtsDemand, 
-                std::vector<std::set<Edge> > & districtsBridgesThatAreNotLeafs,
-                const std::chrono::steady_clock::time_point & startTime, 
+         * Try to fix districts with demand under the minimum in the specified
+         * repair state.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param startTime     the start time.
+         * @param timeLimit     the time limit.
+         */
+        static void fixDistrictsWithDemandUnderTheMinimum(const Instance & instance,
+                RepairState & state, double minimumDemand, double maximumDemand,
+                const std::chrono::steady_clock::time_point & startTime,
                 unsigned int timeLimit);
 
         /*
@@ -150,33 +193,17 @@ class SolutionFixer {
                 const Solution & solution, unsigned int timeLimit);
 
         /*
-         * Try to fix unallocated edges in the specified districts.
-         *
-         * @param instance               the instance of the districts.
-         * @param districts              the districts to be fixed.
-         * @param maximumDemand          the maximum allowed demand for each district.
-         * @param adjacentEdges          the edges adjacent to each edge.
-         * @param edgesDistrict          the current district of each edge.
-         * @param allocatedEdges         the current allocated edges.
-         * @param unallocatedEdges       the current unallocated edges.
-         * @param allocatedAdjacentEdges the current allocated adjacent edges of each edge.
-         * @param districtsDemand        the current demand of each district.
-         * @param startTime              the start time.
-         * @param timeLimit              the time limit.
-         *
-         * @return possibly fixed districts.
-         */
-        static std::vector<std::set<Edge> > fixUnallocatedEdges(
-                const Instance & instance, 
-                const std::vector<std::set<Edge> > & districts, 
-                double maximumDemand, 
-                const std::vector<std::set<Edge> > & adjacentEdges, 
-                std::vector<unsigned int> & edgesDistrict, 
-                std::set<Edge> & allocatedEdges, 
-                std::set<Edge> & unallocatedEdges, 
-                std::vector<std::set<Edge> > & allocatedAdjacentEdges, 
-                std::vector<double> & districtsDemand, 
-                const std::chrono::steady_clock::time_point & startTime, 
+         * Try to fix unallocated edges in the specified repair state.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param startTime     the start time.
+         * @param timeLimit     the time limit.
+         */
+        static void fixUnallocatedEdges(const Instance & instance, RepairState & state,
+                double maximumDemand,
+                const std::chrono::steady_clock::time_point & startTime,
                 unsigned int timeLimit);
 
         /*
@@ -188,6 +215,35 @@ class SolutionFixer {
          */
         static Solution fixUnallocatedEdges(const Solution & solution, unsigned int timeLimit);
 
+        /*
+         * Try to fix districts with demand out of bounds in the specified
+         * repair state, if it is a connected partition, by realising a
+         * minimum cost flow of demand between adjacent districts.
+         *
+         * @param instance      the instance of the repaired solution.
+         * @param state         the repair state.
+         * @param minimumDemand the minimum allowed demand for each district.
+         * @param maximumDemand the maximum allowed demand for each district.
+         * @param startTime     the start time.
+         * @param timeLimit     the time limit.
+         */
+        static void fixUnbalancedDistricts(const Instance & instance, RepairState & state,
+                double minimumDemand, double maximumDemand,
+                const std::chrono::steady_clock::time_point & startTime,
+                unsigned int timeLimit);
+
+        /*
+         * Try to fix districts with demand out of bounds in the specified
+         * solution.
+         *
+         * @param solution  the solution to be fixed.
+         * @param timeLimit the time limit.
+         *
+         * @return a possibly fixed solution.
+         */
+        static Solution fixUnbalancedDistricts(const Solution & solution,
+                unsigned int timeLimit);
+
         /*
          * Try to fix the specified solution.
          *
@@ -196,6 +252,36 @@ class SolutionFixer {
          *
          * @return a possible fixed solution.
          */
-        static Solution fixSolution(const Solution & solution, unsigned int timeLimit);
-};
+        static Solution fixSolution(Solution solution, unsigned int timeLimit);
+
+        /*
+         * Try to fix the specified solution, first rebalancing it by a
+         * minimum cost flow if it is a connected partition and the flag is
+         * set.
+         *
+         * @param solution        the solution to be fixed.
+         * @param timeLimit       the time limit.
+         * @param flowRebalancing the flag indicating whether to rebalance
+         *                        connected partitions by a minimum cost flow.
+         *
+         * @return a possible fixed solution.
+         */
+        static Solution fixSolution(Solution solution, unsigned int timeLimit,
+                bool flowRebalancing);
 
+        /*
+         * Try to fix the specified solution, allocating the repair state and
+         * the repair's temporaries from the specified memory resource. The
+         * solution is updated in place, so that moving it in copies nothing.
+         *
+         * @param solution        the solution to be fixed.
+         * @param timeLimit       the time limit.
+         * @param flowRebalancing the flag indicating whether to rebalance
+         *                        connected partitions by a minimum cost flow.
+         * @param memoryResource  the memory resource.
+         *
+         * @return a possible fixed solution.
+         */
+        static Solution fixSolution(Solution solution, unsigned int timeLimit,
+                bool flowRebalancing, std::pmr::memory_resource * memoryResource);
+};
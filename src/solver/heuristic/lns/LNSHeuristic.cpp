@@ -0,0 +1,221 @@
+#include "LNSHeuristic.hpp"
+#include <algorithm>
+#include <thread>
+
+/*
+ * Constructs a new large neighbourhood search heuristic.
+ *
+ * @param instance         the new heuristic's instance.
+ * @param seed             the seed for the new heuristic's pseudo-random
+ *                         numbers generator.
+ * @param districtsNumber  the number of adjacent districts freed together.
+ * @param restartsNumber   the number of constructive and local search restarts
+ *                         of each subproblem.
+ * @param exactEdgesNumber the maximum number of freed edges of a subproblem
+ *                         solved exhaustively.
+ * @param threadsNumber    the number of threads solving the subproblems.
+ */
+LNSHeuristic::LNSHeuristic(const Instance & instance, unsigned int seed,
+        unsigned int districtsNumber, unsigned int restartsNumber,
+        unsigned int exactEdgesNumber, unsigned int threadsNumber)
+    : Heuristic::Heuristic(instance, seed), districtsNumber(districtsNumber),
+      restartsNumber(restartsNumber), exactEdgesNumber(exactEdgesNumber),
+      threadsNumber(threadsNumber) {}
+
+/*
+ * Constructs a new large neighbourhood search heuristic, which frees three
+ * districts at a time in a single thread.
+ *
+ * @param instance the new heuristic's instance.
+ * @param seed     the seed for the new heuristic's pseudo-random numbers
+ *                 generator.
+ */
+LNSHeuristic::LNSHeuristic(const Instance & instance, unsigned int seed)
+    : LNSHeuristic::LNSHeuristic(instance, seed, 3, 10, 12, 1) {}
+
+/*
+ * Constructs a new empty large neighbourhood search heuristic.
+ */
+LNSHeuristic::LNSHeuristic() : Heuristic::Heuristic(), districtsNumber(0),
+    restartsNumber(0), exactEdgesNumber(0), threadsNumber(1) {}
+
+/*
+ * Returns the number of threads solving the subproblems.
+ *
+ * @return the number of threads solving the subproblems.
+ */
+unsigned int LNSHeuristic::getThreadsNumber() const {
+    return this->threadsNumber;
+}
+
+/*
+ * Partitions the specified solution's districts into random groups of
+ * adjacent districts.
+ *
+ * @param edgesDistrict the district of each edge.
+ *
+ * @return the groups with at least two districts.
+ */
+std::vector<std::vector<unsigned int> > LNSHeuristic::chooseGroups(
+        const std::vector<unsigned int> & edgesDistrict) {
+    unsigned int m = this->instance.getM();
+    std::vector<std::vector<bool> > isAdjacent (m, std::vector<bool> (m, false));
+    std::vector<unsigned int> districtsVector (m);
+    std::vector<bool> isGrouped (m, false);
+    std::vector<std::vector<unsigned int> > groups;
+
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(eId);
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            isAdjacent[edgesDistrict[eId - 1]][edgesDistrict[*fIdIt - 1]] = true;
+        }
+    }
+
+    for (unsigned int j = 0; j < m; j++) {
+        districtsVector[j] = j;
+    }
+
+    std::shuffle(districtsVector.begin(), districtsVector.end(), this->generator);
+
+    for (unsigned int j : districtsVector) {
+        if (isGrouped[j]) {
+            continue;
+        }
+
+        std::vector<unsigned int> group (1, j);
+
+        isGrouped[j] = true;
+
+        /* Each new district is adjacent to one of the group, so the freed edges are connected */
+        while (group.size() < this->districtsNumber) {
+            std::vector<unsigned int> candidates;
+
+            for (unsigned int k = 0; k < m; k++) {
+                if (!isGrouped[k]) {
+                    for (unsigned int l : group) {
+                        if (isAdjacent[l][k]) {
+                            candidates.push_back(k);
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if (candidates.empty()) {
+                break;
+            }
+
+            std::uniform_int_distribution<unsigned int> distribution (0,
+                    candidates.size() - 1);
+            unsigned int k = candidates[distribution(this->generator)];
+
+            group.push_back(k);
+            isGrouped[k] = true;
+        }
+
+        if (group.size() > 1) {
+            groups.push_back(group);
+        }
+    }
+
+    return groups;
+}
+
+/*
+ * Reoptimizes the specified subproblems from the specified one, skipping the
+ * ones handled by the other threads.
+ *
+ * @param regions     the subproblems.
+ * @param improved    the flag of each subproblem indicating whether it was
+ *                    improved.
+ * @param firstRegion the first subproblem.
+ * @param step        the number of threads.
+ * @param startTime   the start time.
+ * @param timeLimit   the time limit.
+ */
+void LNSHeuristic::reoptimizeRegions(std::vector<LNSRegion> & regions,
+        std::vector<unsigned int> & improved, unsigned int firstRegion,
+        unsigned int step, const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) const {
+    for (unsigned int r = firstRegion; r < regions.size() &&
+            Heuristic::getElapsedTime(startTime) < timeLimit; r += step) {
+        improved[r] = regions[r].reoptimize(this->restartsNumber,
+                this->exactEdgesNumber, startTime, timeLimit);
+    }
+}
+
+/*
+ * Improves the specified solution.
+ *
+ * @param solution  the solution to be improved.
+ * @param timeLimit the time limit.
+ *
+ * @return an improved solution.
+ */
+Solution LNSHeuristic::improveSolution(const Solution & solution, unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    if (solution.isEmpty() || !solution.isFeasible()) {
+        return solution;
+    }
+
+    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
+    unsigned int unsuccessfulRoundsCounter = 0;
+
+    /* Another grouping may still improve after a round without improvements, but two end the search */
+    while (unsuccessfulRoundsCounter < 2 &&
+            Heuristic::getElapsedTime(startTime) < timeLimit) {
+        std::vector<std::vector<unsigned int> > groups = this->chooseGroups(edgesDistrict);
+        std::vector<LNSRegion> regions;
+        std::vector<unsigned int> improved (groups.size(), 0);
+        unsigned int threadsNumber = std::min(this->threadsNumber,
+                (unsigned int) groups.size());
+
+        regions.reserve(groups.size());
+
+        for (const std::vector<unsigned int> & group : groups) {
+            regions.push_back(LNSRegion(this->instance, group, edgesDistrict,
+                        this->generator()));
+        }
+
+        if (threadsNumber > 1) {
+            std::vector<std::thread> threads;
+
+            for (unsigned int i = 0; i < threadsNumber; i++) {
+                threads.push_back(std::thread(&LNSHeuristic::reoptimizeRegions, this,
+                            std::ref(regions), std::ref(improved), i, threadsNumber,
+                            std::cref(startTime), timeLimit));
+            }
+
+            for (std::thread & thread : threads) {
+                thread.join();
+            }
+        } else {
+            this->reoptimizeRegions(regions, improved, 0, 1, startTime, timeLimit);
+        }
+
+        bool isImproved = false;
+
+        for (unsigned int r = 0; r < regions.size(); r++) {
+            if (improved[r]) {
+                regions[r].apply(edgesDistrict);
+                isImproved = true;
+            }
+        }
+
+        if (isImproved) {
+            unsuccessfulRoundsCounter = 0;
+        } else {
+            unsuccessfulRoundsCounter++;
+        }
+    }
+
+    Solution improvedSolution (this->instance, edgesDistrict);
+
+    if (!improvedSolution.isFeasible() || improvedSolution.getValue() < solution.getValue()) {
+        return solution;
+    }
+
+    return improvedSolution;
+}
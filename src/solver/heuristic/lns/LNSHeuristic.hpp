@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../Heuristic.hpp"
+#include "../../../solution/Solution.hpp"
+#include "LNSRegion.hpp"
+
+/*
+ * The LNSHeuristic class represents a large neighbourhood search heuristic for
+ * the CEDP, which repeatedly frees the edges of groups of adjacent districts
+ * and reallocates them among the same districts, keeping the rest of the
+ * solution fixed. The groups of a round are disjoint, so their subproblems
+ * are independent and solved in parallel.
+ */
+class LNSHeuristic : public Heuristic {
+    private:
+        /* The number of adjacent districts freed together. */
+        unsigned int districtsNumber;
+
+        /* The number of constructive and local search restarts of each subproblem. */
+        unsigned int restartsNumber;
+
+        /* The maximum number of freed edges of a subproblem solved exhaustively. */
+        unsigned int exactEdgesNumber;
+
+        /* The number of threads solving the subproblems. */
+        unsigned int threadsNumber;
+
+        /*
+         * Partitions the specified solution's districts into random groups of
+         * adjacent districts.
+         *
+         * @param edgesDistrict the district of each edge.
+         *
+         * @return the groups with at least two districts.
+         */
+        std::vector<std::vector<unsigned int> > chooseGroups(
+                const std::vector<unsigned int> & edgesDistrict);
+
+        /*
+         * Reoptimizes the specified subproblems from the specified one,
+         * skipping the ones handled by the other threads.
+         *
+         * @param regions     the subproblems.
+         * @param improved    the flag of each subproblem indicating whether it
+         *                    was improved.
+         * @param firstRegion the first subproblem.
+         * @param step        the number of threads.
+         * @param startTime   the start time.
+         * @param timeLimit   the time limit.
+         */
+        void reoptimizeRegions(std::vector<LNSRegion> & regions,
+                std::vector<unsigned int> & improved, unsigned int firstRegion,
+                unsigned int step, const std::chrono::steady_clock::time_point & startTime,
+                unsigned int timeLimit) const;
+
+    public:
+        /*
+         * Constructs a new large neighbourhood search heuristic.
+         *
+         * @param instance         the new heuristic's instance.
+         * @param seed             the seed for the new heuristic's
+         *                         pseudo-random numbers generator.
+         * @param districtsNumber  the number of adjacent districts freed
+         *                         together.
+         * @param restartsNumber   the number of constructive and local search
+         *                         restarts of each subproblem.
+         * @param exactEdgesNumber the maximum number of freed edges of a
+         *                         subproblem solved exhaustively.
+         * @param threadsNumber    the number of threads solving the
+         *                         subproblems.
+         */
+        LNSHeuristic(const Instance & instance, unsigned int seed,
+                unsigned int districtsNumber, unsigned int restartsNumber,
+                unsigned int exactEdgesNumber, unsigned int threadsNumber);
+
+        /*
+         * Constructs a new large neighbourhood search heuristic, which frees
+         * three districts at a time in a single thread.
+         *
+         * @param instance the new heuristic's instance.
+         * @param seed     the seed for the new heuristic's pseudo-random
+         *                 numbers generator.
+         */
+        LNSHeuristic(const Instance & instance, unsigned int seed);
+
+        /*
+         * Constructs a new empty large neighbourhood search heuristic.
+         */
+        LNSHeuristic();
+
+        /*
+         * Returns the number of threads solving the subproblems.
+         *
+         * @return the number of threads solving the subproblems.
+         */
+        unsigned int getThreadsNumber() const;
+
+        /*
+         * Improves the specified solution.
+         *
+         * @param solution  the solution to be improved.
+         * @param timeLimit the time limit.
+         *
+         * @return an improved solution.
+         */
+        Solution improveSolution(const Solution & solution, unsigned int timeLimit);
+};
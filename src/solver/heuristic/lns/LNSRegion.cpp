@@ -0,0 +1,467 @@
+#include "LNSRegion.hpp"
+#include "../Heuristic.hpp"
+#include <algorithm>
+#include <queue>
+
+/*
+ * Constructs a new subproblem.
+ *
+ * @param instance      the instance.
+ * @param districts     the group's districts.
+ * @param edgesDistrict the district of each edge in the current solution.
+ * @param seed          the seed for the subproblem's pseudo-random numbers
+ *                      generator.
+ */
+LNSRegion::LNSRegion(const Instance & instance, const std::vector<unsigned int> & districts,
+        const std::vector<unsigned int> & edgesDistrict, unsigned int seed)
+    : minimumDemand(instance.getMinimumDemand()),
+      maximumDemand(instance.getMaximumDemand()), districts(districts),
+      bestValue(0.0), generator(seed), nodesCounter(0), isTimedOut(false) {
+    std::vector<unsigned int> groupDistrict (instance.getM(), districts.size());
+    std::vector<unsigned int> edgesIndex (edgesDistrict.size(), edgesDistrict.size());
+
+    for (unsigned int j = 0; j < districts.size(); j++) {
+        groupDistrict[districts[j]] = j;
+    }
+
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        unsigned int j = edgesDistrict[eId - 1];
+
+        if (j < instance.getM() && groupDistrict[j] < districts.size()) {
+            edgesIndex[eId - 1] = this->edgesIds.size();
+            this->edgesIds.push_back(eId);
+            this->edgesDemand.push_back(2.0 * instance.getEdge(eId).w);
+            this->bestEdgesDistrict.push_back(groupDistrict[j]);
+            this->bestValue += instance.getC(eId, j);
+            this->c.push_back(std::vector<double> (districts.size()));
+
+            for (unsigned int k = 0; k < districts.size(); k++) {
+                this->c.back()[k] = instance.getC(eId, districts[k]);
+            }
+        }
+    }
+
+    this->adjacentEdges.resize(this->edgesIds.size());
+
+    for (unsigned int e = 0; e < this->edgesIds.size(); e++) {
+        for (std::vector<unsigned int>::const_iterator fIdIt =
+                instance.getAdjacentEdgesIdsBegin(this->edgesIds[e]);
+                fIdIt != instance.getAdjacentEdgesIdsEnd(this->edgesIds[e]); fIdIt++) {
+            if (edgesIndex[*fIdIt - 1] < edgesDistrict.size()) {
+                this->adjacentEdges[e].push_back(edgesIndex[*fIdIt - 1]);
+            }
+        }
+    }
+}
+
+/*
+ * Returns the number of freed edges.
+ *
+ * @return the number of freed edges.
+ */
+unsigned int LNSRegion::size() const {
+    return this->edgesIds.size();
+}
+
+/*
+ * Returns the value of the best allocation of the freed edges.
+ *
+ * @return the value of the best allocation of the freed edges.
+ */
+double LNSRegion::getValue() const {
+    return this->bestValue;
+}
+
+/*
+ * Verifies whether the specified district of the group is connected.
+ *
+ * @param edgesDistrict the group's district of each freed edge.
+ * @param j             the group's district.
+ *
+ * @return true if the district is nonempty and connected; false otherwise.
+ */
+bool LNSRegion::isConnected(const std::vector<unsigned int> & edgesDistrict,
+        unsigned int j) const {
+    std::vector<bool> visited (edgesDistrict.size(), false);
+    std::queue<unsigned int> Q;
+    unsigned int districtSize = 0;
+    unsigned int visitedCounter = 0;
+
+    for (unsigned int e = 0; e < edgesDistrict.size(); e++) {
+        if (edgesDistrict[e] == j) {
+            if (districtSize == 0) {
+                visited[e] = true;
+                visitedCounter++;
+                Q.push(e);
+            }
+
+            districtSize++;
+        }
+    }
+
+    while (!Q.empty()) {
+        unsigned int e = Q.front();
+        Q.pop();
+
+        for (unsigned int f : this->adjacentEdges[e]) {
+            if (!visited[f] && edgesDistrict[f] == j) {
+                visited[f] = true;
+                visitedCounter++;
+                Q.push(f);
+            }
+        }
+    }
+
+    return districtSize > 0 && visitedCounter == districtSize;
+}
+
+/*
+ * Verifies whether the specified allocation of the freed edges is feasible.
+ *
+ * @param edgesDistrict   the group's district of each freed edge.
+ * @param districtsDemand the demand of each of the group's districts.
+ *
+ * @return true if the allocation is feasible; false otherwise.
+ */
+bool LNSRegion::isFeasible(const std::vector<unsigned int> & edgesDistrict,
+        const std::vector<double> & districtsDemand) const {
+    for (unsigned int j = 0; j < this->districts.size(); j++) {
+        if (districtsDemand[j] < this->minimumDemand ||
+                districtsDemand[j] > this->maximumDemand ||
+                !this->isConnected(edgesDistrict, j)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Grows the group's districts from random edges, choosing the edge to be
+ * allocated from a restricted candidate list.
+ *
+ * @param edgesDistrict   the constructed allocation.
+ * @param districtsDemand the demand of each of the group's districts.
+ * @param alpha           the threshold parameter for the restricted candidate
+ *                        list.
+ *
+ * @return true if every freed edge was allocated; false otherwise.
+ */
+bool LNSRegion::constructAllocation(std::vector<unsigned int> & edgesDistrict,
+        std::vector<double> & districtsDemand, double alpha) {
+    unsigned int n = this->edgesIds.size();
+    unsigned int m = this->districts.size();
+    std::vector<unsigned int> seeds (n);
+    unsigned int allocatedEdgesCounter = 0;
+
+    if (n < m) {
+        return false;
+    }
+
+    edgesDistrict.assign(n, m);
+    districtsDemand.assign(m, 0.0);
+
+    for (unsigned int e = 0; e < n; e++) {
+        seeds[e] = e;
+    }
+
+    std::shuffle(seeds.begin(), seeds.end(), this->generator);
+
+    for (unsigned int j = 0; j < m; j++) {
+        edgesDistrict[seeds[j]] = j;
+        districtsDemand[j] += this->edgesDemand[seeds[j]];
+        allocatedEdgesCounter++;
+    }
+
+    while (allocatedEdgesCounter < n) {
+        std::vector<std::pair<unsigned int, unsigned int> > candidateList;
+        bool isUnderMinimum = false;
+
+        /* Districts below the minimum demand grow first, as in the greedy constructive heuristic */
+        for (unsigned int j = 0; j < m && !isUnderMinimum; j++) {
+            isUnderMinimum = districtsDemand[j] < this->minimumDemand;
+        }
+
+        for (unsigned int e = 0; e < n; e++) {
+            if (edgesDistrict[e] < m) {
+                continue;
+            }
+
+            for (unsigned int f : this->adjacentEdges[e]) {
+                unsigned int j = edgesDistrict[f];
+
+                if (j < m && (!isUnderMinimum || districtsDemand[j] < this->minimumDemand) &&
+                        districtsDemand[j] + this->edgesDemand[e] <= this->maximumDemand) {
+                    candidateList.push_back(std::make_pair(e, j));
+                }
+            }
+        }
+
+        if (candidateList.empty() && isUnderMinimum) {
+            for (unsigned int e = 0; e < n; e++) {
+                if (edgesDistrict[e] < m) {
+                    continue;
+                }
+
+                for (unsigned int f : this->adjacentEdges[e]) {
+                    unsigned int j = edgesDistrict[f];
+
+                    if (j < m && districtsDemand[j] + this->edgesDemand[e] <=
+                            this->maximumDemand) {
+                        candidateList.push_back(std::make_pair(e, j));
+                    }
+                }
+            }
+        }
+
+        if (candidateList.empty()) {
+            return false;
+        }
+
+        double minC = this->c[candidateList.front().first][candidateList.front().second];
+        double maxC = minC;
+
+        for (const std::pair<unsigned int, unsigned int> & candidate : candidateList) {
+            minC = std::min(minC, this->c[candidate.first][candidate.second]);
+            maxC = std::max(maxC, this->c[candidate.first][candidate.second]);
+        }
+
+        double threshold = maxC - alpha * (maxC - minC);
+        std::vector<std::pair<unsigned int, unsigned int> > restrictedCandidateList;
+
+        for (const std::pair<unsigned int, unsigned int> & candidate : candidateList) {
+            if (this->c[candidate.first][candidate.second] >= threshold) {
+                restrictedCandidateList.push_back(candidate);
+            }
+        }
+
+        std::uniform_int_distribution<unsigned int> distribution (0,
+                restrictedCandidateList.size() - 1);
+        std::pair<unsigned int, unsigned int> chosenCandidate =
+            restrictedCandidateList[distribution(this->generator)];
+
+        edgesDistrict[chosenCandidate.first] = chosenCandidate.second;
+        districtsDemand[chosenCandidate.second] += this->edgesDemand[chosenCandidate.first];
+        allocatedEdgesCounter++;
+    }
+
+    return this->isFeasible(edgesDistrict, districtsDemand);
+}
+
+/*
+ * Moves single edges between the group's districts while the value improves
+ * and the allocation stays feasible.
+ *
+ * @param edgesDistrict   the allocation to be improved.
+ * @param districtsDemand the demand of each of the group's districts.
+ * @param value           the allocation's value.
+ */
+void LNSRegion::improveAllocation(std::vector<unsigned int> & edgesDistrict,
+        std::vector<double> & districtsDemand, double & value) {
+    std::vector<unsigned int> edges (edgesDistrict.size());
+    bool improved = true;
+
+    for (unsigned int e = 0; e < edges.size(); e++) {
+        edges[e] = e;
+    }
+
+    while (improved) {
+        improved = false;
+
+        std::shuffle(edges.begin(), edges.end(), this->generator);
+
+        for (unsigned int e : edges) {
+            unsigned int j = edgesDistrict[e];
+
+            if (districtsDemand[j] - this->edgesDemand[e] < this->minimumDemand) {
+                continue;
+            }
+
+            for (unsigned int f : this->adjacentEdges[e]) {
+                unsigned int k = edgesDistrict[f];
+
+                if (k == j || this->c[e][k] <= this->c[e][j] ||
+                        districtsDemand[k] + this->edgesDemand[e] > this->maximumDemand) {
+                    continue;
+                }
+
+                edgesDistrict[e] = k;
+
+                /* G[E_{j} \ {e}] is connected */
+                if (!this->isConnected(edgesDistrict, j)) {
+                    edgesDistrict[e] = j;
+                    continue;
+                }
+
+                districtsDemand[j] -= this->edgesDemand[e];
+                districtsDemand[k] += this->edgesDemand[e];
+                value += this->c[e][k] - this->c[e][j];
+                improved = true;
+
+                break;
+            }
+        }
+    }
+}
+
+/*
+ * Enumerates the allocations of the freed edges from the specified position in
+ * the order, pruning by demand and by profit bounds.
+ *
+ * @param position        the position in the order.
+ * @param edgesDistrict   the partial allocation.
+ * @param districtsDemand the demand of each of the group's districts.
+ * @param value           the partial allocation's value.
+ * @param startTime       the start time.
+ * @param timeLimit       the time limit.
+ */
+void LNSRegion::searchAllocations(unsigned int position,
+        std::vector<unsigned int> & edgesDistrict,
+        std::vector<double> & districtsDemand, double value,
+        const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) {
+    unsigned int m = this->districts.size();
+
+    if (this->isTimedOut || value + this->suffixProfit[position] <= this->bestValue) {
+        return;
+    }
+
+    if (++this->nodesCounter % 4096 == 0 &&
+            Heuristic::getElapsedTime(startTime) >= timeLimit) {
+        this->isTimedOut = true;
+        return;
+    }
+
+    if (position == this->order.size()) {
+        if (this->isFeasible(edgesDistrict, districtsDemand)) {
+            this->bestValue = value;
+            this->bestEdgesDistrict = edgesDistrict;
+        }
+
+        return;
+    }
+
+    double missingDemand = 0.0;
+
+    for (unsigned int j = 0; j < m; j++) {
+        missingDemand += std::max(0.0, this->minimumDemand - districtsDemand[j]);
+    }
+
+    /* The remaining edges cannot bring every district to the minimum demand */
+    if (missingDemand > this->suffixDemand[position]) {
+        return;
+    }
+
+    unsigned int e = this->order[position];
+
+    for (unsigned int j = 0; j < m; j++) {
+        if (districtsDemand[j] + this->edgesDemand[e] <= this->maximumDemand) {
+            edgesDistrict[e] = j;
+            districtsDemand[j] += this->edgesDemand[e];
+            this->searchAllocations(position + 1, edgesDistrict, districtsDemand,
+                    value + this->c[e][j], startTime, timeLimit);
+            districtsDemand[j] -= this->edgesDemand[e];
+            edgesDistrict[e] = m;
+        }
+    }
+}
+
+/*
+ * Reallocates the freed edges, exhaustively when there are few of them and by
+ * constructive and local search restarts otherwise.
+ *
+ * @param restartsNumber   the number of restarts.
+ * @param exactEdgesNumber the maximum number of freed edges for the
+ *                         exhaustive search.
+ * @param startTime        the start time.
+ * @param timeLimit        the time limit.
+ *
+ * @return true if a better allocation was found; false otherwise.
+ */
+bool LNSRegion::reoptimize(unsigned int restartsNumber, unsigned int exactEdgesNumber,
+        const std::chrono::steady_clock::time_point & startTime,
+        unsigned int timeLimit) {
+    unsigned int n = this->edgesIds.size();
+    unsigned int m = this->districts.size();
+    double initialValue = this->bestValue;
+    std::vector<unsigned int> edgesDistrict;
+    std::vector<double> districtsDemand;
+
+    if (n <= exactEdgesNumber) {
+        /* A breadth-first order allocates the edges next to the allocated ones first */
+        std::vector<bool> visited (n, false);
+
+        this->order.clear();
+
+        for (unsigned int e = 0; e < n; e++) {
+            if (!visited[e]) {
+                visited[e] = true;
+                this->order.push_back(e);
+
+                for (unsigned int i = this->order.size() - 1; i < this->order.size(); i++) {
+                    for (unsigned int f : this->adjacentEdges[this->order[i]]) {
+                        if (!visited[f]) {
+                            visited[f] = true;
+                            this->order.push_back(f);
+                        }
+                    }
+                }
+            }
+        }
+
+        this->suffixProfit.assign(n + 1, 0.0);
+        this->suffixDemand.assign(n + 1, 0.0);
+
+        for (unsigned int i = n; i > 0; i--) {
+            unsigned int e = this->order[i - 1];
+
+            this->suffixProfit[i - 1] = this->suffixProfit[i] +
+                *std::max_element(this->c[e].begin(), this->c[e].end());
+            this->suffixDemand[i - 1] = this->suffixDemand[i] + this->edgesDemand[e];
+        }
+
+        edgesDistrict.assign(n, m);
+        districtsDemand.assign(m, 0.0);
+        this->nodesCounter = 0;
+        this->isTimedOut = false;
+
+        this->searchAllocations(0, edgesDistrict, districtsDemand, 0.0, startTime,
+                timeLimit);
+    } else {
+        std::uniform_real_distribution<double> distribution (0.0, 0.5);
+
+        for (unsigned int i = 0; i < restartsNumber &&
+                Heuristic::getElapsedTime(startTime) < timeLimit; i++) {
+            if (!this->constructAllocation(edgesDistrict, districtsDemand,
+                        distribution(this->generator))) {
+                continue;
+            }
+
+            double value = 0.0;
+
+            for (unsigned int e = 0; e < n; e++) {
+                value += this->c[e][edgesDistrict[e]];
+            }
+
+            this->improveAllocation(edgesDistrict, districtsDemand, value);
+
+            if (value > this->bestValue) {
+                this->bestValue = value;
+                this->bestEdgesDistrict = edgesDistrict;
+            }
+        }
+    }
+
+    return this->bestValue > initialValue;
+}
+
+/*
+ * Writes the best allocation of the freed edges into the specified allocation.
+ *
+ * @param edgesDistrict the district of each edge.
+ */
+void LNSRegion::apply(std::vector<unsigned int> & edgesDistrict) const {
+    for (unsigned int e = 0; e < this->edgesIds.size(); e++) {
+        edgesDistrict[this->edgesIds[e] - 1] = this->districts[this->bestEdgesDistrict[e]];
+    }
+}
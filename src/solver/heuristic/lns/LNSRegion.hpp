@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../../../instance/Instance.hpp"
+#include <chrono>
+
+/*
+ * The LNSRegion class represents the subproblem of the large neighbourhood
+ * search in which the edges of a group of adjacent districts are freed and
+ * reallocated among them, while the other districts stay fixed. Since the
+ * group's districts only contain freed edges, the subproblem is independent
+ * of the rest of the solution and of the other groups' subproblems.
+ */
+class LNSRegion {
+    private:
+        /* The minimum allowed demand for each district. */
+        double minimumDemand;
+
+        /* The maximum allowed demand for each district. */
+        double maximumDemand;
+
+        /* The group's districts. */
+        std::vector<unsigned int> districts;
+
+        /* The id of each freed edge. */
+        std::vector<unsigned int> edgesIds;
+
+        /* The demand of each freed edge. */
+        std::vector<double> edgesDemand;
+
+        /* The profit of allocating each freed edge in each of the group's districts. */
+        std::vector<std::vector<double> > c;
+
+        /* The freed edges adjacent to each freed edge. */
+        std::vector<std::vector<unsigned int> > adjacentEdges;
+
+        /* The group's district of each freed edge in the best allocation. */
+        std::vector<unsigned int> bestEdgesDistrict;
+
+        /* The value of the best allocation. */
+        double bestValue;
+
+        /* The pseudo-random numbers generator of this subproblem. */
+        std::mt19937 generator;
+
+        /* The freed edges in the order of the exact search. */
+        std::vector<unsigned int> order;
+
+        /* The maximum profit of the freed edges from each position in the order. */
+        std::vector<double> suffixProfit;
+
+        /* The demand of the freed edges from each position in the order. */
+        std::vector<double> suffixDemand;
+
+        /* The number of nodes visited by the exact search. */
+        unsigned long long nodesCounter;
+
+        /* The flag indicating whether the exact search ran out of time. */
+        bool isTimedOut;
+
+        /*
+         * Verifies whether the specified district of the group is connected.
+         *
+         * @param edgesDistrict the group's district of each freed edge.
+         * @param j             the group's district.
+         *
+         * @return true if the district is nonempty and connected; false
+         *         otherwise.
+         */
+        bool isConnected(const std::vector<unsigned int> & edgesDistrict,
+                unsigned int j) const;
+
+        /*
+         * Verifies whether the specified allocation of the freed edges is
+         * feasible.
+         *
+         * @param edgesDistrict   the group's district of each freed edge.
+         * @param districtsDemand the demand of each of the group's districts.
+         *
+         * @return true if the allocation is feasible; false otherwise.
+         */
+        bool isFeasible(const std::vector<unsigned int> & edgesDistrict,
+                const std::vector<double> & districtsDemand) const;
+
+        /*
+         * Grows the group's districts from random edges, choosing the edge to
+         * be allocated from a restricted candidate list.
+         *
+         * @param edgesDistrict   the constructed allocation.
+         * @param districtsDemand the demand of each of the group's districts.
+         * @param alpha           the threshold parameter for the restricted
+         *                        candidate list.
+         *
+         * @return true if every freed edge was allocated; false otherwise.
+         */
+        bool constructAllocation(std::vector<unsigned int> & edgesDistrict,
+                std::vector<double> & districtsDemand, double alpha);
+
+        /*
+         * Moves single edges between the group's districts while the value
+         * improves and the allocation stays feasible.
+         *
+         * @param edgesDistrict   the allocation to be improved.
+         * @param districtsDemand the demand of each of the group's districts.
+         * @param value           the allocation's value.
+         */
+        void improveAllocation(std::vector<unsigned int> & edgesDistrict,
+                std::vector<double> & districtsDemand, double & value);
+
+        /*
+         * Enumerates the allocations of the freed edges from the specified
+         * position in the order, pruning by demand and by profit bounds.
+         *
+         * @param position        the position in the order.
+         * @param edgesDistrict   the partial allocation.
+         * @param districtsDemand the demand of each of the group's districts.
+         * @param value           the partial allocation's value.
+         * @param startTime       the start time.
+         * @param timeLimit       the time limit.
+         */
+        void searchAllocations(unsigned int position,
+                std::vector<unsigned int> & edgesDistrict,
+                std::vector<double> & districtsDemand, double value,
+                const std::chrono::steady_clock::time_point & startTime,
+                unsigned int timeLimit);
+
+    public:
+        /*
+         * Constructs a new subproblem.
+         *
+         * @param instance      the instance.
+         * @param districts     the group's districts.
+         * @param edgesDistrict the district of each edge in the current
+         *                      solution.
+         * @param seed          the seed for the subproblem's pseudo-random
+         *                      numbers generator.
+         */
+        LNSRegion(const Instance & instance, const std::vector<unsigned int> & districts,
+                const std::vector<unsigned int> & edgesDistrict, unsigned int seed);
+
+        /*
+         * Returns the number of freed edges.
+         *
+         * @return the number of freed edges.
+         */
+        unsigned int size() const;
+
+        /*
+         * Returns the value of the best allocation of the freed edges.
+         *
+         * @return the value of the best allocation of the freed edges.
+         */
+        double getValue() const;
+
+        /*
+         * Reallocates the freed edges, exhaustively when there are few of them
+         * and by constructive and local search restarts otherwise.
+         *
+         * @param restartsNumber   the number of restarts.
+         * @param exactEdgesNumber the maximum number of freed edges for the
+         *                         exhaustive search.
+         * @param startTime        the start time.
+         * @param timeLimit        the time limit.
+         *
+         * @return true if a better allocation was found; false otherwise.
+         */
+        bool reoptimize(unsigned int restartsNumber, unsigned int exactEdgesNumber,
+                const std::chrono::steady_clock::time_point & startTime,
+                unsigned int timeLimit);
+
+        /*
+         * Writes the best allocation of the freed edges into the specified
+         * allocation.
+         *
+         * @param edgesDistrict the district of each edge.
+         */
+        void apply(std::vector<unsigned int> & edgesDistrict) const;
+};
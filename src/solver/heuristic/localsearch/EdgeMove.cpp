@@ -0,0 +1,23 @@
+#include "EdgeMove.hpp"
+
+/*
+ * Constructs a new move.
+ *
+ * @param gain  the profit added by the move.
+ * @param eId   the id of the moved edge.
+ * @param k     the district to which the edge is moved.
+ * @param stamp the stamp of the edge's moves.
+ */
+EdgeMove::EdgeMove(double gain, unsigned int eId, unsigned int k, unsigned int stamp)
+    : gain(gain), eId(eId), k(k), stamp(stamp) {}
+
+/*
+ * Verifies whether this move adds less profit than the specified one.
+ *
+ * @param move the other move.
+ *
+ * @return true if this move adds less profit; false otherwise.
+ */
+bool EdgeMove::operator < (const EdgeMove & move) const {
+    return this->gain < move.gain;
+}
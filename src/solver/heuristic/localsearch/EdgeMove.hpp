@@ -0,0 +1,39 @@
+#pragma once
+
+/*
+ * The EdgeMove class represents the move of an edge to another district in
+ * the local search, ordered by the profit it adds.
+ */
+class EdgeMove {
+    public:
+        /* The profit added by the move. */
+        double gain;
+
+        /* The id of the moved edge. */
+        unsigned int eId;
+
+        /* The district to which the edge is moved. */
+        unsigned int k;
+
+        /* The stamp of the edge's moves when this move was found. */
+        unsigned int stamp;
+
+        /*
+         * Constructs a new move.
+         *
+         * @param gain  the profit added by the move.
+         * @param eId   the id of the moved edge.
+         * @param k     the district to which the edge is moved.
+         * @param stamp the stamp of the edge's moves.
+         */
+        EdgeMove(double gain, unsigned int eId, unsigned int k, unsigned int stamp);
+
+        /*
+         * Verifies whether this move adds less profit than the specified one.
+         *
+         * @param move the other move.
+         *
+         * @return true if this move adds less profit; false otherwise.
+         */
+        bool operator < (const EdgeMove & move) const;
+};
@@ -1,5 +1,18 @@
 #include "LocalSearchHeuristic.hpp"
-#include <dlib/optimization/max_cost_assignment.h>
+#include <algorithm>
+#include <thread>
+
+/* First improvement constant: the first improving move found in random order. */
+const unsigned int LocalSearchHeuristic::FIRST_IMPROVEMENT = 0;
+
+/* Best improvement constant: the most profitable feasible move. */
+const unsigned int LocalSearchHeuristic::BEST_IMPROVEMENT = 1;
+
+/* Candidate list constant: a random move among the most profitable feasible ones. */
+const unsigned int LocalSearchHeuristic::CANDIDATE_LIST = 2;
+
+/* The default number of edges of a colour class that each thread examines at least. */
+const unsigned int LocalSearchHeuristic::THREAD_EDGES_NUMBER = 32;
 
 /*
  * Constructs a new local search heuristic.
@@ -9,309 +22,1210 @@
  *                 numbers generator.
  */
 LocalSearchHeuristic::LocalSearchHeuristic(const Instance & instance, 
-        unsigned int seed) : Heuristic::Heuristic(instance, seed) {}
+        unsigned int seed) : Heuristic::Heuristic(instance, seed), 
+    hungarianAlgorithm(instance.getM()), vnd(false), strategy(FIRST_IMPROVEMENT), 
+    candidatesNumber(1), threadsNumber(1), threadEdgesNumber(THREAD_EDGES_NUMBER), 
+    parallelClassesCounter(0), visitedStamp(0) {}
 
 /*
  * Constructs a new empty local search heuristic.
  */
-LocalSearchHeuristic::LocalSearchHeuristic() : Heuristic::Heuristic() {}
+LocalSearchHeuristic::LocalSearchHeuristic() : Heuristic::Heuristic(), vnd(false), 
+    strategy(FIRST_IMPROVEMENT), candidatesNumber(1), threadsNumber(1), 
+    threadEdgesNumber(THREAD_EDGES_NUMBER), parallelClassesCounter(0), visitedStamp(0) {}
 
 /*
- * Improves the specified solution.
+ * Sets the flag indicating whether to descend through the swap, chain and
+ * shift neighbourhoods once no single edge move improves the solution.
  *
- * @param solution the solution to be improved.
- * @param timeLimit the time limit.
+ * @param vnd the new flag.
+ */
+void LocalSearchHeuristic::setVND(bool vnd) {
+    this->vnd = vnd;
+}
+
+/*
+ * Returns the flag indicating whether to descend through the swap, chain and
+ * shift neighbourhoods.
  *
- * @return an improved solution.
+ * @return true if the variable neighbourhood descent is enabled; false
+ *         otherwise.
  */
-Solution LocalSearchHeuristic::improveSolution(Solution solution, unsigned int timeLimit) {
-    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
-    Solution improvedSolution(solution);
-    std::vector<std::set<Edge> > improvedDistricts = improvedSolution.getDistricts();
+bool LocalSearchHeuristic::getVND() const {
+    return this->vnd;
+}
+
+/*
+ * Sets the strategy for choosing each single edge move.
+ *
+ * @param strategy         the strategy (FIRST_IMPROVEMENT, BEST_IMPROVEMENT or
+ *                         CANDIDATE_LIST).
+ * @param candidatesNumber the number of most profitable feasible moves among
+ *                         which the candidate list strategy chooses.
+ */
+void LocalSearchHeuristic::setStrategy(unsigned int strategy, unsigned int candidatesNumber) {
+    this->strategy = strategy;
+    this->candidatesNumber = candidatesNumber;
+}
+
+/*
+ * Returns the strategy for choosing each single edge move.
+ *
+ * @return the strategy for choosing each single edge move.
+ */
+unsigned int LocalSearchHeuristic::getStrategy() const {
+    return this->strategy;
+}
+
+/*
+ * Returns the number of most profitable feasible moves among which the
+ * candidate list strategy chooses.
+ *
+ * @return the number of most profitable feasible moves among which the
+ *         candidate list strategy chooses.
+ */
+unsigned int LocalSearchHeuristic::getCandidatesNumber() const {
+    return this->candidatesNumber;
+}
+
+/*
+ * Sets the number of threads evaluating the moves of non-adjacent districts
+ * concurrently.
+ *
+ * @param threadsNumber the new number of threads; one keeps the sequential
+ *                      strategies.
+ */
+void LocalSearchHeuristic::setThreadsNumber(unsigned int threadsNumber) {
+    this->threadsNumber = std::max(threadsNumber, 1u);
+}
+
+/*
+ * Returns the number of threads evaluating the moves of non-adjacent districts
+ * concurrently.
+ *
+ * @return the number of threads evaluating the moves of non-adjacent districts
+ *         concurrently.
+ */
+unsigned int LocalSearchHeuristic::getThreadsNumber() const {
+    return this->threadsNumber;
+}
+
+/*
+ * Sets the number of edges of a colour class that each thread examines at
+ * least, below which starting the threads does not pay off.
+ *
+ * @param threadEdgesNumber the new number of edges per thread.
+ */
+void LocalSearchHeuristic::setThreadEdgesNumber(unsigned int threadEdgesNumber) {
+    this->threadEdgesNumber = std::max(threadEdgesNumber, 1u);
+}
+
+/*
+ * Returns the number of edges of a colour class that each thread examines at
+ * least.
+ *
+ * @return the number of edges per thread.
+ */
+unsigned int LocalSearchHeuristic::getThreadEdgesNumber() const {
+    return this->threadEdgesNumber;
+}
+
+/*
+ * Returns the number of colour classes whose moves were chosen by more than
+ * one thread.
+ *
+ * @return the number of colour classes examined in parallel.
+ */
+unsigned int LocalSearchHeuristic::getParallelClassesCounter() const {
+    return this->parallelClassesCounter;
+}
+
+/*
+ * Relabels the specified districts in order to maximize the total profit,
+ * keeping them unchanged when the current labels are already optimal.
+ *
+ * @param edgesDistrict the district of each edge.
+ *
+ * @return true if the districts were relabeled; false otherwise.
+ */
+bool LocalSearchHeuristic::relabelDistricts(std::vector<unsigned int> & edgesDistrict) {
+    unsigned int m = this->instance.getM();
+    double identityCost = 0.0, assignmentCost = 0.0;
+
+    this->hungarianAlgorithm.reset(m);
+
+    /* ∀ e ∈ E, with e ∈ E_{i}: ∀ j ∈ {1, ..., m}: cost_{i, j} += c_{e, j} */
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        unsigned int i = edgesDistrict[eId - 1];
+
+        if (i < m) {
+            double * row = this->hungarianAlgorithm.getRow(i);
+
+            for (unsigned int j = 0; j < m; j++) {
+                row[j] += this->instance.getC(eId, j);
+            }
+        }
+    }
+
+    /* ℰ ← Max-Cost-Assignment(ℰ) */
+    const std::vector<unsigned int> & districtsIds = 
+        this->hungarianAlgorithm.maxCostAssignment();
+
+    if (this->hungarianAlgorithm.isIdentity()) {
+        return false;
+    }
+
+    for (unsigned int i = 0; i < m; i++) {
+        identityCost += this->hungarianAlgorithm.getCost(i, i);
+        assignmentCost += this->hungarianAlgorithm.getCost(i, districtsIds[i]);
+    }
+
+    if (assignmentCost <= identityCost) {
+        return false;
+    }
+
+    for (unsigned int & j : edgesDistrict) {
+        if (j < m) {
+            j = districtsIds[j];
+        }
+    }
+
+    return true;
+}
+
+/*
+ * Moves frontier edges to adjacent districts in which they are more
+ * profitable while the districts stay connected and balanced. The edges to be
+ * examined are kept in a work-list: an edge leaves it once no move of it
+ * improves, and only returns when an adjacent edge moves or when the demand
+ * that blocked its move changes, so that unchanged districts are not scanned
+ * again.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ * @param startTime       the start time.
+ * @param timeLimit       the time limit.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::moveEdges(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand, const std::chrono::steady_clock::time_point & startTime, unsigned int timeLimit) {
+    unsigned int m = this->instance.getM();
     double minimumDemand = this->instance.getMinimumDemand();
     double maximumDemand = this->instance.getMaximumDemand();
-    dlib::matrix<int> cost(this->instance.getM(), this->instance.getM());
-    std::vector<long int> districtsIds;
-    std::vector<unsigned int> edgesDistrict;
-    std::vector<std::set<Edge> > edgesAdjacentEdges (this->instance.getG().m());
-    std::vector<std::set<Edge> > edgesAdjacentEdgesNotInDistrict (this->instance.getG().m());
-    std::vector<unsigned int> districtsVector (this->instance.getM(), this->instance.getM());
-    std::vector<double> districtsDemand;
-    std::vector<std::set<Edge> > districtsFrontierEdges (this->instance.getM());
-    std::vector<std::set<Edge> > districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs 
-        (this->instance.getM());
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    std::pmr::vector<unsigned int> workList (edgesDistrict.size(), this->memoryResource);
+    std::pmr::vector<bool> dontLookBits (edgesDistrict.size(), false, this->memoryResource);
+    std::pmr::vector<std::pmr::vector<unsigned int> > edgesBlockedByMinimumDemand (m, 
+            this->memoryResource);
+    std::pmr::vector<std::pmr::vector<unsigned int> > edgesBlockedByMaximumDemand (m, 
+            this->memoryResource);
+    std::pmr::vector<unsigned int> districtsVector (this->memoryResource);
+    bool isMoved = false;
 
-    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
-        for (unsigned int i = 0; i < this->instance.getM(); i++) {
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                cost(i, j) = 0;
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        workList[eId - 1] = eId;
+    }
+
+    shuffle(workList.begin(), workList.end(), this->generator);
+
+    for (unsigned int i = 0; i < workList.size(); i++) {
+        /* The time is checked every few edges, since each examination is cheap */
+        if (i % 256 == 0 && Heuristic::getElapsedTime(startTime) >= timeLimit) {
+            break;
+        }
+
+        unsigned int eId = workList[i];
+        unsigned int j = edgesDistrict[eId - 1];
+        const Edge & e = this->instance.getEdge(eId);
+
+        dontLookBits[eId - 1] = true;
+
+        /* ∀ k ∈ {1, ..., m} such that σ_{G}(e) ∩ E_{k} ≠ ∅, in random order */
+        districtsVector.clear();
+
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(eId); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            unsigned int k = edgesDistrict[*fIdIt - 1];
+
+            if (k != j && std::find(districtsVector.begin(), districtsVector.end(), k) == 
+                    districtsVector.end()) {
+                districtsVector.push_back(k);
+            }
+        }
+
+        /* Only the frontier edges can move */
+        if (districtsVector.empty()) {
+            continue;
+        }
+
+        /* d_{E_{j}} - 2 d_{e} ≥ (1 - B) \bar{d}_{ℰ} */
+        if (districtsDemand[j] - 2 * e.w < minimumDemand) {
+            edgesBlockedByMinimumDemand[j].push_back(eId);
+            continue;
+        }
+
+        shuffle(districtsVector.begin(), districtsVector.end(), this->generator);
+
+        for (unsigned int k : districtsVector) {
+            /* c_{e, j} < c_{e, k} */
+            if (this->instance.getC(e, j) >= this->instance.getC(e, k)) {
+                continue;
+            }
 
-                for (const Edge & e : improvedDistricts[i]) {
-                    cost(i, j) += this->instance.getC(e, j);
+            /* d_{E_{k}} + 2 d_{e} <= min{D, (1 + B) \bar{d}_{ℰ}} */
+            if (districtsDemand[k] + 2 * e.w > maximumDemand) {
+                edgesBlockedByMaximumDemand[k].push_back(eId);
+                continue;
+            }
+
+            edgesDistrict[eId - 1] = k;
+
+            /* G[E_{j} \ {e}] is connected */
+            if (!this->isConnected(edgesDistrict, j, 
+                        this->getAdjacentEdgeInDistrict(edgesDistrict, eId, j), 
+                        districtsSize[j] - 1)) {
+                edgesDistrict[eId - 1] = j;
+                break;
+            }
+
+            districtsDemand[j] -= 2 * e.w;
+            districtsDemand[k] += 2 * e.w;
+            districtsSize[j]--;
+            districtsSize[k]++;
+            isMoved = true;
+
+            /* The edge and its adjacent edges change their frontiers */
+            dontLookBits[eId - 1] = false;
+            workList.push_back(eId);
+
+            for (std::vector<unsigned int>::const_iterator fIdIt = 
+                    this->instance.getAdjacentEdgesIdsBegin(eId); 
+                    fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+                if (dontLookBits[*fIdIt - 1]) {
+                    dontLookBits[*fIdIt - 1] = false;
+                    workList.push_back(*fIdIt);
+                }
+            }
+
+            /* E_{j} can now receive edges and E_{k} can now give them */
+            for (unsigned int fId : edgesBlockedByMaximumDemand[j]) {
+                if (dontLookBits[fId - 1]) {
+                    dontLookBits[fId - 1] = false;
+                    workList.push_back(fId);
+                }
+            }
+
+            for (unsigned int fId : edgesBlockedByMinimumDemand[k]) {
+                if (dontLookBits[fId - 1]) {
+                    dontLookBits[fId - 1] = false;
+                    workList.push_back(fId);
                 }
             }
+
+            edgesBlockedByMaximumDemand[j].clear();
+            edgesBlockedByMinimumDemand[k].clear();
+
+            break;
         }
+    }
 
-        /* ℰ ← Max-Cost-Assignment(ℰ) */
-        districtsIds = dlib::max_cost_assignment(cost);
+    return isMoved;
+}
+
+/*
+ * Inserts the improving moves of the specified edge into the heap of its
+ * district, invalidating the moves inserted before.
+ *
+ * @param edgesDistrict the district of each edge.
+ * @param edgesStamp    the stamp of the last moves inserted for each edge.
+ * @param movesHeaps    the heap of the moves of each district's edges.
+ * @param eId           the edge's id.
+ */
+void LocalSearchHeuristic::pushMoves(const std::vector<unsigned int> & edgesDistrict, 
+        std::pmr::vector<unsigned int> & edgesStamp, 
+        std::pmr::vector<std::priority_queue<EdgeMove, std::pmr::vector<EdgeMove> > > & 
+        movesHeaps, unsigned int eId) {
+    unsigned int j = edgesDistrict[eId - 1];
+    unsigned int stamp = ++edgesStamp[eId - 1];
+
+    for (std::vector<unsigned int>::const_iterator fIdIt = 
+            this->instance.getAdjacentEdgesIdsBegin(eId); 
+            fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+        unsigned int k = edgesDistrict[*fIdIt - 1];
+        bool isRepeated = (k == j);
+
+        /* Each district adjacent to the edge gives a single move */
+        for (std::vector<unsigned int>::const_iterator gIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(eId); 
+                gIdIt != fIdIt && !isRepeated; gIdIt++) {
+            isRepeated = edgesDistrict[*gIdIt - 1] == k;
+        }
+
+        if (isRepeated) {
+            continue;
+        }
+
+        /* c_{e, k} - c_{e, j} > 0 */
+        double gain = this->instance.getC(eId, k) - this->instance.getC(eId, j);
 
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            improvedDistricts[districtsIds[j]] = improvedSolution.getDistrict(j);
+        if (gain > 0) {
+            movesHeaps[j].push(EdgeMove(gain, eId, k, stamp));
         }
+    }
+}
 
-        improvedSolution = Solution(this->instance, improvedDistricts);
+/*
+ * Moves frontier edges to adjacent districts in which they are more profitable
+ * while the districts stay connected and balanced, choosing at random among
+ * the most profitable feasible moves. The moves of each district's edges are
+ * kept in a heap updated as the moves are applied, so that finding the best
+ * one does not scan the frontiers.
+ *
+ * @param edgesDistrict    the district of each edge.
+ * @param districtsDemand  the demand of each district.
+ * @param candidatesNumber the number of most profitable feasible moves among
+ *                         which each move is chosen.
+ * @param startTime        the start time.
+ * @param timeLimit        the time limit.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::moveBestEdges(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand, unsigned int candidatesNumber, 
+        const std::chrono::steady_clock::time_point & startTime, unsigned int timeLimit) {
+    unsigned int m = this->instance.getM();
+    double minimumDemand = this->instance.getMinimumDemand();
+    double maximumDemand = this->instance.getMaximumDemand();
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    std::pmr::vector<unsigned int> edgesStamp (edgesDistrict.size(), 0, this->memoryResource);
+    std::pmr::vector<std::priority_queue<EdgeMove, std::pmr::vector<EdgeMove> > > movesHeaps (
+            m, this->memoryResource);
+    std::pmr::vector<std::pmr::vector<EdgeMove> > movesBlockedByMinimumDemand (m, 
+            this->memoryResource);
+    std::pmr::vector<std::pmr::vector<EdgeMove> > movesBlockedByMaximumDemand (m, 
+            this->memoryResource);
+    std::pmr::vector<EdgeMove> candidateList (this->memoryResource);
+    unsigned int movesCounter = 0;
+
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        this->pushMoves(edgesDistrict, edgesStamp, movesHeaps, eId);
     }
 
-    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
-        edgesDistrict = improvedSolution.getEdgesDistrict();
+    while (movesCounter % 64 != 0 || Heuristic::getElapsedTime(startTime) < timeLimit) {
+        /* Each iteration either moves an edge or ends the search */
+        candidateList.clear();
+
+        /* CL ← the candidatesNumber most profitable feasible moves */
+        while (candidateList.size() < candidatesNumber) {
+            unsigned int bestJ = m;
+
+            for (unsigned int j = 0; j < m; j++) {
+                /* Moves of edges that moved or whose adjacent edges moved are outdated */
+                while (!movesHeaps[j].empty() && 
+                        movesHeaps[j].top().stamp != edgesStamp[movesHeaps[j].top().eId - 1]) {
+                    movesHeaps[j].pop();
+                }
+
+                if (!movesHeaps[j].empty() && (bestJ == m || 
+                            movesHeaps[bestJ].top().gain < movesHeaps[j].top().gain)) {
+                    bestJ = j;
+                }
+            }
+
+            if (bestJ == m) {
+                break;
+            }
+
+            EdgeMove move = movesHeaps[bestJ].top();
+            double d = 2 * this->instance.getEdge(move.eId).w;
+
+            movesHeaps[bestJ].pop();
+
+            /* d_{E_{j}} - 2 d_{e} ≥ (1 - B) \bar{d}_{ℰ} */
+            if (districtsDemand[bestJ] - d < minimumDemand) {
+                movesBlockedByMinimumDemand[bestJ].push_back(move);
+                continue;
+            }
+
+            /* d_{E_{k}} + 2 d_{e} <= min{D, (1 + B) \bar{d}_{ℰ}} */
+            if (districtsDemand[move.k] + d > maximumDemand) {
+                movesBlockedByMaximumDemand[move.k].push_back(move);
+                continue;
+            }
 
-        for (const Edge & e : this->instance.getG().getEdges()) {
-            unsigned int eId = this->instance.getG().getEdgeId(e);
-            unsigned int j = edgesDistrict[eId - 1];
+            edgesDistrict[move.eId - 1] = move.k;
 
-            edgesAdjacentEdges[eId - 1] = this->instance.getG().getAdjacentEdges(e);
-            std::set_difference(edgesAdjacentEdges[eId - 1].begin(), 
-                    edgesAdjacentEdges[eId - 1].end(), 
-                    improvedDistricts[j].begin(), improvedDistricts[j].end(), 
-                    std::inserter(edgesAdjacentEdgesNotInDistrict[eId - 1], 
-                        edgesAdjacentEdgesNotInDistrict[eId - 1].begin()));
+            /* G[E_{j} \ {e}] is connected */
+            bool isFeasible = this->isConnected(edgesDistrict, bestJ, 
+                    this->getAdjacentEdgeInDistrict(edgesDistrict, move.eId, bestJ), 
+                    districtsSize[bestJ] - 1);
+
+            edgesDistrict[move.eId - 1] = bestJ;
+
+            if (isFeasible) {
+                candidateList.push_back(move);
+            }
+        }
+
+        if (candidateList.empty()) {
+            break;
+        }
+
+        std::uniform_int_distribution<unsigned int> distribution (0, 
+                candidateList.size() - 1);
+        unsigned int chosenCandidate = distribution(this->generator);
+        EdgeMove move = candidateList[chosenCandidate];
+        const Edge & e = this->instance.getEdge(move.eId);
+        unsigned int j = edgesDistrict[move.eId - 1];
+        unsigned int k = move.k;
+
+        /* The other candidates stay valid unless the chosen move outdates them */
+        for (unsigned int i = 0; i < candidateList.size(); i++) {
+            if (i != chosenCandidate) {
+                movesHeaps[edgesDistrict[candidateList[i].eId - 1]].push(candidateList[i]);
+            }
+        }
+
+        /* E_{j} ← E_{j} \ {e}, E_{k} ← E_{k} ∪ {e} */
+        edgesDistrict[move.eId - 1] = k;
+        districtsDemand[j] -= 2 * e.w;
+        districtsDemand[k] += 2 * e.w;
+        districtsSize[j]--;
+        districtsSize[k]++;
+        movesCounter++;
+
+        /* The edge and its adjacent edges change their moves */
+        this->pushMoves(edgesDistrict, edgesStamp, movesHeaps, move.eId);
+
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(move.eId); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(move.eId); fIdIt++) {
+            this->pushMoves(edgesDistrict, edgesStamp, movesHeaps, *fIdIt);
+        }
+
+        /* E_{j} can now receive edges and E_{k} can now give them */
+        for (const EdgeMove & blockedMove : movesBlockedByMaximumDemand[j]) {
+            movesHeaps[edgesDistrict[blockedMove.eId - 1]].push(blockedMove);
+        }
+
+        for (const EdgeMove & blockedMove : movesBlockedByMinimumDemand[k]) {
+            movesHeaps[k].push(blockedMove);
+        }
+
+        movesBlockedByMaximumDemand[j].clear();
+        movesBlockedByMinimumDemand[k].clear();
+    }
+
+    return movesCounter > 0;
+}
+
+/*
+ * Partitions the districts into classes of pairwise non-adjacent districts by a
+ * greedy colouring of the districts' adjacency graph, colouring the districts
+ * with more neighbours first.
+ *
+ * @param frontierEdges the edges of each district j adjacent to each district k.
+ *
+ * @return the districts of each colour.
+ */
+std::vector<std::vector<unsigned int> > LocalSearchHeuristic::colourDistricts(
+        const std::vector<std::vector<std::vector<unsigned int> > > & frontierEdges) const {
+    unsigned int m = this->instance.getM();
+    std::vector<unsigned int> districtsDegree (m, 0);
+    std::vector<unsigned int> districtsVector (m);
+    std::vector<unsigned int> districtsColour (m, m);
+    std::vector<std::vector<unsigned int> > colourClasses;
+
+    for (unsigned int j = 0; j < m; j++) {
+        districtsVector[j] = j;
+
+        for (unsigned int k = 0; k < m; k++) {
+            if (!frontierEdges[j][k].empty()) {
+                districtsDegree[j]++;
+            }
         }
+    }
+
+    std::stable_sort(districtsVector.begin(), districtsVector.end(), 
+            [&districtsDegree](unsigned int j, unsigned int k) {
+                return districtsDegree[j] > districtsDegree[k];
+            });
 
-        districtsDemand = improvedSolution.getDistrictsDemand();
+    for (unsigned int j : districtsVector) {
+        std::vector<bool> isUsed (colourClasses.size() + 1, false);
 
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            districtsVector[j] = j;
+        for (unsigned int k = 0; k < m; k++) {
+            if (!frontierEdges[j][k].empty() && districtsColour[k] < m) {
+                isUsed[districtsColour[k]] = true;
+            }
+        }
+
+        districtsColour[j] = std::find(isUsed.begin(), isUsed.end(), false) - isUsed.begin();
+
+        if (districtsColour[j] == colourClasses.size()) {
+            colourClasses.push_back(std::vector<unsigned int> ());
+        }
+
+        colourClasses[districtsColour[j]].push_back(j);
+    }
 
-            Graph inducedSubGraph = 
-                this->instance.getG().getInducedSubGraph(improvedDistricts[j]);
-            std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-            std::set<Edge> districtLeafEdges = inducedSubGraph.getLeafEdges();
-            std::set<Edge> districtBridgesThatAreNotLeafs;
+    return colourClasses;
+}
 
-            std::set_difference(districtBridges.begin(), districtBridges.end(), 
-                    districtLeafEdges.begin(), districtLeafEdges.end(), 
-                    std::inserter(districtBridgesThatAreNotLeafs, 
-                        districtBridgesThatAreNotLeafs.begin()));
+/*
+ * Chooses a batch of improving moves out of each of the specified districts
+ * from the specified one, skipping the ones handled by the other threads. Each
+ * batch keeps its district connected and balanced and only uses its share of
+ * each receiving district's demand slack, so that the batches of non-adjacent
+ * districts never conflict.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ * @param districtsSize   the number of edges of each district.
+ * @param frontierEdges   the edges of each district j adjacent to each district k.
+ * @param demandSlacks    the demand each district may receive from each batch.
+ * @param colourClass     the pairwise non-adjacent districts.
+ * @param firstDistrict   the position of the first district in the class.
+ * @param step            the number of threads.
+ * @param batches         the batch of moves of each district of the class.
+ */
+void LocalSearchHeuristic::chooseMoves(const std::vector<unsigned int> & edgesDistrict, 
+        const std::vector<double> & districtsDemand, 
+        const std::vector<unsigned int> & districtsSize, 
+        const std::vector<std::vector<std::vector<unsigned int> > > & frontierEdges, 
+        const std::vector<double> & demandSlacks, 
+        const std::vector<unsigned int> & colourClass, unsigned int firstDistrict, 
+        unsigned int step, std::vector<std::vector<EdgeMove> > & batches) const {
+    unsigned int m = this->instance.getM();
+    double minimumDemand = this->instance.getMinimumDemand();
+    std::vector<bool> isRemoved (edgesDistrict.size(), false);
 
-            std::set<Edge> districtAdjacentEdges = 
-                this->instance.getG().getAdjacentEdges(improvedDistricts[j]);
+    for (unsigned int i = firstDistrict; i < colourClass.size(); i += step) {
+        unsigned int j = colourClass[i];
+        double districtDemand = districtsDemand[j];
+        unsigned int districtSize = districtsSize[j];
+        std::vector<double> receivedDemands (m, 0.0);
+        std::vector<EdgeMove> moves;
 
-            for (const Edge & e : districtAdjacentEdges) {
-                unsigned int eId = this->instance.getG().getEdgeId(e);
+        /* c_{e, j} < c_{e, k} for e ∈ E_{j} with σ_{G}(e) ∩ E_{k} ≠ ∅ */
+        for (unsigned int k = 0; k < m; k++) {
+            for (unsigned int eId : frontierEdges[j][k]) {
+                double gain = this->instance.getC(eId, k) - this->instance.getC(eId, j);
 
-                if (edgesDistrict[eId - 1] == j) {
-                    districtsFrontierEdges[j].insert(e);
+                if (gain > 0) {
+                    moves.push_back(EdgeMove(gain, eId, k, 0));
                 }
             }
+        }
+
+        std::sort(moves.rbegin(), moves.rend());
 
-            std::set_difference(districtsFrontierEdges[j].begin(), 
-                    districtsFrontierEdges[j].end(), 
-                    districtBridgesThatAreNotLeafs.begin(), 
-                    districtBridgesThatAreNotLeafs.end(), 
-                    std::inserter(
-                        districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j], 
-                        districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j].begin()));
+        for (const EdgeMove & move : moves) {
+            double demand = 2 * this->instance.getEdge(move.eId).w;
+
+            if (isRemoved[move.eId - 1] || districtDemand - demand < minimumDemand || 
+                    receivedDemands[move.k] + demand > demandSlacks[move.k]) {
+                continue;
+            }
+
+            unsigned int fId = 0;
+
+            isRemoved[move.eId - 1] = true;
+
+            for (std::vector<unsigned int>::const_iterator gIdIt = 
+                    this->instance.getAdjacentEdgesIdsBegin(move.eId); 
+                    gIdIt != this->instance.getAdjacentEdgesIdsEnd(move.eId); gIdIt++) {
+                if (edgesDistrict[*gIdIt - 1] == j && !isRemoved[*gIdIt - 1]) {
+                    fId = *gIdIt;
+                    break;
+                }
+            }
+
+            /* G[E_{j} \ {e}] stays connected after the batch's earlier moves */
+            if (!this->isConnected(edgesDistrict, j, fId, districtSize - 1, isRemoved)) {
+                isRemoved[move.eId - 1] = false;
+                continue;
+            }
+
+            districtDemand -= demand;
+            districtSize--;
+            receivedDemands[move.k] += demand;
+            batches[i].push_back(move);
         }
+    }
+}
 
-        /* improved ← true */
-        bool improved = true;
+/*
+ * Moves frontier edges to adjacent districts in which they are more profitable
+ * while the districts stay connected and balanced, choosing the moves of the
+ * districts of each colour class in parallel and committing them together.
+ * Districts of the same class share no frontier, so a move out of one of them
+ * neither changes the connectivity nor the frontier of the others; only the
+ * receiving districts' demand is shared, and it is split among the batches
+ * beforehand.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ * @param startTime       the start time.
+ * @param timeLimit       the time limit.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::moveEdgesInParallel(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand, const std::chrono::steady_clock::time_point & startTime, unsigned int timeLimit) {
+    unsigned int m = this->instance.getM();
+    double maximumDemand = this->instance.getMaximumDemand();
+    std::vector<std::vector<std::vector<unsigned int> > > frontierEdges = 
+        this->getFrontierEdges(edgesDistrict);
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    std::vector<std::vector<unsigned int> > colourClasses = 
+        this->colourDistricts(frontierEdges);
+    unsigned int idleClassesCounter = 0;
+    bool isMoved = false;
 
-        /* while improved */
-        while (improved && Heuristic::getElapsedTime(startTime) < timeLimit) {
-            /* improved ← false */
-            improved = false;
-
-            shuffle(districtsVector.begin(), districtsVector.end(), this->generator);
-
-            /* ∀ j ∈ {1, ..., m} */
-            for (unsigned int j : districtsVector) {
-                std::vector<Edge> districtFrontierEdgesThatAreNotBridgesButMayBeLeafsVector (
-                        districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j].begin(), 
-                        districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j].end());
-                shuffle(districtFrontierEdgesThatAreNotBridgesButMayBeLeafsVector.begin(), 
-                        districtFrontierEdgesThatAreNotBridgesButMayBeLeafsVector.end(), 
-                        this->generator);
-
-                /* ∀ e ∈ E_{j} */
-                for (const Edge & e : districtFrontierEdgesThatAreNotBridgesButMayBeLeafsVector) {
-                    unsigned int eId = this->instance.getG().getEdgeId(e);
-
-                    /* 
-                     * if G[E_{j} \ {e}] is connected ∧ 
-                     * d_{E_{j}} - 2 d_{e} ≥ (1 - B) \bar{d}_{ℰ} 
-                     */
-                    if (districtsDemand[j] - 2 * e.w >= minimumDemand) {
-                        std::vector<Edge> edgeAdjacentEdgesNotInDistrictVector (
-                                edgesAdjacentEdgesNotInDistrict[eId - 1].begin(), 
-                                edgesAdjacentEdgesNotInDistrict[eId - 1].end());
-                        shuffle(edgeAdjacentEdgesNotInDistrictVector.begin(), 
-                                edgeAdjacentEdgesNotInDistrictVector.end(), this->generator);
-
-                        /* ∀ f ∈ σ_{G}(e) \ E_{j} */
-                        for (const Edge & f : edgeAdjacentEdgesNotInDistrictVector) {
-                            /* Let k ∈ {1, ..., m} such that f ∈ E_{k} */
-                            unsigned int fId = this->instance.getG().getEdgeId(f);
-                            unsigned int k = edgesDistrict[fId - 1];
-
-                            /*
-                             * if d_{E_{k}} + 2 d_{e} <= min{D, (1 + B) \bar{d}_{ℰ}} 
-                             * ∧ c_{e,j} < c_{e, k}
-                             */
-                            if (districtsDemand[k] + 2 * e.w <= maximumDemand 
-                                    && this->instance.getC(e, j) < this->instance.getC(e, k)) {
-                                /* E_{j} ← E_{j} \ {e} */
-                                improvedDistricts[j].erase(e);
-                                /* E_{k} ← E_{k} ∪ {e} */
-                                improvedDistricts[k].insert(e);
-                                edgesDistrict[eId - 1] = k;
-                                std::set_difference(
-                                        edgesAdjacentEdges[eId - 1].begin(), 
-                                        edgesAdjacentEdges[eId - 1].end(), 
-                                        improvedDistricts[k].begin(), 
-                                        improvedDistricts[k].end(), 
-                                        std::inserter(
-                                            edgesAdjacentEdgesNotInDistrict[eId - 1], 
-                                            edgesAdjacentEdgesNotInDistrict[eId - 1].begin()));
-
-                                for (const Edge & g : edgesAdjacentEdges[eId - 1]) {
-                                    unsigned int gId = this->instance.getG().getEdgeId(g);
-                                    unsigned int l = edgesDistrict[gId - 1];
-
-                                    if (l == j) {
-                                        edgesAdjacentEdgesNotInDistrict[gId - 1].insert(e);
-                                    } else if (l == k) {
-                                        edgesAdjacentEdgesNotInDistrict[gId - 1].erase(e);
-                                    }
-                                }
-
-                                districtsDemand[j] -= 2 * e.w;
-                                districtsDemand[k] += 2 * e.w;
-
-                                districtsFrontierEdges[j].erase(e);
-
-                                for (const Edge & g : edgesAdjacentEdges[eId - 1]) {
-                                    unsigned int gId = this->instance.getG().getEdgeId(g);
-
-                                    if (edgesDistrict[gId - 1] == j) {
-                                        bool isFrontierEdge = false;
-
-                                        for (const Edge & h : edgesAdjacentEdges[gId - 1]) {
-                                            unsigned int hId = 
-                                                this->instance.getG().getEdgeId(h);
-
-                                            if (edgesDistrict[hId - 1] != j) {
-                                                isFrontierEdge = true;
-                                                break;
-                                            }
-                                        }
-
-                                        if (isFrontierEdge) {
-                                            districtsFrontierEdges[j].insert(g);
-                                        }
-                                    }
-
-                                    if (edgesDistrict[gId - 1] == k) {
-                                        bool isFrontierEdge = false;
-
-                                        for (const Edge & h : edgesAdjacentEdges[gId - 1]) {
-                                            unsigned int hId = 
-                                                this->instance.getG().getEdgeId(h);
-
-                                            if (edgesDistrict[hId - 1] != k) {
-                                                isFrontierEdge = true;
-                                                break;
-                                            }
-                                        }
-
-                                        if (!isFrontierEdge) {
-                                            districtsFrontierEdges[k].erase(g);
-                                        }
-                                    }
-
-                                    if (edgesDistrict[gId - 1] != k) {
-                                        districtsFrontierEdges[k].insert(e);
-                                    }
-                                }
-
-                                Graph inducedSubGraph = this->instance.getG().
-                                    getInducedSubGraph(improvedDistricts[j]);
-                                std::set<Edge> districtBridges = inducedSubGraph.getBridges();
-                                std::set<Edge> districtLeafEdges = 
-                                    inducedSubGraph.getLeafEdges();
-                                std::set<Edge> districtBridgesThatAreNotLeafs;
-                                std::set_difference(districtBridges.begin(), 
-                                        districtBridges.end(), 
-                                        districtLeafEdges.begin(), 
-                                        districtLeafEdges.end(), 
-                                        std::inserter(
-                                            districtBridgesThatAreNotLeafs, 
-                                            districtBridgesThatAreNotLeafs.begin()));
-                                districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j].clear();
-                                std::set_difference(
-                                        districtsFrontierEdges[j].begin(), 
-                                        districtsFrontierEdges[j].end(), 
-                                        districtBridgesThatAreNotLeafs.begin(), 
-                                        districtBridgesThatAreNotLeafs.end(), 
-                                        std::inserter(
-                                            districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j], 
-                                            districtsFrontierEdgesThatAreNotBridgesButMayBeLeafs[j].begin()));
-
-                                inducedSubGraph = this->instance.getG().
-                                    getInducedSubGraph(improvedDistricts[k]);
-                                districtBridges = inducedSubGraph.getBridges();
-                                districtLeafEdges = inducedSubGraph.getLeafEdges();
-                                districtBridgesThatAreNotLeafs.clear();
-                                std::set_difference(districtBridges.begin(), 
-                                        districtBridges.end(), 
-                                        districtLeafEdges.begin(), 
-                                        districtLeafEdges.end(), 
-                                        std::inserter(
-                                            districtBridgesThatAreNotLeafs, 
-                                            districtBridgesThatAreNotLeafs.begin()));
-
-                                /* improved ← true */
-                                improved = true;
-
-                                break;
-                            }
-                        }
+    /* The classes are visited in turn until none of them has an improving batch */
+    for (unsigned int c = 0; idleClassesCounter < colourClasses.size() && 
+            Heuristic::getElapsedTime(startTime) < timeLimit; c++) {
+        const std::vector<unsigned int> & colourClass = colourClasses[c % colourClasses.size()];
+        std::vector<std::vector<EdgeMove> > batches (colourClass.size());
+        std::vector<double> demandSlacks (m, 0.0);
+        unsigned int threadsNumber = std::min(this->threadsNumber, 
+                (unsigned int) colourClass.size());
+        unsigned int classSize = 0;
+
+        for (unsigned int j : colourClass) {
+            classSize += districtsSize[j];
+        }
+
+        /* Starting the threads only pays off when each one has enough edges to examine */
+        threadsNumber = std::max(std::min(threadsNumber, 
+                    classSize / this->threadEdgesNumber), 1u);
+
+        /* d_{E_{k}} + Σ 2 d_{e} <= min{D, (1 + B) \bar{d}_{ℰ}}, split among the class */
+        for (unsigned int k = 0; k < m; k++) {
+            unsigned int adjacentDistrictsCounter = 0;
+
+            for (unsigned int j : colourClass) {
+                if (!frontierEdges[j][k].empty()) {
+                    adjacentDistrictsCounter++;
+                }
+            }
+
+            if (adjacentDistrictsCounter > 0) {
+                demandSlacks[k] = (maximumDemand - districtsDemand[k]) / 
+                    adjacentDistrictsCounter;
+            }
+        }
+
+        if (threadsNumber > 1) {
+            std::vector<std::thread> threads;
+
+            this->parallelClassesCounter++;
+
+            for (unsigned int i = 0; i < threadsNumber; i++) {
+                threads.push_back(std::thread(&LocalSearchHeuristic::chooseMoves, this, 
+                            std::cref(edgesDistrict), std::cref(districtsDemand), 
+                            std::cref(districtsSize), std::cref(frontierEdges), 
+                            std::cref(demandSlacks), std::cref(colourClass), i, 
+                            threadsNumber, std::ref(batches)));
+            }
+
+            for (std::thread & thread : threads) {
+                thread.join();
+            }
+        } else {
+            this->chooseMoves(edgesDistrict, districtsDemand, districtsSize, frontierEdges, 
+                    demandSlacks, colourClass, 0, 1, batches);
+        }
+
+        bool isCommitted = false;
+
+        for (unsigned int i = 0; i < colourClass.size(); i++) {
+            unsigned int j = colourClass[i];
+
+            for (const EdgeMove & move : batches[i]) {
+                const Edge & e = this->instance.getEdge(move.eId);
+
+                /* E_{j} ← E_{j} \ {e}, E_{k} ← E_{k} ∪ {e} */
+                edgesDistrict[move.eId - 1] = move.k;
+                districtsDemand[j] -= 2 * e.w;
+                districtsDemand[move.k] += 2 * e.w;
+                isCommitted = true;
+            }
+        }
+
+        /* The moved edges change the frontiers and possibly the adjacency of the districts */
+        if (isCommitted) {
+            frontierEdges = this->getFrontierEdges(edgesDistrict);
+            districtsSize = this->getDistrictsSize(edgesDistrict);
+            colourClasses = this->colourDistricts(frontierEdges);
+            idleClassesCounter = 0;
+            isMoved = true;
+        } else {
+            idleClassesCounter++;
+        }
+    }
+
+    return isMoved;
+}
+
+/*
+ * Returns the edges of each district adjacent to each other district.
+ *
+ * @param edgesDistrict the district of each edge.
+ *
+ * @return the ids of the edges of each district j adjacent to each district k.
+ */
+std::vector<std::vector<std::vector<unsigned int> > > LocalSearchHeuristic::getFrontierEdges(
+        const std::vector<unsigned int> & edgesDistrict) const {
+    unsigned int m = this->instance.getM();
+    std::vector<std::vector<std::vector<unsigned int> > > frontierEdges (m, 
+            std::vector<std::vector<unsigned int> > (m));
+
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        unsigned int j = edgesDistrict[eId - 1];
+
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(eId); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            unsigned int k = edgesDistrict[*fIdIt - 1];
+
+            if (k != j && (frontierEdges[j][k].empty() || frontierEdges[j][k].back() != eId)) {
+                frontierEdges[j][k].push_back(eId);
+            }
+        }
+    }
+
+    return frontierEdges;
+}
+
+/*
+ * Returns the number of edges of each district.
+ *
+ * @param edgesDistrict the district of each edge.
+ *
+ * @return the number of edges of each district.
+ */
+std::vector<unsigned int> LocalSearchHeuristic::getDistrictsSize(
+        const std::vector<unsigned int> & edgesDistrict) const {
+    std::vector<unsigned int> districtsSize (this->instance.getM(), 0);
+
+    for (unsigned int j : edgesDistrict) {
+        districtsSize[j]++;
+    }
+
+    return districtsSize;
+}
+
+/*
+ * Returns an edge of the specified district adjacent to the specified edge.
+ *
+ * @param edgesDistrict the district of each edge.
+ * @param eId           the edge's id.
+ * @param j             the district.
+ *
+ * @return the id of an edge of the district adjacent to the edge; 0 if there
+ *         is none.
+ */
+unsigned int LocalSearchHeuristic::getAdjacentEdgeInDistrict(
+        const std::vector<unsigned int> & edgesDistrict, unsigned int eId, 
+        unsigned int j) const {
+    for (std::vector<unsigned int>::const_iterator fIdIt = 
+            this->instance.getAdjacentEdgesIdsBegin(eId); 
+            fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+        if (edgesDistrict[*fIdIt - 1] == j) {
+            return *fIdIt;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * Verifies whether the specified district is connected, by a breadth-first
+ * search from one of its edges that only visits the district's edges.
+ *
+ * @param edgesDistrict the district of each edge.
+ * @param j             the district.
+ * @param eId           the id of an edge of the district; 0 if there is none.
+ * @param districtSize  the number of edges of the district.
+ *
+ * @return true if the district is connected; false otherwise.
+ */
+bool LocalSearchHeuristic::isConnected(const std::vector<unsigned int> & edgesDistrict, 
+        unsigned int j, unsigned int eId, unsigned int districtSize) {
+    if (eId == 0) {
+        return false;
+    }
+
+    /* Stamping the visited edges avoids clearing a vector per search */
+    if (this->visitedStamps.size() < edgesDistrict.size()) {
+        this->visitedStamps.assign(edgesDistrict.size(), 0);
+        this->visitedStamp = 0;
+    }
+
+    unsigned int stamp = ++this->visitedStamp;
+    /* The queue's memory is reused by the next search */
+    std::vector<unsigned int> & Q = this->searchQueue;
+
+    Q.clear();
+    Q.push_back(eId);
+    this->visitedStamps[eId - 1] = stamp;
+
+    for (unsigned int i = 0; i < Q.size(); i++) {
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(Q[i]); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(Q[i]); fIdIt++) {
+            if (this->visitedStamps[*fIdIt - 1] != stamp && edgesDistrict[*fIdIt - 1] == j) {
+                this->visitedStamps[*fIdIt - 1] = stamp;
+                Q.push_back(*fIdIt);
+            }
+        }
+    }
+
+    return Q.size() == districtSize;
+}
+
+/*
+ * Verifies whether the specified district stays connected without its removed
+ * edges, by a breadth-first search that only visits the district's remaining
+ * edges.
+ *
+ * @param edgesDistrict the district of each edge.
+ * @param j             the district.
+ * @param eId           the id of a remaining edge of the district; 0 if there
+ *                      is none.
+ * @param districtSize  the number of remaining edges of the district.
+ * @param isRemoved     the flag of each edge indicating whether it was removed
+ *                      from its district.
+ *
+ * @return true if the district stays connected; false otherwise.
+ */
+bool LocalSearchHeuristic::isConnected(const std::vector<unsigned int> & edgesDistrict, 
+        unsigned int j, unsigned int eId, unsigned int districtSize, 
+        const std::vector<bool> & isRemoved) const {
+    if (eId == 0) {
+        return false;
+    }
+
+    std::vector<bool> isVisited (edgesDistrict.size(), false);
+    std::vector<unsigned int> Q (1, eId);
+
+    isVisited[eId - 1] = true;
+
+    for (unsigned int i = 0; i < Q.size(); i++) {
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                this->instance.getAdjacentEdgesIdsBegin(Q[i]); 
+                fIdIt != this->instance.getAdjacentEdgesIdsEnd(Q[i]); fIdIt++) {
+            if (!isVisited[*fIdIt - 1] && edgesDistrict[*fIdIt - 1] == j && 
+                    !isRemoved[*fIdIt - 1]) {
+                isVisited[*fIdIt - 1] = true;
+                Q.push_back(*fIdIt);
+            }
+        }
+    }
+
+    return Q.size() == districtSize;
+}
+
+/*
+ * Swaps pairs of frontier edges between adjacent districts whenever it
+ * improves the value and the districts stay connected and balanced.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::swapEdges(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand) {
+    unsigned int m = this->instance.getM();
+    double minimumDemand = this->instance.getMinimumDemand();
+    double maximumDemand = this->instance.getMaximumDemand();
+    std::vector<std::vector<std::vector<unsigned int> > > frontierEdges = 
+        this->getFrontierEdges(edgesDistrict);
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    bool isMoved = false;
+
+    for (unsigned int j = 0; j < m; j++) {
+        for (unsigned int k = j + 1; k < m; k++) {
+            for (unsigned int eId : frontierEdges[j][k]) {
+                for (unsigned int fId : frontierEdges[k][j]) {
+                    if (edgesDistrict[eId - 1] != j || edgesDistrict[fId - 1] != k) {
+                        continue;
                     }
 
-                    if (improved) {
-                        break;
+                    double dE = 2 * this->instance.getEdge(eId).w;
+                    double dF = 2 * this->instance.getEdge(fId).w;
+
+                    /* c_{e, k} + c_{f, j} > c_{e, j} + c_{f, k} */
+                    if (this->instance.getC(eId, k) + this->instance.getC(fId, j) <= 
+                            this->instance.getC(eId, j) + this->instance.getC(fId, k) || 
+                            districtsDemand[j] - dE + dF < minimumDemand || 
+                            districtsDemand[j] - dE + dF > maximumDemand || 
+                            districtsDemand[k] + dE - dF < minimumDemand || 
+                            districtsDemand[k] + dE - dF > maximumDemand) {
+                        continue;
                     }
-                }
 
-                if (improved) {
-                    break;
+                    edgesDistrict[eId - 1] = k;
+                    edgesDistrict[fId - 1] = j;
+
+                    /* G[E_{j} \ {e} ∪ {f}] and G[E_{k} \ {f} ∪ {e}] are connected */
+                    if (this->isConnected(edgesDistrict, j, fId, districtsSize[j]) && 
+                            this->isConnected(edgesDistrict, k, eId, districtsSize[k])) {
+                        districtsDemand[j] += dF - dE;
+                        districtsDemand[k] += dE - dF;
+                        isMoved = true;
+                    } else {
+                        edgesDistrict[eId - 1] = j;
+                        edgesDistrict[fId - 1] = k;
+                    }
                 }
             }
         }
+    }
+
+    return isMoved;
+}
+
+/*
+ * Moves a frontier edge from a district to an adjacent one, which in turn
+ * moves one of its frontier edges to a third district, whenever it improves
+ * the value and the districts stay connected and balanced.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::chainEdges(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand) {
+    unsigned int m = this->instance.getM();
+    double minimumDemand = this->instance.getMinimumDemand();
+    double maximumDemand = this->instance.getMaximumDemand();
+    std::vector<std::vector<std::vector<unsigned int> > > frontierEdges = 
+        this->getFrontierEdges(edgesDistrict);
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    bool isMoved = false;
+
+    for (unsigned int j = 0; j < m; j++) {
+        for (unsigned int k = 0; k < m; k++) {
+            for (unsigned int l = 0; l < m && k != j; l++) {
+                if (l == j || l == k) {
+                    continue;
+                }
+
+                for (unsigned int eId : frontierEdges[j][k]) {
+                    for (unsigned int fId : frontierEdges[k][l]) {
+                        if (edgesDistrict[eId - 1] != j || edgesDistrict[fId - 1] != k || 
+                                districtsSize[j] <= 1) {
+                            continue;
+                        }
+
+                        double dE = 2 * this->instance.getEdge(eId).w;
+                        double dF = 2 * this->instance.getEdge(fId).w;
+
+                        /* c_{e, k} + c_{f, l} > c_{e, j} + c_{f, k} */
+                        if (this->instance.getC(eId, k) + this->instance.getC(fId, l) <= 
+                                this->instance.getC(eId, j) + this->instance.getC(fId, k) || 
+                                districtsDemand[j] - dE < minimumDemand || 
+                                districtsDemand[k] + dE - dF < minimumDemand || 
+                                districtsDemand[k] + dE - dF > maximumDemand || 
+                                districtsDemand[l] + dF > maximumDemand) {
+                            continue;
+                        }
 
-        improvedSolution = Solution(this->instance, improvedDistricts);
+                        edgesDistrict[eId - 1] = k;
+                        edgesDistrict[fId - 1] = l;
+
+                        /* G[E_{j} \ {e}], G[E_{k} \ {f} ∪ {e}] and G[E_{l} ∪ {f}] are connected */
+                        if (this->isConnected(edgesDistrict, j, 
+                                    this->getAdjacentEdgeInDistrict(edgesDistrict, eId, j), 
+                                    districtsSize[j] - 1) && 
+                                this->isConnected(edgesDistrict, k, eId, districtsSize[k]) && 
+                                this->isConnected(edgesDistrict, l, fId, districtsSize[l] + 1)) {
+                            districtsDemand[j] -= dE;
+                            districtsDemand[k] += dE - dF;
+                            districtsDemand[l] += dF;
+                            districtsSize[j]--;
+                            districtsSize[l]++;
+                            isMoved = true;
+                        } else {
+                            edgesDistrict[eId - 1] = j;
+                            edgesDistrict[fId - 1] = k;
+                        }
+                    }
+                }
+            }
+        }
     }
 
-    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
-        for (unsigned int i = 0; i < this->instance.getM(); i++) {
-            for (unsigned int j = 0; j < this->instance.getM(); j++) {
-                cost(i, j) = 0;
+    return isMoved;
+}
+
+/*
+ * Moves a frontier edge together with an adjacent edge of its district to an
+ * adjacent district whenever it improves the value and the districts stay
+ * connected and balanced.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool LocalSearchHeuristic::shiftEdges(std::vector<unsigned int> & edgesDistrict, 
+        std::vector<double> & districtsDemand) {
+    unsigned int m = this->instance.getM();
+    double minimumDemand = this->instance.getMinimumDemand();
+    double maximumDemand = this->instance.getMaximumDemand();
+    std::vector<std::vector<std::vector<unsigned int> > > frontierEdges = 
+        this->getFrontierEdges(edgesDistrict);
+    std::vector<unsigned int> districtsSize = this->getDistrictsSize(edgesDistrict);
+    bool isMoved = false;
 
-                for (const Edge & e : improvedDistricts[i]) {
-                    cost(i, j) += this->instance.getC(e, j);
+    for (unsigned int j = 0; j < m; j++) {
+        for (unsigned int k = 0; k < m; k++) {
+            if (k == j) {
+                continue;
+            }
+
+            for (unsigned int eId : frontierEdges[j][k]) {
+                for (std::vector<unsigned int>::const_iterator gIdIt = 
+                        this->instance.getAdjacentEdgesIdsBegin(eId); 
+                        gIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); gIdIt++) {
+                    unsigned int gId = *gIdIt;
+
+                    if (edgesDistrict[eId - 1] != j || edgesDistrict[gId - 1] != j || 
+                            districtsSize[j] <= 2) {
+                        continue;
+                    }
+
+                    double dEG = 2 * (this->instance.getEdge(eId).w + 
+                            this->instance.getEdge(gId).w);
+
+                    /* c_{e, k} + c_{g, k} > c_{e, j} + c_{g, j} */
+                    if (this->instance.getC(eId, k) + this->instance.getC(gId, k) <= 
+                            this->instance.getC(eId, j) + this->instance.getC(gId, j) || 
+                            districtsDemand[j] - dEG < minimumDemand || 
+                            districtsDemand[k] + dEG > maximumDemand) {
+                        continue;
+                    }
+
+                    edgesDistrict[eId - 1] = k;
+                    edgesDistrict[gId - 1] = k;
+
+                    unsigned int hId = this->getAdjacentEdgeInDistrict(edgesDistrict, eId, j);
+
+                    if (hId == 0) {
+                        hId = this->getAdjacentEdgeInDistrict(edgesDistrict, gId, j);
+                    }
+
+                    /* G[E_{j} \ {e, g}] and G[E_{k} ∪ {e, g}] are connected */
+                    if (this->isConnected(edgesDistrict, j, hId, districtsSize[j] - 2) && 
+                            this->isConnected(edgesDistrict, k, eId, districtsSize[k] + 2)) {
+                        districtsDemand[j] -= dEG;
+                        districtsDemand[k] += dEG;
+                        districtsSize[j] -= 2;
+                        districtsSize[k] += 2;
+                        isMoved = true;
+                    } else {
+                        edgesDistrict[eId - 1] = j;
+                        edgesDistrict[gId - 1] = j;
+                    }
                 }
             }
         }
+    }
+
+    return isMoved;
+}
+
+/*
+ * Improves the specified solution, updating it in place so that moving it in
+ * copies nothing.
+ *
+ * @param solution the solution to be improved.
+ * @param timeLimit the time limit.
+ *
+ * @return an improved solution.
+ */
+Solution LocalSearchHeuristic::improveSolution(Solution solution, unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::vector<unsigned int> edgesDistrict;
+    std::vector<double> districtsDemand;
+
+    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
+        edgesDistrict = solution.getEdgesDistrict();
 
         /* ℰ ← Max-Cost-Assignment(ℰ) */
-        districtsIds = dlib::max_cost_assignment(cost);
+        if (this->relabelDistricts(edgesDistrict)) {
+            solution.setEdgesDistrict(edgesDistrict);
+        }
+    }
 
-        for (unsigned int j = 0; j < this->instance.getM(); j++) {
-            improvedDistricts[districtsIds[j]] = improvedSolution.getDistrict(j);
+    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
+        districtsDemand = solution.getDistrictsDemand();
+
+        /* N_{1}: single edge moves; N_{2}, N_{3}, N_{4}: swaps, chains and shifts */
+        bool improved = true;
+
+        /* The parallel batches leave few moves for the sequential strategy */
+        if (this->threadsNumber > 1) {
+            this->moveEdgesInParallel(edgesDistrict, districtsDemand, startTime, timeLimit);
         }
 
-        improvedSolution = Solution(this->instance, improvedDistricts);
+        while (improved && Heuristic::getElapsedTime(startTime) < timeLimit) {
+            if (this->strategy == FIRST_IMPROVEMENT) {
+                this->moveEdges(edgesDistrict, districtsDemand, startTime, timeLimit);
+            } else {
+                this->moveBestEdges(edgesDistrict, districtsDemand, 
+                        (this->strategy == BEST_IMPROVEMENT) ? 1 : this->candidatesNumber, 
+                        startTime, timeLimit);
+            }
+
+            improved = this->vnd && Heuristic::getElapsedTime(startTime) < timeLimit && 
+                (this->swapEdges(edgesDistrict, districtsDemand) || 
+                 this->chainEdges(edgesDistrict, districtsDemand) || 
+                 this->shiftEdges(edgesDistrict, districtsDemand));
+        }
+
+        solution.setEdgesDistrict(edgesDistrict);
     }
 
-    return improvedSolution;
+    if (Heuristic::getElapsedTime(startTime) < timeLimit) {
+        edgesDistrict = solution.getEdgesDistrict();
+
+        /* ℰ ← Max-Cost-Assignment(ℰ) */
+        if (this->relabelDistricts(edgesDistrict)) {
+            solution.setEdgesDistrict(edgesDistrict);
+        }
+    }
+
+    return solution;
 }
 
+/*
+ * Improves the specified solution only by the batches of moves of the
+ * non-adjacent districts, chosen in parallel, until no colour class has an
+ * improving batch.
+ *
+ * @param solution  the solution to be improved.
+ * @param timeLimit the time limit.
+ *
+ * @return an improved solution.
+ */
+Solution LocalSearchHeuristic::improveSolutionInParallel(Solution solution, 
+        unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
+    std::vector<double> districtsDemand = solution.getDistrictsDemand();
+
+    if (this->moveEdgesInParallel(edgesDistrict, districtsDemand, startTime, timeLimit)) {
+        solution.setEdgesDistrict(edgesDistrict);
+    }
+
+    return solution;
+}
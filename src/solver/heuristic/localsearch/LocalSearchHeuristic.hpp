@@ -2,10 +2,312 @@
 
 #include "../Heuristic.hpp"
 #include "../../../solution/Solution.hpp"
+#include "../../../hungarian-algorithm/HungarianAlgorithm.hpp"
+#include "EdgeMove.hpp"
+#include <queue>
 
 /* The LocalSearchHeuristic represents a local search heuristic for the CEDP. */
 class LocalSearchHeuristic : public Heuristic {
+    private:
+        /* This local search heuristic's solver for the districts' relabeling. */
+        HungarianAlgorithm hungarianAlgorithm;
+
+        /*
+         * The flag indicating whether to descend through the swap, chain and
+         * shift neighbourhoods once no single edge move improves the solution.
+         */
+        bool vnd;
+
+        /* The strategy for choosing each single edge move. */
+        unsigned int strategy;
+
+        /*
+         * The number of most profitable feasible moves among which the
+         * candidate list strategy chooses.
+         */
+        unsigned int candidatesNumber;
+
+        /*
+         * The number of threads evaluating the moves of non-adjacent districts
+         * concurrently; one keeps the sequential strategies.
+         */
+        unsigned int threadsNumber;
+
+        /*
+         * The number of edges of a colour class that each thread examines at
+         * least; smaller classes are examined by fewer threads.
+         */
+        unsigned int threadEdgesNumber;
+
+        /*
+         * The number of colour classes whose moves were chosen by more than
+         * one thread.
+         */
+        unsigned int parallelClassesCounter;
+
+        /* The stamp of the last search that visited each edge. */
+        std::vector<unsigned int> visitedStamps;
+
+        /* The stamp of the last search. */
+        unsigned int visitedStamp;
+
+        /* The queue of the last search, kept to reuse its memory. */
+        std::vector<unsigned int> searchQueue;
+
+        /*
+         * Relabels the specified districts in order to maximize the total
+         * profit, keeping them unchanged when the current labels are already
+         * optimal.
+         *
+         * @param edgesDistrict the district of each edge.
+         *
+         * @return true if the districts were relabeled; false otherwise.
+         */
+        bool relabelDistricts(std::vector<unsigned int> & edgesDistrict);
+
+        /*
+         * Moves frontier edges to adjacent districts in which they are more
+         * profitable while the districts stay connected and balanced.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         * @param startTime       the start time.
+         * @param timeLimit       the time limit.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool moveEdges(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand, 
+                const std::chrono::steady_clock::time_point & startTime, 
+                unsigned int timeLimit);
+
+        /*
+         * Inserts the improving moves of the specified edge into the heap of
+         * its district, invalidating the moves inserted before.
+         *
+         * @param edgesDistrict the district of each edge.
+         * @param edgesStamp    the stamp of the last moves inserted for each
+         *                      edge.
+         * @param movesHeaps    the heap of the moves of each district's edges.
+         * @param eId           the edge's id.
+         */
+        void pushMoves(const std::vector<unsigned int> & edgesDistrict, 
+                std::pmr::vector<unsigned int> & edgesStamp, 
+                std::pmr::vector<std::priority_queue<EdgeMove, 
+                    std::pmr::vector<EdgeMove> > > & movesHeaps, unsigned int eId);
+
+        /*
+         * Moves frontier edges to adjacent districts in which they are more
+         * profitable while the districts stay connected and balanced,
+         * choosing at random among the most profitable feasible moves. The
+         * moves of each district's edges are kept in a heap updated as the
+         * moves are applied, so that finding the best one does not scan the
+         * frontiers.
+         *
+         * @param edgesDistrict    the district of each edge.
+         * @param districtsDemand  the demand of each district.
+         * @param candidatesNumber the number of most profitable feasible
+         *                         moves among which each move is chosen.
+         * @param startTime        the start time.
+         * @param timeLimit        the time limit.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool moveBestEdges(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand, unsigned int candidatesNumber, 
+                const std::chrono::steady_clock::time_point & startTime, 
+                unsigned int timeLimit);
+
+        /*
+         * Partitions the districts into classes of pairwise non-adjacent
+         * districts by a greedy colouring of the districts' adjacency graph,
+         * colouring the districts with more neighbours first.
+         *
+         * @param frontierEdges the edges of each district j adjacent to each
+         *                      district k.
+         *
+         * @return the districts of each colour.
+         */
+        std::vector<std::vector<unsigned int> > colourDistricts(
+                const std::vector<std::vector<std::vector<unsigned int> > > & frontierEdges) const;
+
+        /*
+         * Chooses a batch of improving moves out of each of the specified
+         * districts from the specified one, skipping the ones handled by the
+         * other threads. Each batch keeps its district connected and balanced
+         * and only uses its share of each receiving district's demand slack,
+         * so that the batches of non-adjacent districts never conflict.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         * @param districtsSize   the number of edges of each district.
+         * @param frontierEdges   the edges of each district j adjacent to each
+         *                        district k.
+         * @param demandSlacks    the demand each district may receive from
+         *                        each batch.
+         * @param colourClass     the pairwise non-adjacent districts.
+         * @param firstDistrict   the position of the first district in the
+         *                        class.
+         * @param step            the number of threads.
+         * @param batches         the batch of moves of each district of the
+         *                        class.
+         */
+        void chooseMoves(const std::vector<unsigned int> & edgesDistrict, 
+                const std::vector<double> & districtsDemand, 
+                const std::vector<unsigned int> & districtsSize, 
+                const std::vector<std::vector<std::vector<unsigned int> > > & frontierEdges, 
+                const std::vector<double> & demandSlacks, 
+                const std::vector<unsigned int> & colourClass, unsigned int firstDistrict, 
+                unsigned int step, std::vector<std::vector<EdgeMove> > & batches) const;
+
+        /*
+         * Moves frontier edges to adjacent districts in which they are more
+         * profitable while the districts stay connected and balanced,
+         * choosing the moves of the districts of each colour class in
+         * parallel and committing them together.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         * @param startTime       the start time.
+         * @param timeLimit       the time limit.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool moveEdgesInParallel(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand, 
+                const std::chrono::steady_clock::time_point & startTime, 
+                unsigned int timeLimit);
+
+        /*
+         * Returns the edges of each district adjacent to each other district.
+         *
+         * @param edgesDistrict the district of each edge.
+         *
+         * @return the ids of the edges of each district j adjacent to each
+         *         district k.
+         */
+        std::vector<std::vector<std::vector<unsigned int> > > getFrontierEdges(
+                const std::vector<unsigned int> & edgesDistrict) const;
+
+        /*
+         * Returns the number of edges of each district.
+         *
+         * @param edgesDistrict the district of each edge.
+         *
+         * @return the number of edges of each district.
+         */
+        std::vector<unsigned int> getDistrictsSize(
+                const std::vector<unsigned int> & edgesDistrict) const;
+
+        /*
+         * Returns an edge of the specified district adjacent to the specified
+         * edge.
+         *
+         * @param edgesDistrict the district of each edge.
+         * @param eId           the edge's id.
+         * @param j             the district.
+         *
+         * @return the id of an edge of the district adjacent to the edge; 0
+         *         if there is none.
+         */
+        unsigned int getAdjacentEdgeInDistrict(
+                const std::vector<unsigned int> & edgesDistrict, unsigned int eId, 
+                unsigned int j) const;
+
+        /*
+         * Verifies whether the specified district is connected, by a
+         * breadth-first search from one of its edges that only visits the
+         * district's edges.
+         *
+         * @param edgesDistrict the district of each edge.
+         * @param j             the district.
+         * @param eId           the id of an edge of the district; 0 if there
+         *                      is none.
+         * @param districtSize  the number of edges of the district.
+         *
+         * @return true if the district is connected; false otherwise.
+         */
+        bool isConnected(const std::vector<unsigned int> & edgesDistrict, 
+                unsigned int j, unsigned int eId, unsigned int districtSize);
+
+        /*
+         * Verifies whether the specified district stays connected without
+         * its removed edges, by a breadth-first search that only visits the
+         * district's remaining edges.
+         *
+         * @param edgesDistrict the district of each edge.
+         * @param j             the district.
+         * @param eId           the id of a remaining edge of the district; 0
+         *                      if there is none.
+         * @param districtSize  the number of remaining edges of the district.
+         * @param isRemoved     the flag of each edge indicating whether it was
+         *                      removed from its district.
+         *
+         * @return true if the district stays connected; false otherwise.
+         */
+        bool isConnected(const std::vector<unsigned int> & edgesDistrict, 
+                unsigned int j, unsigned int eId, unsigned int districtSize, 
+                const std::vector<bool> & isRemoved) const;
+
+        /*
+         * Swaps pairs of frontier edges between adjacent districts whenever
+         * it improves the value and the districts stay connected and
+         * balanced.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool swapEdges(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand);
+
+        /*
+         * Moves a frontier edge from a district to an adjacent one, which in
+         * turn moves one of its frontier edges to a third district, whenever
+         * it improves the value and the districts stay connected and
+         * balanced.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool chainEdges(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand);
+
+        /*
+         * Moves a frontier edge together with an adjacent edge of its
+         * district to an adjacent district whenever it improves the value
+         * and the districts stay connected and balanced.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool shiftEdges(std::vector<unsigned int> & edgesDistrict, 
+                std::vector<double> & districtsDemand);
+
     public:
+        /* First improvement constant: the first improving move found in random order. */
+        static const unsigned int FIRST_IMPROVEMENT;
+
+        /* Best improvement constant: the most profitable feasible move. */
+        static const unsigned int BEST_IMPROVEMENT;
+
+        /*
+         * Candidate list constant: a random move among the most profitable
+         * feasible ones.
+         */
+        static const unsigned int CANDIDATE_LIST;
+
+        /*
+         * The default number of edges of a colour class that each thread
+         * examines at least.
+         */
+        static const unsigned int THREAD_EDGES_NUMBER;
+
         /*
          * Constructs a new local search heuristic.
          *
@@ -21,7 +323,95 @@ class LocalSearchHeuristic : public Heuristic {
         LocalSearchHeuristic();
 
         /*
-         * Improves the specified solution.
+         * Sets the flag indicating whether to descend through the swap, chain
+         * and shift neighbourhoods once no single edge move improves the
+         * solution.
+         *
+         * @param vnd the new flag.
+         */
+        void setVND(bool vnd);
+
+        /*
+         * Returns the flag indicating whether to descend through the swap,
+         * chain and shift neighbourhoods.
+         *
+         * @return true if the variable neighbourhood descent is enabled;
+         *         false otherwise.
+         */
+        bool getVND() const;
+
+        /*
+         * Sets the strategy for choosing each single edge move.
+         *
+         * @param strategy         the strategy (FIRST_IMPROVEMENT,
+         *                         BEST_IMPROVEMENT or CANDIDATE_LIST).
+         * @param candidatesNumber the number of most profitable feasible
+         *                         moves among which the candidate list
+         *                         strategy chooses.
+         */
+        void setStrategy(unsigned int strategy, unsigned int candidatesNumber);
+
+        /*
+         * Returns the strategy for choosing each single edge move.
+         *
+         * @return the strategy for choosing each single edge move.
+         */
+        unsigned int getStrategy() const;
+
+        /*
+         * Returns the number of most profitable feasible moves among which
+         * the candidate list strategy chooses.
+         *
+         * @return the number of most profitable feasible moves among which
+         *         the candidate list strategy chooses.
+         */
+        unsigned int getCandidatesNumber() const;
+
+        /*
+         * Sets the number of threads evaluating the moves of non-adjacent
+         * districts concurrently.
+         *
+         * @param threadsNumber the new number of threads; one keeps the
+         *                      sequential strategies.
+         */
+        void setThreadsNumber(unsigned int threadsNumber);
+
+        /*
+         * Returns the number of threads evaluating the moves of non-adjacent
+         * districts concurrently.
+         *
+         * @return the number of threads evaluating the moves of non-adjacent
+         *         districts concurrently.
+         */
+        unsigned int getThreadsNumber() const;
+
+        /*
+         * Sets the number of edges of a colour class that each thread examines
+         * at least, below which starting the threads does not pay off.
+         *
+         * @param threadEdgesNumber the new number of edges per thread.
+         */
+        void setThreadEdgesNumber(unsigned int threadEdgesNumber);
+
+        /*
+         * Returns the number of edges of a colour class that each thread
+         * examines at least.
+         *
+         * @return the number of edges per thread.
+         */
+        unsigned int getThreadEdgesNumber() const;
+
+        /*
+         * Returns the number of colour classes whose moves were chosen by more
+         * than one thread.
+         *
+         * @return the number of colour classes examined in parallel.
+         */
+        unsigned int getParallelClassesCounter() const;
+
+        /*
+         * Improves the specified solution, updating it in place so that
+         * moving it in copies nothing.
          *
          * @param solution  the solution to be improved.
          * @param timeLimit the time limit.
@@ -29,5 +419,17 @@ class LocalSearchHeuristic : public Heuristic {
          * @return an improved solution.
          */
         Solution improveSolution(Solution solution, unsigned int timeLimit);
+
+        /*
+         * Improves the specified solution only by the batches of moves of the
+         * non-adjacent districts, chosen in parallel, until no colour class
+         * has an improving batch.
+         *
+         * @param solution  the solution to be improved.
+         * @param timeLimit the time limit.
+         *
+         * @return an improved solution.
+         */
+        Solution improveSolutionInParallel(Solution solution, unsigned int timeLimit);
 };
 
@@ -0,0 +1,256 @@
+#include "PathRelinkingHeuristic.hpp"
+#include <algorithm>
+#include <cfloat>
+
+/* Forward relinking constant: from the new solution to the elite one. */
+const unsigned int PathRelinkingHeuristic::FORWARD = 0;
+
+/* Backward relinking constant: from the elite solution to the new one. */
+const unsigned int PathRelinkingHeuristic::BACKWARD = 1;
+
+/* Mixed relinking constant: from both solutions towards each other. */
+const unsigned int PathRelinkingHeuristic::MIXED = 2;
+
+/*
+ * Constructs a new path relinking heuristic.
+ *
+ * @param instance the new path relinking heuristic's instance.
+ * @param seed     the seed for the new path relinking heuristic's
+ *                 pseudo-random numbers generator.
+ */
+PathRelinkingHeuristic::PathRelinkingHeuristic(const Instance & instance,
+        unsigned int seed) : Heuristic::Heuristic(instance, seed), visitedStamp(0) {}
+
+/*
+ * Constructs a new empty path relinking heuristic.
+ */
+PathRelinkingHeuristic::PathRelinkingHeuristic() : Heuristic::Heuristic(),
+    visitedStamp(0) {}
+
+/*
+ * Verifies whether moving the specified edge to the specified district keeps
+ * the specified districts connected and balanced.
+ *
+ * @param edgesDistrict   the district of each edge.
+ * @param districtsDemand the demand of each district.
+ * @param districtsSize   the number of edges of each district.
+ * @param eId             the id of the edge to be moved.
+ * @param j               the district to which the edge is to be moved.
+ *
+ * @return true if the move keeps the districts feasible; false otherwise.
+ */
+bool PathRelinkingHeuristic::isFeasibleMove(
+        const std::vector<unsigned int> & edgesDistrict,
+        const std::vector<double> & districtsDemand,
+        const std::vector<unsigned int> & districtsSize,
+        unsigned int eId, unsigned int j) {
+    unsigned int k = edgesDistrict[eId - 1];
+    double d = 2 * this->instance.getEdge(eId).w;
+
+    /* 2 ∑_{f ∈ E_{k} \ {e}}{d_{f}} ≥ min ∧ 2 ∑_{f ∈ E_{j} ∪ {e}}{d_{f}} ≤ max */
+    if (districtsSize[k] <= 1 ||
+            districtsDemand[k] - d < this->instance.getMinimumDemand() ||
+            districtsDemand[j] + d > this->instance.getMaximumDemand()) {
+        return false;
+    }
+
+    unsigned int fIdInK = 0;
+    bool isAdjacentToJ = false;
+
+    for (std::vector<unsigned int>::const_iterator fIdIt =
+            this->instance.getAdjacentEdgesIdsBegin(eId);
+            fIdIt != this->instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+        if (edgesDistrict[*fIdIt - 1] == j) {
+            isAdjacentToJ = true;
+        } else if (edgesDistrict[*fIdIt - 1] == k) {
+            fIdInK = *fIdIt;
+        }
+    }
+
+    /* G[E_{j} ∪ {e}] is connected */
+    if (!isAdjacentToJ || fIdInK == 0) {
+        return false;
+    }
+
+    /* G[E_{k} \ {e}] is connected */
+    /* Stamping the visited edges avoids clearing a vector per search */
+    if (this->visitedStamps.size() < edgesDistrict.size()) {
+        this->visitedStamps.assign(edgesDistrict.size(), 0);
+        this->visitedStamp = 0;
+    }
+
+    unsigned int stamp = ++this->visitedStamp;
+    /* The queue's memory is reused by the next search */
+    std::vector<unsigned int> & Q = this->searchQueue;
+    unsigned int visitedCounter = 1;
+
+    Q.clear();
+    Q.push_back(fIdInK);
+    this->visitedStamps[eId - 1] = stamp;
+    this->visitedStamps[fIdInK - 1] = stamp;
+
+    for (unsigned int i = 0; i < Q.size(); i++) {
+        for (std::vector<unsigned int>::const_iterator gIdIt =
+                this->instance.getAdjacentEdgesIdsBegin(Q[i]);
+                gIdIt != this->instance.getAdjacentEdgesIdsEnd(Q[i]); gIdIt++) {
+            if (this->visitedStamps[*gIdIt - 1] != stamp && edgesDistrict[*gIdIt - 1] == k) {
+                this->visitedStamps[*gIdIt - 1] = stamp;
+                visitedCounter++;
+                Q.push_back(*gIdIt);
+            }
+        }
+    }
+
+    return visitedCounter == districtsSize[k] - 1;
+}
+
+/*
+ * Moves the most profitable feasible edge of the specified districts to its
+ * district in the guiding districts.
+ *
+ * @param edgesDistrict        the district of each edge.
+ * @param guidingEdgesDistrict the district of each edge in the guiding solution.
+ * @param districtsDemand      the demand of each district.
+ * @param districtsSize        the number of edges of each district.
+ * @param value                the value of the districts.
+ *
+ * @return true if an edge was moved; false otherwise.
+ */
+bool PathRelinkingHeuristic::moveTowards(std::vector<unsigned int> & edgesDistrict,
+        const std::vector<unsigned int> & guidingEdgesDistrict,
+        std::vector<double> & districtsDemand,
+        std::vector<unsigned int> & districtsSize, double & value) {
+    unsigned int bestEId = 0;
+    double bestGain = -DBL_MAX;
+
+    this->candidates.clear();
+
+    /* ∀ e ∈ E : e ∈ E_{k} ∧ e ∈ E*_{j} ∧ k ≠ j */
+    for (unsigned int eId = 1; eId <= edgesDistrict.size(); eId++) {
+        unsigned int k = edgesDistrict[eId - 1];
+        unsigned int j = guidingEdgesDistrict[eId - 1];
+
+        if (k != j) {
+            double gain = this->instance.getC(eId, j) - this->instance.getC(eId, k);
+
+            this->candidates.push_back(std::make_pair(-gain, eId));
+        }
+    }
+
+    /* Only the most profitable edges are checked, ties broken by the smallest id */
+    std::sort(this->candidates.begin(), this->candidates.end());
+
+    for (unsigned int i = 0; i < this->candidates.size(); i++) {
+        unsigned int eId = this->candidates[i].second;
+
+        if (this->isFeasibleMove(edgesDistrict, districtsDemand, districtsSize, eId,
+                    guidingEdgesDistrict[eId - 1])) {
+            bestEId = eId;
+            bestGain = -this->candidates[i].first;
+            break;
+        }
+    }
+
+    if (bestEId == 0) {
+        return false;
+    }
+
+    unsigned int k = edgesDistrict[bestEId - 1];
+    unsigned int j = guidingEdgesDistrict[bestEId - 1];
+    double d = 2 * this->instance.getEdge(bestEId).w;
+
+    /* E_{k} ← E_{k} \ {e}; E_{j} ← E_{j} ∪ {e} */
+    edgesDistrict[bestEId - 1] = j;
+    districtsDemand[k] -= d;
+    districtsDemand[j] += d;
+    districtsSize[k]--;
+    districtsSize[j]++;
+    value += bestGain;
+
+    return true;
+}
+
+/*
+ * Explores the path between the specified solutions.
+ *
+ * @param solution      the new solution.
+ * @param eliteSolution the elite solution.
+ * @param direction     the direction of the path (FORWARD, BACKWARD or MIXED).
+ * @param timeLimit     the time limit.
+ *
+ * @return the best solution strictly inside the path, or an empty solution if
+ *         there is none.
+ */
+Solution PathRelinkingHeuristic::relinkSolutions(const Solution & solution,
+        const Solution & eliteSolution, unsigned int direction,
+        unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::vector<unsigned int> edgesDistrict[2];
+    std::vector<double> districtsDemand[2];
+    std::vector<unsigned int> districtsSize[2];
+    double value[2];
+    std::vector<unsigned int> bestEdgesDistrict;
+    double bestValue = -DBL_MAX;
+
+    if (direction == PathRelinkingHeuristic::BACKWARD) {
+        edgesDistrict[0] = eliteSolution.getEdgesDistrict();
+        edgesDistrict[1] = solution.getEdgesDistrict();
+        value[0] = eliteSolution.getValue();
+        value[1] = solution.getValue();
+    } else {
+        edgesDistrict[0] = solution.getEdgesDistrict();
+        edgesDistrict[1] = eliteSolution.getEdgesDistrict();
+        value[0] = solution.getValue();
+        value[1] = eliteSolution.getValue();
+    }
+
+    unsigned int distance = 0;
+
+    for (unsigned int s = 0; s < 2; s++) {
+        districtsDemand[s] = std::vector<double> (this->instance.getM(), 0.0);
+        districtsSize[s] = std::vector<unsigned int> (this->instance.getM(), 0);
+
+        for (unsigned int eId = 1; eId <= edgesDistrict[s].size(); eId++) {
+            unsigned int j = edgesDistrict[s][eId - 1];
+
+            districtsDemand[s][j] += 2 * this->instance.getEdge(eId).w;
+            districtsSize[s][j]++;
+        }
+    }
+
+    for (unsigned int eId = 1; eId <= edgesDistrict[0].size(); eId++) {
+        if (edgesDistrict[0][eId - 1] != edgesDistrict[1][eId - 1]) {
+            distance++;
+        }
+    }
+
+    /* The mixed path alternates between both ends; the others only move the first one */
+    for (unsigned int step = 0; distance > 1 &&
+            Heuristic::getElapsedTime(startTime) < timeLimit; step++) {
+        unsigned int s = (direction == PathRelinkingHeuristic::MIXED) ? step % 2 : 0;
+
+        if (!this->moveTowards(edgesDistrict[s], edgesDistrict[1 - s],
+                    districtsDemand[s], districtsSize[s], value[s])) {
+            if (direction != PathRelinkingHeuristic::MIXED ||
+                    !this->moveTowards(edgesDistrict[1 - s], edgesDistrict[s],
+                        districtsDemand[1 - s], districtsSize[1 - s], value[1 - s])) {
+                break;
+            }
+
+            s = 1 - s;
+        }
+
+        distance--;
+
+        if (value[s] > bestValue) {
+            bestValue = value[s];
+            bestEdgesDistrict = edgesDistrict[s];
+        }
+    }
+
+    if (bestEdgesDistrict.empty()) {
+        return Solution();
+    }
+
+    return Solution(this->instance, bestEdgesDistrict);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "../Heuristic.hpp"
+#include "../../../solution/Solution.hpp"
+#include <utility>
+
+/*
+ * The PathRelinkingHeuristic class represents a heuristic that explores the
+ * feasible solutions found in a path between two solutions for the CEDP.
+ */
+class PathRelinkingHeuristic : public Heuristic {
+    private:
+        /* The stamp of the last search that visited each edge. */
+        std::vector<unsigned int> visitedStamps;
+
+        /* The stamp of the last search. */
+        unsigned int visitedStamp;
+
+        /* The queue of the last search, kept to reuse its memory. */
+        std::vector<unsigned int> searchQueue;
+
+        /* The gain and id of each candidate edge of the last move. */
+        std::vector<std::pair<double, unsigned int> > candidates;
+
+        /*
+         * Verifies whether moving the specified edge to the specified district
+         * keeps the specified districts connected and balanced.
+         *
+         * @param edgesDistrict   the district of each edge.
+         * @param districtsDemand the demand of each district.
+         * @param districtsSize   the number of edges of each district.
+         * @param eId             the id of the edge to be moved.
+         * @param j               the district to which the edge is to be moved.
+         *
+         * @return true if the move keeps the districts feasible; false otherwise.
+         */
+        bool isFeasibleMove(const std::vector<unsigned int> & edgesDistrict, 
+                const std::vector<double> & districtsDemand, 
+                const std::vector<unsigned int> & districtsSize, 
+                unsigned int eId, unsigned int j);
+
+        /*
+         * Moves the most profitable feasible edge of the specified districts
+         * to its district in the guiding districts.
+         *
+         * @param edgesDistrict        the district of each edge.
+         * @param guidingEdgesDistrict the district of each edge in the guiding solution.
+         * @param districtsDemand      the demand of each district.
+         * @param districtsSize        the number of edges of each district.
+         * @param value                the value of the districts.
+         *
+         * @return true if an edge was moved; false otherwise.
+         */
+        bool moveTowards(std::vector<unsigned int> & edgesDistrict, 
+                const std::vector<unsigned int> & guidingEdgesDistrict, 
+                std::vector<double> & districtsDemand, 
+                std::vector<unsigned int> & districtsSize, double & value);
+
+    public:
+        /* Forward relinking constant: from the new solution to the elite one. */
+        static const unsigned int FORWARD;
+
+        /* Backward relinking constant: from the elite solution to the new one. */
+        static const unsigned int BACKWARD;
+
+        /* Mixed relinking constant: from both solutions towards each other. */
+        static const unsigned int MIXED;
+
+        /*
+         * Constructs a new path relinking heuristic.
+         *
+         * @param instance the new path relinking heuristic's instance.
+         * @param seed     the seed for the new path relinking heuristic's 
+         *                 pseudo-random numbers generator.
+         */
+        PathRelinkingHeuristic(const Instance & instance, unsigned int seed);
+
+        /*
+         * Constructs a new empty path relinking heuristic.
+         */
+        PathRelinkingHeuristic();
+
+        /*
+         * Explores the path between the specified solutions.
+         *
+         * @param solution      the new solution.
+         * @param eliteSolution the elite solution.
+         * @param direction     the direction of the path (FORWARD, BACKWARD or MIXED).
+         * @param timeLimit     the time limit.
+         *
+         * @return the best solution strictly inside the path, or an empty 
+         *         solution if there is none.
+         */
+        Solution relinkSolutions(const Solution & solution, 
+                const Solution & eliteSolution, unsigned int direction, 
+                unsigned int timeLimit);
+};
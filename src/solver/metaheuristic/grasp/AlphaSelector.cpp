@@ -0,0 +1,420 @@
+#include "AlphaSelector.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
+#include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <limits>
+
+/* Reactive policy constant: probabilities proportional to the mean values. */
+const unsigned int AlphaSelector::REACTIVE = 0;
+
+/* UCB1 policy constant: the value for α with the highest upper confidence bound. */
+const unsigned int AlphaSelector::UCB1 = 1;
+
+/* Thompson sampling policy constant: the value for α with the highest sampled mean. */
+const unsigned int AlphaSelector::THOMPSON = 2;
+
+/*
+ * Constructs a new selector.
+ *
+ * @param m      the number of values for α.
+ * @param policy the new selector's policy (REACTIVE, UCB1 or THOMPSON).
+ */
+AlphaSelector::AlphaSelector(unsigned int m, unsigned int policy) :
+    policy(policy), psi(m), p(m, 1.0/((double) m)),
+    primalBoundStatisticsPerAlpha(m), minimumPrimalBound(DBL_MAX),
+    maximumPrimalBound(-DBL_MAX) {
+    for (unsigned int i = 0; i < m; i++) {
+        this->psi[i] = ((double) (i + 1))/((double) m);
+    }
+
+    this->buildTree();
+}
+
+/*
+ * Constructs a new empty selector.
+ */
+AlphaSelector::AlphaSelector() : AlphaSelector::AlphaSelector(0,
+        AlphaSelector::REACTIVE) {}
+
+/*
+ * Rebuilds the Fenwick tree of the probabilities associated with each value
+ * for α.
+ */
+void AlphaSelector::buildTree() {
+    this->tree = std::vector<double> (this->p.size() + 1, 0.0);
+
+    for (unsigned int i = 1; i <= this->p.size(); i++) {
+        unsigned int j = i + (i & -i);
+
+        this->tree[i] += this->p[i - 1];
+
+        if (j <= this->p.size()) {
+            this->tree[j] += this->tree[i];
+        }
+    }
+}
+
+/*
+ * Randomly selects a value for α with its associated probability.
+ *
+ * @param generator the pseudo-random numbers generator.
+ *
+ * @return the index of the selected value for α.
+ */
+unsigned int AlphaSelector::sampleAlpha(std::mt19937 & generator) const {
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    double toss = distribution(generator);
+    unsigned int i = 0;
+    unsigned int step = 1;
+
+    while (2 * step <= this->p.size()) {
+        step *= 2;
+    }
+
+    /* The first value for α whose cumulative probability reaches the toss */
+    for (; step > 0; step /= 2) {
+        if (i + step <= this->p.size() && this->tree[i + step] < toss) {
+            i += step;
+            toss -= this->tree[i];
+        }
+    }
+
+    return std::min(i, (unsigned int) this->p.size() - 1);
+}
+
+/*
+ * Returns the index of a value for α that was never used, if any.
+ *
+ * @return the index of a value for α that was never used, or the number of
+ *         values for α if all of them were used.
+ */
+unsigned int AlphaSelector::getUnusedAlpha() const {
+    for (unsigned int i = 0; i < this->psi.size(); i++) {
+        if (this->primalBoundStatisticsPerAlpha[i].getSize() == 0) {
+            return i;
+        }
+    }
+
+    return this->psi.size();
+}
+
+/*
+ * Returns this selector's policy.
+ *
+ * @return this selector's policy.
+ */
+unsigned int AlphaSelector::getPolicy() const {
+    return this->policy;
+}
+
+/*
+ * Returns the number of values for α.
+ *
+ * @return the number of values for α.
+ */
+unsigned int AlphaSelector::size() const {
+    return this->psi.size();
+}
+
+/*
+ * Returns the i-th possible value for α.
+ *
+ * @param i the index of the desired value.
+ *
+ * @return the i-th possible value for α.
+ */
+double AlphaSelector::getAlpha(unsigned int i) const {
+    if (i < this->psi.size()) {
+        return this->psi[i];
+    }
+
+    return 0.0;
+}
+
+/*
+ * Returns the probability associated with the i-th possible value for α.
+ *
+ * @param i the index of the desired value.
+ *
+ * @return the probability associated with the i-th possible value for α.
+ */
+double AlphaSelector::getP(unsigned int i) const {
+    if (i < this->p.size()) {
+        return this->p[i];
+    }
+
+    return 0.0;
+}
+
+/*
+ * Returns the statistics of the solution's values found using the i-th
+ * possible value for α.
+ *
+ * @param i the index of the desired value.
+ *
+ * @return the statistics of the solution's values found using the i-th
+ *         possible value for α.
+ */
+const Statistics & AlphaSelector::getPrimalBoundStatistics(unsigned int i) const {
+    return this->primalBoundStatisticsPerAlpha[i];
+}
+
+/*
+ * Selects a value for α according to this selector's policy.
+ *
+ * @param generator the pseudo-random numbers generator.
+ *
+ * @return the index of the selected value for α.
+ */
+unsigned int AlphaSelector::chooseAlpha(std::mt19937 & generator) const {
+    if (this->policy == AlphaSelector::REACTIVE) {
+        return this->sampleAlpha(generator);
+    }
+
+    unsigned int bestI = this->getUnusedAlpha();
+
+    /* Every value for α is used once before trusting its statistics */
+    if (bestI < this->psi.size()) {
+        return bestI;
+    }
+
+    /* The values are scaled to [0, 1], as UCB1 expects bounded rewards */
+    double range = this->maximumPrimalBound - this->minimumPrimalBound;
+    double n = 0.0;
+    double bestScore = -DBL_MAX;
+
+    if (range <= 0.0) {
+        range = 1.0;
+    }
+
+    for (const Statistics & statistics : this->primalBoundStatisticsPerAlpha) {
+        n += statistics.getSize();
+    }
+
+    std::normal_distribution<double> distribution(0.0, 1.0);
+
+    for (unsigned int i = 0; i < this->psi.size(); i++) {
+        const Statistics & statistics = this->primalBoundStatisticsPerAlpha[i];
+        double mean = (statistics.getMean() - this->minimumPrimalBound) / range;
+        double score;
+
+        if (this->policy == AlphaSelector::UCB1) {
+            /* μ_{i} + √(2 ln(n) / n_{i}) */
+            score = mean + sqrt(2.0 * log(n) / statistics.getSize());
+        } else {
+            /* μ_{i} + σ_{i} / √(n_{i}) Z, with an optimistic σ_{i} while it is unknown */
+            double standardDeviation = statistics.getStandardDeviation() / range;
+
+            if (statistics.getSize() < 2) {
+                standardDeviation = 1.0;
+            }
+
+            score = mean + standardDeviation / sqrt(statistics.getSize()) *
+                distribution(generator);
+        }
+
+        if (score > bestScore) {
+            bestI = i;
+            bestScore = score;
+        }
+    }
+
+    return bestI;
+}
+
+/*
+ * Adds the value of a solution found using the i-th value for α.
+ *
+ * @param i           the index of the value for α.
+ * @param primalBound the solution's value.
+ */
+void AlphaSelector::addValue(unsigned int i, double primalBound) {
+    this->primalBoundStatisticsPerAlpha[i].addValue(primalBound);
+    this->minimumPrimalBound = std::min(this->minimumPrimalBound, primalBound);
+    this->maximumPrimalBound = std::max(this->maximumPrimalBound, primalBound);
+}
+
+/*
+ * Reevaluate the probabilities associated with each value for α. The reactive
+ * policy makes them proportional to the mean solution's values; the others
+ * report how often each value for α was used.
+ */
+void AlphaSelector::reevaluateProbabilities() {
+    std::vector<double> q (this->psi.size());
+    double sumQ = 0;
+
+    for (unsigned int j = 0; j < this->psi.size(); j++) {
+        if (this->policy == AlphaSelector::REACTIVE) {
+            q[j] = this->primalBoundStatisticsPerAlpha[j].getMean();
+        } else {
+            q[j] = this->primalBoundStatisticsPerAlpha[j].getSize();
+        }
+
+        sumQ += q[j];
+    }
+
+    if (sumQ <= 0.0) {
+        return;
+    }
+
+    for (unsigned int j = 0; j < this->psi.size(); j++) {
+        this->p[j] = q[j]/sumQ;
+    }
+
+    this->buildTree();
+}
+
+/*
+ * Adds the statistics of the specified selector into this selector's, as
+ * learned by another thread or run with the same values for α.
+ *
+ * @param alphaSelector the selector whose statistics are to be added.
+ */
+void AlphaSelector::merge(const AlphaSelector & alphaSelector) {
+    if (alphaSelector.size() != this->size()) {
+        throw "Invalid number of values for alpha.";
+    }
+
+    for (unsigned int i = 0; i < this->psi.size(); i++) {
+        this->primalBoundStatisticsPerAlpha[i].merge(
+                alphaSelector.primalBoundStatisticsPerAlpha[i]);
+    }
+
+    this->minimumPrimalBound = std::min(this->minimumPrimalBound,
+            alphaSelector.minimumPrimalBound);
+    this->maximumPrimalBound = std::max(this->maximumPrimalBound,
+            alphaSelector.maximumPrimalBound);
+}
+
+/*
+ * Reads statistics from the specified input stream and adds them into this
+ * selector's.
+ *
+ * @param is the input stream to read from.
+ */
+void AlphaSelector::read(std::istream & is) {
+    unsigned int m;
+    AlphaSelector alphaSelector;
+
+    is >> m;
+
+    alphaSelector = AlphaSelector(m, this->policy);
+
+    is >> alphaSelector.minimumPrimalBound >> alphaSelector.maximumPrimalBound;
+
+    for (unsigned int i = 0; i < m; i++) {
+        unsigned int size;
+        double alpha, mean, variance;
+
+        is >> alpha >> size >> mean >> variance;
+
+        alphaSelector.primalBoundStatisticsPerAlpha[i] = Statistics(size, mean, variance);
+    }
+
+    if (!is) {
+        throw "Invalid alpha distribution.";
+    }
+
+    this->merge(alphaSelector);
+}
+
+/*
+ * Reads statistics from the specified file and adds them into this selector's.
+ *
+ * @param filename the file to read from.
+ */
+void AlphaSelector::read(const std::string & filename) {
+    std::ifstream ifs;
+
+    ifs.open(filename);
+
+    if (!ifs.is_open()) {
+        throw "File not found.";
+    }
+
+    this->read(ifs);
+
+    ifs.close();
+}
+
+/*
+ * Write this selector's statistics into the specified output stream.
+ *
+ * @param os the output stream to write into.
+ */
+void AlphaSelector::write(std::ostream & os) const {
+    std::streamsize precision = os.precision(std::numeric_limits<double>::max_digits10);
+
+    os << this->psi.size() << std::endl;
+    os << this->minimumPrimalBound << " " << this->maximumPrimalBound << std::endl;
+
+    for (unsigned int i = 0; i < this->psi.size(); i++) {
+        const Statistics & statistics = this->primalBoundStatisticsPerAlpha[i];
+
+        os << this->psi[i] << " " << statistics.getSize() << " " <<
+            statistics.getMean() << " " << statistics.getVariance() << std::endl;
+    }
+
+    os.precision(precision);
+}
+
+/*
+ * Write this selector's statistics into the specified file.
+ *
+ * @param filename the file to write into.
+ */
+void AlphaSelector::write(const std::string & filename) const {
+    std::ofstream ofs;
+
+    ofs.open(filename);
+
+    if (!ofs.is_open()) {
+        throw "File not created.";
+    }
+
+    this->write(ofs);
+
+    ofs.close();
+}
+
+/*
+ * Writes this selector's state into the specified checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void AlphaSelector::writeCheckpoint(std::ostream & os) const {
+    Checkpoint::write(os, this->policy);
+    Checkpoint::write(os, this->p);
+    Checkpoint::write(os, this->minimumPrimalBound);
+    Checkpoint::write(os, this->maximumPrimalBound);
+
+    for (const Statistics & statistics : this->primalBoundStatisticsPerAlpha) {
+        Checkpoint::write(os, statistics);
+    }
+}
+
+/*
+ * Reads this selector's state from the specified checkpoint.
+ *
+ * @param is the input stream to read from.
+ */
+void AlphaSelector::readCheckpoint(std::istream & is) {
+    unsigned int policy = 0;
+    std::vector<double> p;
+
+    Checkpoint::read(is, policy);
+    Checkpoint::read(is, p);
+
+    *this = AlphaSelector(p.size(), policy);
+
+    this->p = p;
+    Checkpoint::read(is, this->minimumPrimalBound);
+    Checkpoint::read(is, this->maximumPrimalBound);
+
+    for (Statistics & statistics : this->primalBoundStatisticsPerAlpha) {
+        Checkpoint::read(is, statistics);
+    }
+
+    this->buildTree();
+}
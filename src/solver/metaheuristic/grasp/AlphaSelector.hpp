@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../../../statistics/Statistics.hpp"
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/*
+ * The AlphaSelector class represents a policy for choosing the value of the
+ * threshold parameter α of the GRASP from a finite set of values, learning
+ * from the values of the solutions found with each of them.
+ */
+class AlphaSelector {
+    private:
+        /* This selector's policy (REACTIVE, UCB1 or THOMPSON). */
+        unsigned int policy;
+
+        /* The set of possible values for α. */
+        std::vector<double> psi;
+
+        /* The probabilities associated with each value for α. */
+        std::vector<double> p;
+
+        /*
+         * The Fenwick tree of the probabilities associated with each value
+         * for α, indexed from 1.
+         */
+        std::vector<double> tree;
+
+        /* The statistics of the solution's values found using each value for α. */
+        std::vector<Statistics> primalBoundStatisticsPerAlpha;
+
+        /* The minimum solution's value found using any value for α. */
+        double minimumPrimalBound;
+
+        /* The maximum solution's value found using any value for α. */
+        double maximumPrimalBound;
+
+        /*
+         * Rebuilds the Fenwick tree of the probabilities associated with each
+         * value for α.
+         */
+        void buildTree();
+
+        /*
+         * Randomly selects a value for α with its associated probability.
+         *
+         * @param generator the pseudo-random numbers generator.
+         *
+         * @return the index of the selected value for α.
+         */
+        unsigned int sampleAlpha(std::mt19937 & generator) const;
+
+        /*
+         * Returns the index of a value for α that was never used, if any.
+         *
+         * @return the index of a value for α that was never used, or the
+         *         number of values for α if all of them were used.
+         */
+        unsigned int getUnusedAlpha() const;
+
+    public:
+        /* Reactive policy constant: probabilities proportional to the mean values. */
+        static const unsigned int REACTIVE;
+
+        /* UCB1 policy constant: the value for α with the highest upper confidence bound. */
+        static const unsigned int UCB1;
+
+        /* Thompson sampling policy constant: the value for α with the highest sampled mean. */
+        static const unsigned int THOMPSON;
+
+        /*
+         * Constructs a new selector.
+         *
+         * @param m      the number of values for α.
+         * @param policy the new selector's policy (REACTIVE, UCB1 or THOMPSON).
+         */
+        AlphaSelector(unsigned int m, unsigned int policy);
+
+        /*
+         * Constructs a new empty selector.
+         */
+        AlphaSelector();
+
+        /*
+         * Returns this selector's policy.
+         *
+         * @return this selector's policy.
+         */
+        unsigned int getPolicy() const;
+
+        /*
+         * Returns the number of values for α.
+         *
+         * @return the number of values for α.
+         */
+        unsigned int size() const;
+
+        /*
+         * Returns the i-th possible value for α.
+         *
+         * @param i the index of the desired value.
+         *
+         * @return the i-th possible value for α.
+         */
+        double getAlpha(unsigned int i) const;
+
+        /*
+         * Returns the probability associated with the i-th possible value for α.
+         *
+         * @param i the index of the desired value.
+         *
+         * @return the probability associated with the i-th possible value for α.
+         */
+        double getP(unsigned int i) const;
+
+        /*
+         * Returns the statistics of the solution's values found using the
+         * i-th possible value for α.
+         *
+         * @param i the index of the desired value.
+         *
+         * @return the statistics of the solution's values found using the
+         *         i-th possible value for α.
+         */
+        const Statistics & getPrimalBoundStatistics(unsigned int i) const;
+
+        /*
+         * Selects a value for α according to this selector's policy.
+         *
+         * @param generator the pseudo-random numbers generator.
+         *
+         * @return the index of the selected value for α.
+         */
+        unsigned int chooseAlpha(std::mt19937 & generator) const;
+
+        /*
+         * Adds the value of a solution found using the i-th value for α.
+         *
+         * @param i           the index of the value for α.
+         * @param primalBound the solution's value.
+         */
+        void addValue(unsigned int i, double primalBound);
+
+        /*
+         * Reevaluate the probabilities associated with each value for α. The
+         * reactive policy makes them proportional to the mean solution's
+         * values; the others report how often each value for α was used.
+         */
+        void reevaluateProbabilities();
+
+        /*
+         * Adds the statistics of the specified selector into this selector's,
+         * as learned by another thread or run with the same values for α.
+         *
+         * @param alphaSelector the selector whose statistics are to be added.
+         */
+        void merge(const AlphaSelector & alphaSelector);
+
+        /*
+         * Reads statistics from the specified input stream and adds them into
+         * this selector's.
+         *
+         * @param is the input stream to read from.
+         */
+        void read(std::istream & is);
+
+        /*
+         * Reads statistics from the specified file and adds them into this
+         * selector's.
+         *
+         * @param filename the file to read from.
+         */
+        void read(const std::string & filename);
+
+        /*
+         * Write this selector's statistics into the specified output stream.
+         *
+         * @param os the output stream to write into.
+         */
+        void write(std::ostream & os) const;
+
+        /*
+         * Write this selector's statistics into the specified file.
+         *
+         * @param filename the file to write into.
+         */
+        void write(const std::string & filename) const;
+
+        /*
+         * Writes this selector's state into the specified checkpoint.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeCheckpoint(std::ostream & os) const;
+
+        /*
+         * Reads this selector's state from the specified checkpoint.
+         *
+         * @param is the input stream to read from.
+         */
+        void readCheckpoint(std::istream & is);
+};
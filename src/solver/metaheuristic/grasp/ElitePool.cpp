@@ -0,0 +1,220 @@
+#include "ElitePool.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
+#include <algorithm>
+#include <climits>
+
+/*
+ * Constructs a new pool.
+ *
+ * @param capacity        the new pool's maximum number of solutions.
+ * @param minimumDistance the new pool's minimum distance between a new
+ *                        solution and its solutions.
+ */
+ElitePool::ElitePool(unsigned int capacity, unsigned int minimumDistance) 
+    : capacity(capacity), minimumDistance(minimumDistance) {}
+
+/*
+ * Constructs a new empty pool.
+ */
+ElitePool::ElitePool() : ElitePool::ElitePool(0, 0) {}
+
+/*
+ * Returns the number of edges allocated to different districts in the
+ * specified solutions.
+ *
+ * @param solution      the first solution.
+ * @param otherSolution the second solution.
+ *
+ * @return the number of edges allocated to different districts in the
+ *         specified solutions.
+ */
+unsigned int ElitePool::getDistance(const Solution & solution, 
+        const Solution & otherSolution) {
+    unsigned int distance = 0;
+
+    /* |{e ∈ E : e ∈ E_{j} ∧ e ∉ E'_{j}}| */
+    for (unsigned int eId = 1; eId <= solution.getInstance().getG().m(); eId++) {
+        if (solution.getEdgeDistrict(eId) != otherSolution.getEdgeDistrict(eId)) {
+            distance++;
+        }
+    }
+
+    return distance;
+}
+
+/*
+ * Returns this pool's maximum number of solutions.
+ *
+ * @return this pool's maximum number of solutions.
+ */
+unsigned int ElitePool::getCapacity() const {
+    return this->capacity;
+}
+
+/*
+ * Returns this pool's number of solutions.
+ *
+ * @return this pool's number of solutions.
+ */
+unsigned int ElitePool::size() const {
+    return this->solutions.size();
+}
+
+/*
+ * Verifies whether this pool is empty.
+ *
+ * @return true if this pool is empty; false otherwise.
+ */
+bool ElitePool::isEmpty() const {
+    return this->solutions.empty();
+}
+
+/*
+ * Returns this pool's i-th solution.
+ *
+ * @param i the index of the desired solution.
+ *
+ * @return this pool's i-th solution.
+ */
+const Solution & ElitePool::getSolution(unsigned int i) const {
+    return this->solutions[i];
+}
+
+/*
+ * Adds the specified solution to this pool if it is better than the worst
+ * solution of this pool and different enough from all of them, or if it is
+ * better than all of them. When the pool is full, the new solution replaces
+ * the most similar of the worse solutions.
+ *
+ * @param solution the solution to be added.
+ *
+ * @return true if the solution was added; false otherwise.
+ */
+bool ElitePool::addSolution(const Solution & solution) {
+    if (this->capacity == 0) {
+        return false;
+    }
+
+    double value = solution.getValue();
+    double bestValue = value;
+    double worstValue = value;
+    unsigned int closestDistance = UINT_MAX;
+    unsigned int replacedSolution = this->solutions.size();
+    unsigned int replacedDistance = UINT_MAX;
+
+    for (unsigned int i = 0; i < this->solutions.size(); i++) {
+        unsigned int distance = ElitePool::getDistance(solution, this->solutions[i]);
+
+        if (distance == 0) {
+            return false;
+        }
+
+        closestDistance = std::min(closestDistance, distance);
+        bestValue = std::max(bestValue, this->solutions[i].getValue());
+        worstValue = std::min(worstValue, this->solutions[i].getValue());
+
+        if (this->solutions[i].getValue() < value && distance < replacedDistance) {
+            replacedSolution = i;
+            replacedDistance = distance;
+        }
+    }
+
+    bool isBest = value > bestValue || this->solutions.empty();
+    bool isDiverse = closestDistance >= this->minimumDistance;
+
+    if (this->solutions.size() < this->capacity) {
+        if (isBest || isDiverse) {
+            this->solutions.push_back(solution);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    /* The pool is full: only replace a worse solution */
+    if (replacedSolution < this->solutions.size() && (isBest || 
+                (value > worstValue && isDiverse))) {
+        this->solutions[replacedSolution] = solution;
+
+        return true;
+    }
+
+    return false;
+}
+
+/*
+ * Randomly selects one of this pool's solutions, with probability
+ * proportional to its distance to the specified solution.
+ *
+ * @param solution  the reference solution.
+ * @param generator the pseudo-random numbers generator.
+ *
+ * @return the index of the selected solution, or the size of this pool if all
+ *         of its solutions are equal to the specified one.
+ */
+unsigned int ElitePool::chooseSolution(const Solution & solution, 
+        std::mt19937 & generator) const {
+    std::vector<double> distances (this->solutions.size());
+    double totalDistance = 0.0;
+
+    for (unsigned int i = 0; i < this->solutions.size(); i++) {
+        distances[i] = ElitePool::getDistance(solution, this->solutions[i]);
+        totalDistance += distances[i];
+    }
+
+    if (totalDistance == 0.0) {
+        return this->solutions.size();
+    }
+
+    std::uniform_real_distribution<double> distribution(0.0, totalDistance);
+    double toss = distribution(generator);
+    double cumulativeDistance = 0.0;
+
+    for (unsigned int i = 0; i < this->solutions.size(); i++) {
+        cumulativeDistance += distances[i];
+
+        if (distances[i] > 0.0 && toss < cumulativeDistance) {
+            return i;
+        }
+    }
+
+    for (unsigned int i = this->solutions.size(); i > 0; i--) {
+        if (distances[i - 1] > 0.0) {
+            return i - 1;
+        }
+    }
+
+    return this->solutions.size();
+}
+
+/*
+ * Writes this pool's state into the specified checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void ElitePool::writeCheckpoint(std::ostream & os) const {
+    Checkpoint::write(os, (unsigned int) this->solutions.size());
+
+    for (const Solution & solution : this->solutions) {
+        Checkpoint::write(os, solution);
+    }
+}
+
+/*
+ * Reads this pool's state from the specified checkpoint.
+ *
+ * @param is       the input stream to read from.
+ * @param instance the instance of the pool's solutions.
+ */
+void ElitePool::readCheckpoint(std::istream & is, const Instance & instance) {
+    unsigned int size = 0;
+
+    Checkpoint::read(is, size);
+
+    this->solutions.clear();
+
+    for (unsigned int i = 0; i < size && is; i++) {
+        this->solutions.push_back(Checkpoint::readSolution(is, instance));
+    }
+}
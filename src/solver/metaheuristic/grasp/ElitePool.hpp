@@ -0,0 +1,117 @@
+#pragma once
+
+#include "../../../solution/Solution.hpp"
+
+/*
+ * The ElitePool class represents a bounded set of high-quality and diverse
+ * solutions for the CEDP.
+ */
+class ElitePool {
+    private:
+        /* This pool's maximum number of solutions. */
+        unsigned int capacity;
+
+        /* This pool's minimum distance between a new solution and its solutions. */
+        unsigned int minimumDistance;
+
+        /* This pool's solutions. */
+        std::vector<Solution> solutions;
+
+    public:
+        /*
+         * Constructs a new pool.
+         *
+         * @param capacity        the new pool's maximum number of solutions.
+         * @param minimumDistance the new pool's minimum distance between a new
+         *                        solution and its solutions.
+         */
+        ElitePool(unsigned int capacity, unsigned int minimumDistance);
+
+        /*
+         * Constructs a new empty pool.
+         */
+        ElitePool();
+
+        /*
+         * Returns the number of edges allocated to different districts in the
+         * specified solutions.
+         *
+         * @param solution      the first solution.
+         * @param otherSolution the second solution.
+         *
+         * @return the number of edges allocated to different districts in the
+         *         specified solutions.
+         */
+        static unsigned int getDistance(const Solution & solution, 
+                const Solution & otherSolution);
+
+        /*
+         * Returns this pool's maximum number of solutions.
+         *
+         * @return this pool's maximum number of solutions.
+         */
+        unsigned int getCapacity() const;
+
+        /*
+         * Returns this pool's number of solutions.
+         *
+         * @return this pool's number of solutions.
+         */
+        unsigned int size() const;
+
+        /*
+         * Verifies whether this pool is empty.
+         *
+         * @return true if this pool is empty; false otherwise.
+         */
+        bool isEmpty() const;
+
+        /*
+         * Returns this pool's i-th solution.
+         *
+         * @param i the index of the desired solution.
+         *
+         * @return this pool's i-th solution.
+         */
+        const Solution & getSolution(unsigned int i) const;
+
+        /*
+         * Adds the specified solution to this pool if it is better than the
+         * worst solution of this pool and different enough from all of them,
+         * or if it is better than all of them. When the pool is full, the
+         * new solution replaces the most similar of the worse solutions.
+         *
+         * @param solution the solution to be added.
+         *
+         * @return true if the solution was added; false otherwise.
+         */
+        bool addSolution(const Solution & solution);
+
+        /*
+         * Randomly selects one of this pool's solutions, with probability
+         * proportional to its distance to the specified solution.
+         *
+         * @param solution  the reference solution.
+         * @param generator the pseudo-random numbers generator.
+         *
+         * @return the index of the selected solution, or the size of this pool
+         *         if all of its solutions are equal to the specified one.
+         */
+        unsigned int chooseSolution(const Solution & solution, 
+                std::mt19937 & generator) const;
+
+        /*
+         * Writes this pool's state into the specified checkpoint.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeCheckpoint(std::ostream & os) const;
+
+        /*
+         * Reads this pool's state from the specified checkpoint.
+         *
+         * @param is       the input stream to read from.
+         * @param instance the instance of the pool's solutions.
+         */
+        void readCheckpoint(std::istream & is, const Instance & instance);
+};
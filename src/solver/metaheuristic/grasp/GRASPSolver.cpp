@@ -1,5 +1,10 @@
 #include "GRASPSolver.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
 #include <fstream>
+#include <sstream>
+#include <utility>
+
+const std::size_t GRASPSolver::ARENA_SIZE = 1 << 16;
 
 /*
  * Constructs a new solver.
@@ -21,14 +26,104 @@ GRASPSolver::GRASPSolver(const Instance & instance,
                          unsigned int m,
                          unsigned int k,
                          bool statisticalFilter)
+    : GRASPSolver::GRASPSolver(instance, timeLimit, seed, m, k,
+            statisticalFilter, 0, PathRelinkingHeuristic::MIXED, 0) {}
+
+/*
+ * Constructs a new solver with path relinking and a cache of local search
+ * results.
+ *
+ * @param instance          the new solver's instance.
+ * @param timeLimit         the new solver's time limit.
+ * @param seed              the seed for the new solver's pseudo-random
+ *                          numbers generator.
+ * @param m                 the number of values for the new solver's
+ *                          threshold parameter.
+ * @param k                 the number of iterations between each update in
+ *                          the new solver's threshold parameter probabilities.
+ * @param statisticalFilter the flag indicating whether to filter
+ *                          semi-greedy solutions from local search.
+ * @param elitePoolSize     the maximum number of solutions in the new
+ *                          solver's elite pool; zero disables path relinking.
+ * @param pathRelinking     the direction of the new solver's path relinking
+ *                          (FORWARD, BACKWARD or MIXED).
+ * @param cacheSize         the maximum number of entries in the new solver's
+ *                          cache of local search results; zero disables the
+ *                          cache.
+ */
+GRASPSolver::GRASPSolver(const Instance & instance,
+                         unsigned int timeLimit,
+                         unsigned int seed,
+                         unsigned int m,
+                         unsigned int k,
+                         bool statisticalFilter,
+                         unsigned int elitePoolSize,
+                         unsigned int pathRelinking,
+                         unsigned int cacheSize)
+    : GRASPSolver::GRASPSolver(instance, timeLimit, seed, m, k,
+            statisticalFilter, elitePoolSize, pathRelinking, cacheSize,
+            AlphaSelector::REACTIVE) {}
+
+/*
+ * Constructs a new solver with path relinking, a cache of local search results
+ * and a policy for choosing its threshold parameter.
+ *
+ * @param instance          the new solver's instance.
+ * @param timeLimit         the new solver's time limit.
+ * @param seed              the seed for the new solver's pseudo-random
+ *                          numbers generator.
+ * @param m                 the number of values for the new solver's
+ *                          threshold parameter.
+ * @param k                 the number of iterations between each update in
+ *                          the new solver's threshold parameter probabilities.
+ * @param statisticalFilter the flag indicating whether to filter
+ *                          semi-greedy solutions from local search.
+ * @param elitePoolSize     the maximum number of solutions in the new
+ *                          solver's elite pool; zero disables path relinking.
+ * @param pathRelinking     the direction of the new solver's path relinking
+ *                          (FORWARD, BACKWARD or MIXED).
+ * @param cacheSize         the maximum number of entries in the new solver's
+ *                          cache of local search results; zero disables the
+ *                          cache.
+ * @param alphaPolicy       the policy for choosing the new solver's threshold
+ *                          parameter (REACTIVE, UCB1 or THOMPSON).
+ */
+GRASPSolver::GRASPSolver(const Instance & instance,
+                         unsigned int timeLimit,
+                         unsigned int seed,
+                         unsigned int m,
+                         unsigned int k,
+                         bool statisticalFilter,
+                         unsigned int elitePoolSize,
+                         unsigned int pathRelinking,
+                         unsigned int cacheSize,
+                         unsigned int alphaPolicy)
     : CEDPSolver::CEDPSolver(instance, timeLimit, seed),
-      gcHeuristic(instance, seed), lsHeuristic(instance, seed), m(m), k(k),
-      statisticalFilter(statisticalFilter) {}
+      gcHeuristic(instance, seed), rgHeuristic(instance, seed),
+      lsHeuristic(instance, seed), prHeuristic(instance, seed), m(m), k(k),
+      statisticalFilter(statisticalFilter), elitePoolSize(elitePoolSize),
+      pathRelinking(pathRelinking), cacheSize(cacheSize),
+      alphaPolicy(alphaPolicy), initialAlphaSelector(m, alphaPolicy),
+      lagrangianBound(false), lagrangianIterationsCounter(0),
+      flowRebalancing(false), regionGrowing(false), incumbentChannel(0),
+      incumbentVersion(0), importedSolutionsCounter(0), lnsIterations(0),
+      lnsIteration(0), lnsCounter(0), lnsImprovementsCounter(0),
+      checkpointInterval(60), isResumed(false), resumedTime(0),
+      iterationsLimit(0), arenaSize(ARENA_SIZE),
+      arenaUpstreamAllocationsCounter(0), arenaLastOverflowIteration(0),
+      allocationsCounter(0) {}
 
 /*
  * Constructs a new empty solver.
  */
-GRASPSolver::GRASPSolver() : CEDPSolver::CEDPSolver() {}
+GRASPSolver::GRASPSolver() : CEDPSolver::CEDPSolver(), elitePoolSize(0), 
+    cacheSize(0), alphaPolicy(AlphaSelector::REACTIVE), lagrangianBound(false),
+    lagrangianIterationsCounter(0), flowRebalancing(false), regionGrowing(false),
+    incumbentChannel(0), incumbentVersion(0), importedSolutionsCounter(0),
+    lnsIterations(0), lnsIteration(0), lnsCounter(0), lnsImprovementsCounter(0),
+    checkpointInterval(60), isResumed(false), resumedTime(0), iterationsLimit(0),
+    arenaSize(ARENA_SIZE), arenaUpstreamAllocationsCounter(0),
+    arenaLastOverflowIteration(0), allocationsCounter(0) {}
 
 
 /*
@@ -59,6 +154,412 @@ bool GRASPSolver::getStatisticalFilter() const {
     return this->statisticalFilter;
 }
 
+/*
+ * Returns the policy for choosing this solver's threshold parameter.
+ *
+ * @return the policy for choosing this solver's threshold parameter.
+ */
+unsigned int GRASPSolver::getAlphaPolicy() const {
+    return this->alphaPolicy;
+}
+
+/*
+ * Returns the selector of this solver's threshold parameter.
+ *
+ * @return the selector of this solver's threshold parameter.
+ */
+const AlphaSelector & GRASPSolver::getAlphaSelector() const {
+    return this->alphaSelector;
+}
+
+/*
+ * Reads the statistics learned by a previous run from the specified file, to
+ * warm-start the selector of this solver's threshold parameter in the next
+ * calls to solve.
+ *
+ * @param filename the file to read from.
+ */
+void GRASPSolver::importAlphaDistribution(const std::string & filename) {
+    this->initialAlphaSelector.read(filename);
+}
+
+/*
+ * Writes the statistics learned by the selector of this solver's threshold
+ * parameter into the specified file.
+ *
+ * @param filename the file to write into.
+ */
+void GRASPSolver::exportAlphaDistribution(const std::string & filename) const {
+    this->alphaSelector.write(filename);
+}
+
+/*
+ * Sets the flag indicating whether to compute a Lagrangian dual bound in
+ * background, so that this solver stops once it is met.
+ *
+ * @param lagrangianBound the new flag.
+ */
+void GRASPSolver::setLagrangianBound(bool lagrangianBound) {
+    this->lagrangianBound = lagrangianBound;
+}
+
+/*
+ * Returns the flag indicating whether to compute a Lagrangian dual bound in
+ * background.
+ *
+ * @return true if the Lagrangian dual bound is computed; false otherwise.
+ */
+bool GRASPSolver::getLagrangianBound() const {
+    return this->lagrangianBound;
+}
+
+/*
+ * Sets the flag indicating whether this solver's fixer rebalances the
+ * connected partitions by a minimum cost flow.
+ *
+ * @param flowRebalancing the new flag.
+ */
+void GRASPSolver::setFlowRebalancing(bool flowRebalancing) {
+    this->flowRebalancing = flowRebalancing;
+}
+
+/*
+ * Returns the flag indicating whether this solver's fixer rebalances the
+ * connected partitions by a minimum cost flow.
+ *
+ * @return true if the flow rebalancing is enabled; false otherwise.
+ */
+bool GRASPSolver::getFlowRebalancing() const {
+    return this->flowRebalancing;
+}
+
+/*
+ * Sets the flag indicating whether this solver constructs its solutions by
+ * region growing instead of the greedy constructive heuristic.
+ *
+ * @param regionGrowing the new flag.
+ */
+void GRASPSolver::setRegionGrowing(bool regionGrowing) {
+    this->regionGrowing = regionGrowing;
+}
+
+/*
+ * Returns the flag indicating whether this solver constructs its solutions by
+ * region growing.
+ *
+ * @return true if the region growing is enabled; false otherwise.
+ */
+bool GRASPSolver::getRegionGrowing() const {
+    return this->regionGrowing;
+}
+
+/*
+ * Sets the rule by which this solver's region growing spreads the seeds.
+ *
+ * @param seeding the new rule for spreading the seeds.
+ */
+void GRASPSolver::setRegionGrowingSeeding(unsigned int seeding) {
+    this->rgHeuristic.setSeeding(seeding);
+}
+
+/*
+ * Returns the rule by which this solver's region growing spreads the seeds.
+ *
+ * @return the rule for spreading the seeds.
+ */
+unsigned int GRASPSolver::getRegionGrowingSeeding() const {
+    return this->rgHeuristic.getSeeding();
+}
+
+/*
+ * Makes this solver share its incumbent through the specified channel and stop
+ * once the channel is closed.
+ *
+ * @param incumbentChannel the channel; null if this solver runs alone.
+ */
+void GRASPSolver::setIncumbentChannel(IncumbentChannel * incumbentChannel) {
+    this->incumbentChannel = incumbentChannel;
+}
+
+/*
+ * Returns the number of incumbents of concurrent solvers used as restart
+ * points.
+ *
+ * @return the number of incumbents of concurrent solvers used as restart
+ *         points.
+ */
+unsigned int GRASPSolver::getImportedSolutionsCounter() const {
+    return this->importedSolutionsCounter;
+}
+
+/*
+ * Sets the flag indicating whether this solver's local search descends through
+ * the swap, chain and shift neighbourhoods once no single edge move improves
+ * the solution.
+ *
+ * @param vnd the new flag.
+ */
+void GRASPSolver::setVND(bool vnd) {
+    this->lsHeuristic.setVND(vnd);
+}
+
+/*
+ * Returns the flag indicating whether this solver's local search descends
+ * through the swap, chain and shift neighbourhoods.
+ *
+ * @return true if the variable neighbourhood descent is enabled; false
+ *         otherwise.
+ */
+bool GRASPSolver::getVND() const {
+    return this->lsHeuristic.getVND();
+}
+
+/*
+ * Sets the move selection strategy of this solver's local search.
+ *
+ * @param strategy         the new strategy.
+ * @param candidatesNumber the number of best moves a move is randomly chosen
+ *                         from by the candidate list strategy.
+ */
+void GRASPSolver::setLocalSearchStrategy(unsigned int strategy,
+        unsigned int candidatesNumber) {
+    this->lsHeuristic.setStrategy(strategy, candidatesNumber);
+}
+
+/*
+ * Returns the move selection strategy of this solver's local search.
+ *
+ * @return the move selection strategy of this solver's local search.
+ */
+unsigned int GRASPSolver::getLocalSearchStrategy() const {
+    return this->lsHeuristic.getStrategy();
+}
+
+/*
+ * Sets the number of threads evaluating the moves of non-adjacent districts
+ * concurrently in this solver's local search.
+ *
+ * @param threadsNumber the new number of threads.
+ */
+void GRASPSolver::setLocalSearchThreadsNumber(unsigned int threadsNumber) {
+    this->lsHeuristic.setThreadsNumber(threadsNumber);
+}
+
+/*
+ * Returns the number of threads evaluating the moves of non-adjacent districts
+ * concurrently in this solver's local search.
+ *
+ * @return the number of threads of this solver's local search.
+ */
+unsigned int GRASPSolver::getLocalSearchThreadsNumber() const {
+    return this->lsHeuristic.getThreadsNumber();
+}
+
+/*
+ * Makes this solver reoptimize its best solution by large neighbourhood search
+ * whenever it stalls.
+ *
+ * @param iterations    the number of iterations without improving the best
+ *                      solution after which the search runs; zero disables it.
+ * @param threadsNumber the number of threads solving the search's subproblems.
+ */
+void GRASPSolver::setLNS(unsigned int iterations, unsigned int threadsNumber) {
+    this->lnsIterations = iterations;
+    this->lnsHeuristic = LNSHeuristic(this->instance, this->seed, 3, 10, 12,
+            threadsNumber);
+}
+
+/*
+ * Returns this solver's counter of large neighbourhood searches.
+ *
+ * @return this solver's counter of large neighbourhood searches.
+ */
+unsigned int GRASPSolver::getLNSCounter() const {
+    return this->lnsCounter;
+}
+
+/*
+ * Returns this solver's counter of large neighbourhood searches that improved
+ * the best solution.
+ *
+ * @return this solver's counter of large neighbourhood searches that improved
+ *         the best solution.
+ */
+unsigned int GRASPSolver::getLNSImprovementsCounter() const {
+    return this->lnsImprovementsCounter;
+}
+
+/*
+ * Makes this solver write its state into the specified file every specified
+ * number of seconds while solving, and once it finishes.
+ *
+ * @param filename the file to write into; an empty name disables checkpoints.
+ * @param interval the time in seconds between each checkpoint.
+ */
+void GRASPSolver::setCheckpoint(const std::string & filename, unsigned int interval) {
+    this->checkpointFilename = filename;
+    this->checkpointInterval = interval;
+}
+
+/*
+ * Reads this solver's state from the specified file, so that the next call to
+ * solve continues the interrupted run.
+ *
+ * @param filename the file to read from.
+ */
+void GRASPSolver::resume(const std::string & filename) {
+    std::ifstream ifs (filename, std::ios::binary);
+
+    if (!ifs.is_open()) {
+        throw "File not found.";
+    }
+
+    this->readCheckpoint(ifs);
+
+    ifs.close();
+}
+
+/*
+ * Writes this solver's state into the specified output stream, in the format
+ * of a checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void GRASPSolver::writeCheckpoint(std::ostream & os) const {
+    unsigned long long elapsedTime = this->resumedTime;
+
+    if (!this->isResumed) {
+        elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds> (
+                std::chrono::steady_clock::now() - this->startTime).count();
+    }
+
+    Checkpoint::writeHeader(os, Checkpoint::GRASP, this->instance);
+    Checkpoint::write(os, elapsedTime);
+    Checkpoint::write(os, this->generator);
+    Checkpoint::write(os, this->gcHeuristic.getGenerator());
+    Checkpoint::write(os, this->rgHeuristic.getGenerator());
+    Checkpoint::write(os, this->lsHeuristic.getGenerator());
+    Checkpoint::write(os, this->prHeuristic.getGenerator());
+    Checkpoint::write(os, this->lnsHeuristic.getGenerator());
+    Checkpoint::write(os, this->solutionsCounter);
+    Checkpoint::write(os, this->bestPrimalBound);
+    Checkpoint::write(os, this->bestDualBound);
+    Checkpoint::write(os, this->bestPrimalSolution);
+    this->alphaSelector.writeCheckpoint(os);
+    Checkpoint::write(os, this->ratioStatistics);
+    Checkpoint::write(os, this->iterationsCounter);
+    Checkpoint::write(os, this->firstSolutionIteration);
+    Checkpoint::write(os, this->firstSolutionTime);
+    Checkpoint::write(os, this->bestSolutionIteration);
+    Checkpoint::write(os, this->bestSolutionTime);
+    Checkpoint::write(os, this->notPartitionSolutionsCounter);
+    Checkpoint::write(os, this->notConnectedSolutionsCounter);
+    Checkpoint::write(os, this->notRespectsCapacitySolutionsCounter);
+    Checkpoint::write(os, this->notBalancedSolutionsCounter);
+    Checkpoint::write(os, this->notFeasibleSolutionsCounter);
+    Checkpoint::write(os, this->fixedSolutionsCounter);
+    Checkpoint::write(os, this->localSearchCounter);
+    Checkpoint::write(os, this->pathRelinkingCounter);
+    Checkpoint::write(os, this->pathRelinkingImprovementsCounter);
+    Checkpoint::write(os, this->lnsIteration);
+    Checkpoint::write(os, this->lnsCounter);
+    Checkpoint::write(os, this->lnsImprovementsCounter);
+    this->elitePool.writeCheckpoint(os);
+    this->solutionCache.writeCheckpoint(os);
+}
+
+/*
+ * Reads this solver's state from the specified checkpoint, so that the next
+ * call to solve continues the interrupted run.
+ *
+ * @param is the input stream to read from.
+ */
+void GRASPSolver::readCheckpoint(std::istream & is) {
+    if (Checkpoint::readHeader(is, this->instance) != Checkpoint::GRASP) {
+        throw "Invalid checkpoint.";
+    }
+
+    std::mt19937 generator;
+
+    Checkpoint::read(is, this->resumedTime);
+    Checkpoint::read(is, this->generator);
+    Checkpoint::read(is, generator);
+    this->gcHeuristic.setGenerator(generator);
+    Checkpoint::read(is, generator);
+    this->rgHeuristic.setGenerator(generator);
+    Checkpoint::read(is, generator);
+    this->lsHeuristic.setGenerator(generator);
+    Checkpoint::read(is, generator);
+    this->prHeuristic.setGenerator(generator);
+    Checkpoint::read(is, generator);
+    this->lnsHeuristic.setGenerator(generator);
+    Checkpoint::read(is, this->solutionsCounter);
+    Checkpoint::read(is, this->bestPrimalBound);
+    Checkpoint::read(is, this->bestDualBound);
+    this->bestPrimalSolution = Checkpoint::readSolution(is, this->instance);
+    this->alphaSelector.readCheckpoint(is);
+    Checkpoint::read(is, this->ratioStatistics);
+    Checkpoint::read(is, this->iterationsCounter);
+    Checkpoint::read(is, this->firstSolutionIteration);
+    Checkpoint::read(is, this->firstSolutionTime);
+    Checkpoint::read(is, this->bestSolutionIteration);
+    Checkpoint::read(is, this->bestSolutionTime);
+    Checkpoint::read(is, this->notPartitionSolutionsCounter);
+    Checkpoint::read(is, this->notConnectedSolutionsCounter);
+    Checkpoint::read(is, this->notRespectsCapacitySolutionsCounter);
+    Checkpoint::read(is, this->notBalancedSolutionsCounter);
+    Checkpoint::read(is, this->notFeasibleSolutionsCounter);
+    Checkpoint::read(is, this->fixedSolutionsCounter);
+    Checkpoint::read(is, this->localSearchCounter);
+    Checkpoint::read(is, this->pathRelinkingCounter);
+    Checkpoint::read(is, this->pathRelinkingImprovementsCounter);
+    Checkpoint::read(is, this->lnsIteration);
+    Checkpoint::read(is, this->lnsCounter);
+    Checkpoint::read(is, this->lnsImprovementsCounter);
+    this->elitePool = ElitePool(this->elitePoolSize,
+            (unsigned int) ceil(0.1 * this->instance.getG().m()));
+    this->elitePool.readCheckpoint(is, this->instance);
+    this->solutionCache = SolutionCache(this->cacheSize);
+    this->solutionCache.readCheckpoint(is);
+
+    if (!is || this->alphaSelector.size() != this->m) {
+        throw "Invalid checkpoint.";
+    }
+
+    this->isResumed = true;
+}
+
+/*
+ * Makes this solver stop after the specified number of iterations, besides the
+ * time limit, so that two runs of it take the same path.
+ *
+ * @param iterationsLimit the number of iterations; zero disables the limit.
+ */
+void GRASPSolver::setIterationsLimit(unsigned int iterationsLimit) {
+    this->iterationsLimit = iterationsLimit;
+}
+
+/*
+ * Returns the number of iterations after which this solver stops.
+ *
+ * @return the number of iterations; zero if there is no limit.
+ */
+unsigned int GRASPSolver::getIterationsLimit() const {
+    return this->iterationsLimit;
+}
+
+/*
+ * Instruments this solver's iterations with the specified function, which
+ * returns the number of heap allocations made so far by the calling thread,
+ * such as HeapCounter::getAllocationsCounter. The arena and heap allocations
+ * lines are written only when instrumented.
+ *
+ * @param allocationsCounter the function; 0 disables the instrumentation.
+ */
+void GRASPSolver::setAllocationsCounter(unsigned long long (*allocationsCounter)()) {
+    this->allocationsCounter = allocationsCounter;
+}
+
 /*
  * Returns the i-th possible value for alpha.
  *
@@ -67,11 +568,7 @@ bool GRASPSolver::getStatisticalFilter() const {
  * @return the i-th possible value for alpha.
  */
 double GRASPSolver::getAlpha(unsigned int i) const {
-    if (i < this->psi.size()) {
-        return this->psi[i];
-    }
-
-    return 0.0;
+    return this->alphaSelector.getAlpha(i);
 }
 
 /*
@@ -82,11 +579,7 @@ double GRASPSolver::getAlpha(unsigned int i) const {
  * @return the probability associated with the i-th possible value for alpha.
  */
 double GRASPSolver::getP(unsigned int i) const {
-    if (i < this->p.size()) {
-        return this->p[i];
-    }
-
-    return 0.0;
+    return this->alphaSelector.getP(i);
 }
 
 /*
@@ -99,8 +592,8 @@ double GRASPSolver::getP(unsigned int i) const {
  *         possible value for alpha.
  */
 Statistics GRASPSolver::getPrimalBoundStatictics(unsigned int i) const {
-    if (i < this->primalBoundStatisticsPerAlpha.size()) {
-        return this->primalBoundStatisticsPerAlpha[i];
+    if (i < this->alphaSelector.size()) {
+        return this->alphaSelector.getPrimalBoundStatistics(i);
     }
 
     return Statistics();
@@ -224,73 +717,306 @@ unsigned int GRASPSolver::getLocalSearchCounter() const {
 }
 
 /*
- * Randomly selects a value for α.
+ * Returns this solver's counter of path relinking.
+ *
+ * @return this solver's counter of path relinking.
+ */
+unsigned int GRASPSolver::getPathRelinkingCounter() const {
+    return this->pathRelinkingCounter;
+}
+
+/*
+ * Returns this solver's counter of path relinking that improved the best solution.
+ *
+ * @return this solver's counter of path relinking that improved the best solution.
+ */
+unsigned int GRASPSolver::getPathRelinkingImprovementsCounter() const {
+    return this->pathRelinkingImprovementsCounter;
+}
+
+/*
+ * Returns this solver's counter of allocations from the global heap made by
+ * the arena for each iteration's temporaries.
+ *
+ * @return this solver's counter of allocations from the global heap made by
+ *         the arena.
+ */
+unsigned long long GRASPSolver::getArenaUpstreamAllocationsCounter() const {
+    return this->arenaUpstreamAllocationsCounter;
+}
+
+/*
+ * Returns the last iteration whose temporaries did not fit in this solver's
+ * arena; zero if all iterations fit.
  *
- * @return the index of the selected value for α.
+ * @return the last iteration whose temporaries did not fit in the arena.
+ */
+unsigned int GRASPSolver::getArenaLastOverflowIteration() const {
+    return this->arenaLastOverflowIteration;
+}
+
+/*
+ * Returns the statistics of the number of heap allocations made by this
+ * solver's thread in each instrumented iteration.
+ *
+ * @return the statistics of the heap allocations in each iteration.
+ */
+const Statistics & GRASPSolver::getHeapAllocationsStatistics() const {
+    return this->heapAllocationsStatistics;
+}
+
+/*
+ * Returns this solver's counter of lookups in its cache of local search results.
+ *
+ * @return this solver's counter of lookups in its cache of local search results.
+ */
+unsigned int GRASPSolver::getCacheLookupsCounter() const {
+    return this->solutionCache.getLookupsCounter();
+}
+
+/*
+ * Returns this solver's counter of local searches skipped by its cache.
+ *
+ * @return this solver's counter of local searches skipped by its cache.
+ */
+unsigned int GRASPSolver::getCacheHitsCounter() const {
+    return this->solutionCache.getHitsCounter();
+}
+
+/*
+ * Relinks the specified local optimum with an elite solution, improves the
+ * best solution in the path and updates the elite pool.
+ *
+ * @param solution the local optimum.
+ */
+void GRASPSolver::relinkSolution(const Solution & solution) {
+    /* ℰ* ← Choose-Elite-Solution(P, ℰ') */
+    unsigned int i = this->elitePool.chooseSolution(solution, this->generator);
+
+    if (i < this->elitePool.size()) {
+        unsigned int elapsedTime = this->getElapsedTime();
+        unsigned int remainingTime = 0;
+
+        if (this->timeLimit > elapsedTime) {
+            remainingTime = this->timeLimit - elapsedTime;
+        }
+
+        /* ℰ'' ← Path-Relinking(ℰ', ℰ*) */
+        Solution relinkedSolution = this->prHeuristic.relinkSolutions(solution,
+                this->elitePool.getSolution(i), this->pathRelinking, remainingTime);
+
+        this->pathRelinkingCounter++;
+
+        if (!relinkedSolution.isEmpty()) {
+            elapsedTime = this->getElapsedTime();
+            remainingTime = 0;
+
+            if (this->timeLimit > elapsedTime) {
+                remainingTime = this->timeLimit - elapsedTime;
+            }
+
+            /* ℰ'' ← Local-Search-Heuristic(m, D, B, G, d, c, ℰ'') */
+            relinkedSolution = this->lsHeuristic.improveSolution(
+                    std::move(relinkedSolution), remainingTime);
+
+            if (this->bestPrimalBound < relinkedSolution.getValue()) {
+                /* ℰ ← ℰ'' */
+                this->bestPrimalBound = relinkedSolution.getValue();
+                this->bestPrimalSolution = relinkedSolution;
+                this->bestSolutionIteration = this->iterationsCounter;
+                this->bestSolutionTime = this->getElapsedTime();
+                this->pathRelinkingImprovementsCounter++;
+            }
+
+            /* P ← Update-Elite-Pool(P, ℰ'') */
+            this->elitePool.addSolution(relinkedSolution);
+        }
+    }
+
+    /* P ← Update-Elite-Pool(P, ℰ') */
+    this->elitePool.addSolution(solution);
+}
+
+/*
+ * Reoptimizes the best solution by large neighbourhood search once it has not
+ * improved for the configured number of iterations.
  */
-unsigned int GRASPSolver::chooseAlpha() {
-    unsigned int i = 0;
+void GRASPSolver::searchLargeNeighbourhood() {
+    if (this->solutionsCounter == 0 || this->iterationsCounter <
+            std::max(this->bestSolutionIteration, this->lnsIteration) + this->lnsIterations) {
+        return;
+    }
 
-    std::uniform_real_distribution<double> distribution(0.0, 1.0);
-    double toss = distribution(this->generator);
-    double cumulativeProbability = 0;
+    unsigned int elapsedTime = this->getElapsedTime();
+    unsigned int remainingTime = 0;
 
-    do {
-        cumulativeProbability += this->p[i++];
-    } while(cumulativeProbability < toss);
+    if (this->timeLimit > elapsedTime) {
+        remainingTime = this->timeLimit - elapsedTime;
+    }
+
+    /* ℰ' ← Large-Neighbourhood-Search(m, D, B, G, d, c, ℰ) */
+    Solution solution = this->lnsHeuristic.improveSolution(this->bestPrimalSolution,
+            remainingTime);
+
+    this->lnsIteration = this->iterationsCounter;
+    this->lnsCounter++;
 
-    return --i;
+    if (this->bestPrimalBound < solution.getValue()) {
+        this->bestPrimalBound = solution.getValue();
+        this->bestPrimalSolution = solution;
+        this->bestSolutionIteration = this->iterationsCounter;
+        this->bestSolutionTime = this->getElapsedTime();
+        this->lnsImprovementsCounter++;
+
+        if (this->elitePoolSize > 0) {
+            this->elitePool.addSolution(solution);
+        }
+    }
 }
 
 /*
- * Reevaluate the probabilities associated with each value for α.
+ * Offers this solver's incumbent to the concurrent solvers and restarts the
+ * local search from theirs if it is better.
  */
-void GRASPSolver::reevalueateProbabilities() {
-    std::vector<double> q (this->m);
-    double sumQ = 0;
+void GRASPSolver::exchangeIncumbent() {
+    if (this->solutionsCounter > 0 &&
+            this->bestPrimalBound > this->incumbentChannel->getValue()) {
+        unsigned long long version = this->incumbentChannel->offer(this->bestPrimalSolution);
+
+        if (version > 0) {
+            this->incumbentVersion = version;
+        }
+    }
+
+    Solution solution;
+
+    if (this->incumbentChannel->getIsClosed() ||
+            !this->incumbentChannel->poll(this->incumbentVersion, solution) ||
+            solution.getValue() <= this->bestPrimalBound) {
+        return;
+    }
+
+    unsigned int elapsedTime = this->getElapsedTime();
+    unsigned int remainingTime = 0;
+
+    if (this->timeLimit > elapsedTime) {
+        remainingTime = this->timeLimit - elapsedTime;
+    }
+
+    this->bestPrimalBound = solution.getValue();
+    this->bestPrimalSolution = solution;
+    this->importedSolutionsCounter++;
 
-    for (unsigned int j = 0; j < this->m; j++) {
-        q[j] = this->primalBoundStatisticsPerAlpha[j].getMean() / 
-            this->bestPrimalBound;
-        sumQ += q[j];
+    /* The other solver's incumbent is a restart point for the local search */
+    solution = this->lsHeuristic.improveSolution(std::move(solution), remainingTime);
+    this->localSearchCounter++;
+
+    if (this->bestPrimalBound < solution.getValue()) {
+        this->bestPrimalBound = solution.getValue();
+        this->bestPrimalSolution = solution;
+        this->bestSolutionIteration = this->iterationsCounter;
+        this->bestSolutionTime = this->getElapsedTime();
     }
 
-    for (unsigned int j = 0; j < this->m; j++) {
-        this->p[j] = q[j]/sumQ;
+    if (this->elitePoolSize > 0) {
+        this->relinkSolution(solution);
     }
 }
 
+/*
+ * Writes this solver's state into a checkpoint handed to the specified writer,
+ * which writes it into the disk in background.
+ *
+ * @param checkpointWriter the checkpoint writer.
+ */
+void GRASPSolver::submitCheckpoint(CheckpointWriter & checkpointWriter) const {
+    std::stringstream ss;
+
+    this->writeCheckpoint(ss);
+    checkpointWriter.submit(ss.str());
+}
+
 /*
  * Solve this solver's instance.
  */
 void GRASPSolver::solve() {
     this->startTime = std::chrono::steady_clock::now();
 
-    this->psi = std::vector<double> (this->m);
-    this->p = std::vector<double> (this->m, 1.0/((double) this->m));
-    this->primalBoundStatisticsPerAlpha = std::vector<Statistics>(this->m);
+    if (this->isResumed) {
+        /* The interrupted run's time keeps counting towards the time limit */
+        this->startTime -= std::chrono::milliseconds(this->resumedTime);
+        this->isResumed = false;
+    } else {
+        this->alphaSelector = this->initialAlphaSelector;
+        this->alphaSelector.reevaluateProbabilities();
+
+        this->iterationsCounter = 1;
+        this->firstSolutionIteration = 0;
+        this->firstSolutionTime = 0;
+        this->bestSolutionIteration = 0;
+        this->bestSolutionTime = 0;
+        this->notPartitionSolutionsCounter = 0;
+        this->notConnectedSolutionsCounter = 0;
+        this->notRespectsCapacitySolutionsCounter = 0;
+        this->notBalancedSolutionsCounter = 0;
+        this->notFeasibleSolutionsCounter = 0;
+        this->fixedSolutionsCounter = 0;
+        this->localSearchCounter = 0;
+        this->pathRelinkingCounter = 0;
+        this->pathRelinkingImprovementsCounter = 0;
+        this->importedSolutionsCounter = 0;
+        this->incumbentVersion = 0;
+        this->lnsIteration = 0;
+        this->lnsCounter = 0;
+        this->lnsImprovementsCounter = 0;
+        this->elitePool = ElitePool(this->elitePoolSize,
+                (unsigned int) ceil(0.1 * this->instance.getG().m()));
+        this->solutionCache = SolutionCache(this->cacheSize);
+
+        this->ratioStatistics = Statistics();
+    }
 
-    this->firstSolutionIteration = 0;
-    this->firstSolutionTime = 0;
-    this->bestSolutionIteration = 0;
-    this->bestSolutionTime = 0;
-    this->notPartitionSolutionsCounter = 0;
-    this->notConnectedSolutionsCounter = 0;
-    this->notRespectsCapacitySolutionsCounter = 0;
-    this->notBalancedSolutionsCounter = 0;
-    this->notFeasibleSolutionsCounter = 0;
-    this->fixedSolutionsCounter = 0;
-    this->localSearchCounter = 0;
+    CheckpointWriter checkpointWriter (this->checkpointFilename);
+    unsigned int checkpointTime = this->getElapsedTime();
+    LagrangianRelaxation relaxation (this->instance);
+
+    if (this->lagrangianBound && this->getElapsedTime() < this->timeLimit) {
+        if (this->solutionsCounter > 0) {
+            relaxation.setPrimalBound(this->bestPrimalBound);
+        }
 
-    for (unsigned int i = 0; i < this->m; i++) {
-        this->psi[i] = ((double) (i + 1))/((double) this->m);
+        relaxation.start(this->timeLimit - this->getElapsedTime());
     }
 
-    this->ratioStatistics = Statistics();
+    /* The heuristics' temporaries live until the end of their iteration */
+    IterationArena arena (ARENA_SIZE);
+    unsigned int firstArenaIteration = this->iterationsCounter;
+
+    this->gcHeuristic.setMemoryResource(arena.getResource());
+    this->rgHeuristic.setMemoryResource(arena.getResource());
+    this->lsHeuristic.setMemoryResource(arena.getResource());
+    this->heapAllocationsStatistics = Statistics();
 
     /* while termination criteria are not met */
-    for (this->iterationsCounter = 1; !this->areTerminationCriteriaMet(); 
-            this->iterationsCounter++) {
+    for (; !this->areTerminationCriteriaMet() && !(this->incumbentChannel &&
+                this->incumbentChannel->getIsClosed()) && (this->iterationsLimit == 0 ||
+                this->iterationsCounter <= this->iterationsLimit); this->iterationsCounter++) {
+        arena.reset();
+
+        unsigned long long heapAllocationsCounter = this->allocationsCounter ?
+            this->allocationsCounter() : 0;
+
+        if (this->incumbentChannel) {
+            this->exchangeIncumbent();
+        }
+
+        /* The state between two iterations is enough to continue the run */
+        if (checkpointWriter.isEnabled() && 
+                this->getElapsedTime() >= checkpointTime + this->checkpointInterval) {
+            this->submitCheckpoint(checkpointWriter);
+            checkpointTime = this->getElapsedTime();
+        }
+
         unsigned int elapsedTime = this->getElapsedTime();
         unsigned int remainingTime = 0;
 
@@ -298,12 +1024,15 @@ void GRASPSolver::solve() {
             remainingTime = this->timeLimit - elapsedTime;
         }
 
-        unsigned int i = this->chooseAlpha();
+        unsigned int i = this->alphaSelector.chooseAlpha(this->generator);
 
-        this->gcHeuristic.setAlpha(this->psi[i]);
+        this->gcHeuristic.setAlpha(this->alphaSelector.getAlpha(i));
+        this->rgHeuristic.setAlpha(this->alphaSelector.getAlpha(i));
 
         /* ℰ' ← Constructive-Heuristic(m, D, B, G, d, c) */
-        Solution solution = this->gcHeuristic.constructSolution(remainingTime);
+        Solution solution = this->regionGrowing ?
+            this->rgHeuristic.constructSolution(remainingTime) :
+            this->gcHeuristic.constructSolution(remainingTime);
 
         bool isFeasible = true;
 
@@ -338,7 +1067,8 @@ void GRASPSolver::solve() {
             }
 
             /* ℰ' ← Fix-Solution(m, D, B, G, d, c, ℰ') */
-            solution = SolutionFixer::fixSolution(solution, remainingTime);
+            solution = SolutionFixer::fixSolution(std::move(solution), remainingTime,
+                    this->flowRebalancing, arena.getResource());
         }
 
         /* if ℰ' is a feasible solution */
@@ -350,29 +1080,46 @@ void GRASPSolver::solve() {
             }
 
             double primalBound = solution.getValue();
+            double cachedPrimalBound = 0.0;
+            bool isLocalOptimum = false;
+            bool isCached = false;
 
             if (!this->statisticalFilter || this->solutionsCounter <= k ||
                     primalBound >= (this->ratioStatistics.getMean() - 2.0 *
                         this->ratioStatistics.getStandardDeviation()) *
                     this->bestPrimalBound) {
-                elapsedTime = this->getElapsedTime();
-                remainingTime = 0;
+                unsigned long long hash = solution.getHash();
 
-                if (this->timeLimit > elapsedTime) {
-                    remainingTime = this->timeLimit - elapsedTime;
-                }
+                /* A repeated starting point leads to an already evaluated local optimum */
+                if (this->cacheSize > 0 && this->solutionCache.find(hash, 
+                            cachedPrimalBound)) {
+                    primalBound = cachedPrimalBound;
+                    isCached = true;
+                } else {
+                    elapsedTime = this->getElapsedTime();
+                    remainingTime = 0;
+
+                    if (this->timeLimit > elapsedTime) {
+                        remainingTime = this->timeLimit - elapsedTime;
+                    }
 
-                /* ℰ' ← Local-Search-Heuristic(m, D, B, G, d, c, ℰ') */
-                solution = this->lsHeuristic.improveSolution(solution, 
-                        remainingTime);
-                this->localSearchCounter++;
-                double newPrimalBound = solution.getValue();
+                    /* ℰ' ← Local-Search-Heuristic(m, D, B, G, d, c, ℰ') */
+                    solution = this->lsHeuristic.improveSolution(std::move(solution), 
+                            remainingTime);
+                    this->localSearchCounter++;
+                    double newPrimalBound = solution.getValue();
 
-                double ratio = primalBound / newPrimalBound;
+                    double ratio = primalBound / newPrimalBound;
 
-                this->ratioStatistics.addValue(ratio);
+                    this->ratioStatistics.addValue(ratio);
 
-                primalBound = newPrimalBound;
+                    primalBound = newPrimalBound;
+                    isLocalOptimum = true;
+
+                    if (this->cacheSize > 0) {
+                        this->solutionCache.insert(hash, primalBound);
+                    }
+                }
             }
 
             if (this->solutionsCounter == 1) {
@@ -385,7 +1132,7 @@ void GRASPSolver::solve() {
              * || ∑_{j = 1}^{m}{∑_{e ∈ E_{j}}{c_{e, j}}} 
              * < ∑_{j = 1}^{m}{∑_{e ∈ E'_{j}}{c_{e, j}}} 
              */
-            if (this->bestPrimalBound < primalBound) {
+            if (!isCached && this->bestPrimalBound < primalBound) {
                 /* ℰ ← ℰ' */
                 this->bestPrimalBound = primalBound;
                 this->bestPrimalSolution = solution;
@@ -393,16 +1140,67 @@ void GRASPSolver::solve() {
                 this->bestSolutionTime = this->getElapsedTime();
             }
 
-            this->primalBoundStatisticsPerAlpha[i].addValue(primalBound);
+            this->alphaSelector.addValue(i, primalBound);
+
+            if (this->elitePoolSize > 0 && isLocalOptimum) {
+                this->relinkSolution(solution);
+            }
         }
 
         if (this->solutionsCounter % this->k == 0 && 
                 this->solutionsCounter > 0) {
-            this->reevalueateProbabilities();
+            this->alphaSelector.reevaluateProbabilities();
+        }
+
+        if (this->lnsIterations > 0) {
+            this->searchLargeNeighbourhood();
         }
+
+        /* The relaxation's thread publishes its bound and learns the primal one */
+        if (this->lagrangianBound) {
+            if (this->solutionsCounter > 0) {
+                relaxation.setPrimalBound(this->bestPrimalBound);
+            }
+
+            this->bestDualBound = std::min(this->bestDualBound, relaxation.getBound());
+        }
+
+        if (this->allocationsCounter) {
+            this->heapAllocationsStatistics.addValue(
+                    this->allocationsCounter() - heapAllocationsCounter);
+        }
+    }
+
+    arena.reset();
+
+    this->gcHeuristic.setMemoryResource(std::pmr::get_default_resource());
+    this->rgHeuristic.setMemoryResource(std::pmr::get_default_resource());
+    this->lsHeuristic.setMemoryResource(std::pmr::get_default_resource());
+
+    this->arenaSize = arena.getSize();
+    this->arenaUpstreamAllocationsCounter = arena.getUpstreamAllocationsCounter();
+
+    /* The first reset ends no iteration */
+    if (arena.getOverflowsCounter() > 0) {
+        this->arenaLastOverflowIteration = firstArenaIteration +
+            arena.getLastOverflowReset() - 2;
+    }
+
+    if (this->incumbentChannel) {
+        this->exchangeIncumbent();
+    }
+
+    if (this->lagrangianBound) {
+        relaxation.stop();
+        this->bestDualBound = std::min(this->bestDualBound, relaxation.getBound());
+        this->lagrangianIterationsCounter = relaxation.getIterationsCounter();
     }
 
     this->solvingTime = this->getElapsedTime();
+
+    if (checkpointWriter.isEnabled()) {
+        this->submitCheckpoint(checkpointWriter);
+    }
 }
 
 /*
@@ -434,14 +1232,80 @@ void GRASPSolver::write(std::ostream & os) const {
     os << "Statistical filter: " << this->statisticalFilter << std::endl;
     os << "Psi: ";
     for(unsigned i = 0; i < this->m - 1; i++) {
-        os << this->psi[i] << " ";
+        os << this->alphaSelector.getAlpha(i) << " ";
     }
-    os << this->psi[this->m - 1] << std::endl;
+    os << this->alphaSelector.getAlpha(this->m - 1) << std::endl;
     os << "p: ";
     for(unsigned i = 0; i < this->m - 1; i++) {
-        os << this->p[i] << " ";
+        os << this->alphaSelector.getP(i) << " ";
+    }
+    os << this->alphaSelector.getP(this->m - 1) << std::endl;
+
+    if (this->elitePoolSize > 0) {
+        os << "Elite pool size: " << this->elitePoolSize << std::endl;
+        os << "Path relinking: " << this->pathRelinking << std::endl;
+        os << "Path relinking counter: " << this->pathRelinkingCounter << std::endl;
+        os << "Path relinking improvements: " << 
+            this->pathRelinkingImprovementsCounter << std::endl;
+    }
+
+    if (this->cacheSize > 0) {
+        os << "Cache size: " << this->cacheSize << std::endl;
+        os << "Cache lookups: " << this->solutionCache.getLookupsCounter() << std::endl;
+        os << "Cache hits: " << this->solutionCache.getHitsCounter() << std::endl;
+    }
+
+    if (this->alphaPolicy != AlphaSelector::REACTIVE) {
+        os << "Alpha policy: " << this->alphaPolicy << std::endl;
+    }
+
+    if (this->flowRebalancing) {
+        os << "Flow rebalancing: " << this->flowRebalancing << std::endl;
+    }
+
+    if (this->regionGrowing) {
+        os << "Region growing: " << this->rgHeuristic.getSeeding() << std::endl;
+    }
+
+    if (this->allocationsCounter) {
+        os << "Arena size: " << this->arenaSize << std::endl;
+        os << "Arena upstream refills: " << this->arenaUpstreamAllocationsCounter <<
+            std::endl;
+        os << "Arena last overflow iteration: " << this->arenaLastOverflowIteration <<
+            std::endl;
+        os << "Heap allocations per iteration mean: " <<
+            this->heapAllocationsStatistics.getMean() << std::endl;
+        os << "Heap allocations per iteration standard deviation: " <<
+            this->heapAllocationsStatistics.getStandardDeviation() << std::endl;
+    }
+
+    if (this->lsHeuristic.getVND()) {
+        os << "VND: " << this->lsHeuristic.getVND() << std::endl;
+    }
+
+    if (this->lsHeuristic.getStrategy() != LocalSearchHeuristic::FIRST_IMPROVEMENT) {
+        os << "LS strategy: " << this->lsHeuristic.getStrategy() << std::endl;
+        os << "LS candidates: " << this->lsHeuristic.getCandidatesNumber() << std::endl;
+    }
+
+    if (this->lsHeuristic.getThreadsNumber() > 1) {
+        os << "LS threads: " << this->lsHeuristic.getThreadsNumber() << std::endl;
+    }
+
+    if (this->lnsIterations > 0) {
+        os << "LNS iterations: " << this->lnsIterations << std::endl;
+        os << "LNS threads: " << this->lnsHeuristic.getThreadsNumber() << std::endl;
+        os << "LNS counter: " << this->lnsCounter << std::endl;
+        os << "LNS improvements: " << this->lnsImprovementsCounter << std::endl;
+    }
+
+    if (this->incumbentChannel) {
+        os << "Imported solutions: " << this->importedSolutionsCounter << std::endl;
+    }
+
+    if (this->lagrangianBound) {
+        os << "Lagrangian bound iterations: " << this->lagrangianIterationsCounter << std::endl;
     }
-    os << this->p[this->m - 1] << std::endl;
 }
 
 /*
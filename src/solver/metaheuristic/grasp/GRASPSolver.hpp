@@ -1,9 +1,19 @@
 #pragma once
 
 #include "../../CEDPSolver.hpp"
+#include "../../IncumbentChannel.hpp"
+#include "../../../checkpoint/CheckpointWriter.hpp"
 #include "../../heuristic/constructive/GreedyConstructiveHeuristic.hpp"
+#include "../../heuristic/constructive/RegionGrowingConstructiveHeuristic.hpp"
+#include "../../heuristic/arena/IterationArena.hpp"
 #include "../../heuristic/fixer/SolutionFixer.hpp"
 #include "../../heuristic/localsearch/LocalSearchHeuristic.hpp"
+#include "../../heuristic/lns/LNSHeuristic.hpp"
+#include "../../heuristic/pathrelinking/PathRelinkingHeuristic.hpp"
+#include "../../relaxation/LagrangianRelaxation.hpp"
+#include "AlphaSelector.hpp"
+#include "ElitePool.hpp"
+#include "SolutionCache.hpp"
 #include "../../../statistics/Statistics.hpp"
 
 /*
@@ -15,9 +25,24 @@ class GRASPSolver : public CEDPSolver {
         /* This solver's greedy constructive heuristic. */
         GreedyConstructiveHeuristic gcHeuristic;
 
+        /* This solver's region-growing constructive heuristic. */
+        RegionGrowingConstructiveHeuristic rgHeuristic;
+
         /* This solver's local search heuristic. */
         LocalSearchHeuristic lsHeuristic;
 
+        /* This solver's path relinking heuristic. */
+        PathRelinkingHeuristic prHeuristic;
+
+        /* This solver's large neighbourhood search heuristic. */
+        LNSHeuristic lnsHeuristic;
+
+        /* This solver's pool of elite solutions. */
+        ElitePool elitePool;
+
+        /* This solver's cache of the values reached by local search from each solution. */
+        SolutionCache solutionCache;
+
         /*
          * The number of values for this solver's threshold parameter.
          */
@@ -36,19 +61,131 @@ class GRASPSolver : public CEDPSolver {
         bool statisticalFilter;
 
         /*
-         * The set of possible values for α.
+         * The maximum number of solutions in this solver's elite pool; zero
+         * disables path relinking.
+         */
+        unsigned int elitePoolSize;
+
+        /*
+         * The direction of this solver's path relinking (FORWARD, BACKWARD
+         * or MIXED).
+         */
+        unsigned int pathRelinking;
+
+        /*
+         * The maximum number of entries in this solver's cache of local
+         * search results; zero disables the cache.
+         */
+        unsigned int cacheSize;
+
+        /*
+         * The policy for choosing this solver's threshold parameter
+         * (REACTIVE, UCB1 or THOMPSON).
+         */
+        unsigned int alphaPolicy;
+
+        /*
+         * The selector of this solver's threshold parameter, which keeps the
+         * statistics of the solution's values found using each value for α.
+         */
+        AlphaSelector alphaSelector;
+
+        /*
+         * The statistics learned by previous runs, which warm-start the
+         * selector of this solver's threshold parameter.
+         */
+        AlphaSelector initialAlphaSelector;
+
+        /*
+         * The flag indicating whether to compute a Lagrangian dual bound in
+         * background, so that this solver stops once it is met.
+         */
+        bool lagrangianBound;
+
+        /*
+         * The number of subgradient iterations of the Lagrangian dual bound.
+         */
+        unsigned int lagrangianIterationsCounter;
+
+        /*
+         * The flag indicating whether this solver's fixer rebalances the
+         * connected partitions by a minimum cost flow.
+         */
+        bool flowRebalancing;
+
+        /*
+         * The flag indicating whether this solver constructs its solutions by
+         * region growing instead of the greedy constructive heuristic.
+         */
+        bool regionGrowing;
+
+        /*
+         * The channel through which this solver shares its incumbent with
+         * concurrent solvers; null if it runs alone.
          */
-        std::vector<double> psi;
+        IncumbentChannel * incumbentChannel;
 
         /*
-         * The probabilities associated with each value for α.
+         * The version of the last incumbent seen in the channel.
          */
-        std::vector<double> p;
+        unsigned long long incumbentVersion;
 
         /*
-         * The statistics of the solution's values found using each value for α.
+         * The number of incumbents of concurrent solvers used as restart
+         * points.
          */
-        std::vector<Statistics> primalBoundStatisticsPerAlpha;
+        unsigned int importedSolutionsCounter;
+
+        /*
+         * The number of iterations without improving the best solution after
+         * which the large neighbourhood search reoptimizes it; zero disables
+         * the large neighbourhood search.
+         */
+        unsigned int lnsIterations;
+
+        /*
+         * The iteration of the last large neighbourhood search.
+         */
+        unsigned int lnsIteration;
+
+        /*
+         * This solver's counter of large neighbourhood searches.
+         */
+        unsigned int lnsCounter;
+
+        /*
+         * This solver's counter of large neighbourhood searches that improved
+         * the best solution.
+         */
+        unsigned int lnsImprovementsCounter;
+
+        /*
+         * The file into which this solver periodically writes its state;
+         * empty if checkpoints are disabled.
+         */
+        std::string checkpointFilename;
+
+        /*
+         * The time in seconds between each checkpoint.
+         */
+        unsigned int checkpointInterval;
+
+        /*
+         * The flag indicating whether the next call to solve continues the
+         * run whose state was read from a checkpoint.
+         */
+        bool isResumed;
+
+        /*
+         * The time in milliseconds elapsed in the run read from a checkpoint.
+         */
+        unsigned long long resumedTime;
+
+        /*
+         * The number of iterations after which this solver stops; zero if
+         * only the time limit stops it.
+         */
+        unsigned int iterationsLimit;
 
         /* 
          * The statistics of the ratio between initial and local search solutions value.
@@ -116,25 +253,75 @@ class GRASPSolver : public CEDPSolver {
         unsigned int localSearchCounter;
 
         /*
-         * Randomly selects a value for α.
+         * This solver's counter of path relinking.
+         */
+        unsigned int pathRelinkingCounter;
+
+        /*
+         * This solver's counter of path relinking that improved the best solution.
+         */
+        unsigned int pathRelinkingImprovementsCounter;
+
+        /*
+         * The initial size in bytes of the arena for each iteration's temporaries.
+         */
+        static const std::size_t ARENA_SIZE;
+
+        /*
+         * The size in bytes reached by the arena for each iteration's temporaries.
+         */
+        std::size_t arenaSize;
+
+        /*
+         * This solver's counter of allocations from the global heap made by the
+         * arena for each iteration's temporaries.
+         */
+        unsigned long long arenaUpstreamAllocationsCounter;
+
+        /*
+         * The last iteration whose temporaries did not fit in the arena.
+         */
+        unsigned int arenaLastOverflowIteration;
+
+        /*
+         * The function returning the number of heap allocations made so far
+         * by the calling thread; 0 if the iterations are not instrumented.
+         */
+        unsigned long long (*allocationsCounter)();
+
+        /*
+         * The statistics of the number of heap allocations made by the
+         * solver's thread in each iteration.
+         */
+        Statistics heapAllocationsStatistics;
+
+        /*
+         * Relinks the specified local optimum with an elite solution, improves
+         * the best solution in the path and updates the elite pool.
          *
-         * @return the index of the selected value for α.
+         * @param solution the local optimum.
          */
-        unsigned int chooseAlpha();
+        void relinkSolution(const Solution & solution);
 
         /*
-         * Updated the average solution value found by each value for α.
+         * Reoptimizes the best solution by large neighbourhood search once it
+         * has not improved for the configured number of iterations.
+         */
+        void searchLargeNeighbourhood();
+
+        /*
+         * Writes this solver's state into a checkpoint handed to the
+         * specified writer, which writes it into the disk in background.
          *
-         * @param i the index of the selected value for α.
-         * @param primalBound the new primal bound.
+         * @param checkpointWriter the checkpoint writer.
          */
-        void updateAverageSolutionValuePerAlpha(unsigned int i, 
-                double primalBound);
+        void submitCheckpoint(CheckpointWriter & checkpointWriter) const;
 
         /*
-         * Reevaluate the probabilities associated with each value for α.
+         * Offers this solver's incumbent to the concurrent solvers and
+         * restarts the local search from theirs if it is better.
          */
-        void reevalueateProbabilities();
+        void exchangeIncumbent();
 
     public:
         /*
@@ -156,6 +343,68 @@ class GRASPSolver : public CEDPSolver {
                 unsigned int seed, unsigned int m, unsigned int k,
                 bool statisticalFilter);
 
+        /*
+         * Constructs a new solver with path relinking and a cache of local
+         * search results.
+         *
+         * @param instance          the new solver's instance.
+         * @param timeLimit         the new solver's time limit.
+         * @param seed              the seed for the new solver's pseudo-random 
+         *                          numbers generator.
+         * @param m                 the number of values for the new solver's 
+         *                          threshold parameter.
+         * @param k                 the number of iterations between each
+         *                          update in the new solver's threshold
+         *                          probabilities.
+         * @param statisticalFilter the flag indicating whether to filter
+         *                          semi-greedy solutions from local search.
+         * @param elitePoolSize     the maximum number of solutions in the new
+         *                          solver's elite pool; zero disables path
+         *                          relinking.
+         * @param pathRelinking     the direction of the new solver's path
+         *                          relinking (FORWARD, BACKWARD or MIXED).
+         * @param cacheSize         the maximum number of entries in the new
+         *                          solver's cache of local search results;
+         *                          zero disables the cache.
+         */
+        GRASPSolver(const Instance & instance, unsigned int timeLimit, 
+                unsigned int seed, unsigned int m, unsigned int k,
+                bool statisticalFilter, unsigned int elitePoolSize, 
+                unsigned int pathRelinking, unsigned int cacheSize);
+
+        /*
+         * Constructs a new solver with path relinking, a cache of local search
+         * results and a policy for choosing its threshold parameter.
+         *
+         * @param instance          the new solver's instance.
+         * @param timeLimit         the new solver's time limit.
+         * @param seed              the seed for the new solver's pseudo-random 
+         *                          numbers generator.
+         * @param m                 the number of values for the new solver's 
+         *                          threshold parameter.
+         * @param k                 the number of iterations between each
+         *                          update in the new solver's threshold
+         *                          probabilities.
+         * @param statisticalFilter the flag indicating whether to filter
+         *                          semi-greedy solutions from local search.
+         * @param elitePoolSize     the maximum number of solutions in the new
+         *                          solver's elite pool; zero disables path
+         *                          relinking.
+         * @param pathRelinking     the direction of the new solver's path
+         *                          relinking (FORWARD, BACKWARD or MIXED).
+         * @param cacheSize         the maximum number of entries in the new
+         *                          solver's cache of local search results;
+         *                          zero disables the cache.
+         * @param alphaPolicy       the policy for choosing the new solver's
+         *                          threshold parameter (REACTIVE, UCB1 or
+         *                          THOMPSON).
+         */
+        GRASPSolver(const Instance & instance, unsigned int timeLimit, 
+                unsigned int seed, unsigned int m, unsigned int k,
+                bool statisticalFilter, unsigned int elitePoolSize, 
+                unsigned int pathRelinking, unsigned int cacheSize,
+                unsigned int alphaPolicy);
+
         /*
          * Constructs a new empty solver.
          */
@@ -185,6 +434,257 @@ class GRASPSolver : public CEDPSolver {
          */
         bool getStatisticalFilter() const;
 
+        /*
+         * Returns the policy for choosing this solver's threshold parameter.
+         *
+         * @return the policy for choosing this solver's threshold parameter.
+         */
+        unsigned int getAlphaPolicy() const;
+
+        /*
+         * Returns the selector of this solver's threshold parameter.
+         *
+         * @return the selector of this solver's threshold parameter.
+         */
+        const AlphaSelector & getAlphaSelector() const;
+
+        /*
+         * Reads the statistics learned by a previous run from the specified
+         * file, to warm-start the selector of this solver's threshold
+         * parameter in the next calls to solve.
+         *
+         * @param filename the file to read from.
+         */
+        void importAlphaDistribution(const std::string & filename);
+
+        /*
+         * Writes the statistics learned by the selector of this solver's
+         * threshold parameter into the specified file.
+         *
+         * @param filename the file to write into.
+         */
+        void exportAlphaDistribution(const std::string & filename) const;
+
+        /*
+         * Sets the flag indicating whether to compute a Lagrangian dual bound
+         * in background, so that this solver stops once it is met.
+         *
+         * @param lagrangianBound the new flag.
+         */
+        void setLagrangianBound(bool lagrangianBound);
+
+        /*
+         * Returns the flag indicating whether to compute a Lagrangian dual
+         * bound in background.
+         *
+         * @return true if the Lagrangian dual bound is computed; false otherwise.
+         */
+        bool getLagrangianBound() const;
+
+        /*
+         * Sets the flag indicating whether this solver's fixer rebalances the
+         * connected partitions by a minimum cost flow.
+         *
+         * @param flowRebalancing the new flag.
+         */
+        void setFlowRebalancing(bool flowRebalancing);
+
+        /*
+         * Returns the flag indicating whether this solver's fixer rebalances
+         * the connected partitions by a minimum cost flow.
+         *
+         * @return true if the flow rebalancing is enabled; false otherwise.
+         */
+        bool getFlowRebalancing() const;
+
+        /*
+         * Sets the flag indicating whether this solver constructs its
+         * solutions by region growing instead of the greedy constructive
+         * heuristic.
+         *
+         * @param regionGrowing the new flag.
+         */
+        void setRegionGrowing(bool regionGrowing);
+
+        /*
+         * Returns the flag indicating whether this solver constructs its
+         * solutions by region growing.
+         *
+         * @return true if the region growing is enabled; false otherwise.
+         */
+        bool getRegionGrowing() const;
+
+        /*
+         * Sets the rule by which this solver's region growing spreads the
+         * seeds.
+         *
+         * @param seeding the new rule for spreading the seeds.
+         */
+        void setRegionGrowingSeeding(unsigned int seeding);
+
+        /*
+         * Returns the rule by which this solver's region growing spreads the
+         * seeds.
+         *
+         * @return the rule for spreading the seeds.
+         */
+        unsigned int getRegionGrowingSeeding() const;
+
+        /*
+         * Makes this solver share its incumbent through the specified channel
+         * and stop once the channel is closed.
+         *
+         * @param incumbentChannel the channel; null if this solver runs alone.
+         */
+        void setIncumbentChannel(IncumbentChannel * incumbentChannel);
+
+        /*
+         * Returns the number of incumbents of concurrent solvers used as
+         * restart points.
+         *
+         * @return the number of incumbents of concurrent solvers used as
+         *         restart points.
+         */
+        unsigned int getImportedSolutionsCounter() const;
+
+        /*
+         * Sets the flag indicating whether this solver's local search
+         * descends through the swap, chain and shift neighbourhoods once no
+         * single edge move improves the solution.
+         *
+         * @param vnd the new flag.
+         */
+        void setVND(bool vnd);
+
+        /*
+         * Returns the flag indicating whether this solver's local search
+         * descends through the swap, chain and shift neighbourhoods.
+         *
+         * @return true if the variable neighbourhood descent is enabled;
+         *         false otherwise.
+         */
+        bool getVND() const;
+
+        /*
+         * Sets the move selection strategy of this solver's local search.
+         *
+         * @param strategy         the new strategy.
+         * @param candidatesNumber the number of best moves a move is randomly
+         *                         chosen from by the candidate list strategy.
+         */
+        void setLocalSearchStrategy(unsigned int strategy, unsigned int candidatesNumber);
+
+        /*
+         * Returns the move selection strategy of this solver's local search.
+         *
+         * @return the move selection strategy of this solver's local search.
+         */
+        unsigned int getLocalSearchStrategy() const;
+
+        /*
+         * Sets the number of threads evaluating the moves of non-adjacent
+         * districts concurrently in this solver's local search.
+         *
+         * @param threadsNumber the new number of threads.
+         */
+        void setLocalSearchThreadsNumber(unsigned int threadsNumber);
+
+        /*
+         * Returns the number of threads evaluating the moves of non-adjacent
+         * districts concurrently in this solver's local search.
+         *
+         * @return the number of threads of this solver's local search.
+         */
+        unsigned int getLocalSearchThreadsNumber() const;
+
+        /*
+         * Makes this solver reoptimize its best solution by large
+         * neighbourhood search whenever it stalls.
+         *
+         * @param iterations    the number of iterations without improving the
+         *                      best solution after which the search runs;
+         *                      zero disables it.
+         * @param threadsNumber the number of threads solving the search's
+         *                      subproblems.
+         */
+        void setLNS(unsigned int iterations, unsigned int threadsNumber);
+
+        /*
+         * Returns this solver's counter of large neighbourhood searches.
+         *
+         * @return this solver's counter of large neighbourhood searches.
+         */
+        unsigned int getLNSCounter() const;
+
+        /*
+         * Returns this solver's counter of large neighbourhood searches that
+         * improved the best solution.
+         *
+         * @return this solver's counter of large neighbourhood searches that
+         *         improved the best solution.
+         */
+        unsigned int getLNSImprovementsCounter() const;
+
+        /*
+         * Makes this solver write its state into the specified file every
+         * specified number of seconds while solving, and once it finishes.
+         *
+         * @param filename the file to write into; an empty name disables
+         *                 checkpoints.
+         * @param interval the time in seconds between each checkpoint.
+         */
+        void setCheckpoint(const std::string & filename, unsigned int interval);
+
+        /*
+         * Reads this solver's state from the specified file, so that the next
+         * call to solve continues the interrupted run.
+         *
+         * @param filename the file to read from.
+         */
+        void resume(const std::string & filename);
+
+        /*
+         * Writes this solver's state into the specified output stream, in the
+         * format of a checkpoint.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeCheckpoint(std::ostream & os) const;
+
+        /*
+         * Reads this solver's state from the specified checkpoint, so that the
+         * next call to solve continues the interrupted run.
+         *
+         * @param is the input stream to read from.
+         */
+        void readCheckpoint(std::istream & is);
+
+        /*
+         * Makes this solver stop after the specified number of iterations,
+         * besides the time limit, so that two runs of it take the same path.
+         *
+         * @param iterationsLimit the number of iterations; zero disables the
+         *                        limit.
+         */
+        void setIterationsLimit(unsigned int iterationsLimit);
+
+        /*
+         * Returns the number of iterations after which this solver stops.
+         *
+         * @return the number of iterations; zero if there is no limit.
+         */
+        unsigned int getIterationsLimit() const;
+
+        /*
+         * Instruments this solver's iterations with the specified function,
+         * which returns the number of heap allocations made so far by the
+         * calling thread, such as HeapCounter::getAllocationsCounter. The
+         * arena and heap allocations lines are written only when instrumented.
+         *
+         * @param allocationsCounter the function; 0 disables the instrumentation.
+         */
+        void setAllocationsCounter(unsigned long long (*allocationsCounter)());
+
         /*
          * Returns the i-th possible value for alpha.
          *
@@ -305,6 +805,61 @@ class GRASPSolver : public CEDPSolver {
          */
         unsigned int getLocalSearchCounter() const;
 
+        /*
+         * Returns this solver's counter of path relinking.
+         *
+         * @return this solver's counter of path relinking.
+         */
+        unsigned int getPathRelinkingCounter() const;
+
+        /*
+         * Returns this solver's counter of path relinking that improved the
+         * best solution.
+         *
+         * @return this solver's counter of path relinking that improved the
+         *         best solution.
+         */
+        unsigned int getPathRelinkingImprovementsCounter() const;
+
+        /*
+         * Returns this solver's counter of allocations from the global heap
+         * made by the arena for each iteration's temporaries.
+         *
+         * @return this solver's counter of allocations from the global heap
+         *         made by the arena.
+         */
+        unsigned long long getArenaUpstreamAllocationsCounter() const;
+
+        /*
+         * Returns the last iteration whose temporaries did not fit in this
+         * solver's arena; zero if all iterations fit.
+         *
+         * @return the last iteration whose temporaries did not fit in the arena.
+         */
+        unsigned int getArenaLastOverflowIteration() const;
+
+        /*
+         * Returns the statistics of the number of heap allocations made by
+         * this solver's thread in each instrumented iteration.
+         *
+         * @return the statistics of the heap allocations in each iteration.
+         */
+        const Statistics & getHeapAllocationsStatistics() const;
+
+        /*
+         * Returns this solver's counter of lookups in its cache of local search results.
+         *
+         * @return this solver's counter of lookups in its cache of local search results.
+         */
+        unsigned int getCacheLookupsCounter() const;
+
+        /*
+         * Returns this solver's counter of local searches skipped by its cache.
+         *
+         * @return this solver's counter of local searches skipped by its cache.
+         */
+        unsigned int getCacheHitsCounter() const;
+
         /*
          * Solve this solver's instance.
          */
@@ -0,0 +1,130 @@
+#include "GRASPWorkers.hpp"
+
+/*
+ * Constructs new workers.
+ *
+ * @param instance          the workers' instance.
+ * @param seed              the seed of the first worker; each other worker
+ *                          uses the next one.
+ * @param m                 the number of values for the GRASP's threshold
+ *                          parameter.
+ * @param k                 the number of iterations between each update in the
+ *                          GRASP's threshold parameter probabilities.
+ * @param statisticalFilter the flag indicating whether to filter semi-greedy
+ *                          solutions from local search.
+ * @param threadsNumber     the number of workers.
+ * @param incumbentChannel  the channel shared with the exact search.
+ */
+GRASPWorkers::GRASPWorkers(const Instance & instance,
+                           unsigned int seed,
+                           unsigned int m,
+                           unsigned int k,
+                           bool statisticalFilter,
+                           unsigned int threadsNumber,
+                           IncumbentChannel & incumbentChannel)
+    : instance(instance),
+      seed(seed),
+      m(m),
+      k(k),
+      statisticalFilter(statisticalFilter),
+      threadsNumber(threadsNumber),
+      incumbentChannel(incumbentChannel) {}
+
+/*
+ * Closes the channel and waits for the workers.
+ */
+GRASPWorkers::~GRASPWorkers() {
+    this->stop();
+}
+
+/*
+ * Starts the workers in background threads.
+ *
+ * @param timeLimit the workers' time limit.
+ */
+void GRASPWorkers::start(unsigned int timeLimit) {
+    this->solvers.clear();
+
+    /* The solvers must not move once their threads run */
+    this->solvers.reserve(this->threadsNumber);
+
+    for (unsigned int i = 0; i < this->threadsNumber; i++) {
+        this->solvers.push_back(GRASPSolver(this->instance, timeLimit, this->seed + i,
+                    this->m, this->k, this->statisticalFilter));
+        this->solvers.back().setIncumbentChannel(&this->incumbentChannel);
+    }
+
+    for (GRASPSolver & solver : this->solvers) {
+        this->threads.push_back(std::thread(&GRASPSolver::solve, &solver));
+    }
+}
+
+/*
+ * Closes the channel and waits for the workers.
+ */
+void GRASPWorkers::stop() {
+    this->incumbentChannel.close();
+
+    for (std::thread & thread : this->threads) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    this->threads.clear();
+}
+
+/*
+ * Returns the number of workers.
+ *
+ * @return the number of workers.
+ */
+unsigned int GRASPWorkers::getThreadsNumber() const {
+    return this->threadsNumber;
+}
+
+/*
+ * Returns the total number of GRASP iterations of the workers.
+ *
+ * @return the total number of GRASP iterations of the workers.
+ */
+unsigned int GRASPWorkers::getIterationsCounter() const {
+    unsigned int iterationsCounter = 0;
+
+    for (const GRASPSolver & solver : this->solvers) {
+        iterationsCounter += solver.getIterationsCounter();
+    }
+
+    return iterationsCounter;
+}
+
+/*
+ * Returns the total number of feasible solutions found by the workers.
+ *
+ * @return the total number of feasible solutions found by the workers.
+ */
+unsigned int GRASPWorkers::getSolutionsCounter() const {
+    unsigned int solutionsCounter = 0;
+
+    for (const GRASPSolver & solver : this->solvers) {
+        solutionsCounter += solver.getSolutionsCounter();
+    }
+
+    return solutionsCounter;
+}
+
+/*
+ * Returns the total number of incumbents of the exact search used as restart
+ * points by the workers.
+ *
+ * @return the total number of incumbents used as restart points.
+ */
+unsigned int GRASPWorkers::getImportedSolutionsCounter() const {
+    unsigned int importedSolutionsCounter = 0;
+
+    for (const GRASPSolver & solver : this->solvers) {
+        importedSolutionsCounter += solver.getImportedSolutionsCounter();
+    }
+
+    return importedSolutionsCounter;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "GRASPSolver.hpp"
+#include <thread>
+
+/*
+ * The GRASPWorkers class represents GRASP solvers running in background
+ * threads next to an exact search, exchanging incumbents with it through an
+ * incumbent channel until the channel is closed.
+ */
+class GRASPWorkers {
+    private:
+        /* The workers' instance. */
+        const Instance & instance;
+
+        /* The seed of the first worker. */
+        unsigned int seed;
+
+        /* The number of values for the GRASP's threshold parameter. */
+        unsigned int m;
+
+        /*
+         * The number of iterations between each update in the GRASP's
+         * threshold parameter probabilities.
+         */
+        unsigned int k;
+
+        /*
+         * The flag indicating whether to filter semi-greedy solutions from
+         * local search.
+         */
+        bool statisticalFilter;
+
+        /* The number of workers. */
+        unsigned int threadsNumber;
+
+        /* The workers' solvers. */
+        std::vector<GRASPSolver> solvers;
+
+        /* The workers' threads. */
+        std::vector<std::thread> threads;
+
+        /* The channel shared with the exact search. */
+        IncumbentChannel & incumbentChannel;
+
+    public:
+        /*
+         * Constructs new workers.
+         *
+         * @param instance          the workers' instance.
+         * @param seed              the seed of the first worker; each other
+         *                          worker uses the next one.
+         * @param m                 the number of values for the GRASP's
+         *                          threshold parameter.
+         * @param k                 the number of iterations between each
+         *                          update in the GRASP's threshold parameter
+         *                          probabilities.
+         * @param statisticalFilter the flag indicating whether to filter
+         *                          semi-greedy solutions from local search.
+         * @param threadsNumber     the number of workers.
+         * @param incumbentChannel  the channel shared with the exact search.
+         */
+        GRASPWorkers(const Instance & instance, unsigned int seed, unsigned int m,
+                unsigned int k, bool statisticalFilter, unsigned int threadsNumber,
+                IncumbentChannel & incumbentChannel);
+
+        /*
+         * Closes the channel and waits for the workers.
+         */
+        ~GRASPWorkers();
+
+        GRASPWorkers(const GRASPWorkers &) = delete;
+
+        GRASPWorkers & operator = (const GRASPWorkers &) = delete;
+
+        /*
+         * Starts the workers in background threads.
+         *
+         * @param timeLimit the workers' time limit.
+         */
+        void start(unsigned int timeLimit);
+
+        /*
+         * Closes the channel and waits for the workers.
+         */
+        void stop();
+
+        /*
+         * Returns the number of workers.
+         *
+         * @return the number of workers.
+         */
+        unsigned int getThreadsNumber() const;
+
+        /*
+         * Returns the total number of GRASP iterations of the workers.
+         *
+         * @return the total number of GRASP iterations of the workers.
+         */
+        unsigned int getIterationsCounter() const;
+
+        /*
+         * Returns the total number of feasible solutions found by the workers.
+         *
+         * @return the total number of feasible solutions found by the workers.
+         */
+        unsigned int getSolutionsCounter() const;
+
+        /*
+         * Returns the total number of incumbents of the exact search used as
+         * restart points by the workers.
+         *
+         * @return the total number of incumbents used as restart points.
+         */
+        unsigned int getImportedSolutionsCounter() const;
+};
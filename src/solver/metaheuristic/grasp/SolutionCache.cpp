@@ -0,0 +1,179 @@
+#include "SolutionCache.hpp"
+#include "../../../checkpoint/Checkpoint.hpp"
+
+/*
+ * Constructs a new cache.
+ *
+ * @param capacity the new cache's maximum number of entries.
+ */
+SolutionCache::SolutionCache(unsigned int capacity) : capacity(capacity), 
+    lookupsCounter(0), hitsCounter(0) {}
+
+/*
+ * Constructs a new empty cache.
+ */
+SolutionCache::SolutionCache() : SolutionCache::SolutionCache(0) {}
+
+/*
+ * Constructs a new cache with the same entries as the specified one.
+ *
+ * @param cache the cache to be copied.
+ */
+SolutionCache::SolutionCache(const SolutionCache & cache) {
+    *this = cache;
+}
+
+/*
+ * Replaces this cache's entries with the entries of the specified one. The
+ * index is rebuilt, since its iterators refer to the copied list.
+ *
+ * @param cache the cache to be copied.
+ *
+ * @return this cache.
+ */
+SolutionCache & SolutionCache::operator = (const SolutionCache & cache) {
+    if (this != &cache) {
+        this->capacity = cache.capacity;
+        this->entries = cache.entries;
+        this->lookupsCounter = cache.lookupsCounter;
+        this->hitsCounter = cache.hitsCounter;
+        this->index.clear();
+
+        for (std::list<std::pair<unsigned long long, double> >::iterator it = 
+                this->entries.begin(); it != this->entries.end(); it++) {
+            this->index[it->first] = it;
+        }
+    }
+
+    return *this;
+}
+
+/*
+ * Returns this cache's maximum number of entries.
+ *
+ * @return this cache's maximum number of entries.
+ */
+unsigned int SolutionCache::getCapacity() const {
+    return this->capacity;
+}
+
+/*
+ * Returns this cache's counter of lookups.
+ *
+ * @return this cache's counter of lookups.
+ */
+unsigned int SolutionCache::getLookupsCounter() const {
+    return this->lookupsCounter;
+}
+
+/*
+ * Returns this cache's counter of lookups that found an entry.
+ *
+ * @return this cache's counter of lookups that found an entry.
+ */
+unsigned int SolutionCache::getHitsCounter() const {
+    return this->hitsCounter;
+}
+
+/*
+ * Looks up the value associated with the specified hash, marking it as the
+ * most recently used.
+ *
+ * @param hash  the hash to be looked up.
+ * @param value the value associated with the hash, if found.
+ *
+ * @return true if the hash was found; false otherwise.
+ */
+bool SolutionCache::find(unsigned long long hash, double & value) {
+    this->lookupsCounter++;
+
+    std::unordered_map<unsigned long long, 
+        std::list<std::pair<unsigned long long, double> >::iterator>::iterator it = 
+            this->index.find(hash);
+
+    if (it == this->index.end()) {
+        return false;
+    }
+
+    this->entries.splice(this->entries.begin(), this->entries, it->second);
+    value = it->second->second;
+    this->hitsCounter++;
+
+    return true;
+}
+
+/*
+ * Associates the specified value with the specified hash, evicting the least
+ * recently used entry if this cache is full.
+ *
+ * @param hash  the hash.
+ * @param value the value to be associated with the hash.
+ */
+void SolutionCache::insert(unsigned long long hash, double value) {
+    if (this->capacity == 0) {
+        return;
+    }
+
+    std::unordered_map<unsigned long long, 
+        std::list<std::pair<unsigned long long, double> >::iterator>::iterator it = 
+            this->index.find(hash);
+
+    if (it != this->index.end()) {
+        it->second->second = value;
+        this->entries.splice(this->entries.begin(), this->entries, it->second);
+
+        return;
+    }
+
+    if (this->entries.size() >= this->capacity) {
+        this->index.erase(this->entries.back().first);
+        this->entries.pop_back();
+    }
+
+    this->entries.push_front(std::make_pair(hash, value));
+    this->index[hash] = this->entries.begin();
+}
+
+/*
+ * Writes this cache's state into the specified checkpoint.
+ *
+ * @param os the output stream to write into.
+ */
+void SolutionCache::writeCheckpoint(std::ostream & os) const {
+    Checkpoint::write(os, this->lookupsCounter);
+    Checkpoint::write(os, this->hitsCounter);
+    Checkpoint::write(os, (unsigned int) this->entries.size());
+
+    /* From the most to the least recently used, so that the order is kept */
+    for (const std::pair<unsigned long long, double> & entry : this->entries) {
+        Checkpoint::write(os, entry.first);
+        Checkpoint::write(os, entry.second);
+    }
+}
+
+/*
+ * Reads this cache's state from the specified checkpoint.
+ *
+ * @param is the input stream to read from.
+ */
+void SolutionCache::readCheckpoint(std::istream & is) {
+    unsigned int size = 0;
+
+    this->entries.clear();
+    this->index.clear();
+
+    Checkpoint::read(is, this->lookupsCounter);
+    Checkpoint::read(is, this->hitsCounter);
+    Checkpoint::read(is, size);
+
+    for (unsigned int i = 0; i < size && is; i++) {
+        unsigned long long hash = 0;
+        double value = 0.0;
+
+        Checkpoint::read(is, hash);
+        Checkpoint::read(is, value);
+
+        this->entries.push_back(std::make_pair(hash, value));
+        this->index[hash] = std::prev(this->entries.end());
+    }
+}
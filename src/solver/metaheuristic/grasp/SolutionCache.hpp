@@ -0,0 +1,113 @@
+#pragma once
+
+#include <iostream>
+#include <list>
+#include <unordered_map>
+
+/*
+ * The SolutionCache class represents a bounded least recently used map from
+ * the hash of a solution to the value reached by improving it.
+ */
+class SolutionCache {
+    private:
+        /* This cache's maximum number of entries. */
+        unsigned int capacity;
+
+        /* This cache's entries, from the most to the least recently used. */
+        std::list<std::pair<unsigned long long, double> > entries;
+
+        /* A map that maps each hash to its entry. */
+        std::unordered_map<unsigned long long, 
+            std::list<std::pair<unsigned long long, double> >::iterator> index;
+
+        /* This cache's counter of lookups. */
+        unsigned int lookupsCounter;
+
+        /* This cache's counter of lookups that found an entry. */
+        unsigned int hitsCounter;
+
+    public:
+        /*
+         * Constructs a new cache.
+         *
+         * @param capacity the new cache's maximum number of entries.
+         */
+        SolutionCache(unsigned int capacity);
+
+        /*
+         * Constructs a new empty cache.
+         */
+        SolutionCache();
+
+        /*
+         * Constructs a new cache with the same entries as the specified one.
+         *
+         * @param cache the cache to be copied.
+         */
+        SolutionCache(const SolutionCache & cache);
+
+        /*
+         * Replaces this cache's entries with the entries of the specified one.
+         * The index is rebuilt, since its iterators refer to the copied list.
+         *
+         * @param cache the cache to be copied.
+         *
+         * @return this cache.
+         */
+        SolutionCache & operator = (const SolutionCache & cache);
+
+        /*
+         * Returns this cache's maximum number of entries.
+         *
+         * @return this cache's maximum number of entries.
+         */
+        unsigned int getCapacity() const;
+
+        /*
+         * Returns this cache's counter of lookups.
+         *
+         * @return this cache's counter of lookups.
+         */
+        unsigned int getLookupsCounter() const;
+
+        /*
+         * Returns this cache's counter of lookups that found an entry.
+         *
+         * @return this cache's counter of lookups that found an entry.
+         */
+        unsigned int getHitsCounter() const;
+
+        /*
+         * Looks up the value associated with the specified hash, marking it
+         * as the most recently used.
+         *
+         * @param hash  the hash to be looked up.
+         * @param value the value associated with the hash, if found.
+         *
+         * @return true if the hash was found; false otherwise.
+         */
+        bool find(unsigned long long hash, double & value);
+
+        /*
+         * Associates the specified value with the specified hash, evicting
+         * the least recently used entry if this cache is full.
+         *
+         * @param hash  the hash.
+         * @param value the value to be associated with the hash.
+         */
+        void insert(unsigned long long hash, double value);
+
+        /*
+         * Writes this cache's state into the specified checkpoint.
+         *
+         * @param os the output stream to write into.
+         */
+        void writeCheckpoint(std::ostream & os) const;
+
+        /*
+         * Reads this cache's state from the specified checkpoint.
+         *
+         * @param is the input stream to read from.
+         */
+        void readCheckpoint(std::istream & is);
+};
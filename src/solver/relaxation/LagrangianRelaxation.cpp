@@ -0,0 +1,228 @@
+#include "LagrangianRelaxation.hpp"
+#include "../heuristic/Heuristic.hpp"
+#include <cfloat>
+#include <cmath>
+
+/*
+ * Constructs a new relaxation.
+ *
+ * @param instance the instance to be relaxed.
+ */
+LagrangianRelaxation::LagrangianRelaxation(const Instance & instance) :
+    m(instance.getM()), n(instance.getG().m()), c(instance.getM() *
+            instance.getG().m()), d(instance.getG().m()),
+    minimumDemand(instance.getMinimumDemand()),
+    maximumDemand(std::min(instance.getMaximumDemand(), (double) instance.getD())),
+    isIntegral(true), bound(DBL_MAX), primalBound(-DBL_MAX),
+    iterationsCounter(0), isStopped(false) {
+    for (unsigned int eId = 1; eId <= this->n; eId++) {
+        this->d[eId - 1] = 2 * instance.getEdge(eId).w;
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            double cej = instance.getC(eId, j);
+
+            this->c[(eId - 1) * this->m + j] = cej;
+
+            if (cej != floor(cej)) {
+                this->isIntegral = false;
+            }
+        }
+    }
+}
+
+/*
+ * Stops this relaxation's thread.
+ */
+LagrangianRelaxation::~LagrangianRelaxation() {
+    this->stop();
+}
+
+/*
+ * Evaluates the relaxation for the specified multipliers.
+ *
+ * @param lambda the multipliers of the maximum demand constraints.
+ * @param mu     the multipliers of the minimum demand constraints.
+ * @param demand the demand of each district in the relaxed solution.
+ *
+ * @return the relaxation's value, an upper bound for the CEDP.
+ */
+double LagrangianRelaxation::evaluate(const std::vector<double> & lambda,
+        const std::vector<double> & mu, std::vector<double> & demand) const {
+    double value = 0.0;
+
+    std::fill(demand.begin(), demand.end(), 0.0);
+
+    /* ∑_{j = 1}^{m}{λ_{j} max - μ_{j} min} */
+    for (unsigned int j = 0; j < this->m; j++) {
+        value += lambda[j] * this->maximumDemand - mu[j] * this->minimumDemand;
+    }
+
+    /* ∀ e ∈ E : e is allocated to argmax_{j}{c_{e, j} - 2 d_{e} (λ_{j} - μ_{j})} */
+    for (unsigned int e = 0; e < this->n; e++) {
+        const double * ce = this->c.data() + e * this->m;
+        unsigned int bestJ = 0;
+        double bestProfit = -DBL_MAX;
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            double profit = ce[j] - this->d[e] * (lambda[j] - mu[j]);
+
+            if (profit > bestProfit) {
+                bestJ = j;
+                bestProfit = profit;
+            }
+        }
+
+        value += bestProfit;
+        demand[bestJ] += this->d[e];
+    }
+
+    return value;
+}
+
+/*
+ * Publishes the specified upper bound if it is better than the best one.
+ *
+ * @param bound the upper bound.
+ */
+void LagrangianRelaxation::updateBound(double bound) {
+    /* The optimum is an integer whenever the profits are */
+    if (this->isIntegral) {
+        bound = floor(bound + 1e-6);
+    }
+
+    if (bound < this->bound) {
+        this->bound = bound;
+    }
+}
+
+/*
+ * Runs the subgradient optimisation until it converges, meets the primal
+ * bound, or the time limit or a stop request is reached.
+ *
+ * @param timeLimit the time limit.
+ */
+void LagrangianRelaxation::run(unsigned int timeLimit) {
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    std::vector<double> lambda (this->m, 0.0);
+    std::vector<double> mu (this->m, 0.0);
+    std::vector<double> demand (this->m, 0.0);
+    double theta = 2.0;
+    double bestValue = DBL_MAX;
+    unsigned int nonImprovingCounter = 0;
+
+    while (!this->isStopped && theta > 1e-6 &&
+            Heuristic::getElapsedTime(startTime) < timeLimit) {
+        double value = this->evaluate(lambda, mu, demand);
+        double primalBound = this->primalBound;
+        double normSquared = 0.0;
+
+        this->iterationsCounter++;
+        this->updateBound(value);
+
+        if (value < bestValue - 1e-9) {
+            bestValue = value;
+            nonImprovingCounter = 0;
+        } else if (++nonImprovingCounter >= 20) {
+            theta /= 2.0;
+            nonImprovingCounter = 0;
+        }
+
+        /* The bound cannot be improved beyond a known solution */
+        if (this->bound - primalBound < 1.0) {
+            break;
+        }
+
+        /* The subgradients of max - 2 ∑_{e}{d_{e} x_{e, j}} and 2 ∑_{e}{d_{e} x_{e, j}} - min */
+        for (unsigned int j = 0; j < this->m; j++) {
+            double lambdaSubgradient = this->maximumDemand - demand[j];
+            double muSubgradient = demand[j] - this->minimumDemand;
+
+            if (lambda[j] > 0.0 || lambdaSubgradient < 0.0) {
+                normSquared += lambdaSubgradient * lambdaSubgradient;
+            }
+
+            if (mu[j] > 0.0 || muSubgradient < 0.0) {
+                normSquared += muSubgradient * muSubgradient;
+            }
+        }
+
+        /* The relaxed solution is feasible and complementary, hence optimal */
+        if (normSquared == 0.0) {
+            break;
+        }
+
+        double target = primalBound;
+
+        if (target == -DBL_MAX) {
+            target = value - std::max(1.0, 0.05 * fabs(value));
+        }
+
+        /* Polyak's step towards the target */
+        double step = theta * (value - target) / normSquared;
+
+        for (unsigned int j = 0; j < this->m; j++) {
+            lambda[j] = std::max(0.0, lambda[j] - step * (this->maximumDemand - demand[j]));
+            mu[j] = std::max(0.0, mu[j] - step * (demand[j] - this->minimumDemand));
+        }
+    }
+}
+
+/*
+ * Returns the best upper bound found so far.
+ *
+ * @return the best upper bound found so far.
+ */
+double LagrangianRelaxation::getBound() const {
+    return this->bound;
+}
+
+/*
+ * Returns this relaxation's counter of subgradient iterations.
+ *
+ * @return this relaxation's counter of subgradient iterations.
+ */
+unsigned int LagrangianRelaxation::getIterationsCounter() const {
+    return this->iterationsCounter;
+}
+
+/*
+ * Informs this relaxation of the best known value of a feasible solution,
+ * which steers the subgradient steps.
+ *
+ * @param primalBound the best known value of a feasible solution.
+ */
+void LagrangianRelaxation::setPrimalBound(double primalBound) {
+    this->primalBound = primalBound;
+}
+
+/*
+ * Runs the subgradient optimisation in the calling thread.
+ *
+ * @param timeLimit the time limit.
+ */
+void LagrangianRelaxation::solve(unsigned int timeLimit) {
+    this->isStopped = false;
+    this->run(timeLimit);
+}
+
+/*
+ * Starts the subgradient optimisation in a background thread.
+ *
+ * @param timeLimit the time limit.
+ */
+void LagrangianRelaxation::start(unsigned int timeLimit) {
+    this->stop();
+    this->isStopped = false;
+    this->thread = std::thread(&LagrangianRelaxation::run, this, timeLimit);
+}
+
+/*
+ * Requests the background thread to stop and waits for it.
+ */
+void LagrangianRelaxation::stop() {
+    this->isStopped = true;
+
+    if (this->thread.joinable()) {
+        this->thread.join();
+    }
+}
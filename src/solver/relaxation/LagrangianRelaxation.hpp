@@ -0,0 +1,136 @@
+#pragma once
+
+#include "../../instance/Instance.hpp"
+#include <atomic>
+#include <thread>
+
+/*
+ * The LagrangianRelaxation class represents an upper bound for the CEDP that
+ * drops the connectivity constraints and relaxes the demand constraints of
+ * each district in a Lagrangian fashion. Each edge is then allocated to the
+ * district with the highest reduced profit, and the multipliers are improved
+ * by subgradient optimisation in a background thread.
+ */
+class LagrangianRelaxation {
+    private:
+        /* The number of districts. */
+        unsigned int m;
+
+        /* The number of edges. */
+        unsigned int n;
+
+        /* The profit of allocating each edge to each district, row by row. */
+        std::vector<double> c;
+
+        /* The demand 2 d_{e} of each edge. */
+        std::vector<double> d;
+
+        /* The minimum allowed demand for each district. */
+        double minimumDemand;
+
+        /* The maximum allowed demand for each district, including the capacity. */
+        double maximumDemand;
+
+        /* The flag indicating whether every profit is an integer. */
+        bool isIntegral;
+
+        /* The best upper bound found so far. */
+        std::atomic<double> bound;
+
+        /* The best known value of a feasible solution, used as the subgradient target. */
+        std::atomic<double> primalBound;
+
+        /* This relaxation's counter of subgradient iterations. */
+        std::atomic<unsigned int> iterationsCounter;
+
+        /* The flag indicating whether this relaxation's thread must stop. */
+        std::atomic<bool> isStopped;
+
+        /* This relaxation's thread. */
+        std::thread thread;
+
+        /*
+         * Evaluates the relaxation for the specified multipliers.
+         *
+         * @param lambda   the multipliers of the maximum demand constraints.
+         * @param mu       the multipliers of the minimum demand constraints.
+         * @param demand   the demand of each district in the relaxed solution.
+         *
+         * @return the relaxation's value, an upper bound for the CEDP.
+         */
+        double evaluate(const std::vector<double> & lambda,
+                const std::vector<double> & mu, std::vector<double> & demand) const;
+
+        /*
+         * Publishes the specified upper bound if it is better than the best one.
+         *
+         * @param bound the upper bound.
+         */
+        void updateBound(double bound);
+
+        /*
+         * Runs the subgradient optimisation until it converges, meets the
+         * primal bound, or the time limit or a stop request is reached.
+         *
+         * @param timeLimit the time limit.
+         */
+        void run(unsigned int timeLimit);
+
+    public:
+        /*
+         * Constructs a new relaxation.
+         *
+         * @param instance the instance to be relaxed.
+         */
+        LagrangianRelaxation(const Instance & instance);
+
+        /*
+         * Stops this relaxation's thread.
+         */
+        ~LagrangianRelaxation();
+
+        LagrangianRelaxation(const LagrangianRelaxation &) = delete;
+
+        LagrangianRelaxation & operator = (const LagrangianRelaxation &) = delete;
+
+        /*
+         * Returns the best upper bound found so far.
+         *
+         * @return the best upper bound found so far.
+         */
+        double getBound() const;
+
+        /*
+         * Returns this relaxation's counter of subgradient iterations.
+         *
+         * @return this relaxation's counter of subgradient iterations.
+         */
+        unsigned int getIterationsCounter() const;
+
+        /*
+         * Informs this relaxation of the best known value of a feasible
+         * solution, which steers the subgradient steps.
+         *
+         * @param primalBound the best known value of a feasible solution.
+         */
+        void setPrimalBound(double primalBound);
+
+        /*
+         * Runs the subgradient optimisation in the calling thread.
+         *
+         * @param timeLimit the time limit.
+         */
+        void solve(unsigned int timeLimit);
+
+        /*
+         * Starts the subgradient optimisation in a background thread.
+         *
+         * @param timeLimit the time limit.
+         */
+        void start(unsigned int timeLimit);
+
+        /*
+         * Requests the background thread to stop and waits for it.
+         */
+        void stop();
+};
@@ -5,6 +5,18 @@
 Statistics::Statistics() : size(0.0), mean(0.0), variance(0.0), 
     standardDeviation(0.0) {}
 
+/*
+ * Creates a new data structure for statistics of a sequence of values with the
+ * specified size, mean and variance.
+ *
+ * @param size     the new statistics' sequence size.
+ * @param mean     the new statistics' sequence mean.
+ * @param variance the new statistics' sequence variance.
+ */
+Statistics::Statistics(unsigned int size, double mean, double variance) : 
+    size(size), mean(mean), variance(variance), 
+    standardDeviation(std::sqrt(variance)) {}
+
 
 /* 
  * Returns this statistics' sequence size.
@@ -55,3 +67,25 @@ void Statistics::addValue(double value) {
     this->standardDeviation = std::sqrt(this->variance);
 }
 
+/*
+ * Adds the values of the specified statistics' sequence into this statistics'
+ * sequence.
+ *
+ * @param statistics the statistics whose sequence is to be added into this
+ *                   statistics' sequence.
+ */
+void Statistics::merge(const Statistics & statistics) {
+    if (statistics.size == 0) {
+        return;
+    }
+
+    double n = this->size + statistics.size;
+    double delta = statistics.mean - this->mean;
+
+    /* Both sequences' sums of squared deviations, plus the shift between their means */
+    this->variance = (this->size * this->variance + statistics.size * 
+            statistics.variance + delta * delta * this->size * statistics.size / n) / n;
+    this->mean += delta * statistics.size / n;
+    this->size += statistics.size;
+    this->standardDeviation = std::sqrt(this->variance);
+}
@@ -32,6 +32,16 @@ class Statistics {
          */
         Statistics();
 
+        /*
+         * Creates a new data structure for statistics of a sequence of values
+         * with the specified size, mean and variance.
+         *
+         * @param size     the new statistics' sequence size.
+         * @param mean     the new statistics' sequence mean.
+         * @param variance the new statistics' sequence variance.
+         */
+        Statistics(unsigned int size, double mean, double variance);
+
         /* 
          * Returns this statistics' sequence size.
          *
@@ -67,5 +77,14 @@ class Statistics {
          *              sequence.
          */
         void addValue(double value);
+
+        /*
+         * Adds the values of the specified statistics' sequence into this
+         * statistics' sequence.
+         *
+         * @param statistics the statistics whose sequence is to be added into
+         *                   this statistics' sequence.
+         */
+        void merge(const Statistics & statistics);
 };
 
@@ -0,0 +1,75 @@
+#include "../bitset/Bitset.hpp"
+#include <cassert>
+#include <random>
+
+int main () {
+    Bitset bitset;
+
+    assert(bitset.size() == 0);
+    assert(bitset.count() == 0);
+    assert(bitset.findNext(0) == 0);
+
+    bitset = Bitset(130);
+
+    assert(bitset.size() == 130);
+    assert(bitset.count() == 0);
+    assert(bitset.findNext(0) == 130);
+
+    bitset.set(0);
+    bitset.set(63);
+    bitset.set(64);
+    bitset.set(129);
+
+    assert(bitset.count() == 4);
+    assert(bitset.test(0) && bitset.test(63) && bitset.test(64) && bitset.test(129));
+    assert(!bitset.test(1) && !bitset.test(65) && !bitset.test(128));
+    assert(bitset.findNext(0) == 0);
+    assert(bitset.findNext(1) == 63);
+    assert(bitset.findNext(64) == 64);
+    assert(bitset.findNext(65) == 129);
+    assert(bitset.findNext(130) == 130);
+
+    bitset.reset(63);
+
+    assert(bitset.count() == 3);
+    assert(!bitset.test(63));
+    assert(bitset.findNext(1) == 64);
+
+    bitset.clear();
+
+    assert(bitset.count() == 0);
+    assert(bitset.findNext(0) == 130);
+
+    /* The word-parallel counts agree with the element-wise ones, past whole vectors of words */
+    std::mt19937 generator (0);
+
+    for (unsigned int n : {1, 64, 255, 256, 257, 1000, 4099}) {
+        Bitset a (n), b (n);
+        unsigned int countA = 0, countAnd = 0, countAndNot = 0;
+
+        for (unsigned int i = 0; i < n; i++) {
+            bool isInA = generator() % 2 == 0;
+            bool isInB = generator() % 3 == 0;
+
+            if (isInA) {
+                a.set(i);
+                countA++;
+            }
+
+            if (isInB) {
+                b.set(i);
+            }
+
+            countAnd += isInA && isInB;
+            countAndNot += isInA && !isInB;
+        }
+
+        assert(a.count() == countA);
+        assert(a.countAnd(b) == countAnd);
+        assert(a.countAndNot(b) == countAndNot);
+        assert(a.countAndNot(a) == 0);
+        assert(a.countAnd(a) == countA);
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+#include "../solver/exact/branch-and-cut/ConnectivitySeparator.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+/*
+ * Verifies whether the specified edges are joined in the line graph after
+ * removing the specified separator.
+ *
+ * @param instance  the instance.
+ * @param eId       the first edge's id.
+ * @param fId       the second edge's id.
+ * @param separator the ids of the removed edges.
+ *
+ * @return true if the edges are joined; false otherwise.
+ */
+bool areJoined(const Instance & instance, unsigned int eId, unsigned int fId,
+        const std::vector<unsigned int> & separator) {
+    std::vector<bool> isReached (instance.getG().m() + 1, false);
+    std::vector<unsigned int> queue (1, eId);
+
+    for (unsigned int gId : separator) {
+        isReached[gId] = true;
+    }
+
+    isReached[eId] = true;
+
+    for (unsigned int i = 0; i < queue.size(); i++) {
+        for (std::vector<unsigned int>::const_iterator hIdIt =
+                instance.getAdjacentEdgesIdsBegin(queue[i]);
+                hIdIt != instance.getAdjacentEdgesIdsEnd(queue[i]); hIdIt++) {
+            if (!isReached[*hIdIt]) {
+                isReached[*hIdIt] = true;
+                queue.push_back(*hIdIt);
+            }
+        }
+    }
+
+    return isReached[fId] && std::find(separator.begin(), separator.end(), fId) ==
+        separator.end();
+}
+
+int main () {
+    Instance instance ("instances/exampleC.in");
+    ConnectivitySeparator separator (instance);
+    unsigned int n = instance.getG().m();
+    unsigned int eId = 1;
+    unsigned int fId = 0;
+    std::vector<std::vector<double> > x (n, std::vector<double> (instance.getM(), 0.0));
+
+    /* The first edge not adjacent to e */
+    for (unsigned int gId = 2; gId <= n && fId == 0; gId++) {
+        if (std::find(instance.getAdjacentEdgesIdsBegin(eId),
+                    instance.getAdjacentEdgesIdsEnd(eId), gId) ==
+                instance.getAdjacentEdgesIdsEnd(eId)) {
+            fId = gId;
+        }
+    }
+
+    assert(fId > 0);
+
+    /* Every edge in the first district is connected */
+    for (unsigned int gId = 1; gId <= n; gId++) {
+        x[gId - 1][0] = 1.0;
+    }
+
+    assert(separator.separate(x).empty());
+
+    /* Two disconnected edges in the first district */
+    for (unsigned int gId = 1; gId <= n; gId++) {
+        x[gId - 1][0] = 0.0;
+    }
+
+    x[eId - 1][0] = 1.0;
+    x[fId - 1][0] = 1.0;
+
+    std::vector<ConnectivityCut> cuts = separator.separate(x);
+
+    /* One cut around each of the two edges */
+    assert(cuts.size() == 2);
+
+    for (const ConnectivityCut & cut : cuts) {
+        assert(cut.j == 0);
+        assert(fabs(cut.violation - 1.0) < 1e-6);
+        assert(!cut.separator.empty());
+        assert(!areJoined(instance, cut.eId, cut.fId, cut.separator));
+    }
+
+    /* A fractional point: the separator's value lowers the violation */
+    for (unsigned int gId = 1; gId <= n; gId++) {
+        x[gId - 1][0] = 0.1;
+    }
+
+    x[eId - 1][0] = 0.9;
+    x[fId - 1][0] = 0.9;
+
+    cuts = separator.separate(x);
+
+    assert(!cuts.empty());
+
+    for (const ConnectivityCut & cut : cuts) {
+        double lhs = x[cut.eId - 1][cut.j] + x[cut.fId - 1][cut.j];
+
+        for (unsigned int gId : cut.separator) {
+            lhs -= x[gId - 1][cut.j];
+        }
+
+        assert(cut.violation > 0.0);
+        assert(cut.violation < 0.8);
+        assert(fabs(lhs - 1.0 - cut.violation) < 1e-6);
+        assert(!areJoined(instance, cut.eId, cut.fId, cut.separator));
+    }
+
+    for (unsigned int i = 1; i < cuts.size(); i++) {
+        assert(cuts[i - 1].violation >= cuts[i].violation);
+    }
+
+    /* Enough value around the edges satisfies every cut */
+    for (unsigned int gId = 1; gId <= n; gId++) {
+        x[gId - 1][0] = 0.8;
+    }
+
+    x[eId - 1][0] = 0.9;
+    x[fId - 1][0] = 0.9;
+
+    assert(separator.separate(x).empty());
+
+    /* The cuts are bounded per district */
+    separator = ConnectivitySeparator(instance, 1, n, 1e-4);
+
+    for (unsigned int gId = 1; gId <= n; gId++) {
+        x[gId - 1][0] = (gId % 2 == 0) ? 1.0 : 0.0;
+        x[gId - 1][1] = (gId % 2 == 0) ? 0.0 : 1.0;
+    }
+
+    cuts = separator.separate(x);
+
+    assert(cuts.size() <= instance.getM());
+
+    for (unsigned int i = 1; i < cuts.size(); i++) {
+        assert(cuts[i - 1].j < cuts[i].j);
+    }
+
+    return 0;
+}
@@ -1,6 +1,11 @@
+#include "../solver/heuristic/arena/HeapCounter.hpp"
 #include "../solver/metaheuristic/grasp/GRASPSolver.hpp"
 #include <cassert>
 #include <cfloat>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 int main () {
     unsigned int timeLimit = 5;
@@ -191,6 +196,223 @@ int main () {
         assert(solver.getLocalSearchCounter() <= solver.getSolutionsCounter());
     }
 
+    for (unsigned int pathRelinking = PathRelinkingHeuristic::FORWARD; 
+            pathRelinking <= PathRelinkingHeuristic::MIXED; pathRelinking++) {
+        instance = Instance("instances/exampleF.in");
+
+        solver = GRASPSolver(instance, timeLimit, 0, m, k, true, 10, pathRelinking, 0);
+
+        solver.solve();
+
+        assert(solver.getSolutionsCounter() > 0);
+        assert(solver.getBestPrimalBound() >= 84);
+        assert(solver.getBestPrimalSolution().isFeasible());
+        assert(solver.getBestPrimalSolution().getValue() == solver.getBestPrimalBound());
+        assert(solver.getPathRelinkingCounter() > 0);
+        assert(solver.getPathRelinkingCounter() <= solver.getLocalSearchCounter());
+        assert(solver.getPathRelinkingImprovementsCounter() <= 
+                solver.getPathRelinkingCounter());
+    }
+
+    instance = Instance("instances/exampleA.in");
+
+    solver = GRASPSolver(instance, timeLimit, 0, m, k, true, 0, 
+            PathRelinkingHeuristic::MIXED, 100);
+
+    solver.solve();
+
+    assert(solver.getBestPrimalBound() >= 2);
+    assert(solver.getBestPrimalSolution().isFeasible());
+    assert(solver.getCacheHitsCounter() > 0);
+    assert(solver.getCacheHitsCounter() <= solver.getCacheLookupsCounter());
+    assert(solver.getLocalSearchCounter() + solver.getCacheHitsCounter() == 
+            solver.getCacheLookupsCounter());
+
+    AlphaSelector alphaSelector (4, AlphaSelector::REACTIVE);
+    std::mt19937 generator (0);
+    std::vector<unsigned int> choices (4, 0);
+
+    alphaSelector.addValue(0, 1.0);
+    alphaSelector.addValue(1, 2.0);
+    alphaSelector.addValue(2, 3.0);
+    alphaSelector.addValue(3, 4.0);
+    alphaSelector.reevaluateProbabilities();
+
+    for (unsigned int t = 0; t < 100000; t++) {
+        choices[alphaSelector.chooseAlpha(generator)]++;
+    }
+
+    for (unsigned int i = 0; i < 4; i++) {
+        assert(fabs(alphaSelector.getP(i) - (i + 1) / 10.0) < 0.001);
+        assert(fabs(choices[i] / 100000.0 - alphaSelector.getP(i)) < 0.01);
+    }
+
+    for (unsigned int alphaPolicy = AlphaSelector::UCB1; 
+            alphaPolicy <= AlphaSelector::THOMPSON; alphaPolicy++) {
+        instance = Instance("instances/exampleF.in");
+
+        solver = GRASPSolver(instance, timeLimit, 0, m, k, true, 0, 
+                PathRelinkingHeuristic::MIXED, 0, alphaPolicy);
+
+        solver.solve();
+
+        assert(solver.getBestPrimalBound() >= 84);
+        assert(solver.getBestPrimalSolution().isFeasible());
+
+        double sumP = 0.0;
+
+        for (unsigned int i = 0; i < m; i++) {
+            assert(solver.getPrimalBoundStatictics(i).getSize() > 0);
+            sumP += solver.getP(i);
+        }
+
+        assert(fabs(sumP - 1.0) < 0.001);
+
+        std::stringstream ss;
+        AlphaSelector importedAlphaSelector (m, alphaPolicy);
+
+        solver.getAlphaSelector().write(ss);
+        importedAlphaSelector.read(ss);
+        importedAlphaSelector.merge(solver.getAlphaSelector());
+
+        for (unsigned int i = 0; i < m; i++) {
+            const Statistics & statistics = solver.getAlphaSelector().getPrimalBoundStatistics(i);
+
+            assert(importedAlphaSelector.getPrimalBoundStatistics(i).getSize() == 
+                    2 * statistics.getSize());
+            assert(fabs(importedAlphaSelector.getPrimalBoundStatistics(i).getMean() - 
+                        statistics.getMean()) < 0.001);
+        }
+    }
+
+    instance = Instance("instances/exampleF.in");
+
+    solver = GRASPSolver(instance, 2, 0, m, k, true, 10, 
+            PathRelinkingHeuristic::MIXED, 100);
+    solver.setCheckpoint("bin/test/GRASPSolverTest.ckpt", 0);
+
+    solver.solve();
+
+    GRASPSolver resumedSolver = GRASPSolver(instance, timeLimit, 0, m, k, true, 10, 
+            PathRelinkingHeuristic::MIXED, 100);
+    std::stringstream checkpoint, resumedCheckpoint;
+
+    resumedSolver.resume("bin/test/GRASPSolverTest.ckpt");
+    resumedSolver.writeCheckpoint(resumedCheckpoint);
+
+    std::ifstream ifs ("bin/test/GRASPSolverTest.ckpt", std::ios::binary);
+    checkpoint << ifs.rdbuf();
+
+    assert(checkpoint.str() == resumedCheckpoint.str());
+    assert(resumedSolver.getIterationsCounter() == solver.getIterationsCounter());
+    assert(resumedSolver.getBestPrimalBound() == solver.getBestPrimalBound());
+    assert(resumedSolver.getPrimalBoundStatictics(0).getSize() == 
+            solver.getPrimalBoundStatictics(0).getSize());
+
+    resumedSolver.solve();
+
+    assert(resumedSolver.getIterationsCounter() > solver.getIterationsCounter());
+    assert(resumedSolver.getBestPrimalBound() >= solver.getBestPrimalBound());
+    assert(resumedSolver.getBestPrimalSolution().isFeasible());
+    assert(resumedSolver.getSolvingTime() >= timeLimit);
+
+    /* A run resumed from a checkpoint takes the same path as an uninterrupted one */
+    std::stringstream interruptedCheckpoint;
+
+    solver = GRASPSolver(instance, timeLimit, 0, m, k, true, 10, 
+            PathRelinkingHeuristic::MIXED, 100);
+    solver.setLNS(2, 1);
+    solver.setIterationsLimit(20);
+
+    solver.solve();
+    solver.writeCheckpoint(interruptedCheckpoint);
+
+    GRASPSolver uninterruptedSolver = GRASPSolver(instance, timeLimit, 0, m, k, true, 10, 
+            PathRelinkingHeuristic::MIXED, 100);
+    uninterruptedSolver.setLNS(2, 1);
+    uninterruptedSolver.setIterationsLimit(60);
+    uninterruptedSolver.setAllocationsCounter(HeapCounter::getAllocationsCounter);
+
+    uninterruptedSolver.solve();
+
+    resumedSolver = GRASPSolver(instance, timeLimit, 0, m, k, true, 10, 
+            PathRelinkingHeuristic::MIXED, 100);
+    resumedSolver.setLNS(2, 1);
+    resumedSolver.setIterationsLimit(60);
+    resumedSolver.readCheckpoint(interruptedCheckpoint);
+
+    resumedSolver.solve();
+
+    assert(solver.getLNSCounter() > 0);
+    assert(uninterruptedSolver.getLNSCounter() > solver.getLNSCounter());
+    assert(resumedSolver.getIterationsCounter() == uninterruptedSolver.getIterationsCounter());
+    assert(resumedSolver.getLNSCounter() == uninterruptedSolver.getLNSCounter());
+    assert(resumedSolver.getLNSImprovementsCounter() == 
+            uninterruptedSolver.getLNSImprovementsCounter());
+    assert(resumedSolver.getBestSolutionIteration() == 
+            uninterruptedSolver.getBestSolutionIteration());
+    assert(resumedSolver.getBestPrimalBound() == uninterruptedSolver.getBestPrimalBound());
+    assert(resumedSolver.getBestPrimalSolution().getHash() == 
+            uninterruptedSolver.getBestPrimalSolution().getHash());
+    assert(resumedSolver.getPrimalBoundStatictics(0).getSize() == 
+            uninterruptedSolver.getPrimalBoundStatictics(0).getSize());
+
+    /* Each thread counts only its own heap allocations */
+    unsigned long long heapAllocationsCounter = HeapCounter::getAllocationsCounter();
+    std::thread allocatingThread ([] () {
+        for (unsigned int i = 0; i < 1000; i++) {
+            delete new unsigned int (i);
+        }
+    });
+
+    allocatingThread.join();
+    assert(HeapCounter::getAllocationsCounter() - heapAllocationsCounter < 1000);
+
+    heapAllocationsCounter = HeapCounter::getAllocationsCounter();
+    delete new unsigned int (0);
+    assert(HeapCounter::getAllocationsCounter() == heapAllocationsCounter + 1);
+
+    /* Only the instrumented solver counts the heap allocations of its iterations and writes them */
+    std::stringstream instrumentedStatistics, plainStatistics;
+
+    uninterruptedSolver.write(instrumentedStatistics);
+    resumedSolver.write(plainStatistics);
+
+    assert(uninterruptedSolver.getHeapAllocationsStatistics().getSize() == 60);
+    assert(uninterruptedSolver.getHeapAllocationsStatistics().getMean() > 0.0);
+    assert(resumedSolver.getHeapAllocationsStatistics().getSize() == 0);
+    assert(instrumentedStatistics.str().find("Heap allocations per iteration mean") != 
+            std::string::npos);
+    assert(plainStatistics.str().find("Arena") == std::string::npos);
+    assert(plainStatistics.str().find("Heap allocations") == std::string::npos);
+
+    instance = Instance("instances/exampleA.in");
+
+    solver = GRASPSolver(instance, timeLimit, 0, m, k, true);
+    solver.setLagrangianBound(true);
+
+    solver.solve();
+
+    assert(solver.getBestPrimalBound() == solver.getBestDualBound());
+    assert(solver.getSolvingTime() < timeLimit);
+
+    instance = Instance("instances/exampleF.in");
+
+    LagrangianRelaxation relaxation (instance);
+
+    relaxation.solve(timeLimit);
+
+    assert(relaxation.getIterationsCounter() > 0);
+    assert(relaxation.getBound() >= 102);
+
+    solver = GRASPSolver(instance, 1, 0, m, k, true);
+    solver.setLagrangianBound(true);
+
+    solver.solve();
+
+    assert(solver.getBestDualBound() < DBL_MAX);
+    assert(solver.getBestPrimalBound() <= solver.getBestDualBound());
+
     return 0;
 }
 
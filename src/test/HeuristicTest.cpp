@@ -1,7 +1,15 @@
+#include "../solver/heuristic/arena/IterationArena.hpp"
 #include "../solver/heuristic/constructive/GreedyConstructiveHeuristic.hpp"
+#include "../solver/heuristic/constructive/RegionGrowingConstructiveHeuristic.hpp"
+#include "../solver/heuristic/fixer/IndexedPriorityQueue.hpp"
+#include "../solver/heuristic/fixer/MinimumCostFlow.hpp"
 #include "../solver/heuristic/fixer/SolutionFixer.hpp"
 #include "../solver/heuristic/localsearch/LocalSearchHeuristic.hpp"
+#include "../solver/heuristic/pathrelinking/PathRelinkingHeuristic.hpp"
+#include "../solver/heuristic/lns/LNSHeuristic.hpp"
 #include <cassert>
+#include <cfloat>
+#include <sstream>
 
 int main () {
     unsigned int seed;
@@ -110,6 +118,502 @@ int main () {
         }
     }
 
+    PathRelinkingHeuristic prHeuristic;
+    Solution eliteSolution, relinkedSolution;
+
+    for (seed = 0; seed < 20; seed++) {
+        instance = Instance("instances/exampleF.in");
+        gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.5);
+        lsHeuristic = LocalSearchHeuristic(instance, seed);
+        prHeuristic = PathRelinkingHeuristic(instance, seed);
+        constructedSolution = gcHeuristic.constructSolution(timeLimit);
+        eliteSolution = gcHeuristic.constructSolution(timeLimit);
+
+        if (constructedSolution.isFeasible() && eliteSolution.isFeasible()) {
+            improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+            eliteSolution = lsHeuristic.improveSolution(eliteSolution, timeLimit);
+
+            for (unsigned int direction = PathRelinkingHeuristic::FORWARD; 
+                    direction <= PathRelinkingHeuristic::MIXED; direction++) {
+                relinkedSolution = prHeuristic.relinkSolutions(improvedSolution, 
+                        eliteSolution, direction, timeLimit);
+
+                if (!relinkedSolution.isEmpty()) {
+                    assert(relinkedSolution.isFeasible());
+                }
+            }
+        }
+    }
+
+    std::vector<std::string> filenames = {"instances/exampleF.in",
+                                          "instances/grid-m5V49E84B10D10.in"};
+
+    /* Every district keeps a single connected component after the repair of disconnected districts */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.6);
+            constructedSolution = SolutionFixer::fixDisconnectedDistricts(
+                    gcHeuristic.constructSolution(timeLimit), timeLimit);
+
+            for (const std::set<Edge> & district : constructedSolution.getDistricts()) {
+                assert(district.empty() || 
+                        instance.getG().getInducedSubGraph(district).isConnected());
+            }
+        }
+    }
+
+    /* The flow rebalancing keeps connected partitions connected partitions */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.6);
+            constructedSolution = SolutionFixer::fixSolution(
+                    gcHeuristic.constructSolution(timeLimit), timeLimit);
+
+            if (constructedSolution.isPartition() && constructedSolution.isConnected()) {
+                Solution rebalancedSolution = SolutionFixer::fixUnbalancedDistricts(
+                        constructedSolution, timeLimit);
+
+                assert(rebalancedSolution.isPartition());
+                assert(rebalancedSolution.isConnected());
+                assert(!constructedSolution.isBalanced() || 
+                        rebalancedSolution.getValue() == constructedSolution.getValue());
+            }
+        }
+    }
+
+    /* Only paths through the penalized arc s → a are augmented, along a → b → t at cost -9 */
+    MinimumCostFlow penalizedFlow (4);
+    std::vector<unsigned int> arcs;
+
+    arcs.push_back(penalizedFlow.addArc(0, 1, 2, -10));
+    arcs.push_back(penalizedFlow.addArc(1, 3, 1, 3));
+    arcs.push_back(penalizedFlow.addArc(1, 2, 5, 0));
+    arcs.push_back(penalizedFlow.addArc(2, 3, 5, 1));
+    arcs.push_back(penalizedFlow.addArc(0, 2, 3, 0));
+
+    assert(penalizedFlow.solve(0, 3, -5) == -18);
+    assert(penalizedFlow.getFlow(arcs[0]) == 2);
+    assert(penalizedFlow.getFlow(arcs[1]) == 0);
+    assert(penalizedFlow.getFlow(arcs[2]) == 2);
+    assert(penalizedFlow.getFlow(arcs[3]) == 2);
+    assert(penalizedFlow.getFlow(arcs[4]) == 0);
+
+    /* Without the bound the free path s → b → t is augmented as well */
+    MinimumCostFlow freeFlow (4);
+
+    arcs.clear();
+    arcs.push_back(freeFlow.addArc(0, 1, 2, -10));
+    arcs.push_back(freeFlow.addArc(1, 3, 1, 3));
+    arcs.push_back(freeFlow.addArc(1, 2, 5, 0));
+    arcs.push_back(freeFlow.addArc(2, 3, 5, 1));
+    arcs.push_back(freeFlow.addArc(0, 2, 3, 0));
+
+    assert(freeFlow.solve(0, 3, DBL_MAX) == -15);
+    assert(freeFlow.getFlow(arcs[0]) == 2);
+    assert(freeFlow.getFlow(arcs[1]) == 0);
+    assert(freeFlow.getFlow(arcs[2]) == 2);
+    assert(freeFlow.getFlow(arcs[3]) == 5);
+    assert(freeFlow.getFlow(arcs[4]) == 3);
+
+    /*
+     * The 9-edge path splits into E_{1} = {e1, ..., e5} (demand 10 > 8.4), E_{2} =
+     * {e6, e7, e8} and E_{3} = {e9} (demand 2 < 3.6): the flow sends the excess of
+     * E_{1} through E_{2} to E_{3}, moving e5 to E_{2} and e8 to E_{3}
+     */
+    std::stringstream unbalancedInstance ("3\n100\n0.4\n10 9\n"
+            "0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n1 2 1\n2 3 1\n3 4 1\n4 5 1\n5 6 1\n6 7 1\n7 8 1\n8 9 1\n"
+            "3 0 0\n3 0 0\n3 0 0\n3 0 0\n3 1 0\n0 3 0\n0 3 0\n0 3 1\n0 0 3\n");
+
+    instance = Instance(unbalancedInstance);
+    constructedSolution = Solution(instance,
+            std::vector<unsigned int>({0, 0, 0, 0, 0, 1, 1, 1, 2}));
+
+    assert(constructedSolution.isPartition());
+    assert(constructedSolution.isConnected());
+    assert(!constructedSolution.isBalanced());
+
+    Solution rebalancedSolution = SolutionFixer::fixUnbalancedDistricts(constructedSolution,
+            timeLimit);
+
+    assert(rebalancedSolution.getEdgesDistrict() ==
+            std::vector<unsigned int>({0, 0, 0, 0, 1, 1, 1, 2, 2}));
+    assert(rebalancedSolution.isBalanced());
+    assert(rebalancedSolution.isFeasible());
+    assert(rebalancedSolution.getValue() == 23);
+
+    /* The swap, chain and shift neighbourhoods keep the local optima feasible */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.3);
+            lsHeuristic = LocalSearchHeuristic(instance, seed);
+            lsHeuristic.setVND(true);
+            constructedSolution = gcHeuristic.constructSolution(timeLimit);
+
+            if (!constructedSolution.isFeasible()) {
+                constructedSolution = SolutionFixer::fixSolution(constructedSolution, timeLimit);
+            }
+
+            if (constructedSolution.isFeasible()) {
+                improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+                assert(improvedSolution.isFeasible());
+                assert(improvedSolution.getValue() >= constructedSolution.getValue());
+            }
+        }
+    }
+
+
+    /* Only a swap improves the 4-cycle: {e1, e2}, {e3, e4} → {e1, e4}, {e2, e3} */
+    std::stringstream swapInstance ("2\n100\n0\n4 4\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n0 3 1\n1 2 1\n2 3 1\n10 0\n5 0\n0 5\n0 10\n");
+
+    instance = Instance(swapInstance);
+    lsHeuristic = LocalSearchHeuristic(instance, 0);
+    constructedSolution = Solution(instance, std::vector<unsigned int>({0, 1, 0, 1}));
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == constructedSolution.getEdgesDistrict());
+
+    lsHeuristic.setVND(true);
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == std::vector<unsigned int>({0, 0, 1, 1}));
+    assert(improvedSolution.isFeasible());
+    assert(improvedSolution.getValue() == 30);
+
+    /* Only a chain improves the path: e2 moves into E_{2} while e3 leaves it for E_{3} */
+    std::stringstream chainInstance ("3\n100\n0.5\n5 4\n0 0\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n1 2 1\n2 3 1\n3 4 1\n10 0 0\n5 4 0\n0 1 6\n0 0 10\n");
+
+    instance = Instance(chainInstance);
+    lsHeuristic = LocalSearchHeuristic(instance, 0);
+    constructedSolution = Solution(instance, std::vector<unsigned int>({0, 0, 1, 2}));
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == constructedSolution.getEdgesDistrict());
+
+    lsHeuristic.setVND(true);
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == std::vector<unsigned int>({0, 1, 2, 2}));
+    assert(improvedSolution.isFeasible());
+    assert(improvedSolution.getValue() == 30);
+
+    /* Only a shift improves the path: e3 alone loses, e3 with e2 gains */
+    std::stringstream shiftInstance ("2\n100\n0.7\n6 5\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n1 2 1\n2 3 1\n3 4 1\n4 5 1\n10 0\n0 6\n5 4\n0 10\n0 10\n");
+
+    instance = Instance(shiftInstance);
+    lsHeuristic = LocalSearchHeuristic(instance, 0);
+    constructedSolution = Solution(instance, std::vector<unsigned int>({0, 0, 0, 1, 1}));
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == constructedSolution.getEdgesDistrict());
+
+    lsHeuristic.setVND(true);
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == std::vector<unsigned int>({0, 1, 1, 1, 1}));
+    assert(improvedSolution.isFeasible());
+    assert(improvedSolution.getValue() == 40);
+
+    /* The best improvement and candidate list strategies also keep the local optima feasible */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.3);
+            constructedSolution = gcHeuristic.constructSolution(timeLimit);
+
+            if (!constructedSolution.isFeasible()) {
+                constructedSolution = SolutionFixer::fixSolution(constructedSolution, timeLimit);
+            }
+
+            if (constructedSolution.isFeasible()) {
+                for (unsigned int strategy = LocalSearchHeuristic::BEST_IMPROVEMENT;
+                        strategy <= LocalSearchHeuristic::CANDIDATE_LIST; strategy++) {
+                    lsHeuristic = LocalSearchHeuristic(instance, seed);
+                    lsHeuristic.setStrategy(strategy, 3);
+                    improvedSolution = lsHeuristic.improveSolution(constructedSolution,
+                            timeLimit);
+
+                    assert(improvedSolution.isFeasible());
+                    assert(improvedSolution.getValue() >= constructedSolution.getValue());
+                }
+            }
+        }
+    }
+
+
+    /* The best move fills E_{2}'s slack first: e4 (gain 7) goes in, e2 (gain 3) is blocked */
+    std::stringstream bestMoveInstance ("3\n100\n0.5\n6 5\n0 0\n0 0\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n1 2 1\n2 3 1\n3 4 1\n4 5 1\n10 0 0\n2 5 0\n0 10 0\n0 7 0\n0 0 10\n");
+
+    instance = Instance(bestMoveInstance);
+    lsHeuristic = LocalSearchHeuristic(instance, 0);
+    lsHeuristic.setStrategy(LocalSearchHeuristic::BEST_IMPROVEMENT, 1);
+    constructedSolution = Solution(instance, std::vector<unsigned int>({0, 0, 1, 2, 2}));
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == std::vector<unsigned int>({0, 0, 1, 1, 2}));
+    assert(improvedSolution.isFeasible());
+    assert(improvedSolution.getValue() == 39);
+
+    /*
+     * Once e3 (gain 8) joins E_{1}, the heap's move of e2 into E_{2} (gain 5)
+     * is outdated: e2 no longer touches E_{2}, which it would disconnect
+     */
+    std::stringstream staleMoveInstance ("2\n100\n0.6\n5 4\n0 0\n0 0\n0 0\n0 0\n0 0\n"
+            "0 1 1\n0 2 1\n0 3 1\n3 4 1\n10 0\n0 5\n8 0\n0 10\n");
+
+    instance = Instance(staleMoveInstance);
+    lsHeuristic = LocalSearchHeuristic(instance, 0);
+    lsHeuristic.setStrategy(LocalSearchHeuristic::BEST_IMPROVEMENT, 1);
+    constructedSolution = Solution(instance, std::vector<unsigned int>({0, 0, 1, 1}));
+    improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+    assert(improvedSolution.getEdgesDistrict() == std::vector<unsigned int>({0, 0, 0, 1}));
+    assert(improvedSolution.isFeasible());
+    assert(improvedSolution.getValue() == 28);
+
+    /* The batches of the districts of a colour class are committed without conflicts */
+    unsigned int parallelClassesCounter = 0;
+
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.3);
+            lsHeuristic = LocalSearchHeuristic(instance, seed);
+            lsHeuristic.setThreadsNumber(4);
+            constructedSolution = gcHeuristic.constructSolution(timeLimit);
+
+            if (!constructedSolution.isFeasible()) {
+                constructedSolution = SolutionFixer::fixSolution(constructedSolution, timeLimit);
+            }
+
+            if (constructedSolution.isFeasible()) {
+                improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+
+                assert(improvedSolution.isFeasible());
+                assert(improvedSolution.getValue() >= constructedSolution.getValue());
+
+                /* Every class of these small instances is split among the threads */
+                LocalSearchHeuristic sequentialLSHeuristic (instance, seed);
+                lsHeuristic.setThreadEdgesNumber(1);
+
+                Solution parallelSolution = lsHeuristic.improveSolutionInParallel(
+                        constructedSolution, timeLimit);
+                Solution sequentialSolution = sequentialLSHeuristic.improveSolutionInParallel(
+                        constructedSolution, timeLimit);
+
+                assert(parallelSolution.isPartition());
+                assert(parallelSolution.isConnected());
+                assert(parallelSolution.respectsCapacity());
+                assert(parallelSolution.isBalanced());
+                assert(parallelSolution.getValue() >= constructedSolution.getValue());
+                assert(parallelSolution.getEdgesDistrict() == 
+                        sequentialSolution.getEdgesDistrict());
+                assert(sequentialLSHeuristic.getParallelClassesCounter() == 0);
+
+                parallelClassesCounter += lsHeuristic.getParallelClassesCounter();
+            }
+        }
+    }
+
+    assert(parallelClassesCounter > 0);
+
+    /* The arena yields the same solutions and stops reaching the global heap once grown */
+    for (const std::string & filename : filenames) {
+        instance = Instance(filename);
+        IterationArena arena (1024);
+        unsigned long long upstreamAllocationsCounter = 0;
+
+        /* The second pass repeats the first one's iterations on the grown arena */
+        for (unsigned int pass = 0; pass < 2; pass++) {
+            GreedyConstructiveHeuristic arenaGCHeuristic (instance, 0, 0.3);
+            LocalSearchHeuristic arenaLSHeuristic (instance, 0);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, 0, 0.3);
+            lsHeuristic = LocalSearchHeuristic(instance, 0);
+            arenaGCHeuristic.setMemoryResource(arena.getResource());
+            arenaLSHeuristic.setMemoryResource(arena.getResource());
+            upstreamAllocationsCounter = arena.getUpstreamAllocationsCounter();
+
+            for (seed = 0; seed < 10; seed++) {
+                arena.reset();
+                constructedSolution = gcHeuristic.constructSolution(timeLimit);
+                Solution arenaSolution = arenaGCHeuristic.constructSolution(timeLimit);
+
+                assert(arenaSolution.getHash() == constructedSolution.getHash());
+
+                if (!constructedSolution.isFeasible()) {
+                    constructedSolution = SolutionFixer::fixSolution(constructedSolution,
+                            timeLimit);
+                    arenaSolution = SolutionFixer::fixSolution(arenaSolution, timeLimit,
+                            false, arena.getResource());
+
+                    assert(arenaSolution.getHash() == constructedSolution.getHash());
+                }
+
+                if (constructedSolution.isFeasible()) {
+                    improvedSolution = lsHeuristic.improveSolution(constructedSolution,
+                            timeLimit);
+                    arenaSolution = arenaLSHeuristic.improveSolution(arenaSolution,
+                            timeLimit);
+
+                    assert(arenaSolution.getHash() == improvedSolution.getHash());
+                }
+            }
+
+            arena.reset();
+        }
+
+        assert(arena.getUpstreamAllocationsCounter() == upstreamAllocationsCounter);
+    }
+
+    RegionGrowingConstructiveHeuristic rgHeuristic;
+
+    /* The districts grown from spread seeds form a connected partition */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 10; seed++) {
+            for (unsigned int seeding = RegionGrowingConstructiveHeuristic::EUCLIDEAN_SEEDING;
+                    seeding <= RegionGrowingConstructiveHeuristic::LINE_GRAPH_SEEDING;
+                    seeding++) {
+                instance = Instance(filename);
+                rgHeuristic = RegionGrowingConstructiveHeuristic(instance, seed, 0.3, seeding);
+                lsHeuristic = LocalSearchHeuristic(instance, seed);
+                constructedSolution = rgHeuristic.constructSolution(timeLimit);
+
+                assert(constructedSolution.isPartition());
+                assert(constructedSolution.isConnected());
+
+                if (!constructedSolution.isFeasible()) {
+                    constructedSolution = SolutionFixer::fixSolution(constructedSolution,
+                            timeLimit);
+                }
+
+                if (constructedSolution.isFeasible()) {
+                    improvedSolution = lsHeuristic.improveSolution(constructedSolution,
+                            timeLimit);
+
+                    assert(improvedSolution.isFeasible());
+                    assert(improvedSolution.getValue() >= constructedSolution.getValue());
+                }
+            }
+        }
+    }
+
+    LNSHeuristic lnsHeuristic;
+
+    /* Small freed regions are solved exhaustively, larger ones by restarts in two threads */
+    for (const std::string & filename : filenames) {
+        for (seed = 0; seed < 5; seed++) {
+            instance = Instance(filename);
+            gcHeuristic = GreedyConstructiveHeuristic(instance, seed, 0.05);
+            lsHeuristic = LocalSearchHeuristic(instance, seed);
+            lnsHeuristic = LNSHeuristic(instance, seed, 3, 10, 15, 2);
+            constructedSolution = gcHeuristic.constructSolution(timeLimit);
+
+            if (!constructedSolution.isFeasible()) {
+                constructedSolution = SolutionFixer::fixSolution(constructedSolution, timeLimit);
+            }
+
+            if (constructedSolution.isFeasible()) {
+                improvedSolution = lsHeuristic.improveSolution(constructedSolution, timeLimit);
+                Solution lnsSolution = lnsHeuristic.improveSolution(improvedSolution, timeLimit);
+
+                assert(lnsSolution.isFeasible());
+                assert(lnsSolution.getValue() >= improvedSolution.getValue());
+
+                /* Freeing the three districts of exampleF reaches its optimum */
+                if (filename == "instances/exampleF.in") {
+                    assert(lnsSolution.getValue() == 102);
+                }
+            }
+        }
+    }
+
+    IndexedPriorityQueue queue;
+    std::vector<std::array<double, 3> > keys = {{1, 0, 0}, {1, 2, 0}, {1, 2, 5}, {0, 9, 9},
+        {2, 0, 0}, {1, 2, 3}};
+    std::vector<unsigned int> order;
+
+    /* The ids are popped in decreasing lexicographic order of their keys */
+    queue = IndexedPriorityQueue(keys.size());
+
+    for (unsigned int id = 1; id <= keys.size(); id++) {
+        queue.push(id, keys[id - 1]);
+    }
+
+    order.clear();
+
+    while (!queue.isEmpty()) {
+        order.push_back(queue.top());
+        queue.remove(queue.top());
+    }
+
+    assert(order == std::vector<unsigned int>({5, 3, 6, 2, 1, 4}));
+
+    /* Pushing an id already in the queue raises or lowers its key in place */
+    queue = IndexedPriorityQueue(keys.size());
+
+    for (unsigned int id = 1; id <= keys.size(); id++) {
+        queue.push(id, keys[id - 1]);
+    }
+
+    queue.push(4, {3, 0, 0});
+    assert(queue.top() == 4);
+    queue.push(4, {-1, 0, 0});
+    assert(queue.top() == 5);
+    queue.push(5, {1, 2, 4});
+    assert(queue.top() == 3);
+    queue.push(1, {1, 2, 4.5});
+    assert((queue.getKey(1) == std::array<double, 3>({1, 2, 4.5})));
+
+    order.clear();
+
+    while (!queue.isEmpty()) {
+        order.push_back(queue.top());
+        queue.remove(queue.top());
+    }
+
+    assert(order == std::vector<unsigned int>({3, 1, 5, 6, 2, 4}));
+
+    /* Removing the last (2), a middle (3) and the top (5) id of the heap {5, 3, 6, 4, 1, 2} */
+    queue = IndexedPriorityQueue(keys.size());
+
+    for (unsigned int id = 1; id <= keys.size(); id++) {
+        queue.push(id, keys[id - 1]);
+    }
+
+    queue.remove(2);
+    queue.remove(3);
+    queue.remove(5);
+    queue.remove(3);
+
+    assert(!queue.contains(2));
+    assert(!queue.contains(3));
+    assert(!queue.contains(5));
+    assert(queue.contains(1) && queue.contains(4) && queue.contains(6));
+    assert(queue.top() == 6);
+
+    queue.push(2, {3, 0, 0});
+    assert(queue.contains(2));
+
+    order.clear();
+
+    while (!queue.isEmpty()) {
+        order.push_back(queue.top());
+        queue.remove(queue.top());
+    }
+
+    assert(order == std::vector<unsigned int>({2, 6, 1, 4}));
+
+    for (unsigned int id = 1; id <= keys.size(); id++) {
+        assert(!queue.contains(id));
+    }
+
     return 0;
 }
-
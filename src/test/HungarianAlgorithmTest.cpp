@@ -0,0 +1,87 @@
+#include "../hungarian-algorithm/HungarianAlgorithm.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <random>
+
+int main () {
+    HungarianAlgorithm hungarianAlgorithm;
+
+    assert(hungarianAlgorithm.size() == 0);
+    assert(hungarianAlgorithm.maxCostAssignment().empty());
+    assert(hungarianAlgorithm.isIdentity());
+
+    hungarianAlgorithm.reset(3);
+
+    hungarianAlgorithm.setCost(0, 0, 1.0);
+    hungarianAlgorithm.setCost(0, 1, 2.0);
+    hungarianAlgorithm.setCost(0, 2, 3.0);
+    hungarianAlgorithm.setCost(1, 0, 2.0);
+    hungarianAlgorithm.setCost(1, 1, 4.0);
+    hungarianAlgorithm.setCost(1, 2, 6.0);
+    hungarianAlgorithm.setCost(2, 0, 3.0);
+    hungarianAlgorithm.setCost(2, 1, 6.0);
+    hungarianAlgorithm.setCost(2, 2, 9.5);
+
+    std::vector<unsigned int> assignment = hungarianAlgorithm.maxCostAssignment();
+
+    assert(assignment[0] == 0);
+    assert(assignment[1] == 1);
+    assert(assignment[2] == 2);
+    assert(hungarianAlgorithm.isIdentity());
+
+    assignment = hungarianAlgorithm.minCostAssignment();
+
+    assert(assignment[0] == 2);
+    assert(assignment[1] == 1);
+    assert(assignment[2] == 0);
+    assert(!hungarianAlgorithm.isIdentity());
+
+    std::mt19937 generator (0);
+    std::uniform_real_distribution<double> distribution (-100.0, 100.0);
+
+    for (unsigned int n = 1; n <= 7; n++) {
+        for (unsigned int t = 0; t < 20; t++) {
+            hungarianAlgorithm.reset(n);
+
+            for (unsigned int i = 0; i < n; i++) {
+                for (unsigned int j = 0; j < n; j++) {
+                    hungarianAlgorithm.setCost(i, j, distribution(generator));
+                }
+            }
+
+            std::vector<unsigned int> permutation (n);
+            double bestCost = -HUGE_VAL;
+
+            for (unsigned int i = 0; i < n; i++) {
+                permutation[i] = i;
+            }
+
+            do {
+                double cost = 0.0;
+
+                for (unsigned int i = 0; i < n; i++) {
+                    cost += hungarianAlgorithm.getCost(i, permutation[i]);
+                }
+
+                bestCost = std::max(bestCost, cost);
+            } while (std::next_permutation(permutation.begin(), permutation.end()));
+
+            assignment = hungarianAlgorithm.maxCostAssignment();
+
+            std::vector<bool> assigned (n, false);
+            double cost = 0.0;
+
+            for (unsigned int i = 0; i < n; i++) {
+                assert(assignment[i] < n);
+                assert(!assigned[assignment[i]]);
+                assigned[assignment[i]] = true;
+                cost += hungarianAlgorithm.getCost(i, assignment[i]);
+            }
+
+            assert(fabs(cost - bestCost) < 0.001);
+        }
+    }
+
+    return 0;
+}
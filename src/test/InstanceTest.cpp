@@ -1,5 +1,6 @@
 #include "../instance/Instance.hpp"
 #include <cassert>
+#include <sstream>
 
 int main () {
     Instance instance;
@@ -1405,6 +1406,83 @@ int main () {
 
     assert(leafEdges.size() == 0);
 
+    for (const Edge & e : instance.getG().getEdges()) {
+        unsigned int eId = instance.getG().getEdgeId(e);
+
+        assert(instance.getEdge(eId) == e);
+
+        adjacentEdges = instance.getG().getAdjacentEdges(e);
+        E.clear();
+
+        for (std::vector<unsigned int>::const_iterator fIdIt = 
+                instance.getAdjacentEdgesIdsBegin(eId); 
+                fIdIt != instance.getAdjacentEdgesIdsEnd(eId); fIdIt++) {
+            E.insert(instance.getEdge(*fIdIt));
+        }
+
+        assert(E == adjacentEdges);
+    }
+
+    for (unsigned int seed = 0; seed < 4; seed++) {
+        std::stringstream ss;
+
+        Graph::writeRandomConnectedGraph(ss, 200, 400, 100, seed % 2 == 0, seed);
+        subGraph = Graph(ss);
+        assert(subGraph.n() == 200);
+        assert(subGraph.m() == 400);
+        assert(subGraph.isConnected());
+
+        ss.str("");
+        ss.clear();
+        Graph::writeRandomConnectedGridGraph(ss, 12, 12, 200, 100, seed % 2 == 0, seed);
+        subGraph = Graph(ss);
+        assert(subGraph.n() == 144);
+        assert(subGraph.m() == 200);
+        assert(subGraph.isConnected());
+
+        ss.str("");
+        ss.clear();
+        Graph::writeRandomNearestNeighboursGraph(ss, 300, 3, 100, seed);
+        subGraph = Graph(ss);
+        assert(subGraph.n() == 300);
+        assert(subGraph.m() >= 300 * 3 / 2);
+        assert(subGraph.isConnected());
+    }
+
+    for (unsigned int seed = 0; seed < 4; seed++) {
+        std::stringstream ss, tt;
+
+        Instance::writeRandomInstance(ss, 5, 300, 0.5, subGraph, seed);
+        Instance(5, 300, 0.5, subGraph, seed).write(tt);
+        assert(ss.str() == tt.str());
+    }
+
+    /* The vertices and edges returned by the streamed generators stand in for their graph */
+    for (unsigned int seed = 0; seed < 4; seed++) {
+        std::stringstream gs, hs, ss, tt;
+        std::vector<Vertex> vertices;
+        std::vector<Edge> edges;
+        double edgesWeight;
+
+        edgesWeight = Graph::writeRandomConnectedGraph(gs, 300, 400, 100, true, seed, vertices,
+                edges);
+        subGraph = Graph(gs);
+        Instance::writeRandomInstance(ss, 5, 300, 0.5, vertices, edges, seed);
+        Instance::writeRandomInstance(tt, 5, 300, 0.5, subGraph, seed);
+        assert(ss.str() == tt.str());
+        assert(fabs(edgesWeight - subGraph.getEdgesWeight()) < 1e-3 * subGraph.m());
+
+        ss.str("");
+        tt.str("");
+        edgesWeight = Graph::writeRandomConnectedGridGraph(hs, 10, 10, 150, 100, true, seed,
+                vertices, edges);
+        subGraph = Graph(hs);
+        Instance::writeRandomInstance(ss, 5, 300, 0.5, vertices, edges, seed);
+        Instance::writeRandomInstance(tt, 5, 300, 0.5, subGraph, seed);
+        assert(ss.str() == tt.str());
+        assert(fabs(edgesWeight - subGraph.getEdgesWeight()) < 1e-3 * subGraph.m());
+    }
+
     return 0;
 }
 
@@ -0,0 +1,226 @@
+#include "../solver/exact/branch-and-bound/LGFFModel.hpp"
+#include "../solution/Solution.hpp"
+#include <algorithm>
+#include <cassert>
+#include <sstream>
+
+/*
+ * Returns the point of the model that represents the specified allocation,
+ * rooting each district at the specified edge and routing its flow along a
+ * breadth-first search tree.
+ *
+ * @param instance      the instance.
+ * @param model         the model.
+ * @param edgesDistrict the district of each edge.
+ * @param rootsIds      the id of each district's root.
+ *
+ * @return the point of the model that represents the allocation.
+ */
+std::vector<double> getPoint(const Instance & instance, const LGFFModel & model,
+        const std::vector<unsigned int> & edgesDistrict,
+        const std::vector<unsigned int> & rootsIds) {
+    std::set<Vertex> vertices = instance.getLG().getVertices();
+    std::vector<Vertex> idsVertex (instance.getLG().n() + 1);
+    std::vector<double> point (model.getVariablesNumber(), 0.0);
+    unsigned int mPrime = instance.getGPrime().m();
+
+    for (const Vertex & e : vertices) {
+        idsVertex[instance.getLG().getVertexId(e)] = e;
+    }
+
+    for (unsigned int eId = 1; eId <= instance.getLG().n(); eId++) {
+        point[model.getX(eId, edgesDistrict[eId - 1])] = 1.0;
+    }
+
+    for (unsigned int j = 0; j < instance.getM(); j++) {
+        std::vector<unsigned int> queue (1, rootsIds[j]);
+        std::vector<unsigned int> parentsIds (instance.getLG().n() + 1, 0);
+        std::vector<unsigned int> parentsArcsIds (instance.getLG().n() + 1, 0);
+        std::vector<double> subtreesSize (instance.getLG().n() + 1, 1.0);
+
+        parentsIds[rootsIds[j]] = rootsIds[j];
+
+        for (unsigned int i = 0; i < queue.size(); i++) {
+            const Vertex & e = idsVertex[queue[i]];
+
+            for (const Edge & ef : instance.getLG().getIncidentEdges(e)) {
+                Vertex f = (ef.u == e) ? ef.v : ef.u;
+                unsigned int fId = instance.getLG().getVertexId(f);
+                unsigned int efId = instance.getLG().getEdgeId(ef);
+
+                if (edgesDistrict[fId - 1] == j && parentsIds[fId] == 0) {
+                    parentsIds[fId] = queue[i];
+                    parentsArcsIds[fId] = (e < f) ? efId : mPrime + efId;
+                    queue.push_back(fId);
+                }
+            }
+        }
+
+        /* Each edge receives the size of its subtree from its parent */
+        for (unsigned int i = queue.size() - 1; i > 0; i--) {
+            point[model.getZ(parentsArcsIds[queue[i]], j)] = subtreesSize[queue[i]];
+            subtreesSize[parentsIds[queue[i]]] += subtreesSize[queue[i]];
+        }
+
+        unsigned int ePrimeRootId = instance.getGPrime().getEdgeId(instance.getEPrime(),
+                idsVertex[rootsIds[j]]);
+
+        point[model.getY(rootsIds[j], j)] = 1.0;
+        point[model.getZ(mPrime + ePrimeRootId, j)] = queue.size();
+    }
+
+    return point;
+}
+
+int main () {
+    std::vector<std::string> filenames = {"instances/exampleA.in",
+                                          "instances/exampleB.in",
+                                          "instances/exampleD.in",
+                                          "instances/exampleE.in"};
+
+    /* Every feasible allocation is a point of both models, only when rooted at its smallest edge */
+    for (const std::string & filename : filenames) {
+        Instance instance (filename);
+        LGFFModel model (instance, false, false);
+        LGFFModel compactModel (instance, true, false);
+        std::vector<unsigned int> edgesDistrict (instance.getG().m(), 0);
+        unsigned int n = instance.getLG().n();
+        unsigned int m = instance.getM();
+        unsigned int feasibleSolutionsCounter = 0;
+
+        assert(model.getVariablesNumber() == compactModel.getVariablesNumber());
+        assert(model.getConstraintsNumber() - compactModel.getConstraintsNumber() ==
+                m * n * (n - 1) / 2 - m * (n - 1));
+
+        while (true) {
+            Solution solution (instance, edgesDistrict);
+            std::vector<unsigned int> rootsIds (m, 0);
+            std::vector<unsigned int> districtsSize (m, 0);
+
+            for (const Vertex & e : instance.getLG().getVertices()) {
+                unsigned int eId = instance.getLG().getVertexId(e);
+
+                districtsSize[edgesDistrict[eId - 1]]++;
+
+                if (rootsIds[edgesDistrict[eId - 1]] == 0) {
+                    rootsIds[edgesDistrict[eId - 1]] = eId;
+                }
+            }
+
+            if (solution.isFeasible() && std::find(rootsIds.begin(), rootsIds.end(), 0) ==
+                    rootsIds.end()) {
+                std::vector<double> point = getPoint(instance, model, edgesDistrict, rootsIds);
+
+                feasibleSolutionsCounter++;
+
+                assert(model.getViolatedConstraintsNumber(point, 1e-6) == 0);
+                assert(compactModel.getViolatedConstraintsNumber(point, 1e-6) == 0);
+
+                double value = 0.0;
+
+                for (unsigned int i = 0; i < point.size(); i++) {
+                    value += model.getObjective()[i] * point[i];
+                }
+
+                assert(value == solution.getValue());
+
+                /* Rooting a district at another edge breaks the ordering rows */
+                for (unsigned int j = 0; j < m; j++) {
+                    if (districtsSize[j] > 1) {
+                        std::vector<unsigned int> otherRootsIds (rootsIds);
+
+                        for (unsigned int eId = 1; eId <= n; eId++) {
+                            if (edgesDistrict[eId - 1] == j && eId != rootsIds[j]) {
+                                otherRootsIds[j] = eId;
+                            }
+                        }
+
+                        point = getPoint(instance, model, edgesDistrict, otherRootsIds);
+
+                        assert(model.getViolatedConstraintsNumber(point, 1e-6) > 0);
+                        assert(compactModel.getViolatedConstraintsNumber(point, 1e-6) > 0);
+
+                        break;
+                    }
+                }
+            }
+
+            unsigned int e = 0;
+
+            while (e < edgesDistrict.size() && ++edgesDistrict[e] == m) {
+                edgesDistrict[e++] = 0;
+            }
+
+            if (e == edgesDistrict.size()) {
+                break;
+            }
+        }
+
+        assert(feasibleSolutionsCounter > 0);
+    }
+
+    Instance instance ("instances/exampleC.in");
+    LGFFModel model (instance, true, false);
+    LGFFModel namedModel (instance, true, true);
+    std::stringstream ss;
+    std::string line;
+
+    assert(model.getVariablesNames().empty());
+    assert(model.getConstraintsNames().empty());
+    assert(namedModel.getVariablesNames().size() == namedModel.getVariablesNumber());
+    assert(namedModel.getConstraintsNames().size() == namedModel.getConstraintsNumber());
+    assert(namedModel.getConstraintsNames()[0] == "c_01_0");
+
+    /* The LP file has a section per part of the model and a line per constraint */
+    model.writeLP(ss);
+
+    std::getline(ss, line);
+    assert(line == "Maximize");
+
+    unsigned int constraintsNumber = 0;
+    unsigned int boundsNumber = 0;
+    unsigned int binariesNumber = 0;
+    std::string section;
+
+    while (std::getline(ss, line)) {
+        if (line == "Subject To" || line == "Bounds" || line == "Binaries" || line == "End") {
+            section = line;
+        } else if (section == "Subject To" && line.find(':') != std::string::npos) {
+            constraintsNumber++;
+        } else if (section == "Bounds") {
+            boundsNumber++;
+        } else if (section == "Binaries") {
+            binariesNumber++;
+        }
+    }
+
+    assert(section == "End");
+    assert(constraintsNumber == model.getConstraintsNumber());
+    assert(boundsNumber + binariesNumber == model.getVariablesNumber());
+    assert(binariesNumber == 2 * instance.getLG().n() * instance.getM());
+
+    /* The MPS file has a row per constraint and an entry per nonzero */
+    ss.str("");
+    ss.clear();
+    model.writeMPS(ss);
+
+    unsigned int rowsNumber = 0;
+    unsigned int entriesNumber = 0;
+
+    while (std::getline(ss, line)) {
+        if (line == "ROWS" || line == "COLUMNS" || line == "RHS" || line == "BOUNDS" ||
+                line == "ENDATA") {
+            section = line;
+        } else if (section == "ROWS") {
+            rowsNumber++;
+        } else if (section == "COLUMNS" && line.find(" obj ") == std::string::npos) {
+            entriesNumber++;
+        }
+    }
+
+    assert(section == "ENDATA");
+    assert(rowsNumber == model.getConstraintsNumber() + 1);
+    assert(entriesNumber == model.getNonZerosNumber());
+
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include "../solver/exact/native-branch-and-bound/NativeBnBSolver.hpp"
+#include <cassert>
+#include <cfloat>
+
+/*
+ * Returns the value of an optimal solution by enumerating every allocation.
+ *
+ * @param instance the instance.
+ *
+ * @return the value of an optimal solution.
+ */
+double enumerate(const Instance & instance) {
+    std::vector<unsigned int> edgesDistrict (instance.getG().m(), 0);
+    double bestValue = 0.0;
+
+    while (true) {
+        Solution solution (instance, edgesDistrict);
+
+        if (solution.isFeasible()) {
+            bestValue = std::max(bestValue, solution.getValue());
+        }
+
+        unsigned int e = 0;
+
+        while (e < edgesDistrict.size() && ++edgesDistrict[e] == instance.getM()) {
+            edgesDistrict[e++] = 0;
+        }
+
+        if (e == edgesDistrict.size()) {
+            return bestValue;
+        }
+    }
+}
+
+int main () {
+    unsigned int timeLimit = 10;
+    unsigned int seed = 0;
+    double warmStartPercentageTime = 0.1;
+    unsigned int m = 10;
+    unsigned int k = 100;
+    unsigned int threadsNumber = 2;
+    Instance instance;
+    NativeBnBSolver solver;
+
+    std::vector<std::string> filenames = {"instances/exampleA.in",
+                                          "instances/exampleB.in",
+                                          "instances/exampleD.in",
+                                          "instances/exampleE.in"};
+
+    /* The tree proves the optimum found by enumeration */
+    for (const std::string & filename : filenames) {
+        instance = Instance(filename);
+
+        solver = NativeBnBSolver(instance,
+                                 timeLimit,
+                                 seed,
+                                 warmStartPercentageTime,
+                                 m,
+                                 k,
+                                 true,
+                                 threadsNumber);
+
+        assert(solver.getSolutionsCounter() == 0);
+        assert(solver.getSolvingTime() == 0);
+        assert(solver.getBestPrimalBound() == 0);
+        assert(solver.getBestDualBound() == DBL_MAX);
+
+        solver.solve();
+
+        assert(solver.getSolutionsCounter() > 0);
+        assert(solver.getBestPrimalBound() == enumerate(instance));
+        assert(solver.getBestDualBound() == solver.getBestPrimalBound());
+        assert(solver.getBestPrimalSolution().isFeasible());
+        assert(solver.getBestPrimalSolution().getValue() == solver.getBestPrimalBound());
+    }
+
+    instance = Instance("instances/exampleC.in");
+
+    solver = NativeBnBSolver(instance,
+                             timeLimit,
+                             seed,
+                             warmStartPercentageTime,
+                             m,
+                             k,
+                             true,
+                             threadsNumber);
+
+    solver.solve();
+
+    assert(solver.getSolutionsCounter() > 0);
+    assert(solver.getBestPrimalBound() >= 12);
+    assert(solver.getBestDualBound() == solver.getBestPrimalBound());
+    assert(solver.getBestPrimalSolution().isFeasible());
+
+    /* Without a warm start, the tree finds its own solutions and steals subtrees */
+    instance = Instance("instances/exampleF.in");
+
+    solver = NativeBnBSolver(instance,
+                             timeLimit,
+                             seed,
+                             0.0,
+                             m,
+                             k,
+                             true,
+                             4);
+
+    solver.solve();
+
+    assert(solver.getSolutionsCounter() > 0);
+    assert(solver.getBestPrimalBound() == 102);
+    assert(solver.getBestDualBound() == solver.getBestPrimalBound());
+    assert(solver.getRootDualBound() >= solver.getBestDualBound());
+    assert(solver.getNodesCounter() > 1);
+    assert(solver.getBestPrimalSolution().isFeasible());
+    assert(solver.getBestPrimalSolution().getValue() == solver.getBestPrimalBound());
+
+    /* A single thread reaches the same optimum */
+    solver = NativeBnBSolver(instance,
+                             timeLimit,
+                             seed,
+                             0.0,
+                             m,
+                             k,
+                             true,
+                             1);
+
+    solver.solve();
+
+    assert(solver.getBestPrimalBound() == 102);
+    assert(solver.getBestDualBound() == solver.getBestPrimalBound());
+    assert(solver.getStealsCounter() == 0);
+
+    /* GRASP threads running next to the tree exchange incumbents with it */
+    solver = NativeBnBSolver(instance,
+                             timeLimit,
+                             seed,
+                             0.0,
+                             m,
+                             k,
+                             true,
+                             threadsNumber);
+
+    solver.setConcurrentGRASP(2);
+    solver.solve();
+
+    assert(solver.getGRASPThreadsNumber() == 2);
+    assert(solver.getBestPrimalBound() == 102);
+    assert(solver.getBestDualBound() == solver.getBestPrimalBound());
+    assert(solver.getBestPrimalSolution().isFeasible());
+    assert(solver.getBestPrimalSolution().getValue() == solver.getBestPrimalBound());
+
+    /* The time limit leaves open subproblems whose bounds still bound the optimum */
+    instance = Instance("instances/grid-m5V49E84B05D05.in");
+
+    solver = NativeBnBSolver(instance,
+                             2,
+                             seed,
+                             0.0,
+                             m,
+                             k,
+                             true,
+                             threadsNumber);
+
+    solver.solve();
+
+    assert(solver.getBestDualBound() < DBL_MAX);
+    assert(solver.getBestDualBound() <= solver.getRootDualBound());
+    assert(solver.getBestPrimalBound() <= solver.getBestDualBound());
+
+    /* The GRASP threads keep improving the incumbent until the time limit */
+    solver = NativeBnBSolver(instance,
+                             2,
+                             seed,
+                             0.0,
+                             m,
+                             k,
+                             true,
+                             threadsNumber);
+
+    solver.setConcurrentGRASP(2);
+    solver.solve();
+
+    assert(solver.getGRASPIterationsCounter() > 0);
+    assert(solver.getSolutionsCounter() > 0);
+    assert(solver.getBestPrimalSolution().isFeasible());
+    assert(solver.getBestPrimalBound() <= solver.getBestDualBound());
+    assert(solver.getSolvingTime() <= 3);
+
+    return 0;
+}
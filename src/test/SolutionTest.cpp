@@ -109,6 +109,53 @@ int main () {
 
     assert(solution.isFeasible());
 
+    Solution otherSolution (instance, solution.getEdgesDistrict());
+    unsigned long long hash = solution.getHash();
+
+    assert(otherSolution.getHash() == hash);
+
+    solution.setEdgeDistrict(Edge(7, 9, 9), 1);
+    assert(solution.getHash() != hash);
+
+    solution.setEdgeDistrict(Edge(7, 9, 9), 2);
+    assert(solution.getHash() == hash);
+
+    solution.unsetEdgeDistrict(Edge(7, 9, 9));
+    assert(solution.getEdgeDistrict(Edge(7, 9, 9)) == instance.getM());
+    assert(solution.getDistrict(2).size() == 2);
+    assert(solution.getValue() == 84 - instance.getC(Edge(7, 9, 9), 2));
+    assert(solution.getHash() != hash);
+
+    solution.setEdgeDistrict(Edge(7, 9, 9), 2);
+    assert(solution.getValue() == 84);
+    assert(solution.getHash() == hash);
+
+    solution.unsetDistrict(2);
+    assert(solution.getDistrict(2).empty());
+
+    solution.setDistrict(2, E[2]);
+    assert(solution.getHash() == hash);
+
+    /* (6, 9) shares no vertex with the other edges of district 1 */
+    solution.setEdgeDistrict(Edge(6, 9, 8), 1);
+    assert(!solution.isConnected());
+    assert(!instance.getG().getInducedSubGraph(solution.getDistrict(1)).isConnected());
+
+    solution.setEdgeDistrict(Edge(6, 9, 8), 2);
+    assert(solution.isConnected());
+
+    /* The district of each edge updates the solution in place, unsetting the edges with district m */
+    std::vector<unsigned int> edgesDistrict = solution.getEdgesDistrict();
+    edgesDistrict[instance.getG().getEdgeId(Edge(7, 9, 9)) - 1] = instance.getM();
+    solution.setEdgesDistrict(edgesDistrict);
+    assert(solution.getEdgeDistrict(Edge(7, 9, 9)) == instance.getM());
+    assert(solution.getHash() == Solution(instance, edgesDistrict).getHash());
+
+    edgesDistrict[instance.getG().getEdgeId(Edge(7, 9, 9)) - 1] = 2;
+    solution.setEdgesDistrict(edgesDistrict);
+    assert(solution.getValue() == 84);
+    assert(solution.getHash() == hash);
+
     return 0;
 }
 
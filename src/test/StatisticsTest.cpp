@@ -45,6 +45,26 @@ int main () {
     assert(fabs(statistics.getVariance() - 1123.84) < 0.001);
     assert(fabs(statistics.getStandardDeviation() - 33.52372) < 0.001);
 
+    Statistics firstHalf, secondHalf;
+
+    firstHalf.addValue(89.0);
+    firstHalf.addValue(13.0);
+    secondHalf.addValue(5.0);
+    secondHalf.addValue(3.0);
+    secondHalf.addValue(2.0);
+    firstHalf.merge(secondHalf);
+    firstHalf.merge(Statistics());
+
+    assert(firstHalf.getSize() == 5);
+    assert(fabs(firstHalf.getMean() - 22.4) < 0.001);
+    assert(fabs(firstHalf.getVariance() - 1123.84) < 0.001);
+    assert(fabs(firstHalf.getStandardDeviation() - 33.52372) < 0.001);
+
+    Statistics copy (statistics.getSize(), statistics.getMean(), statistics.getVariance());
+
+    assert(copy.getSize() == 5);
+    assert(fabs(copy.getStandardDeviation() - 33.52372) < 0.001);
+
     return 0;
 }
 